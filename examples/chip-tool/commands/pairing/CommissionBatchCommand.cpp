@@ -0,0 +1,84 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "CommissionBatchCommand.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <string>
+
+using namespace ::chip;
+
+CHIP_ERROR CommissionBatchCommand::RunCommand()
+{
+    ReturnErrorOnFailure(mPipeline.Init(CurrentCommissioner(), DeviceLayer::SystemLayer(), this));
+    if (mMaxConcurrency.HasValue())
+    {
+        mPipeline.SetMaxConcurrency(mMaxConcurrency.Value());
+    }
+
+    mStartTime  = System::SystemClock().GetMonotonicTimestamp();
+    mFirstError = CHIP_NO_ERROR;
+
+    NodeId nodeId = mNodeId;
+    std::string payloads(mOnboardingPayloads);
+    size_t start = 0;
+    while (start <= payloads.size())
+    {
+        size_t end = payloads.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = payloads.size();
+        }
+        if (end > start)
+        {
+            ReturnErrorOnFailure(mPipeline.AddDevice(nodeId++, payloads.substr(start, end - start).c_str()));
+        }
+        start = end + 1;
+    }
+
+    VerifyOrReturnError(nodeId != mNodeId, CHIP_ERROR_INVALID_ARGUMENT, ChipLogError(chipTool, "No setup code given"));
+    return CHIP_NO_ERROR;
+}
+
+void CommissionBatchCommand::Shutdown()
+{
+    mPipeline.Shutdown();
+    CHIPCommand::Shutdown();
+}
+
+void CommissionBatchCommand::OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error)
+{
+    const auto elapsed = System::SystemClock().GetMonotonicTimestamp() - mStartTime;
+    ChipLogProgress(chipTool, "Device 0x" ChipLogFormatX64 " commissioned after %u ms: %" CHIP_ERROR_FORMAT,
+                    ChipLogValueX64(nodeId), static_cast<unsigned>(elapsed.count()), error.Format());
+    if (mFirstError == CHIP_NO_ERROR)
+    {
+        mFirstError = error;
+    }
+}
+
+void CommissionBatchCommand::OnPipelineIdle()
+{
+    const auto elapsed   = System::SystemClock().GetMonotonicTimestamp() - mStartTime;
+    const auto & metrics = mPipeline.GetMetrics();
+    ChipLogProgress(chipTool, "Commissioned %u devices, %u failed, in %u ms (at most %u in progress)",
+                    static_cast<unsigned>(metrics.succeeded), static_cast<unsigned>(metrics.failed),
+                    static_cast<unsigned>(elapsed.count()), static_cast<unsigned>(metrics.maxInProgress));
+    SetCommandExitStatus(mFirstError);
+}
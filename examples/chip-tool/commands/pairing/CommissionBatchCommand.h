@@ -0,0 +1,61 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+
+#include <controller/CommissioningPipeline.h>
+#include <system/SystemClock.h>
+
+/**
+ * Commissions several on-network devices, each with its own setup code, establishing the PASE connection with the next
+ * device while the current one is commissioned.  The devices get consecutive node ids, starting at node-id.
+ */
+class CommissionBatchCommand : public CHIPCommand, public chip::Controller::CommissioningPipeline::Delegate
+{
+public:
+    CommissionBatchCommand(CredentialIssuerCommands * credIssuerCommands) : CHIPCommand("code-batch", credIssuerCommands)
+    {
+        AddArgument("node-id", 0, UINT64_MAX, &mNodeId, "Node id of the first device; the next devices get the next node ids.");
+        AddArgument("payloads", &mOnboardingPayloads, "Comma-separated list of the setup codes of the devices.");
+        AddArgument("max-concurrency", 1, chip::Controller::CommissioningPipeline::kMaxConcurrency, &mMaxConcurrency,
+                    "Maximum number of devices in progress at once.  1 commissions the devices one after the other, 2 (the "
+                    "default) establishes the PASE session with the next device while the current one is commissioned.");
+        AddArgument("timeout", 0, UINT16_MAX, &mTimeout);
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override { return chip::System::Clock::Seconds16(mTimeout.ValueOr(300)); }
+    void Shutdown() override;
+
+    /////////// CommissioningPipeline::Delegate Interface /////////
+    void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) override;
+    void OnPipelineIdle() override;
+
+private:
+    NodeId mNodeId;
+    char * mOnboardingPayloads;
+    chip::Optional<uint16_t> mMaxConcurrency;
+    chip::Optional<uint16_t> mTimeout;
+
+    chip::Controller::CommissioningPipeline mPipeline;
+    chip::System::Clock::Timestamp mStartTime;
+    CHIP_ERROR mFirstError = CHIP_NO_ERROR;
+};
@@ -32,6 +32,9 @@
 #include <lib/core/NodeId.h>
 #include <lib/core/Optional.h>
 #include <lib/support/logging/CHIPLogging.h>
+#if CHIP_PW_TOKENIZER_LOGGING
+#include <lib/support/logging/TokenizedLogWriter.h>
+#endif
 #include <setup_payload/OnboardingCodesUtil.h>
 
 #include <credentials/DeviceAttestationCredsProvider.h>
@@ -339,6 +342,10 @@ void Cleanup()
     chip::trace::DeInitTrace();
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
 
+#if CHIP_PW_TOKENIZER_LOGGING
+    chip::Logging::StopTokenizedLogFile();
+#endif // CHIP_PW_TOKENIZER_LOGGING
+
     // TODO(16968): Lifecycle management of storage-using components like GroupDataProvider, etc
 }
 
@@ -450,6 +457,14 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions,
     err = ParseArguments(argc, argv, customOptions);
     SuccessOrExit(err);
 
+#if CHIP_PW_TOKENIZER_LOGGING
+    if (LinuxDeviceOptions::GetInstance().tokenizedLogFilename.HasValue())
+    {
+        err = chip::Logging::StartTokenizedLogFile(LinuxDeviceOptions::GetInstance().tokenizedLogFilename.Value().c_str());
+        SuccessOrExit(err);
+    }
+#endif // CHIP_PW_TOKENIZER_LOGGING
+
     sSecondaryNetworkCommissioningEndpoint = secondaryNetworkCommissioningEndpoint;
 
 #ifdef CHIP_CONFIG_KVS_PATH
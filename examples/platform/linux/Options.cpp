@@ -94,6 +94,9 @@ enum
     kDeviceOption_TraceFile,
     kDeviceOption_TraceLog,
     kDeviceOption_TraceDecode,
+#if CHIP_PW_TOKENIZER_LOGGING
+    kDeviceOption_TokenizedLogFile,
+#endif
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     kDeviceOption_CommissioningArlEntries,
     kDeviceOption_ArlEntries,
@@ -185,6 +188,9 @@ OptionDef sDeviceOptionDefs[] = {
     { "trace_log", kArgumentRequired, kDeviceOption_TraceLog },
     { "trace_decode", kArgumentRequired, kDeviceOption_TraceDecode },
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
+#if CHIP_PW_TOKENIZER_LOGGING
+    { "tokenized-log-file", kArgumentRequired, kDeviceOption_TokenizedLogFile },
+#endif // CHIP_PW_TOKENIZER_LOGGING
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     { "commissioning-arl-entries", kArgumentRequired, kDeviceOption_CommissioningArlEntries },
     { "arl-entries", kArgumentRequired, kDeviceOption_ArlEntries },
@@ -330,6 +336,12 @@ const char * sDeviceOptionHelp =
     "  --trace_decode <1/0>\n"
     "       A value of 1 enables traces decoding, 0 disables this (default 0).\n"
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
+#if CHIP_PW_TOKENIZER_LOGGING
+    "\n"
+    "  --tokenized-log-file <file>\n"
+    "       Write the log messages to the provided file in binary form, to be decoded by\n"
+    "       scripts/tools/decode_tokenized_logs.py.\n"
+#endif // CHIP_PW_TOKENIZER_LOGGING
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     "  --commissioning-arl-entries <CommissioningARL JSON>\n"
     "       Enable ACL cluster access restrictions used during commissioning with the provided JSON. Example:\n"
@@ -657,6 +669,11 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         }
         break;
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
+#if CHIP_PW_TOKENIZER_LOGGING
+    case kDeviceOption_TokenizedLogFile:
+        LinuxDeviceOptions::GetInstance().tokenizedLogFilename.SetValue(std::string{ aValue });
+        break;
+#endif // CHIP_PW_TOKENIZER_LOGGING
 
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     // TODO(#35189): change to use a path to JSON files instead
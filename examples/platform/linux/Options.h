@@ -80,6 +80,9 @@ struct LinuxDeviceOptions
     bool traceStreamToLogEnabled  = false;
     chip::Optional<std::string> traceStreamFilename;
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
+#if CHIP_PW_TOKENIZER_LOGGING
+    chip::Optional<std::string> tokenizedLogFilename;
+#endif // CHIP_PW_TOKENIZER_LOGGING
     chip::Credentials::DeviceAttestationCredentialsProvider * dacProvider = nullptr;
     chip::CSRResponseOptions mCSRResponseOptions;
     uint8_t testEventTriggerEnableKey[16] = { 0 };
@@ -68,6 +68,8 @@ static chip::DeviceLayer::Internal::Efr32PsaOperationalKeystore gOperationalKeys
 
 #if CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
+#elif CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+#include <app/reporting/SpreadReportSchedulerImpl.h>
 #else
 #include <app/reporting/ReportSchedulerImpl.h>
 #endif
@@ -266,6 +268,8 @@ CHIP_ERROR SilabsMatterConfig::InitMatter(const char * appName)
     static chip::app::DefaultTimerDelegate sTimerDelegate;
 #if CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED
     static chip::app::reporting::SynchronizedReportSchedulerImpl sReportScheduler(&sTimerDelegate);
+#elif CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+    static chip::app::reporting::SpreadReportSchedulerImpl sReportScheduler(&sTimerDelegate);
 #else
     static chip::app::reporting::ReportSchedulerImpl sReportScheduler(&sTimerDelegate);
 #endif
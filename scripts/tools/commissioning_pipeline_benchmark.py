@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Project CHIP Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Benchmark the commissioning of a batch of on-network devices.
+
+Starts several instances of a Linux example application, such as
+all-clusters-app, on the local host, then commissions them all with
+`chip-tool pairing code-batch`, once for each --max-concurrency value.
+A maximum concurrency of 1 commissions the devices one after the other; 2,
+the highest value, lets chip-tool establish the PASE session with the next
+device while the current device is commissioned (see CommissioningPipeline.h).
+
+Each run starts from freshly reset devices and an empty chip-tool storage,
+and prints the time chip-tool took to commission the whole batch:
+
+    scripts/tools/commissioning_pipeline_benchmark.py \\
+        --chip-tool out/linux-x64-chip-tool/chip-tool \\
+        --app out/linux-x64-all-clusters/chip-all-clusters-app \\
+        --devices 8 --max-concurrency 1 --max-concurrency 2
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+from typing import List, Optional
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', '..', 'src', 'setup_payload', 'python'))
+from SetupPayload import SetupPayload  # noqa: E402
+
+FIRST_NODE_ID = 0x1000
+FIRST_DISCRIMINATOR = 3000
+PASSCODE = 20202021
+FIRST_SECURED_PORT = 5640
+FIRST_UNSECURED_COMMISSIONER_PORT = 5740
+READY_MESSAGE = 'Server initialization complete'
+SUMMARY = re.compile(r'Commissioned (\d+) devices, (\d+) failed, in (\d+) ms \(at most (\d+) in progress\)')
+
+
+def _start_devices(app: str, count: int, directory: str) -> List[subprocess.Popen]:
+    devices = []
+    for i in range(count):
+        with open(os.path.join(directory, 'device-%d.log' % i), 'w') as log:
+            devices.append(subprocess.Popen(
+                [app,
+                 '--discriminator', str(FIRST_DISCRIMINATOR + i),
+                 '--passcode', str(PASSCODE),
+                 '--secured-device-port', str(FIRST_SECURED_PORT + i),
+                 '--unsecured-commissioner-port', str(FIRST_UNSECURED_COMMISSIONER_PORT + i),
+                 '--KVS', os.path.join(directory, 'device-%d.kvs' % i)],
+                stdout=log, stderr=subprocess.STDOUT))
+    return devices
+
+
+def _wait_until_ready(directory: str, count: int, timeout: float):
+    deadline = time.monotonic() + timeout
+    for i in range(count):
+        path = os.path.join(directory, 'device-%d.log' % i)
+        while True:
+            with open(path, errors='replace') as log:
+                if READY_MESSAGE in log.read():
+                    break
+            if time.monotonic() > deadline:
+                raise RuntimeError('Device %d did not start, see %s' % (i, path))
+            time.sleep(0.1)
+
+
+def _stop_devices(devices: List[subprocess.Popen]):
+    for device in devices:
+        device.terminate()
+    for device in devices:
+        try:
+            device.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            device.kill()
+
+
+def _run(args, maxConcurrency: int) -> Optional[str]:
+    codes = [SetupPayload(FIRST_DISCRIMINATOR + i, PASSCODE).generate_manualcode() for i in range(args.devices)]
+
+    with tempfile.TemporaryDirectory(prefix='commissioning-pipeline-') as directory:
+        devices = _start_devices(args.app, args.devices, directory)
+        try:
+            _wait_until_ready(directory, args.devices, args.timeout)
+            storage = os.path.join(directory, 'chip-tool')
+            os.mkdir(storage)
+
+            result = subprocess.run(
+                [args.chip_tool, 'pairing', 'code-batch', str(FIRST_NODE_ID), ','.join(codes),
+                 '--max-concurrency', str(maxConcurrency), '--timeout', str(args.timeout),
+                 '--storage-directory', storage],
+                stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors='replace')
+        finally:
+            _stop_devices(devices)
+
+    summary = SUMMARY.search(result.stdout)
+    if summary is None:
+        sys.stderr.write(result.stdout)
+        return None
+
+    succeeded, failed, ms, peakInProgress = (int(value) for value in summary.groups())
+    return '%15d %10d %7d %16d %12d %14.0f' % (maxConcurrency, succeeded, failed, peakInProgress, ms,
+                                                 ms / max(succeeded + failed, 1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--chip-tool', required=True, help='Path to chip-tool.')
+    parser.add_argument('--app', required=True, help='Path to the Linux example application to commission.')
+    parser.add_argument('--devices', type=int, default=4, help='Number of devices to commission in each run.')
+    parser.add_argument('--max-concurrency', type=int, action='append', dest='concurrencies',
+                        help='Maximum number of devices in progress at once, 1 or 2; may be repeated. Defaults to both.')
+    parser.add_argument('--timeout', type=int, default=300, help='Timeout of each run, in seconds.')
+    args = parser.parse_args()
+
+    print('%15s %10s %7s %16s %12s %14s' % ('max-concurrency', 'succeeded', 'failed', 'peak-in-progress', 'total ms',
+                                            'ms / device'))
+    failed = False
+    for maxConcurrency in args.concurrencies or [1, 2]:
+        line = _run(args, maxConcurrency)
+        if line is None:
+            print('%15d chip-tool did not complete the batch' % maxConcurrency)
+            failed = True
+        else:
+            print(line)
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
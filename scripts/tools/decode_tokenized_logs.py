@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Project CHIP Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Decode a tokenized log file.
+
+Renders as text the binary log file written by an application built with
+chip_pw_tokenizer_logging=true (see TokenizedLogWriter.h), using the token
+database of the application: its ELF binary, or a database generated by
+pw_tokenizer_database.
+
+Each message is printed in the format of the Linux text logs:
+
+    [<seconds>.<microseconds>] CHIP:<module>: <message>
+
+Messages whose token is not in the database are printed as their prefixed
+Base64 encoding, which pw_tokenizer tools can decode with another database.
+"""
+
+import argparse
+import base64
+import struct
+import sys
+from typing import BinaryIO, Callable, Iterator, List, NamedTuple, Optional
+
+MAGIC = b'CHIPTLOG'
+VERSION = 1
+MODULE_NAME_SIZE = 4
+
+# Log categories, from kLogCategory_Error (1).
+CATEGORIES = ['error', 'progress', 'detail', 'automation']
+
+
+class Record(NamedTuple):
+    timestamp_us: int
+    category: int
+    module: str
+    encoded_message: bytes
+
+
+class DecodeError(Exception):
+    pass
+
+
+def _read_exactly(stream: BinaryIO, length: int) -> bytes:
+    data = stream.read(length)
+    if len(data) != length:
+        raise DecodeError('Truncated log file')
+    return data
+
+
+def _read_varint(stream: BinaryIO, first_byte: Optional[int] = None) -> int:
+    value = 0
+    shift = 0
+    byte = _read_exactly(stream, 1)[0] if first_byte is None else first_byte
+    while True:
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value
+        shift += 7
+        if shift >= 64:
+            raise DecodeError('Invalid varint')
+        byte = _read_exactly(stream, 1)[0]
+
+
+def _zigzag_decode(value: int) -> int:
+    return (value >> 1) ^ -(value & 1)
+
+
+def read_records(stream: BinaryIO) -> Iterator[Record]:
+    """Read the records of a tokenized log file.
+
+    A record truncated at the end of the file, as left by an application
+    which did not stop logging cleanly, is ignored.
+    """
+    if _read_exactly(stream, len(MAGIC)) != MAGIC:
+        raise DecodeError('Not a tokenized log file')
+    version = _read_exactly(stream, 1)[0]
+    if version != VERSION:
+        raise DecodeError(f'Unsupported tokenized log file version {version}')
+    timestamp_us, = struct.unpack('<Q', _read_exactly(stream, 8))
+    module_count = _read_exactly(stream, 1)[0]
+    modules: List[str] = []
+    for _ in range(module_count):
+        name = _read_exactly(stream, MODULE_NAME_SIZE)
+        modules.append(name.split(b'\0', 1)[0].decode('ascii', errors='replace'))
+
+    while True:
+        first_byte = stream.read(1)
+        if not first_byte:
+            return
+        try:
+            length = _read_varint(stream, first_byte[0])
+            category, module = _read_exactly(stream, 2)
+            timestamp_us += _zigzag_decode(_read_varint(stream))
+            encoded_message = _read_exactly(stream, length)
+        except DecodeError:
+            print('Warning: ignoring the truncated last record', file=sys.stderr)
+            return
+        module_name = modules[module] if module < len(modules) else '-'
+        yield Record(timestamp_us, category, module_name, encoded_message)
+
+
+def format_record(record: Record, detokenize: Callable[[bytes], str]) -> str:
+    seconds, microseconds = divmod(record.timestamp_us, 1000000)
+    return f'[{seconds}.{microseconds:06}] CHIP:{record.module}: {detokenize(record.encoded_message)}'
+
+
+def make_detokenizer(databases: List[str]) -> Callable[[bytes], str]:
+    # pw_tokenizer is only available in the activated build environment.
+    from pw_tokenizer import detokenize
+
+    detokenizer = detokenize.Detokenizer(*databases)
+
+    def decode(encoded_message: bytes) -> str:
+        result = detokenizer.detokenize(encoded_message)
+        if result.ok():
+            return str(result)
+        return '$' + base64.b64encode(encoded_message).decode('ascii')
+
+    return decode
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-d', '--database', action='append', required=True,
+                        help='ELF binary or token database of the application (may be repeated)')
+    parser.add_argument('-c', '--category', choices=CATEGORIES,
+                        help='Only print the messages of this category, or more important ones')
+    parser.add_argument('-o', '--output', type=argparse.FileType('w'), default=sys.stdout,
+                        help='Output file (default: standard output)')
+    parser.add_argument('input', type=argparse.FileType('rb'), help='Tokenized log file')
+    args = parser.parse_args()
+
+    max_category = 255
+    if args.category:
+        max_category = CATEGORIES.index(args.category) + 1
+
+    detokenize = make_detokenizer(args.database)
+    try:
+        for record in read_records(args.input):
+            if record.category <= max_category:
+                print(format_record(record, detokenize), file=args.output)
+    except DecodeError as e:
+        print(f'Error: {e}', file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -153,6 +153,8 @@ protected:
     Optional<EndpointId> GetEndpointId() { return mEndpointId; }
 
 private:
+    friend class AttributeAccessInterfaceRegistry;
+
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
     AttributeAccessInterface * mNext = nullptr;
@@ -18,6 +18,8 @@
 
 #include <app/AttributeAccessInterfaceCache.h>
 
+#include <stdint.h>
+
 namespace {
 
 using chip::app::AttributeAccessInterface;
@@ -56,6 +58,20 @@ void UnregisterMatchingAttributeAccessInterfaces(F shouldUnregister, AttributeAc
     }
 }
 
+// Returns the first of the `count` first interfaces of the list that `matches`.
+template <typename F>
+AttributeAccessInterface * FindInList(AttributeAccessInterface * list_head, size_t count, F matches)
+{
+    for (AttributeAccessInterface * cur = list_head; cur != nullptr && count > 0; cur = cur->GetNext(), count--)
+    {
+        if (matches(cur))
+        {
+            return cur;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace
 
 namespace chip {
@@ -70,35 +86,68 @@ AttributeAccessInterfaceRegistry & AttributeAccessInterfaceRegistry::Instance()
 void AttributeAccessInterfaceRegistry::Unregister(AttributeAccessInterface * attrOverride)
 {
     mAttributeAccessInterfaceCache.Invalidate();
-    UnregisterMatchingAttributeAccessInterfaces([attrOverride](AttributeAccessInterface * entry) { return entry == attrOverride; },
-                                                mAttributeAccessOverrides);
+    UnregisterMatchingAttributeAccessInterfaces(
+        [this, attrOverride](AttributeAccessInterface * entry) {
+            VerifyOrReturnValue(entry == attrOverride, false);
+            RemoveFromIndex(*entry);
+            return true;
+        },
+        mAttributeAccessOverrides);
 }
 
 void AttributeAccessInterfaceRegistry::UnregisterAllForEndpoint(EndpointId endpointId)
 {
     mAttributeAccessInterfaceCache.Invalidate();
     UnregisterMatchingAttributeAccessInterfaces(
-        [endpointId](AttributeAccessInterface * entry) { return entry->MatchesEndpoint(endpointId); }, mAttributeAccessOverrides);
+        [this, endpointId](AttributeAccessInterface * entry) {
+            VerifyOrReturnValue(entry->MatchesEndpoint(endpointId), false);
+            RemoveFromIndex(*entry);
+            return true;
+        },
+        mAttributeAccessOverrides);
 }
 
 bool AttributeAccessInterfaceRegistry::Register(AttributeAccessInterface * attrOverride)
 {
     mAttributeAccessInterfaceCache.Invalidate();
-    for (auto * cur = mAttributeAccessOverrides; cur; cur = cur->GetNext())
+    if (HasConflictingOverride(*attrOverride))
     {
-        if (cur->Matches(*attrOverride))
-        {
-            ChipLogError(InteractionModel, "Duplicate attribute override registration failed");
-            return false;
-        }
+        ChipLogError(InteractionModel, "Duplicate attribute override registration failed");
+        return false;
+    }
+
+    if (!mIndex.Insert(IndexEndpointId(*attrOverride), attrOverride->mClusterId, attrOverride))
+    {
+        attrOverride->SetNext(mAttributeAccessOverrides);
+        mAttributeAccessOverrides = attrOverride;
+        mUnindexedCount++;
+        return true;
+    }
+
+    // Indexed overrides go after the ones that did not fit in the index, so that lookups only walk the latter.
+    AttributeAccessInterface * prev = nullptr;
+    for (size_t i = 0; i < mUnindexedCount; i++)
+    {
+        prev = (prev == nullptr) ? mAttributeAccessOverrides : prev->GetNext();
+    }
+    if (prev == nullptr)
+    {
+        attrOverride->SetNext(mAttributeAccessOverrides);
+        mAttributeAccessOverrides = attrOverride;
+    }
+    else
+    {
+        attrOverride->SetNext(prev->GetNext());
+        prev->SetNext(attrOverride);
     }
-    attrOverride->SetNext(mAttributeAccessOverrides);
-    mAttributeAccessOverrides = attrOverride;
     return true;
 }
 
 AttributeAccessInterface * AttributeAccessInterfaceRegistry::Get(EndpointId endpointId, ClusterId clusterId)
 {
+    AttributeAccessInterface * found = mIndex.Find(endpointId, clusterId);
+    VerifyOrReturnValue(found == nullptr && mUnindexedCount > 0, found);
+
     using CacheResult = AttributeAccessInterfaceCache::CacheResult;
 
     AttributeAccessInterface * cached = nullptr;
@@ -111,14 +160,13 @@ AttributeAccessInterface * AttributeAccessInterfaceRegistry::Get(EndpointId endp
         return cached;
     case CacheResult::kCacheMiss:
     default:
-        // Did not cache yet, search set of AAI registered, and cache if found.
-        for (app::AttributeAccessInterface * cur = mAttributeAccessOverrides; cur; cur = cur->GetNext())
+        // Did not cache yet, search the overrides that are not in the index, and cache if found.
+        found = FindInList(mAttributeAccessOverrides, mUnindexedCount,
+                           [endpointId, clusterId](AttributeAccessInterface * cur) { return cur->Matches(endpointId, clusterId); });
+        if (found != nullptr)
         {
-            if (cur->Matches(endpointId, clusterId))
-            {
-                mAttributeAccessInterfaceCache.MarkUsed(endpointId, clusterId, cur);
-                return cur;
-            }
+            mAttributeAccessInterfaceCache.MarkUsed(endpointId, clusterId, found);
+            return found;
         }
 
         // Did not find AAI registered: mark as definitely not using.
@@ -128,5 +176,29 @@ AttributeAccessInterface * AttributeAccessInterfaceRegistry::Get(EndpointId endp
     return nullptr;
 }
 
+bool AttributeAccessInterfaceRegistry::HasConflictingOverride(const AttributeAccessInterface & attrOverride) const
+{
+    // An override for a single endpoint conflicts with the one for that endpoint and the one for all endpoints, which are
+    // either in the index or among the overrides that did not fit in it. An override for all endpoints conflicts with any
+    // override of its cluster.
+    size_t count = SIZE_MAX;
+    if (attrOverride.mEndpointId.HasValue())
+    {
+        VerifyOrReturnValue(mIndex.Find(attrOverride.mEndpointId.Value(), attrOverride.mClusterId) == nullptr, true);
+        count = mUnindexedCount;
+    }
+
+    return FindInList(mAttributeAccessOverrides, count,
+                      [&attrOverride](AttributeAccessInterface * cur) { return cur->Matches(attrOverride); }) != nullptr;
+}
+
+void AttributeAccessInterfaceRegistry::RemoveFromIndex(AttributeAccessInterface & attrOverride)
+{
+    if (!mIndex.Remove(IndexEndpointId(attrOverride), attrOverride.mClusterId, &attrOverride))
+    {
+        mUnindexedCount--;
+    }
+}
+
 } // namespace app
 } // namespace chip
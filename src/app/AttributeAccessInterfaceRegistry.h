@@ -17,6 +17,10 @@
 
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributeAccessInterfaceCache.h>
+#include <app/ClusterPathIndex.h>
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
 
 namespace chip {
 namespace app {
@@ -56,7 +60,23 @@ public:
     static AttributeAccessInterfaceRegistry & Instance();
 
 private:
+    static EndpointId IndexEndpointId(const AttributeAccessInterface & attrOverride)
+    {
+        return attrOverride.mEndpointId.ValueOr(kInvalidEndpointId);
+    }
+
+    bool HasConflictingOverride(const AttributeAccessInterface & attrOverride) const;
+    void RemoveFromIndex(AttributeAccessInterface & attrOverride);
+
     AttributeAccessInterface * mAttributeAccessOverrides = nullptr;
+
+    // Index of mAttributeAccessOverrides, so that lookups during wildcard expansion do not walk the list. Disabled unless
+    // CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE is set.
+    ClusterPathIndex<AttributeAccessInterface, CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE> mIndex;
+
+    // Number of overrides that did not fit in mIndex. They come first in mAttributeAccessOverrides, and only they need a
+    // list walk, behind mAttributeAccessInterfaceCache.
+    size_t mUnindexedCount = 0;
     AttributeAccessInterfaceCache mAttributeAccessInterfaceCache;
 };
 
@@ -21,6 +21,7 @@
 #include <app/data-model/FabricScoped.h>
 #include <app/data-model/List.h> // So we can encode lists
 #include <lib/core/CHIPError.h>
+#include <lib/core/TLVCountingWriter.h>
 
 #include <type_traits>
 
@@ -71,6 +72,23 @@ public:
         return DataModel::EncodeForRead(*(aAttributeReportIBs.GetAttributeReport().GetAttributeData().GetWriter()), tag,
                                         accessingFabricIndex, item);
     }
+
+    /**
+     * MeasureValue encodes the given item and tag the way EncodeValue would, but into aCountingWriter, so that the number of
+     * bytes EncodeValue would write is how much the length written by aCountingWriter grows.
+     */
+    template <typename T, std::enable_if_t<!DataModel::IsFabricScoped<T>::value, bool> = true>
+    CHIP_ERROR MeasureValue(TLV::CountingTLVWriter & aCountingWriter, TLV::Tag tag, const T & item)
+    {
+        return DataModel::Encode(aCountingWriter, tag, item);
+    }
+
+    template <typename T, std::enable_if_t<DataModel::IsFabricScoped<T>::value, bool> = true>
+    CHIP_ERROR MeasureValue(TLV::CountingTLVWriter & aCountingWriter, TLV::Tag tag, const T & item,
+                            FabricIndex accessingFabricIndex)
+    {
+        return DataModel::EncodeForRead(aCountingWriter, tag, accessingFabricIndex, item);
+    }
 };
 
 } // namespace app
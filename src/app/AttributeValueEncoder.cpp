@@ -16,6 +16,10 @@
  */
 #include <app/AttributeValueEncoder.h>
 
+#include <lib/core/TLVCountingWriter.h>
+
+#include <algorithm>
+
 namespace chip {
 namespace app {
 
@@ -125,6 +129,59 @@ bool AttributeValueEncoder::ShouldEncodeListItem(TLV::TLVWriter & aCheckpoint)
     return true;
 }
 
+bool AttributeValueEncoder::ShouldMeasureListItem() const
+{
+    VerifyOrReturnValue(mLargestEncodedListItemLength > 0, false);
+
+    // The remaining writable length is only the space left if the writer cannot get more buffers
+    // from its backing store.
+    const TLV::TLVWriter * writer       = mAttributeReportIBsBuilder.GetWriter();
+    TLV::TLVBackingStore * backingStore = writer->GetBackingStore();
+    VerifyOrReturnValue(backingStore == nullptr || backingStore->GetNewBufferWillAlwaysFail(), false);
+
+    return writer->GetRemainingWritableLength() < mLargestEncodedListItemLength;
+}
+
+bool AttributeValueEncoder::ListItemFits(uint32_t aItemLength)
+{
+    uint32_t itemLength = aItemLength;
+    if (!mEncodingInitialList)
+    {
+        // Each item is encoded in its own AttributeReportIB.
+        if (!mMeasuredListItemReportIBOverhead)
+        {
+            // Without the overhead, the item is just tried.
+            VerifyOrReturnValue(MeasureAttributeReportIBOverhead(mListItemReportIBOverhead) == CHIP_NO_ERROR, true);
+            mMeasuredListItemReportIBOverhead = true;
+        }
+        itemLength += mListItemReportIBOverhead;
+    }
+
+    return itemLength <= mAttributeReportIBsBuilder.GetWriter()->GetRemainingWritableLength();
+}
+
+CHIP_ERROR AttributeValueEncoder::MeasureAttributeReportIBOverhead(uint32_t & aOverhead)
+{
+    // Measure a report of a null value, and take the value out.  This leaves in the context tag
+    // of the value, which list items are measured without.
+    TLV::CountingTLVWriter writer;
+    AttributeReportIBs::Builder attributeReportIBs;
+    ReturnErrorOnFailure(attributeReportIBs.Init(&writer));
+    const uint32_t startLength = writer.GetLengthWritten();
+
+    AttributeReportBuilder builder;
+    ReturnErrorOnFailure(builder.PrepareAttribute(attributeReportIBs, mPath, mDataVersion));
+    ReturnErrorOnFailure(builder.EncodeValue(attributeReportIBs, TLV::ContextTag(AttributeDataIB::Tag::kData),
+                                             DataModel::Nullable<uint8_t>()));
+    ReturnErrorOnFailure(builder.FinishAttribute(attributeReportIBs));
+
+    uint32_t valueLength = 0;
+    ReturnErrorOnFailure(DataModel::EncodedLength(TLV::AnonymousTag(), DataModel::Nullable<uint8_t>(), valueLength));
+
+    aOverhead = writer.GetLengthWritten() - startLength - valueLength;
+    return CHIP_NO_ERROR;
+}
+
 void AttributeValueEncoder::PostEncodeListItem(CHIP_ERROR aEncodeStatus, const TLV::TLVWriter & aCheckpoint)
 {
     if (aEncodeStatus != CHIP_NO_ERROR)
@@ -133,6 +190,9 @@ void AttributeValueEncoder::PostEncodeListItem(CHIP_ERROR aEncodeStatus, const T
         return;
     }
 
+    const uint32_t itemLength = mAttributeReportIBsBuilder.GetWriter()->GetLengthWritten() - aCheckpoint.GetLengthWritten();
+    mLargestEncodedListItemLength = std::max(mLargestEncodedListItemLength, itemLength);
+
     mCurrentEncodingListIndex++;
     mEncodeState.SetCurrentEncodingListIndex(mCurrentEncodingListIndex);
     mEncodedAtLeastOneListItem = true;
@@ -201,6 +201,19 @@ private:
     // attribute report list builder.
     bool ShouldEncodeListItem(TLV::TLVWriter & aCheckpoint);
 
+    // Returns true if the next list item should be measured before being encoded, because the
+    // buffer cannot grow and the space left in it is smaller than the largest list item encoded so
+    // far.  Measuring every item would double the cost of encoding the list.
+    bool ShouldMeasureListItem() const;
+
+    // Returns false if a list item whose value takes aItemLength bytes with an anonymous tag does
+    // not fit in the space left in the buffer.
+    bool ListItemFits(uint32_t aItemLength);
+
+    // Computes the number of bytes an AttributeReportIB for mPath takes on top of its value encoded
+    // with an anonymous tag.
+    CHIP_ERROR MeasureAttributeReportIBOverhead(uint32_t & aOverhead);
+
     // Does any cleanup work needed after attempting to encode a list item.
     void PostEncodeListItem(CHIP_ERROR aEncodeStatus, const TLV::TLVWriter & aCheckpoint);
 
@@ -216,6 +229,20 @@ private:
             return CHIP_NO_ERROR;
         }
 
+        if (ShouldMeasureListItem())
+        {
+            // We are close to the end of the buffer: an item that does not fit is left for the next
+            // chunk instead of being encoded just to be rolled back.  A failure to measure the item
+            // is reported by encoding it.
+            TLV::CountingTLVWriter countingWriter;
+            AttributeReportBuilder builder;
+            if (builder.MeasureValue(countingWriter, TLV::AnonymousTag(), aItem, aExtraArgs...) == CHIP_NO_ERROR &&
+                !ListItemFits(countingWriter.GetLengthWritten()))
+            {
+                return CHIP_ERROR_NO_MEMORY;
+            }
+        }
+
         CHIP_ERROR err;
         if (mEncodingInitialList)
         {
@@ -286,6 +313,12 @@ private:
     // mEncodedAtLeastOneListItem becomes true once we successfully encode a list item.
     bool mEncodedAtLeastOneListItem     = false;
     ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
+    // Number of bytes taken by the largest list item encoded so far, including the
+    // AttributeReportIB overhead when items are encoded one IB per item.
+    uint32_t mLargestEncodedListItemLength = 0;
+    // The space the AttributeReportIB of each list item takes on top of its value, once measured.
+    uint32_t mListItemReportIBOverhead     = 0;
+    bool mMeasuredListItemReportIBOverhead = false;
     AttributeEncodeState mEncodeState;
 };
 
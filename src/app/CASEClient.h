@@ -35,6 +35,11 @@ struct CASEClientInitParams
     FabricTable * fabricTable                                          = nullptr;
     Credentials::GroupDataProvider * groupDataProvider                 = nullptr;
 
+    // ephemeralKeypairPool is optional: without it, ephemeral keypairs are generated during the handshake.
+    CASEEphemeralKeypairPool * ephemeralKeypairPool = nullptr;
+    // certChainCache is optional: without it, the certificate chain of the peer is validated on every handshake.
+    Credentials::ValidatedCertChainCache * certChainCache = nullptr;
+
     // mrpLocalConfig should not generally be set to anything other than
     // NullOptional.  Doing that can lead to different parts of the system
     // claiming different MRP parameters for the same node.
@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/FixedHashMap.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/// Fixed-capacity hash index from an (endpoint, cluster) pair to an object registered for it.
+///
+/// Used by the registries of cluster interfaces (attribute access, command handlers, server clusters) to find the
+/// interface for a path without walking their registration lists. The registries keep their intrusive lists as the
+/// source of truth: `Insert` fails once the index holds `kCapacity` entries, in which case the registry must fall back to
+/// its list for that registration. A capacity of 0 disables the index: it holds nothing and costs no RAM beyond an empty
+/// object.
+///
+/// Interfaces registered for all endpoints use `kInvalidEndpointId` as their endpoint. `Find` looks up the given
+/// endpoint first and then the wildcard entry for the cluster.
+///
+/// This is a FixedHashMap keyed by the (endpoint, cluster) pair, see there for the table layout.
+template <typename T, size_t kCapacity>
+class ClusterPathIndex
+{
+public:
+    /// Add an entry. Returns false if the index is full, `value` is null, or the (endpoint, cluster) pair already has an
+    /// entry.
+    bool Insert(EndpointId endpointId, ClusterId clusterId, T * value)
+    {
+        const Key key{ endpointId, clusterId };
+        if (value == nullptr || mEntries.Contains(key))
+        {
+            return false;
+        }
+        return mEntries.Insert(key, value) != nullptr;
+    }
+
+    /// Remove the entry for the given (endpoint, cluster) pair if it maps to `value`. Returns false if there is no
+    /// such entry.
+    bool Remove(EndpointId endpointId, ClusterId clusterId, const T * value)
+    {
+        const Key key{ endpointId, clusterId };
+        T * const * entry = mEntries.Find(key);
+        if (entry == nullptr || *entry != value)
+        {
+            return false;
+        }
+        return mEntries.Erase(key);
+    }
+
+    /// Get the entry for exactly the given (endpoint, cluster) pair, or nullptr.
+    T * Get(EndpointId endpointId, ClusterId clusterId) const
+    {
+        T * const * entry = mEntries.Find(Key{ endpointId, clusterId });
+        return entry != nullptr ? *entry : nullptr;
+    }
+
+    /// Get the entry for the given (endpoint, cluster) pair, falling back to the entry registered for the cluster on all
+    /// endpoints.
+    T * Find(EndpointId endpointId, ClusterId clusterId) const
+    {
+        T * value = Get(endpointId, clusterId);
+        if (value == nullptr && endpointId != kInvalidEndpointId)
+        {
+            value = Get(kInvalidEndpointId, clusterId);
+        }
+        return value;
+    }
+
+    void Clear() { mEntries.Clear(); }
+
+    size_t Count() const { return mEntries.Size(); }
+
+    /// Number of entries that can still be inserted.
+    size_t Remaining() const { return kCapacity - mEntries.Size(); }
+
+private:
+    struct Key
+    {
+        EndpointId endpointId;
+        ClusterId clusterId;
+
+        bool operator==(const Key & other) const { return endpointId == other.endpointId && clusterId == other.clusterId; }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key & key) const
+        {
+            // Cluster ids share their low bits across vendors and endpoints are small consecutive numbers: mix both before
+            // taking the low bits.
+            uint32_t hash = (key.clusterId * 0x9E3779B1u) ^ (static_cast<uint32_t>(key.endpointId) * 0x85EBCA77u);
+            hash ^= hash >> 16;
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    FixedHashMap<Key, T *, kCapacity, KeyHash> mEntries;
+};
+
+/// Disabled index: the registries find every interface by walking their lists.
+template <typename T>
+class ClusterPathIndex<T, 0>
+{
+public:
+    bool Insert(EndpointId endpointId, ClusterId clusterId, T * value) { return false; }
+    bool Remove(EndpointId endpointId, ClusterId clusterId, const T * value) { return false; }
+    T * Get(EndpointId endpointId, ClusterId clusterId) const { return nullptr; }
+    T * Find(EndpointId endpointId, ClusterId clusterId) const { return nullptr; }
+    void Clear() {}
+    size_t Count() const { return 0; }
+    size_t Remaining() const { return 0; }
+};
+
+} // namespace app
+} // namespace chip
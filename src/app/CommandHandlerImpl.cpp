@@ -27,14 +27,20 @@
 #include <app/util/MatterCallbacks.h>
 #include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPConfig.h>
+#include <lib/core/TLVCountingWriter.h>
 #include <lib/core/TLVData.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/IntrusiveList.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
 #include <platform/LockTracker.h>
 #include <protocols/interaction_model/StatusCode.h>
 #include <protocols/secure_channel/Constants.h>
+#include <tracing/metric_event.h>
+#include <transport/SessionManager.h>
+
+#include <optional>
 
 namespace chip {
 namespace app {
@@ -53,10 +59,12 @@ CommandHandlerImpl::CommandHandlerImpl(TestOnlyOverrides & aTestOverride, Callba
     {
         SetExchangeInterface(aTestOverride.commandResponder);
     }
+    mpSystemLayer = aTestOverride.systemLayer;
 }
 
 CommandHandlerImpl::~CommandHandlerImpl()
 {
+    CancelCommandTimeoutTimer();
     InvalidateHandles();
 }
 
@@ -144,8 +152,22 @@ CHIP_ERROR CommandHandlerImpl::AddResponseData(const ConcreteCommandPath & aRequ
 {
     // Return early when response should not be sent out.
     VerifyOrReturnValue(ResponsesAccepted(), CHIP_NO_ERROR);
-    return TryAddingResponse(
+
+    switch (OnCommandResponse(aRequestCommandPath))
+    {
+    case ResponseAction::kDrop:
+        return CHIP_NO_ERROR;
+    case ResponseAction::kHold:
+        return HoldResponseData(aRequestCommandPath, aResponseCommandId, aEncodable);
+    case ResponseAction::kSend:
+        break;
+    }
+
+    CHIP_ERROR err = TryAddingResponse(
         [&]() -> CHIP_ERROR { return TryAddResponseData(aRequestCommandPath, aResponseCommandId, aEncodable); });
+    // The responses of the following commands may have been waiting for this one.
+    SendHeldResponses();
+    return err;
 }
 
 CHIP_ERROR CommandHandlerImpl::ValidateInvokeRequestMessageAndBuildRegistry(InvokeRequestMessage::Parser & invokeRequestMessage)
@@ -220,10 +242,11 @@ CHIP_ERROR CommandHandlerImpl::ValidateInvokeRequestMessageAndBuildRegistry(Invo
 
 Status CommandHandlerImpl::ProcessInvokeRequest(System::PacketBufferHandle && payload, bool isTimedInvoke)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader reader;
     InvokeRequestMessage::Parser invokeRequestMessage;
     InvokeRequests::Parser invokeRequests;
+    // Kept alive for the commands that may have to wait for earlier ones to respond before being dispatched.
+    System::PacketBufferHandle request = payload.Retain();
     reader.Init(std::move(payload));
     VerifyOrReturnError(invokeRequestMessage.Init(reader) == CHIP_NO_ERROR, Status::InvalidAction);
 #if CHIP_CONFIG_IM_PRETTY_PRINT
@@ -256,13 +279,37 @@ Status CommandHandlerImpl::ProcessInvokeRequest(System::PacketBufferHandle && pa
     if (commandCount > 1)
     {
         mReserveSpaceForMoreChunkMessages = true;
+        MATTER_LOG_METRIC(Tracing::kMetricInvokeBatchSize, static_cast<uint32_t>(commandCount));
     }
 
-    while (CHIP_NO_ERROR == (err = invokeRequestsReader.Next()))
+    Status status = ProcessCommandDataIBs(invokeRequestsReader);
+    VerifyOrReturnError(status == Status::Success, status);
+
+    if (mHasDeferredCommands)
+    {
+        // The whole message was already validated while building the registry.
+        mDeferredRequest    = std::move(request);
+        mDeferredOnExchange = (GetExchangeContext() != nullptr);
+        return Status::Success;
+    }
+
+    VerifyOrReturnError(invokeRequestMessage.ExitContainer() == CHIP_NO_ERROR, Status::InvalidAction);
+    return Status::Success;
+}
+
+Status CommandHandlerImpl::ProcessCommandDataIBs(TLV::TLVReader & aInvokeRequestsReader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    ScopedChange<bool> dispatching(mDispatchingCommands, true);
+    mHasDeferredCommands = false;
+
+    // Positioned before the next CommandDataIB, in case it has to be deferred.
+    TLV::TLVReader nextCommandReader = aInvokeRequestsReader;
+    while (CHIP_NO_ERROR == (err = aInvokeRequestsReader.Next()))
     {
-        VerifyOrReturnError(TLV::AnonymousTag() == invokeRequestsReader.GetTag(), Status::InvalidAction);
+        VerifyOrReturnError(TLV::AnonymousTag() == aInvokeRequestsReader.GetTag(), Status::InvalidAction);
         CommandDataIB::Parser commandData;
-        VerifyOrReturnError(commandData.Init(invokeRequestsReader) == CHIP_NO_ERROR, Status::InvalidAction);
+        VerifyOrReturnError(commandData.Init(aInvokeRequestsReader) == CHIP_NO_ERROR, Status::InvalidAction);
         Status status = Status::Success;
         if (IsGroupRequest())
         {
@@ -270,12 +317,57 @@ Status CommandHandlerImpl::ProcessInvokeRequest(System::PacketBufferHandle && pa
         }
         else
         {
+            // Errors decoding the path are reported by ProcessCommandDataIB.
+            CommandPathIB::Parser commandPath;
+            ConcreteCommandPath concretePath(0, 0, 0);
+            DataModel::InvokeDispatchPolicy policy;
+            if (commandData.GetPath(&commandPath) == CHIP_NO_ERROR &&
+                commandPath.GetConcreteCommandPath(concretePath) == CHIP_NO_ERROR)
+            {
+                policy = mpCallback->GetDispatchPolicy(concretePath);
+            }
+
+            if (MustDeferCommand(policy))
+            {
+                ChipLogDetail(DataManagement, "Deferring command until the commands in progress have responded");
+                mDeferredCommandsReader = nextCommandReader;
+                mDeferredCommandPolicy  = policy;
+                mHasDeferredCommands    = true;
+                StartCommandTimeoutTimer();
+                return Status::Success;
+            }
+
+            DispatchedCommand * command = nullptr;
+            for (auto & entry : mDispatchedCommands)
+            {
+                if (entry.state == DispatchedCommand::State::kFree)
+                {
+                    command = &entry;
+                    break;
+                }
+            }
+            // MustDeferCommand made sure there is a free entry.
+            VerifyOrDie(command != nullptr);
+            command->path            = concretePath;
+            command->sequence        = mNextCommandSequence++;
+            command->dispatchTime    = System::SystemClock().GetMonotonicTimestamp();
+            command->timeout         = policy.timeout;
+            command->concurrencySafe = policy.concurrencySafe;
+            command->state           = DispatchedCommand::State::kDispatching;
+
             status = ProcessCommandDataIB(commandData);
+
+            // Responding frees or holds the entry; if it is still dispatching, the handler responds asynchronously.
+            if (command->state == DispatchedCommand::State::kDispatching)
+            {
+                command->state = DispatchedCommand::State::kAwaitingResponse;
+            }
         }
         if (status != Status::Success)
         {
             return status;
         }
+        nextCommandReader = aInvokeRequestsReader;
     }
 
     // if we have exhausted this container
@@ -284,16 +376,413 @@ Status CommandHandlerImpl::ProcessInvokeRequest(System::PacketBufferHandle && pa
         err = CHIP_NO_ERROR;
     }
     VerifyOrReturnError(err == CHIP_NO_ERROR, Status::InvalidAction);
-    VerifyOrReturnError(invokeRequestMessage.ExitContainer() == CHIP_NO_ERROR, Status::InvalidAction);
+    StartCommandTimeoutTimer();
     return Status::Success;
 }
 
+bool CommandHandlerImpl::MustDeferCommand(const DataModel::InvokeDispatchPolicy & aPolicy) const
+{
+    bool hasFreeEntry           = false;
+    bool awaitingResponse       = false;
+    bool unsafeAwaitingResponse = false;
+
+    for (auto & command : mDispatchedCommands)
+    {
+        if (command.state == DispatchedCommand::State::kFree)
+        {
+            hasFreeEntry = true;
+        }
+        else if (command.state == DispatchedCommand::State::kAwaitingResponse)
+        {
+            awaitingResponse = true;
+            unsafeAwaitingResponse |= !command.concurrencySafe;
+        }
+    }
+
+    VerifyOrReturnValue(hasFreeEntry, true);
+    VerifyOrReturnValue(awaitingResponse, false);
+    return !aPolicy.concurrencySafe || unsafeAwaitingResponse;
+}
+
+void CommandHandlerImpl::DispatchDeferredCommands()
+{
+    if (mPendingWork == 0)
+    {
+        // Nothing holds a Handle anymore, so the commands still awaiting a response will not get one.
+        SendHeldResponses(/* aWaitForEarlierCommands = */ false);
+        ClearDispatchedCommands();
+    }
+
+    // Releasing this once done may finalize the response and close this object.
+    Handle workHandle(this);
+
+    mHasDeferredCommands = false;
+    if (mDeferredOnExchange && GetExchangeContext() == nullptr)
+    {
+        ChipLogError(DataManagement, "Exchange closed, dropping the remaining commands of the invoke request");
+    }
+    else
+    {
+        TLV::TLVReader invokeRequestsReader = mDeferredCommandsReader;
+        Status status                       = ProcessCommandDataIBs(invokeRequestsReader);
+        if (status != Status::Success)
+        {
+            ChipLogError(DataManagement, "Failed to dispatch the remaining commands of the invoke request: " ChipLogFormatIMStatus,
+                         ChipLogValueIMStatus(status));
+            mHasDeferredCommands = false;
+        }
+    }
+
+    if (!mHasDeferredCommands)
+    {
+        mDeferredRequest = nullptr;
+    }
+}
+
+CommandHandlerImpl::ResponseAction CommandHandlerImpl::OnCommandResponse(const ConcreteCommandPath & aRequestCommandPath,
+                                                                        bool aCanHold)
+{
+    DispatchedCommand * command = FindDispatchedCommand(aRequestCommandPath);
+    VerifyOrReturnValue(command != nullptr, ResponseAction::kSend);
+
+    if (command->state == DispatchedCommand::State::kTimedOut || command->state == DispatchedCommand::State::kResponded)
+    {
+        ChipLogError(DataManagement,
+                     "Dropping response for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI
+                     ": the command %s",
+                     aRequestCommandPath.mEndpointId, ChipLogValueMEI(aRequestCommandPath.mClusterId),
+                     ChipLogValueMEI(aRequestCommandPath.mCommandId),
+                     command->state == DispatchedCommand::State::kTimedOut ? "timed out" : "already responded");
+        return ResponseAction::kDrop;
+    }
+
+    bool wasAsync = (command->state == DispatchedCommand::State::kAwaitingResponse);
+    if (wasAsync)
+    {
+        System::Clock::Timestamp latency = System::SystemClock().GetMonotonicTimestamp() - command->dispatchTime;
+        MATTER_LOG_METRIC(Tracing::kMetricInvokeCommandLatency, static_cast<uint32_t>(latency.count()));
+    }
+
+    ResponseAction action = ResponseAction::kSend;
+    if (aCanHold && HasEarlierCommandAwaitingResponse(*command))
+    {
+        command->state = DispatchedCommand::State::kResponded;
+        action         = ResponseAction::kHold;
+    }
+    else
+    {
+        *command = DispatchedCommand();
+    }
+
+    // The commands dispatched synchronously get their timer started once dispatching is done.
+    if (wasAsync)
+    {
+        StartCommandTimeoutTimer();
+    }
+    return action;
+}
+
+CommandHandlerImpl::DispatchedCommand * CommandHandlerImpl::FindDispatchedCommand(const ConcreteCommandPath & aRequestCommandPath)
+{
+    for (auto & command : mDispatchedCommands)
+    {
+        if (command.state != DispatchedCommand::State::kFree && command.path == aRequestCommandPath)
+        {
+            return &command;
+        }
+    }
+    return nullptr;
+}
+
+bool CommandHandlerImpl::HasEarlierCommandAwaitingResponse(const DispatchedCommand & aCommand) const
+{
+    for (auto & command : mDispatchedCommands)
+    {
+        if (command.IsAwaitingResponse() && command.sequence < aCommand.sequence)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace {
+// The fields of a command response held by HoldResponseData, copied into the response message once it is sent.
+class HeldResponseFields : public DataModel::EncodableToTLV
+{
+public:
+    HeldResponseFields(const System::PacketBufferHandle & aBuffer) : mBuffer(aBuffer) {}
+
+    CHIP_ERROR EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag) const override
+    {
+        System::PacketBufferTLVReader reader;
+        reader.Init(mBuffer.Retain());
+        ReturnErrorOnFailure(reader.Next());
+        return writer.CopyElement(tag, reader);
+    }
+
+private:
+    const System::PacketBufferHandle & mBuffer;
+};
+} // anonymous namespace
+
+CHIP_ERROR CommandHandlerImpl::HoldResponseData(const ConcreteCommandPath & aRequestCommandPath, CommandId aResponseCommandId,
+                                                const DataModel::EncodableToTLV & aEncodable)
+{
+    DispatchedCommand * command = FindDispatchedCommand(aRequestCommandPath);
+    VerifyOrDie(command != nullptr);
+    command->hasHeldResponse = true;
+
+    // Measured first, so that each held response only takes the space its fields need. The held fields are sent in a
+    // response message of their own if they do not fit with the others.
+    TLV::CountingTLVWriter counter;
+    CHIP_ERROR err = aEncodable.EncodeTo(counter, TLV::AnonymousTag());
+    if (err == CHIP_NO_ERROR && counter.GetLengthWritten() > mpResponder->GetCommandResponseMaxBufferSize())
+    {
+        err = CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(counter.GetLengthWritten(), /* aReservedSize = */ 0);
+        err                               = buffer.IsNull() ? CHIP_ERROR_NO_MEMORY : CHIP_NO_ERROR;
+        if (err == CHIP_NO_ERROR)
+        {
+            System::PacketBufferTLVWriter writer;
+            writer.Init(std::move(buffer));
+            err = aEncodable.EncodeTo(writer, TLV::AnonymousTag());
+            if (err == CHIP_NO_ERROR)
+            {
+                err = writer.Finalize(&command->heldFields);
+            }
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        // Same as AddResponse when the response cannot be added.
+        command->heldFields = nullptr;
+        command->heldStatus = StatusIB(Status::Failure);
+        return err;
+    }
+    command->heldResponseCommandId = aResponseCommandId;
+    return CHIP_NO_ERROR;
+}
+
+void CommandHandlerImpl::HoldStatus(const ConcreteCommandPath & aRequestCommandPath, const StatusIB & aStatus)
+{
+    DispatchedCommand * command = FindDispatchedCommand(aRequestCommandPath);
+    VerifyOrDie(command != nullptr);
+    command->heldStatus      = aStatus;
+    command->hasHeldResponse = true;
+}
+
+void CommandHandlerImpl::SendHeldResponses(bool aWaitForEarlierCommands)
+{
+    while (true)
+    {
+        DispatchedCommand * next = nullptr;
+        for (auto & command : mDispatchedCommands)
+        {
+            if ((command.hasHeldResponse || (aWaitForEarlierCommands && command.IsAwaitingResponse())) &&
+                (next == nullptr || command.sequence < next->sequence))
+            {
+                next = &command;
+            }
+        }
+        VerifyOrReturn(next != nullptr && next->hasHeldResponse);
+        SendHeldResponse(*next);
+    }
+}
+
+void CommandHandlerImpl::SendHeldResponse(DispatchedCommand & aCommand)
+{
+    const ConcreteCommandPath path    = aCommand.path;
+    const StatusIB status             = aCommand.heldStatus;
+    const CommandId responseCommandId = aCommand.heldResponseCommandId;
+    System::PacketBufferHandle fields = std::move(aCommand.heldFields);
+
+    // A timed out command keeps its entry, so that a late response from its handler is dropped.
+    if (aCommand.state == DispatchedCommand::State::kTimedOut)
+    {
+        aCommand.hasHeldResponse = false;
+    }
+    else
+    {
+        aCommand = DispatchedCommand();
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (!fields.IsNull())
+    {
+        HeldResponseFields encodable(fields);
+        err = TryAddingResponse([&]() -> CHIP_ERROR { return TryAddResponseData(path, responseCommandId, encodable); });
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Adding held response failed: %" CHIP_ERROR_FORMAT ". Returning failure instead.",
+                         err.Format());
+            err = AddStatusInternal(path, StatusIB(Status::Failure));
+        }
+    }
+    else
+    {
+        err = AddStatusInternal(path, status);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to add held command response: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void CommandHandlerImpl::ClearDispatchedCommands()
+{
+    for (auto & command : mDispatchedCommands)
+    {
+        command = DispatchedCommand();
+    }
+    CancelCommandTimeoutTimer();
+}
+
+void CommandHandlerImpl::StartCommandTimeoutTimer()
+{
+    CancelCommandTimeoutTimer();
+
+    bool awaitingResponse = false;
+    bool timedOut         = false;
+    std::optional<System::Clock::Timestamp> deadline;
+    for (auto & command : mDispatchedCommands)
+    {
+        timedOut |= (command.state == DispatchedCommand::State::kTimedOut);
+        if (command.state != DispatchedCommand::State::kAwaitingResponse)
+        {
+            continue;
+        }
+        awaitingResponse = true;
+        if (command.timeout > System::Clock::kZero &&
+            (!deadline.has_value() || command.dispatchTime + command.timeout < *deadline))
+        {
+            deadline = command.dispatchTime + command.timeout;
+        }
+    }
+
+    System::Clock::Timeout delay = System::Clock::kZero;
+    if (timedOut && !awaitingResponse)
+    {
+        // Only timed out commands are left: stop waiting for their handlers right away.
+    }
+    else if (deadline.has_value())
+    {
+        System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        if (*deadline > now)
+        {
+            delay = std::chrono::duration_cast<System::Clock::Timeout>(*deadline - now);
+        }
+    }
+    else
+    {
+        return;
+    }
+
+    System::Layer * layer = GetSystemLayer();
+    VerifyOrReturn(layer != nullptr);
+    CHIP_ERROR err = layer->StartTimer(delay, OnCommandTimeoutTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to start command timeout timer: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mpTimerLayer = layer;
+}
+
+void CommandHandlerImpl::CancelCommandTimeoutTimer()
+{
+    VerifyOrReturn(mpTimerLayer != nullptr);
+    mpTimerLayer->CancelTimer(OnCommandTimeoutTimer, this);
+    mpTimerLayer = nullptr;
+}
+
+System::Layer * CommandHandlerImpl::GetSystemLayer() const
+{
+    VerifyOrReturnValue(mpSystemLayer == nullptr, mpSystemLayer);
+    VerifyOrReturnValue(mpResponder != nullptr, nullptr);
+    Messaging::ExchangeContext * exchangeContext = mpResponder->GetExchangeContext();
+    VerifyOrReturnValue(exchangeContext != nullptr, nullptr);
+    return exchangeContext->GetExchangeMgr()->GetSessionManager()->SystemLayer();
+}
+
+void CommandHandlerImpl::OnCommandTimeoutTimer(System::Layer * aLayer, void * aAppState)
+{
+    static_cast<CommandHandlerImpl *>(aAppState)->HandleCommandTimeouts();
+}
+
+void CommandHandlerImpl::HandleCommandTimeouts()
+{
+    mpTimerLayer = nullptr;
+
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    uint32_t timedOutCount       = 0;
+    bool awaitingResponse        = false;
+    for (auto & command : mDispatchedCommands)
+    {
+        if (command.state != DispatchedCommand::State::kAwaitingResponse)
+        {
+            continue;
+        }
+        if (command.timeout == System::Clock::kZero || now < command.dispatchTime + command.timeout)
+        {
+            awaitingResponse = true;
+            continue;
+        }
+
+        ChipLogError(DataManagement, "Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI " timed out",
+                     command.path.mEndpointId, ChipLogValueMEI(command.path.mClusterId), ChipLogValueMEI(command.path.mCommandId));
+        // Sent by SendHeldResponses below, in the order of the request.
+        command.state           = DispatchedCommand::State::kTimedOut;
+        command.heldStatus      = StatusIB(Status::Timeout);
+        command.hasHeldResponse = true;
+        timedOutCount++;
+    }
+
+    if (timedOutCount > 0)
+    {
+        MATTER_LOG_METRIC(Tracing::kMetricInvokeCommandTimeout, timedOutCount);
+    }
+    SendHeldResponses();
+
+    if (awaitingResponse)
+    {
+        StartCommandTimeoutTimer();
+        if (mHasDeferredCommands && !MustDeferCommand(mDeferredCommandPolicy))
+        {
+            DispatchDeferredCommands();
+        }
+        return;
+    }
+
+    // All the commands that did not respond timed out. Their handlers may still hold Handles, which must not keep the
+    // response from being sent: invalidate them, so that those handlers find they can no longer respond.
+    ClearDispatchedCommands();
+    InvalidateHandles();
+    mPendingWork = 0;
+
+    if (mHasDeferredCommands)
+    {
+        DispatchDeferredCommands();
+        return;
+    }
+    FinalizeAndClose();
+}
+
 void CommandHandlerImpl::Close()
 {
     mSuppressResponse = false;
     mpResponder       = nullptr;
     MoveToState(State::AwaitingDestruction);
 
+    ClearDispatchedCommands();
+    mHasDeferredCommands = false;
+    mDeferredRequest     = nullptr;
+
     // We must finish all async work before we can shut down a CommandHandlerImpl. The actual CommandHandlerImpl MUST finish their
     // work in reasonable time or there is a bug. The only case for releasing CommandHandlerImpl without CommandHandler::Handle
     // releasing its reference is the stack shutting down, in which case Close() is not called. So the below check should always
@@ -343,11 +832,25 @@ void CommandHandlerImpl::DecrementHoldOff(Handle * apHandle)
 
     RemoveFromHandleList(apHandle);
 
+    if (mHasDeferredCommands && !mDispatchingCommands && (mPendingWork == 0 || !MustDeferCommand(mDeferredCommandPolicy)))
+    {
+        DispatchDeferredCommands();
+        return;
+    }
+
     if (mPendingWork != 0)
     {
         return;
     }
 
+    FinalizeAndClose();
+}
+
+void CommandHandlerImpl::FinalizeAndClose()
+{
+    // The handlers of the commands still awaiting a response released their Handle without responding.
+    SendHeldResponses(/* aWaitForEarlierCommands = */ false);
+
     if (mpResponder == nullptr)
     {
         ChipLogProgress(DataManagement, "Skipping command response: response sender is null");
@@ -571,6 +1074,9 @@ CHIP_ERROR CommandHandlerImpl::FallibleAddStatus(const ConcreteCommandPath & pat
                                                  const Protocols::InteractionModel::ClusterStatusCode & status,
                                                  const char * context)
 {
+    ResponseAction action = OnCommandResponse(path);
+    VerifyOrReturnValue(action != ResponseAction::kDrop, CHIP_NO_ERROR);
+
     if (!status.IsSuccess())
     {
         if (context == nullptr)
@@ -597,7 +1103,16 @@ CHIP_ERROR CommandHandlerImpl::FallibleAddStatus(const ConcreteCommandPath & pat
         }
     }
 
-    return AddStatusInternal(path, StatusIB{ status });
+    if (action == ResponseAction::kHold)
+    {
+        HoldStatus(path, StatusIB{ status });
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR err = AddStatusInternal(path, StatusIB{ status });
+    // The responses of the following commands may have been waiting for this one.
+    SendHeldResponses();
+    return err;
 }
 
 CHIP_ERROR CommandHandlerImpl::PrepareInvokeResponseCommand(const ConcreteCommandPath & aResponseCommandPath,
@@ -605,6 +1120,13 @@ CHIP_ERROR CommandHandlerImpl::PrepareInvokeResponseCommand(const ConcreteComman
 {
     auto commandPathRegistryEntry = GetCommandPathRegistry().Find(aPrepareParameters.mRequestCommandPath);
     VerifyOrReturnValue(commandPathRegistryEntry.has_value(), CHIP_ERROR_INCORRECT_STATE);
+    // Responses written directly by the handler cannot be held: they are sent as they come, and only the responses added
+    // through AddResponse/AddStatus are kept in the order of the request.
+    if (!mInternalCallToAddResponseData)
+    {
+        ResponseAction action = OnCommandResponse(aPrepareParameters.mRequestCommandPath, /* aCanHold = */ false);
+        VerifyOrReturnError(action != ResponseAction::kDrop, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     return PrepareInvokeResponseCommand(*commandPathRegistryEntry, aResponseCommandPath, aPrepareParameters.mStartOrEndDataStruct);
 }
@@ -761,7 +1283,9 @@ TLV::TLVWriter * CommandHandlerImpl::GetCommandDataIBTLVWriter()
 
 FabricIndex CommandHandlerImpl::GetAccessingFabricIndex() const
 {
-    VerifyOrDie(!mGoneAsync);
+    // Deferred commands of the request are dispatched after going async, while the exchange is still open: look the
+    // session up again for them, so that they run with its current credentials.
+    VerifyOrDie(!mGoneAsync || mDispatchingCommands);
     VerifyOrDie(mpResponder);
     return mpResponder->GetAccessingFabricIndex();
 }
@@ -859,7 +1383,8 @@ void CommandHandlerImpl::FlushAcksRightAwayOnSlowCommand()
 
 Access::SubjectDescriptor CommandHandlerImpl::GetSubjectDescriptor() const
 {
-    VerifyOrDie(!mGoneAsync);
+    // Deferred commands of the request are dispatched after going async, see GetAccessingFabricIndex.
+    VerifyOrDie(!mGoneAsync || mDispatchingCommands);
     VerifyOrDie(mpResponder);
     return mpResponder->GetSubjectDescriptor();
 }
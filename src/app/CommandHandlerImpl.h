@@ -23,6 +23,7 @@
 #include <app/CommandPathRegistry.h>
 #include <app/MessageDef/InvokeRequestMessage.h>
 #include <app/MessageDef/InvokeResponseMessage.h>
+#include <app/MessageDef/StatusIB.h>
 #include <app/data-model-provider/OperationTypes.h>
 #include <lib/core/TLV.h>
 #include <lib/core/TLVDebug.h>
@@ -33,6 +34,8 @@
 #include <protocols/Protocols.h>
 #include <protocols/interaction_model/Constants.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
@@ -76,6 +79,16 @@ public:
          */
         virtual void DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                      TLV::TLVReader & apPayload) = 0;
+
+        /*
+         * Returns whether the command at aCommandPath may run concurrently with the other commands of the same invoke
+         * request, and how long it may take to respond. By default, the commands of a request are all dispatched without
+         * waiting for each other's response, and there is no timeout.
+         */
+        virtual DataModel::InvokeDispatchPolicy GetDispatchPolicy(const ConcreteCommandPath & aCommandPath)
+        {
+            return DataModel::InvokeDispatchPolicy();
+        }
     };
 
     struct InvokeResponseParameters
@@ -101,6 +114,7 @@ public:
     public:
         CommandPathRegistry * commandPathRegistry          = nullptr;
         CommandHandlerExchangeInterface * commandResponder = nullptr;
+        System::Layer * systemLayer                        = nullptr;
     };
 
     /*
@@ -277,6 +291,44 @@ private:
         AwaitingDestruction, ///< The object has completed its work and is awaiting destruction by the application.
     };
 
+    /**
+     * A command of the invoke request that has been dispatched and whose response is being waited for, or held until the
+     * commands dispatched before it have responded.
+     */
+    struct DispatchedCommand
+    {
+        enum class State : uint8_t
+        {
+            kFree,             ///< The entry is not in use.
+            kDispatching,      ///< The command is being handed to its handler.
+            kAwaitingResponse, ///< The handler returned without responding, it will respond through a Handle.
+            kResponded,        ///< The handler responded, the response is held until the earlier commands have responded.
+            kTimedOut,         ///< The command got a Timeout status; a late response from its handler is dropped.
+        };
+
+        bool IsAwaitingResponse() const { return state == State::kDispatching || state == State::kAwaitingResponse; }
+
+        ConcreteCommandPath path              = ConcreteCommandPath(0, 0, 0);
+        System::Clock::Timestamp dispatchTime = System::Clock::kZero;
+        System::Clock::Timeout timeout        = System::Clock::kZero;
+        // The held response: the fields of a command response if heldFields is not null, heldStatus otherwise.
+        System::PacketBufferHandle heldFields;
+        StatusIB heldStatus;
+        CommandId heldResponseCommandId = kInvalidCommandId;
+        // Position of the command in the invoke request.
+        uint16_t sequence    = 0;
+        State state          = State::kFree;
+        bool concurrencySafe = true;
+        bool hasHeldResponse = false;
+    };
+
+    enum class ResponseAction : uint8_t
+    {
+        kSend, ///< Add the response to the response message now.
+        kHold, ///< Hold the response until the commands dispatched before have responded.
+        kDrop, ///< Drop the response: the command already timed out, or already responded.
+    };
+
     /**
      * @brief Best effort to add InvokeResponse to InvokeResponseMessage.
      *
@@ -394,6 +446,70 @@ private:
 
     Protocols::InteractionModel::Status ProcessInvokeRequest(System::PacketBufferHandle && payload, bool isTimedInvoke);
 
+    /**
+     * Dispatches the CommandDataIBs that follow the current position of aInvokeRequestsReader, in order.
+     *
+     * For a unicast request, a command is not dispatched while earlier commands of the request that are not
+     * concurrency-safe are awaiting their response, or, if the command itself is not concurrency-safe, while any earlier
+     * command is. The remaining commands are then deferred (mHasDeferredCommands) and dispatched by
+     * DispatchDeferredCommands once the commands holding them back have responded.
+     */
+    Protocols::InteractionModel::Status ProcessCommandDataIBs(TLV::TLVReader & aInvokeRequestsReader);
+
+    /**
+     * Whether a command with the given dispatch policy has to wait for the commands awaiting their response.
+     */
+    bool MustDeferCommand(const DataModel::InvokeDispatchPolicy & aPolicy) const;
+
+    /**
+     * Dispatches the commands deferred by ProcessCommandDataIBs. This may finalize the response and Close() this
+     * object, so nothing may be accessed after calling it.
+     */
+    void DispatchDeferredCommands();
+
+    /**
+     * Records that a response is being added for the given request path, and returns what to do with it. Responses are
+     * sent in the order of the request: a response is held if a command dispatched before is still awaiting its own,
+     * unless aCanHold is false, in which case it is sent right away.
+     */
+    ResponseAction OnCommandResponse(const ConcreteCommandPath & aRequestCommandPath, bool aCanHold = true);
+
+    DispatchedCommand * FindDispatchedCommand(const ConcreteCommandPath & aRequestCommandPath);
+    bool HasEarlierCommandAwaitingResponse(const DispatchedCommand & aCommand) const;
+
+    /**
+     * Holds the response of a command for which OnCommandResponse returned ResponseAction::kHold. If the fields cannot be
+     * held, a Failure status is held instead and the error is returned.
+     */
+    CHIP_ERROR HoldResponseData(const ConcreteCommandPath & aRequestCommandPath, CommandId aResponseCommandId,
+                                const DataModel::EncodableToTLV & aEncodable);
+    void HoldStatus(const ConcreteCommandPath & aRequestCommandPath, const StatusIB & aStatus);
+
+    /**
+     * Sends the held responses, in the order of the request, up to the first command still awaiting its response. If
+     * aWaitForEarlierCommands is false, all the held responses are sent, as the commands still awaiting their response
+     * will not get one.
+     */
+    void SendHeldResponses(bool aWaitForEarlierCommands = true);
+    void SendHeldResponse(DispatchedCommand & aCommand);
+
+    void ClearDispatchedCommands();
+
+    /**
+     * (Re)starts the timer for the earliest timeout of the commands awaiting their response.
+     */
+    void StartCommandTimeoutTimer();
+    void CancelCommandTimeoutTimer();
+    static void OnCommandTimeoutTimer(System::Layer * aLayer, void * aAppState);
+    void HandleCommandTimeouts();
+
+    System::Layer * GetSystemLayer() const;
+
+    /**
+     * Called once no more work is pending: sends the final response message and Close()s this object.
+     */
+    void FinalizeAndClose();
+
     /**
      * Called internally to signal the completion of all work on this object, gracefully close the
      * exchange (by calling into the base class) and finally, signal to a registerd callback that it's
@@ -473,6 +589,19 @@ private:
 
     CommandHandlerExchangeInterface * mpResponder = nullptr;
 
+    // Commands of the current invoke request whose response is being waited for.
+    DispatchedCommand mDispatchedCommands[CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE];
+
+    // The invoke request is kept while some of its commands are deferred, see ProcessCommandDataIBs.
+    System::PacketBufferHandle mDeferredRequest;
+    TLV::TLVReader mDeferredCommandsReader;
+    DataModel::InvokeDispatchPolicy mDeferredCommandPolicy;
+    uint16_t mNextCommandSequence = 0;
+
+    System::Layer * mpSystemLayer = nullptr;
+    // The layer the command timeout timer was started on, if it is running.
+    System::Layer * mpTimerLayer = nullptr;
+
     State mState = State::Idle;
     State mBackupState;
     ScopedChangeOnly<bool> mInternalCallToAddResponseData{ false };
@@ -489,6 +618,11 @@ private:
     // incoming invoke.  After this point, our session could go away at any
     // time.
     bool mGoneAsync = false;
+    // True while ProcessCommandDataIBs is dispatching commands.
+    bool mDispatchingCommands = false;
+    bool mHasDeferredCommands = false;
+    // Whether the deferred commands were received over an exchange, which must still be open to dispatch them.
+    bool mDeferredOnExchange = false;
 };
 } // namespace app
 } // namespace chip
@@ -21,6 +21,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteClusterPath.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/data-model-provider/OperationTypes.h>
 #include <app/data-model/Decode.h>
 #include <app/data-model/List.h> // So we can encode lists
 #include <lib/core/DataModelTypes.h>
@@ -72,6 +73,11 @@ public:
         bool mCommandHandled = false;
     };
 
+    /**
+     * How the commands handled by an interface are dispatched when they are part of a batched invoke request.
+     */
+    using DispatchPolicy = DataModel::InvokeDispatchPolicy;
+
     /**
      * aEndpointId can be Missing to indicate that this object is meant to be
      * used with all endpoints.
@@ -101,6 +107,13 @@ public:
      */
     virtual void InvokeCommand(HandlerContext & handlerContext) = 0;
 
+    /**
+     * Function that may be implemented to keep the commands at the given path from running concurrently with the other
+     * commands of a batched invoke request, or to limit the time they may take to respond. By default, the commands of a
+     * request are all dispatched without waiting for each other's response.
+     */
+    virtual DispatchPolicy GetDispatchPolicy(const ConcreteCommandPath & aCommandPath) const { return DispatchPolicy(); }
+
     typedef Loop (*CommandIdCallback)(CommandId id, void * context);
 
     /**
@@ -227,6 +240,8 @@ protected:
     Optional<EndpointId> GetEndpointId() { return mEndpointId; }
 
 private:
+    friend class CommandHandlerInterfaceRegistry;
+
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
     CommandHandlerInterface * mNext = nullptr;
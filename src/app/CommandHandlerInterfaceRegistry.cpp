@@ -15,6 +15,8 @@
  */
 #include <app/CommandHandlerInterfaceRegistry.h>
 
+#include <stdint.h>
+
 using namespace chip::app;
 
 namespace chip {
@@ -43,23 +45,44 @@ void CommandHandlerInterfaceRegistry::UnregisterAllHandlers()
     }
 
     mCommandHandlerList = nullptr;
+    mIndex.Clear();
+    mUnindexedCount = 0;
 }
 
 CHIP_ERROR CommandHandlerInterfaceRegistry::RegisterCommandHandler(CommandHandlerInterface * handler)
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    if (HasConflictingHandler(*handler))
     {
-        if (cur->Matches(*handler))
-        {
-            ChipLogError(InteractionModel, "Duplicate command handler registration failed");
-            return CHIP_ERROR_INCORRECT_STATE;
-        }
+        ChipLogError(InteractionModel, "Duplicate command handler registration failed");
+        return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    handler->SetNext(mCommandHandlerList);
-    mCommandHandlerList = handler;
+    if (!mIndex.Insert(IndexEndpointId(*handler), handler->mClusterId, handler))
+    {
+        handler->SetNext(mCommandHandlerList);
+        mCommandHandlerList = handler;
+        mUnindexedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    // Indexed handlers go after the ones that did not fit in the index, so that lookups only walk the latter.
+    CommandHandlerInterface * prev = nullptr;
+    for (size_t i = 0; i < mUnindexedCount; i++)
+    {
+        prev = (prev == nullptr) ? mCommandHandlerList : prev->GetNext();
+    }
+    if (prev == nullptr)
+    {
+        handler->SetNext(mCommandHandlerList);
+        mCommandHandlerList = handler;
+    }
+    else
+    {
+        handler->SetNext(prev->GetNext());
+        prev->SetNext(handler);
+    }
 
     return CHIP_NO_ERROR;
 }
@@ -75,6 +98,8 @@ void CommandHandlerInterfaceRegistry::UnregisterAllCommandHandlersForEndpoint(En
 
         if (cur->MatchesEndpoint(endpointId))
         {
+            RemoveFromIndex(*cur);
+
             if (prev == nullptr)
             {
                 mCommandHandlerList = cur->GetNext();
@@ -104,6 +129,8 @@ CHIP_ERROR CommandHandlerInterfaceRegistry::UnregisterCommandHandler(CommandHand
     {
         if (cur->Matches(*handler))
         {
+            RemoveFromIndex(*cur);
+
             if (prev == nullptr)
             {
                 mCommandHandlerList = cur->GetNext();
@@ -126,7 +153,12 @@ CHIP_ERROR CommandHandlerInterfaceRegistry::UnregisterCommandHandler(CommandHand
 
 CommandHandlerInterface * CommandHandlerInterfaceRegistry::GetCommandHandler(EndpointId endpointId, ClusterId clusterId)
 {
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    CommandHandlerInterface * found = mIndex.Find(endpointId, clusterId);
+    VerifyOrReturnValue(found == nullptr && mUnindexedCount > 0, found);
+
+    // Only the handlers that did not fit in the index are walked; they come first in the list.
+    size_t count = mUnindexedCount;
+    for (auto * cur = mCommandHandlerList; cur && count > 0; cur = cur->GetNext(), count--)
     {
         if (cur->Matches(endpointId, clusterId))
         {
@@ -137,5 +169,35 @@ CommandHandlerInterface * CommandHandlerInterfaceRegistry::GetCommandHandler(End
     return nullptr;
 }
 
+bool CommandHandlerInterfaceRegistry::HasConflictingHandler(const CommandHandlerInterface & handler) const
+{
+    // A handler for a single endpoint conflicts with the one for that endpoint and the one for all endpoints, which are
+    // either in the index or among the handlers that did not fit in it. A handler for all endpoints conflicts with any
+    // handler of its cluster.
+    size_t count = SIZE_MAX;
+    if (handler.mEndpointId.HasValue())
+    {
+        VerifyOrReturnValue(mIndex.Find(handler.mEndpointId.Value(), handler.mClusterId) == nullptr, true);
+        count = mUnindexedCount;
+    }
+
+    for (auto * cur = mCommandHandlerList; cur && count > 0; cur = cur->GetNext(), count--)
+    {
+        if (cur->Matches(handler))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommandHandlerInterfaceRegistry::RemoveFromIndex(CommandHandlerInterface & handler)
+{
+    if (!mIndex.Remove(IndexEndpointId(handler), handler.mClusterId, &handler))
+    {
+        mUnindexedCount--;
+    }
+}
+
 } // namespace app
 } // namespace chip
@@ -15,7 +15,11 @@
  */
 #pragma once
 
+#include <app/ClusterPathIndex.h>
 #include <app/CommandHandlerInterface.h>
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
 
 namespace chip {
 namespace app {
@@ -53,7 +57,22 @@ public:
     static CommandHandlerInterfaceRegistry & Instance();
 
 private:
+    static EndpointId IndexEndpointId(const CommandHandlerInterface & handler)
+    {
+        return handler.mEndpointId.ValueOr(kInvalidEndpointId);
+    }
+
+    bool HasConflictingHandler(const CommandHandlerInterface & handler) const;
+    void RemoveFromIndex(CommandHandlerInterface & handler);
+
     CommandHandlerInterface * mCommandHandlerList = nullptr;
+
+    // Index of mCommandHandlerList, so that lookups do not walk the list. Disabled unless
+    // CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE is set.
+    ClusterPathIndex<CommandHandlerInterface, CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE> mIndex;
+
+    // Number of handlers that did not fit in mIndex. They come first in mCommandHandlerList, and only they need a list walk.
+    size_t mUnindexedCount = 0;
 };
 
 } // namespace app
@@ -138,6 +138,12 @@ Protocols::InteractionModel::Status CommandResponseSender::ValidateCommandCanBeD
     return mpCommandHandlerCallback->ValidateCommandCanBeDispatched(request);
 }
 
+DataModel::InvokeDispatchPolicy CommandResponseSender::GetDispatchPolicy(const ConcreteCommandPath & aCommandPath)
+{
+    VerifyOrReturnValue(mpCommandHandlerCallback, DataModel::InvokeDispatchPolicy());
+    return mpCommandHandlerCallback->GetDispatchPolicy(aCommandPath);
+}
+
 CHIP_ERROR CommandResponseSender::SendCommandResponse()
 {
     VerifyOrReturnError(HasMoreToSend(), CHIP_ERROR_INCORRECT_STATE);
@@ -54,6 +54,17 @@ public:
         mpCallback(apCallback), mpCommandHandlerCallback(apDispatchCallback), mCommandHandler(this), mExchangeCtx(*this)
     {}
 
+    /*
+     * Constructor to override the number of supported paths per invoke of the underlying CommandHandlerImpl.
+     *
+     * For testing purposes.
+     */
+    CommandResponseSender(Callback * apCallback, CommandHandlerImpl::Callback * apDispatchCallback,
+                          CommandHandlerImpl::TestOnlyOverrides & aTestOverride) :
+        mpCallback(apCallback), mpCommandHandlerCallback(apDispatchCallback), mCommandHandler(aTestOverride, this),
+        mExchangeCtx(*this)
+    {}
+
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
 
@@ -66,6 +77,8 @@ public:
 
     Protocols::InteractionModel::Status ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request) override;
 
+    DataModel::InvokeDispatchPolicy GetDispatchPolicy(const ConcreteCommandPath & aCommandPath) override;
+
     /**
      * Gets the inner exchange context object, without ownership.
      *
@@ -53,6 +53,7 @@
 #include <lib/support/FibonacciUtils.h>
 #include <lib/support/ReadOnlyBuffer.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/metric_event.h>
 
 namespace chip {
 namespace app {
@@ -182,6 +183,9 @@ void InteractionModelEngine::Shutdown()
     VerifyOrReturn(State::kUninitialized != mState);
 
     mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeSubscriptionsTimerCallback, this);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    ReleaseQueuedSubscriptionResumptions();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
     // TODO: individual object clears the entire command handler interface registry.
     //       This may not be expected as IME does NOT own the command handler interface registry.
@@ -240,6 +244,7 @@ void InteractionModelEngine::Shutdown()
     mReportingEngine.Shutdown();
     mAttributePathPool.ReleaseAll();
     mEventPathPool.ReleaseAll();
+    mEventPathCount = 0;
     mDataVersionFilterPool.ReleaseAll();
     mpExchangeMgr->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
 
@@ -546,7 +551,13 @@ Status InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext
                                                       bool aIsTimedInvoke)
 {
     // TODO(#30453): Refactor CommandResponseSender's constructor to accept an exchange context parameter.
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    CommandHandlerImpl::TestOnlyOverrides testOnlyOverrides;
+    testOnlyOverrides.commandPathRegistry    = mCommandPathRegistryOverride;
+    CommandResponseSender * commandResponder = mCommandResponderObjs.CreateObject(this, this, testOnlyOverrides);
+#else
     CommandResponseSender * commandResponder = mCommandResponderObjs.CreateObject(this, this);
+#endif
     if (commandResponder == nullptr)
     {
         ChipLogProgress(InteractionModel, "no resource for Invoke interaction");
@@ -1597,15 +1608,16 @@ bool InteractionModelEngine::HasConflictWriteRequests(const WriteHandler * apWri
     return false;
 }
 
-void InteractionModelEngine::ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList)
+void InteractionModelEngine::ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
+                                                      PathArena * apArena)
 {
-    ReleasePool(aAttributePathList, mAttributePathPool);
+    ReleasePool(aAttributePathList, mAttributePathPool, apArena);
 }
 
 CHIP_ERROR InteractionModelEngine::PushFrontAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
-                                                              AttributePathParams & aAttributePath)
+                                                              AttributePathParams & aAttributePath, PathArena * apArena)
 {
-    CHIP_ERROR err = PushFront(aAttributePathList, aAttributePath, mAttributePathPool);
+    CHIP_ERROR err = PushFront(aAttributePathList, aAttributePath, mAttributePathPool, apArena);
     if (err == CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(InteractionModel, "AttributePath pool full");
@@ -1620,7 +1632,8 @@ bool InteractionModelEngine::IsExistentAttributePath(const ConcreteAttributePath
     return finder.Find(path).has_value();
 }
 
-void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths)
+void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                                                  PathArena * apArena)
 {
     SingleLinkedListNode<AttributePathParams> * prev = nullptr;
     auto * path1                                     = aAttributePaths;
@@ -1662,47 +1675,57 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
             continue;
         }
 
+        // Nodes from an arena are only unlinked, and freed with the rest of the list.
+        auto * removed = path1;
         if (path1 == aAttributePaths)
         {
             aAttributePaths = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = aAttributePaths;
+            path1           = aAttributePaths;
         }
         else
         {
             prev->mpNext = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = prev->mpNext;
+            path1        = prev->mpNext;
+        }
+        if (apArena == nullptr)
+        {
+            mAttributePathPool.ReleaseObject(removed);
         }
     }
 }
 
-void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList)
+void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList, PathArena * apArena)
 {
-    ReleasePool(aEventPathList, mEventPathPool);
+    mEventPathCount -= (aEventPathList == nullptr) ? 0 : aEventPathList->Count();
+    ReleasePool(aEventPathList, mEventPathPool, apArena);
 }
 
 CHIP_ERROR InteractionModelEngine::PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList,
-                                                                EventPathParams & aEventPath)
+                                                                EventPathParams & aEventPath, PathArena * apArena)
 {
-    CHIP_ERROR err = PushFront(aEventPathList, aEventPath, mEventPathPool);
+    CHIP_ERROR err = PushFront(aEventPathList, aEventPath, mEventPathPool, apArena);
     if (err == CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(InteractionModel, "EventPath pool full");
         return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
     }
+    if (err == CHIP_NO_ERROR)
+    {
+        mEventPathCount++;
+    }
     return err;
 }
 
-void InteractionModelEngine::ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList)
+void InteractionModelEngine::ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
+                                                          PathArena * apArena)
 {
-    ReleasePool(aDataVersionFilterList, mDataVersionFilterPool);
+    ReleasePool(aDataVersionFilterList, mDataVersionFilterPool, apArena);
 }
 
 CHIP_ERROR InteractionModelEngine::PushFrontDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
-                                                                  DataVersionFilter & aDataVersionFilter)
+                                                                  DataVersionFilter & aDataVersionFilter, PathArena * apArena)
 {
-    CHIP_ERROR err = PushFront(aDataVersionFilterList, aDataVersionFilter, mDataVersionFilterPool);
+    CHIP_ERROR err = PushFront(aDataVersionFilterList, aDataVersionFilter, mDataVersionFilterPool, apArena);
     if (err == CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(InteractionModel, "DataVersionFilter pool full, ignore this filter");
@@ -1713,8 +1736,15 @@ CHIP_ERROR InteractionModelEngine::PushFrontDataVersionFilterList(SingleLinkedLi
 
 template <typename T, size_t N>
 void InteractionModelEngine::ReleasePool(SingleLinkedListNode<T> *& aObjectList,
-                                         ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool)
+                                         ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool, PathArena * apArena)
 {
+    if (apArena != nullptr)
+    {
+        apArena->Release();
+        aObjectList = nullptr;
+        return;
+    }
+
     SingleLinkedListNode<T> * current = aObjectList;
     while (current != nullptr)
     {
@@ -1728,9 +1758,10 @@ void InteractionModelEngine::ReleasePool(SingleLinkedListNode<T> *& aObjectList,
 
 template <typename T, size_t N>
 CHIP_ERROR InteractionModelEngine::PushFront(SingleLinkedListNode<T> *& aObjectList, T & aData,
-                                             ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool)
+                                             ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool, PathArena * apArena)
 {
-    SingleLinkedListNode<T> * object = aObjectPool.CreateObject();
+    SingleLinkedListNode<T> * object =
+        (apArena != nullptr) ? apArena->New<SingleLinkedListNode<T>>() : aObjectPool.CreateObject();
     if (object == nullptr)
     {
         return CHIP_ERROR_NO_MEMORY;
@@ -1762,6 +1793,12 @@ void InteractionModelEngine::DispatchCommand(CommandHandlerImpl & apCommandObj,
     }
 }
 
+DataModel::InvokeDispatchPolicy InteractionModelEngine::GetDispatchPolicy(const ConcreteCommandPath & aCommandPath)
+{
+    VerifyOrReturnValue(mDataModelProvider != nullptr, DataModel::InvokeDispatchPolicy());
+    return mDataModelProvider->GetInvokeDispatchPolicy(aCommandPath);
+}
+
 Protocols::InteractionModel::Status InteractionModelEngine::ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request)
 {
 
@@ -2100,20 +2137,14 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
     imEngine->mSubscriptionResumptionScheduled = false;
     bool resumedSubscriptions                  = false;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    CHIP_ERROR err = CHIP_NO_ERROR;
     SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo;
     AutoReleaseSubscriptionInfoIterator iterator(imEngine->mpSubscriptionResumptionStorage->IterateSubscriptions());
+    const LiveSubscriptionIds liveSubscriptionIds(*imEngine);
     while (iterator->Next(subscriptionInfo))
     {
         // If subscription happens between reboot and this timer callback, it's already live and should skip resumption
-        if (Loop::Break == imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
-                SubscriptionId subscriptionId;
-                handler->GetSubscriptionId(subscriptionId);
-                if (subscriptionId == subscriptionInfo.mSubscriptionId)
-                {
-                    return Loop::Break;
-                }
-                return Loop::Continue;
-            }))
+        if (liveSubscriptionIds.Contains(subscriptionInfo.mSubscriptionId))
         {
             ChipLogProgress(InteractionModel, "Skip resuming live subscriptionId %" PRIu32, subscriptionInfo.mSubscriptionId);
             continue;
@@ -2123,21 +2154,38 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
         if (subscriptionResumptionSessionEstablisher == nullptr)
         {
             ChipLogProgress(InteractionModel, "Failed to create SubscriptionResumptionSessionEstablisher");
-            return;
+            err = CHIP_ERROR_NO_MEMORY;
+            break;
         }
 
-        if (subscriptionResumptionSessionEstablisher->ResumeSubscription(*imEngine->mpCASESessionMgr, subscriptionInfo) !=
-            CHIP_NO_ERROR)
+        err = subscriptionResumptionSessionEstablisher->Init(subscriptionInfo);
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogProgress(InteractionModel, "Failed to ResumeSubscription 0x%" PRIx32, subscriptionInfo.mSubscriptionId);
-            return;
+            break;
         }
-        subscriptionResumptionSessionEstablisher.release();
+        imEngine->QueueSubscriptionResumption(subscriptionResumptionSessionEstablisher.release());
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
         resumedSubscriptions = true;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     }
 
+    // Whatever could be queued is resumed, even if a later subscription failed to be queued.
+    if (!imEngine->mPendingSubscriptionResumptions.Empty() && !imEngine->mSubscriptionResumptionInProgress)
+    {
+        uint32_t peerCount = imEngine->mSubscriptionResumptionMetrics.peersQueued;
+        ChipLogProgress(InteractionModel, "Resuming subscriptions of %" PRIu32 " subscribers", peerCount);
+        MATTER_LOG_METRIC(Tracing::kMetricSubscriptionResumptionPeerCount, peerCount);
+        MATTER_LOG_METRIC_BEGIN(Tracing::kMetricSubscriptionResumption);
+
+        imEngine->mSubscriptionResumptionInProgress      = true;
+        imEngine->mSubscriptionResumptionStartTime       = System::SystemClock().GetMonotonicTimestamp();
+        imEngine->mSubscriptionResumptionMetrics.resumed = 0;
+        imEngine->mSubscriptionResumptionMetrics.failed  = 0;
+    }
+    imEngine->StartQueuedSubscriptionResumptions();
+    VerifyOrReturn(err == CHIP_NO_ERROR);
+
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     // If no persisted subscriptions needed resumption then all resumption retries are done
     if (!resumedSubscriptions)
@@ -2176,17 +2224,10 @@ bool InteractionModelEngine::HasSubscriptionsToResume()
     SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo;
     auto * iterator                = mpSubscriptionResumptionStorage->IterateSubscriptions();
     bool foundSubscriptionToResume = false;
+    const LiveSubscriptionIds liveSubscriptionIds(*this);
     while (iterator->Next(subscriptionInfo))
     {
-        if (Loop::Break == mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
-                SubscriptionId subscriptionId;
-                handler->GetSubscriptionId(subscriptionId);
-                if (subscriptionId == subscriptionInfo.mSubscriptionId)
-                {
-                    return Loop::Break;
-                }
-                return Loop::Continue;
-            }))
+        if (liveSubscriptionIds.Contains(subscriptionInfo.mSubscriptionId))
         {
             continue;
         }
@@ -2201,6 +2242,112 @@ bool InteractionModelEngine::HasSubscriptionsToResume()
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+InteractionModelEngine::LiveSubscriptionIds::LiveSubscriptionIds(InteractionModelEngine & engine) : mEngine(engine)
+{
+    mEngine.mReadHandlers.ForEachActiveObject([this](ReadHandler * handler) {
+        SubscriptionId subscriptionId;
+        handler->GetSubscriptionId(subscriptionId);
+        mComplete = mIds.Insert(subscriptionId);
+        return mComplete ? Loop::Continue : Loop::Break;
+    });
+}
+
+bool InteractionModelEngine::LiveSubscriptionIds::Contains(SubscriptionId subscriptionId) const
+{
+    VerifyOrReturnValue(!mIds.Contains(subscriptionId), true);
+    VerifyOrReturnValue(!mComplete, false);
+
+    return Loop::Break == mEngine.mReadHandlers.ForEachActiveObject([subscriptionId](ReadHandler * handler) {
+        SubscriptionId handlerSubscriptionId;
+        handler->GetSubscriptionId(handlerSubscriptionId);
+        return handlerSubscriptionId == subscriptionId ? Loop::Break : Loop::Continue;
+    });
+}
+
+void InteractionModelEngine::QueueSubscriptionResumption(SubscriptionResumptionSessionEstablisher * establisher)
+{
+    for (auto & pending : mPendingSubscriptionResumptions)
+    {
+        if (pending.GetPeer() == establisher->GetPeer())
+        {
+            pending.AddToPeerGroup(establisher);
+            return;
+        }
+    }
+    mPendingSubscriptionResumptions.PushBack(establisher);
+    mSubscriptionResumptionMetrics.peersQueued++;
+}
+
+void InteractionModelEngine::StartQueuedSubscriptionResumptions()
+{
+    VerifyOrReturn(!mStartingSubscriptionResumptions);
+    mStartingSubscriptionResumptions = true;
+
+    while (!mPendingSubscriptionResumptions.Empty() &&
+           mSubscriptionResumptionMetrics.peersInProgress < CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS)
+    {
+        SubscriptionResumptionSessionEstablisher & establisher = *mPendingSubscriptionResumptions.begin();
+        mPendingSubscriptionResumptions.Remove(&establisher);
+        mSubscriptionResumptionMetrics.peersQueued--;
+        mSubscriptionResumptionMetrics.peersInProgress++;
+
+        // May complete synchronously, and delete the establisher, if a session to the peer already exists.
+        establisher.EstablishSession(*mpCASESessionMgr);
+    }
+
+    mStartingSubscriptionResumptions = false;
+
+    if (mSubscriptionResumptionInProgress && mPendingSubscriptionResumptions.Empty() &&
+        mSubscriptionResumptionMetrics.peersInProgress == 0)
+    {
+        mSubscriptionResumptionInProgress           = false;
+        mSubscriptionResumptionMetrics.lastDuration = std::chrono::duration_cast<System::Clock::Milliseconds64>(
+            System::SystemClock().GetMonotonicTimestamp() - mSubscriptionResumptionStartTime);
+        MATTER_LOG_METRIC_END(Tracing::kMetricSubscriptionResumption);
+        ChipLogProgress(InteractionModel, "Resumed subscriptions in %" PRIu64 " ms: %" PRIu32 " resumed, %" PRIu32 " failed",
+                        mSubscriptionResumptionMetrics.lastDuration.count(), mSubscriptionResumptionMetrics.resumed,
+                        mSubscriptionResumptionMetrics.failed);
+    }
+}
+
+void InteractionModelEngine::OnSubscriptionResumptionPeerDone(size_t subscriptionCount, CHIP_ERROR error)
+{
+    VerifyOrReturn(mSubscriptionResumptionMetrics.peersInProgress > 0);
+    mSubscriptionResumptionMetrics.peersInProgress--;
+    if (error == CHIP_NO_ERROR)
+    {
+        mSubscriptionResumptionMetrics.resumed += static_cast<uint32_t>(subscriptionCount);
+    }
+    else
+    {
+        mSubscriptionResumptionMetrics.failed += static_cast<uint32_t>(subscriptionCount);
+    }
+
+    // When called from within StartQueuedSubscriptionResumptions, its loop starts the next peer.
+    StartQueuedSubscriptionResumptions();
+}
+
+void InteractionModelEngine::ReleaseQueuedSubscriptionResumptions()
+{
+    while (!mPendingSubscriptionResumptions.Empty())
+    {
+        SubscriptionResumptionSessionEstablisher & establisher = *mPendingSubscriptionResumptions.begin();
+        mPendingSubscriptionResumptions.Remove(&establisher);
+        establisher.DeletePeerGroup();
+    }
+    // Sessions being established still resume their subscriptions when done, but are no longer counted.
+    mSubscriptionResumptionMetrics.peersQueued     = 0;
+    mSubscriptionResumptionMetrics.peersInProgress = 0;
+
+    if (mSubscriptionResumptionInProgress)
+    {
+        mSubscriptionResumptionInProgress = false;
+        MATTER_LOG_METRIC_END(Tracing::kMetricSubscriptionResumption, CHIP_ERROR_CANCELLED);
+        ChipLogProgress(InteractionModel, "Stopped resuming subscriptions: %" PRIu32 " resumed, %" PRIu32 " failed",
+                        mSubscriptionResumptionMetrics.resumed, mSubscriptionResumptionMetrics.failed);
+    }
+}
+
 void InteractionModelEngine::DecrementNumSubscriptionsToResume()
 {
     VerifyOrReturn(mNumOfSubscriptionsToResume > 0);
@@ -57,6 +57,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/FixedHashMap.h>
 #include <lib/support/LinkedList.h>
 #include <lib/support/Pool.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -201,23 +202,28 @@ public:
 
     reporting::ReportScheduler * GetReportScheduler() { return mReportScheduler; }
 
-    void ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList);
+    // The nodes of path and filter lists come from `apArena` when one is given (it is then released with the list), and from
+    // the pools of the engine otherwise. A list must always be used with the same arena, or with none.
+    void ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList, PathArena * apArena = nullptr);
 
     CHIP_ERROR PushFrontAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
-                                          AttributePathParams & aAttributePath);
+                                          AttributePathParams & aAttributePath, PathArena * apArena = nullptr);
 
     // If a concrete path indicates an attribute that is also referenced by a wildcard path in the request,
     // the path SHALL be removed from the list.
-    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
+    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                              PathArena * apArena = nullptr);
 
-    void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
+    void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList, PathArena * apArena = nullptr);
 
-    CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath);
+    CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath,
+                                            PathArena * apArena = nullptr);
 
-    void ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList);
+    void ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
+                                      PathArena * apArena = nullptr);
 
     CHIP_ERROR PushFrontDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
-                                              DataVersionFilter & aDataVersionFilter);
+                                              DataVersionFilter & aDataVersionFilter, PathArena * apArena = nullptr);
 
     /*
      * Register an application callback to be notified of notable events when handling reads/subscribes.
@@ -338,6 +344,18 @@ public:
      */
     void ResetNumSubscriptionsRetries();
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
+    struct SubscriptionResumptionMetrics
+    {
+        uint32_t peersQueued     = 0; // Peers waiting for their session to be established.
+        uint32_t peersInProgress = 0; // Peers whose session is being established.
+        uint32_t resumed         = 0; // Subscriptions of the current pass whose session was established.
+        uint32_t failed          = 0; // Subscriptions of the current pass whose session could not be established.
+        // Time from the start of the last complete resumption pass until its last peer was done.
+        System::Clock::Milliseconds64 lastDuration = System::Clock::kZero;
+    };
+
+    const SubscriptionResumptionMetrics & GetSubscriptionResumptionMetrics() const { return mSubscriptionResumptionMetrics; }
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -353,6 +371,14 @@ public:
     //
     void SetConfigMaxFabrics(int32_t sz) { mMaxNumFabricsOverride = sz; }
 
+    //
+    // Override the command path registry, and with it the number of paths per invoke, of the invoke interactions
+    // started from now on. The registry is shared by those interactions, so only one can be in progress at a time.
+    //
+    // If nullptr is passed in, no override is instituted and default behavior resumes.
+    //
+    void SetCommandPathRegistryOverride(CommandPathRegistry * apRegistry) { mCommandPathRegistryOverride = apRegistry; }
+
     //
     // Override the maximal capacity of the underlying read handler pool to mimic
     // out of memory scenarios in unit-tests. You need to SetConfigMaxFabrics to make GetGuaranteedReadRequestsPerFabric
@@ -524,6 +550,8 @@ private:
 
     Protocols::InteractionModel::Status ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request) override;
 
+    DataModel::InvokeDispatchPolicy GetDispatchPolicy(const ConcreteCommandPath & aCommandPath) override;
+
     bool HasActiveRead();
 
     inline size_t GetPathPoolCapacityForReads() const
@@ -641,9 +669,11 @@ private:
     static void ResumeSubscriptionsTimerCallback(System::Layer * apSystemLayer, void * apAppState);
 
     template <typename T, size_t N>
-    void ReleasePool(SingleLinkedListNode<T> *& aObjectList, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool);
+    void ReleasePool(SingleLinkedListNode<T> *& aObjectList, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool,
+                     PathArena * apArena);
     template <typename T, size_t N>
-    CHIP_ERROR PushFront(SingleLinkedListNode<T> *& aObjectList, T & aData, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool);
+    CHIP_ERROR PushFront(SingleLinkedListNode<T> *& aObjectList, T & aData, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool,
+                         PathArena * apArena);
 
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
 
@@ -683,6 +713,9 @@ private:
                CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
         mDataVersionFilterPool;
 
+    // Number of event paths in all the event path lists, whether they come from mEventPathPool or from an arena.
+    size_t mEventPathCount = 0;
+
     ObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mReadHandlers;
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -700,6 +733,8 @@ private:
 
     int mMaxNumFabricsOverride = -1;
 
+    CommandPathRegistry * mCommandPathRegistryOverride = nullptr;
+
     // We won't limit the handler used per fabric on platforms that are using heap for memory pools, so we introduces a flag to
     // enforce such check based on the configured size. This flag is used for unit tests only, there is another compare time flag
     // CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK for stress tests.
@@ -723,6 +758,41 @@ private:
     uint32_t mNumSubscriptionResumptionRetries = 0;
     bool mSubscriptionResumptionScheduled      = false;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+
+    /**
+     * Subscription ids of the live subscriptions, collected once so that each persisted subscription can be checked
+     * without walking the read handlers. If there are more live subscriptions than CHIP_IM_MAX_NUM_SUBSCRIPTIONS, which
+     * only heap-backed pools allow, Contains falls back to that walk.
+     */
+    class LiveSubscriptionIds
+    {
+    public:
+        explicit LiveSubscriptionIds(InteractionModelEngine & engine);
+        bool Contains(SubscriptionId subscriptionId) const;
+
+    private:
+        InteractionModelEngine & mEngine;
+        FixedHashSet<SubscriptionId, CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mIds;
+        bool mComplete = true;
+    };
+
+    /**
+     * Subscriptions to resume are grouped by peer, so that each peer gets a single session, and at most
+     * CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS sessions are established at the same time. The other peers
+     * wait in mPendingSubscriptionResumptions, in the order of the storage, until a session is done.
+     */
+    void QueueSubscriptionResumption(SubscriptionResumptionSessionEstablisher * establisher);
+    void StartQueuedSubscriptionResumptions();
+    void OnSubscriptionResumptionPeerDone(size_t subscriptionCount, CHIP_ERROR error);
+    void ReleaseQueuedSubscriptionResumptions();
+
+    IntrusiveList<SubscriptionResumptionSessionEstablisher, IntrusiveMode::AutoUnlink> mPendingSubscriptionResumptions;
+    SubscriptionResumptionMetrics mSubscriptionResumptionMetrics;
+    System::Clock::Timestamp mSubscriptionResumptionStartTime = System::Clock::kZero;
+    bool mSubscriptionResumptionInProgress                    = false;
+    // Set while StartQueuedSubscriptionResumptions is on the stack: a session that is already established completes
+    // synchronously, and must not start the next peers from within the loop.
+    bool mStartingSubscriptionResumptions = false;
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
     FabricTable * mpFabricTable = nullptr;
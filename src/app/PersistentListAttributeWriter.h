@@ -0,0 +1,229 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributeValueDecoder.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model/DecodableList.h>
+#include <app/data-model/FabricScoped.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/PersistentList.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Streams the writes of a list attribute into a PersistentList, one element at a time.
+ *
+ * The interaction model delivers a list write as a series of writes of the same attribute (a ReplaceAll followed by
+ * AppendItem writes when the list is chunked), bracketed by list write begin/end notifications. This persists every
+ * element as it is received, and commits the new list only once the end notification reports a successful write, so
+ * that:
+ *   - a list write needs memory for one element, however long the list is;
+ *   - a write that fails partway (an invalid element, a full list, a dropped chunk) leaves the stored list untouched.
+ *
+ * Call Write from AttributeAccessInterface::Write (or ServerClusterInterface::WriteAttribute) for the list attribute,
+ * and OnListWriteEnd from AttributeAccessInterface::OnListWriteEnd (or ListAttributeWriteNotification).
+ *
+ * `kMaxElementSize` is the largest serialized element. `serialize` is called as
+ * `CHIP_ERROR serialize(const ElementType & element, MutableByteSpan & out)`: it validates the element (returning an
+ * IM status error, e.g. ConstraintError, if it is invalid) and serializes it into `out`, resizing it.
+ *
+ * For a fabric-scoped list, each stored element is prefixed with the index of its fabric: a ReplaceAll only replaces the
+ * elements of the accessing fabric, keeping those of the other fabrics. Read the elements back with ReadElement, and call
+ * RemoveFabric when a fabric is removed.
+ */
+template <typename ElementType, size_t kMaxElementSize>
+class PersistentListAttributeWriter
+{
+public:
+    static constexpr bool kIsFabricScoped = DataModel::IsFabricScoped<ElementType>::value;
+    /// Size of an element as stored in the PersistentList.
+    static constexpr size_t kMaxStoredElementSize = kMaxElementSize + (kIsFabricScoped ? 1 : 0);
+
+    explicit PersistentListAttributeWriter(PersistentList & list) : mList(list) {}
+
+    /**
+     * Read an element of the committed list, as passed to the serializer when it was written.
+     *
+     * @param[in]  aIndex       index of the element in the list.
+     * @param[in]  aBuffer      buffer of at least kMaxStoredElementSize bytes.
+     * @param[out] aElement     the serialized element, within aBuffer.
+     * @param[out] aFabricIndex the fabric of the element, kUndefinedFabricIndex if the list is not fabric-scoped.
+     */
+    static CHIP_ERROR ReadElement(const PersistentList & list, uint16_t aIndex, MutableByteSpan aBuffer, ByteSpan & aElement,
+                                  FabricIndex & aFabricIndex)
+    {
+        ReturnErrorOnFailure(list.Get(aIndex, aBuffer));
+        aFabricIndex = kUndefinedFabricIndex;
+        aElement     = aBuffer;
+        if constexpr (kIsFabricScoped)
+        {
+            VerifyOrReturnError(!aBuffer.empty(), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+            aFabricIndex = aBuffer[0];
+            aElement     = aElement.SubSpan(1);
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Serializer>
+    CHIP_ERROR Write(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder, Serializer && serialize)
+    {
+        if (aPath.IsListItemOperation())
+        {
+            VerifyOrReturnError(aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem,
+                                CHIP_IM_GLOBAL_STATUS(UnsupportedWrite));
+            if (!mList.IsWriting())
+            {
+                ReturnErrorOnFailure(mList.BeginAppend());
+            }
+
+            ElementType element;
+            ReturnErrorOnFailure(aDecoder.Decode(element));
+            return AppendElement(element, serialize);
+        }
+
+        DataModel::DecodableList<ElementType> list;
+        ReturnErrorOnFailure(aDecoder.Decode(list));
+
+        // A ReplaceAll starts a new list write, whatever is left from a previous one.
+        mList.Rollback();
+        ReturnErrorOnFailure(mList.BeginReplace());
+
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        if constexpr (kIsFabricScoped)
+        {
+            SuccessOrExit(err = KeepElementsOfOtherFabrics(aDecoder.AccessingFabricIndex()));
+        }
+
+        {
+            auto iter = list.begin();
+            while (err == CHIP_NO_ERROR && iter.Next())
+            {
+                err = AppendElement(iter.GetValue(), serialize);
+            }
+            SuccessOrExit(err);
+            SuccessOrExit(err = iter.GetStatus());
+        }
+
+        // Only list operations are followed by a list write end notification.
+        if (!aPath.IsListOperation())
+        {
+            err = mList.Commit();
+        }
+
+    exit:
+        if (err != CHIP_NO_ERROR && !aPath.IsListOperation())
+        {
+            mList.Rollback();
+        }
+        return err;
+    }
+
+    /// Commits the list write if it was successful, rolls it back otherwise.
+    CHIP_ERROR OnListWriteEnd(bool aWriteWasSuccessful)
+    {
+        VerifyOrReturnError(mList.IsWriting(), CHIP_NO_ERROR);
+        if (!aWriteWasSuccessful)
+        {
+            mList.Rollback();
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR err = mList.Commit();
+        if (err != CHIP_NO_ERROR)
+        {
+            mList.Rollback();
+        }
+        return err;
+    }
+
+    /**
+     * Remove the elements of aFabricIndex from the committed list, e.g. from FabricTable::Delegate::OnFabricRemoved.
+     * A list write in progress is abandoned.
+     */
+    CHIP_ERROR RemoveFabric(FabricIndex aFabricIndex)
+    {
+        static_assert(kIsFabricScoped, "Only the elements of fabric-scoped lists belong to a fabric");
+
+        mList.Rollback();
+        ReturnErrorOnFailure(mList.BeginReplace());
+
+        CHIP_ERROR err = KeepElementsOfOtherFabrics(aFabricIndex);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = mList.Commit();
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            mList.Rollback();
+        }
+        return err;
+    }
+
+private:
+    template <typename Serializer>
+    CHIP_ERROR AppendElement(const ElementType & element, Serializer & serialize)
+    {
+        uint8_t buffer[kMaxStoredElementSize];
+        MutableByteSpan serialized(buffer);
+        if constexpr (kIsFabricScoped)
+        {
+            // The decoder set the fabric index of the element to the accessing fabric.
+            buffer[0]  = element.GetFabricIndex();
+            serialized = serialized.SubSpan(1);
+        }
+        ReturnErrorOnFailure(serialize(element, serialized));
+
+        return AppendStored(ByteSpan(buffer, serialized.size() + (kIsFabricScoped ? 1 : 0)));
+    }
+
+    // Copy the committed elements that belong to another fabric than aFabricIndex into the list being written.
+    CHIP_ERROR KeepElementsOfOtherFabrics(FabricIndex aFabricIndex)
+    {
+        for (uint16_t index = 0; index < mList.Count(); index++)
+        {
+            uint8_t buffer[kMaxStoredElementSize];
+            MutableByteSpan stored(buffer);
+            ReturnErrorOnFailure(mList.Get(index, stored));
+            VerifyOrReturnError(!stored.empty(), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+            if (stored[0] != aFabricIndex)
+            {
+                ReturnErrorOnFailure(AppendStored(stored));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR AppendStored(ByteSpan aStored)
+    {
+        CHIP_ERROR err = mList.Append(aStored);
+        VerifyOrReturnError(err != CHIP_ERROR_NO_MEMORY, CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
+        return err;
+    }
+
+    PersistentList & mList;
+};
+
+} // namespace app
+} // namespace chip
@@ -42,6 +42,7 @@
 #include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/ChunkedArena.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
@@ -50,6 +51,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
+#include <system/SystemConfig.h>
 #include <system/SystemPacketBuffer.h>
 
 // https://github.com/CHIP-Specifications/connectedhomeip-spec/blob/61a9d19e6af12fdfb0872bcff26d19de6c680a1a/src/Ch02_Architecture.adoc#1122-subscribe-interaction-limits
@@ -72,6 +74,9 @@ class TestReportScheduler;
 class InteractionModelEngine;
 class TestInteractionModelEngine;
 
+/// Storage for the nodes of one path or filter list of a read or subscription, freed all at once with the list.
+using PathArena = ChunkedArena<CHIP_IM_PATH_ARENA_CHUNK_SIZE>;
+
 /**
  *  @class ReadHandler
  *
@@ -580,6 +585,22 @@ private:
     SingleLinkedListNode<EventPathParams> * mpEventPathList           = nullptr;
     SingleLinkedListNode<DataVersionFilter> * mpDataVersionFilterList = nullptr;
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // With heap pools, each list is allocated from its own arena instead of node by node: the data version filters are
+    // released after the priming report, the paths when the handler is destroyed.
+    PathArena mAttributePathArena;
+    PathArena mEventPathArena;
+    PathArena mDataVersionFilterArena;
+
+    PathArena * GetAttributePathArena() { return &mAttributePathArena; }
+    PathArena * GetEventPathArena() { return &mEventPathArena; }
+    PathArena * GetDataVersionFilterArena() { return &mDataVersionFilterArena; }
+#else
+    PathArena * GetAttributePathArena() { return nullptr; }
+    PathArena * GetEventPathArena() { return nullptr; }
+    PathArena * GetDataVersionFilterArena() { return nullptr; }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
     ManagementCallback & mManagementCallback;
 
     // TODO (#27675): Merge all observers into one and that one will dispatch the callbacks to the right place.
@@ -62,9 +62,15 @@ size_t SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::Coun
 
 bool SimpleSubscriptionResumptionStorage::SimpleSubscriptionInfoIterator::Next(SubscriptionInfo & output)
 {
+    if (mLoadBuffer.Get() == nullptr)
+    {
+        mLoadBuffer.Alloc(MaxSubscriptionSize());
+        VerifyOrReturnValue(mLoadBuffer.Get() != nullptr, false);
+    }
+
     for (; mNextIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; mNextIndex++)
     {
-        CHIP_ERROR err = mStorage.Load(mNextIndex, output);
+        CHIP_ERROR err = mStorage.Load(mNextIndex, output, MutableByteSpan(mLoadBuffer.Get(), MaxSubscriptionSize()));
         if (err == CHIP_NO_ERROR)
         {
             // increment index for the next call
@@ -142,14 +148,23 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(uint16_t subscriptionInde
 CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo)
 {
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-    backingBuffer.Calloc(MaxSubscriptionSize());
+    backingBuffer.Alloc(MaxSubscriptionSize());
     VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
 
+    return Load(subscriptionIndex, subscriptionInfo, MutableByteSpan(backingBuffer.Get(), MaxSubscriptionSize()));
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo,
+                                                     MutableByteSpan buffer)
+{
+    VerifyOrReturnError(buffer.size() >= MaxSubscriptionSize(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
     uint16_t len = static_cast<uint16_t>(MaxSubscriptionSize());
     ReturnErrorOnFailure(mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumption(subscriptionIndex).KeyName(),
-                                                   backingBuffer.Get(), len));
+                                                   buffer.data(), len));
 
-    TLV::ScopedBufferTLVReader reader(std::move(backingBuffer), len);
+    TLV::TLVReader reader;
+    reader.Init(buffer.data(), len);
 
     ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
 
@@ -334,10 +349,17 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
     // Find empty index or duplicate if exists
     uint16_t subscriptionIndex;
     uint16_t firstEmptySubscriptionIndex = CHIP_IM_MAX_NUM_SUBSCRIPTIONS; // initialize to out of bounds as "not set"
+
+    // The same buffer is used to load the existing subscriptions, and then to write the new one.
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Alloc(MaxSubscriptionSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
     for (subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
         SubscriptionInfo currentSubscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, currentSubscriptionInfo);
+        CHIP_ERROR err =
+            Load(subscriptionIndex, currentSubscriptionInfo, MutableByteSpan(backingBuffer.Get(), MaxSubscriptionSize()));
 
         // if empty and firstEmptySubscriptionIndex isn't set yet, then mark empty spot
         if ((firstEmptySubscriptionIndex == CHIP_IM_MAX_NUM_SUBSCRIPTIONS) && (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND))
@@ -369,10 +391,6 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(SubscriptionInfo & subscrip
     }
 
     // Now construct subscription state and save
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-    backingBuffer.Calloc(MaxSubscriptionSize());
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
     TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxSubscriptionSize());
 
     ReturnErrorOnFailure(Save(writer, subscriptionInfo));
@@ -394,11 +412,15 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricInde
     bool subscriptionFound   = false;
     CHIP_ERROR lastDeleteErr = CHIP_NO_ERROR;
 
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Alloc(MaxSubscriptionSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
     uint16_t remainingSubscriptionsCount = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
         SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
+        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo, MutableByteSpan(backingBuffer.Get(), MaxSubscriptionSize()));
 
         // delete match
         if (err == CHIP_NO_ERROR)
@@ -443,11 +465,15 @@ CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricInde
 {
     CHIP_ERROR deleteErr = CHIP_NO_ERROR;
 
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Alloc(MaxSubscriptionSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
     uint16_t count = 0;
     for (uint16_t subscriptionIndex = 0; subscriptionIndex < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; subscriptionIndex++)
     {
         SubscriptionInfo subscriptionInfo;
-        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo);
+        CHIP_ERROR err = Load(subscriptionIndex, subscriptionInfo, MutableByteSpan(backingBuffer.Get(), MaxSubscriptionSize()));
 
         if (err == CHIP_NO_ERROR)
         {
@@ -28,6 +28,8 @@
 #include <lib/core/TLV.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
 
 namespace chip {
 namespace app {
@@ -53,6 +55,9 @@ public:
 protected:
     CHIP_ERROR Save(TLV::TLVWriter & writer, SubscriptionInfo & subscriptionInfo);
     CHIP_ERROR Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo);
+    // Same as above, with a caller-provided buffer of at least MaxSubscriptionSize() bytes, so that a pass over all the
+    // subscriptions can reuse a single buffer.
+    CHIP_ERROR Load(uint16_t subscriptionIndex, SubscriptionInfo & subscriptionInfo, MutableByteSpan buffer);
     CHIP_ERROR Delete(uint16_t subscriptionIndex);
     uint16_t Count();
     CHIP_ERROR DeleteMaxCount();
@@ -68,6 +73,8 @@ protected:
     private:
         SimpleSubscriptionResumptionStorage & mStorage;
         uint16_t mNextIndex;
+        // Allocated on the first call to Next, and reused for all the subscriptions.
+        Platform::ScopedMemoryBuffer<uint8_t> mLoadBuffer;
     };
 
     static constexpr size_t MaxScopedNodeIdSize() { return TLV::EstimateStructOverhead(sizeof(NodeId), sizeof(FabricIndex)); }
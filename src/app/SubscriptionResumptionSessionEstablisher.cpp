@@ -40,9 +40,7 @@ SubscriptionResumptionSessionEstablisher::SubscriptionResumptionSessionEstablish
     mOnConnectedCallback(HandleDeviceConnected, this), mOnConnectionFailureCallback(HandleDeviceConnectionFailure, this)
 {}
 
-CHIP_ERROR
-SubscriptionResumptionSessionEstablisher::ResumeSubscription(
-    CASESessionManager & caseSessionManager, const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
+CHIP_ERROR SubscriptionResumptionSessionEstablisher::Init(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
 {
     mSubscriptionInfo.mNodeId         = subscriptionInfo.mNodeId;
     mSubscriptionInfo.mFabricIndex    = subscriptionInfo.mFabricIndex;
@@ -79,16 +77,82 @@ SubscriptionResumptionSessionEstablisher::ResumeSubscription(
         }
     }
 
-    ScopedNodeId peerNode = ScopedNodeId(mSubscriptionInfo.mNodeId, mSubscriptionInfo.mFabricIndex);
-    caseSessionManager.FindOrEstablishSession(peerNode, &mOnConnectedCallback, &mOnConnectionFailureCallback);
     return CHIP_NO_ERROR;
 }
 
+void SubscriptionResumptionSessionEstablisher::EstablishSession(CASESessionManager & caseSessionManager)
+{
+    caseSessionManager.FindOrEstablishSession(GetPeer(), &mOnConnectedCallback, &mOnConnectionFailureCallback);
+}
+
+CHIP_ERROR
+SubscriptionResumptionSessionEstablisher::ResumeSubscription(
+    CASESessionManager & caseSessionManager, const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
+{
+    ReturnErrorOnFailure(Init(subscriptionInfo));
+    EstablishSession(caseSessionManager);
+    return CHIP_NO_ERROR;
+}
+
+void SubscriptionResumptionSessionEstablisher::AddToPeerGroup(SubscriptionResumptionSessionEstablisher * establisher)
+{
+    VerifyOrDie(establisher->GetPeer() == GetPeer());
+
+    SubscriptionResumptionSessionEstablisher * last = this;
+    while (last->mpNextInPeerGroup != nullptr)
+    {
+        last = last->mpNextInPeerGroup;
+    }
+    last->mpNextInPeerGroup = establisher;
+}
+
+void SubscriptionResumptionSessionEstablisher::DeletePeerGroup()
+{
+    SubscriptionResumptionSessionEstablisher * establisher = this;
+    while (establisher != nullptr)
+    {
+        SubscriptionResumptionSessionEstablisher * next = establisher->mpNextInPeerGroup;
+        chip::Platform::Delete(establisher);
+        establisher = next;
+    }
+}
+
 void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
                                                                      const SessionHandle & sessionHandle)
 {
-    AutoDeleteEstablisher establisher(static_cast<SubscriptionResumptionSessionEstablisher *>(context));
-    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo = establisher->mSubscriptionInfo;
+    auto * establisher = static_cast<SubscriptionResumptionSessionEstablisher *>(context);
+    size_t resumed     = 0;
+    while (establisher != nullptr)
+    {
+        AutoDeleteEstablisher current(establisher);
+        establisher = establisher->mpNextInPeerGroup;
+        current->OnSessionEstablished(sessionHandle);
+        resumed++;
+    }
+    InteractionModelEngine::GetInstance()->OnSubscriptionResumptionPeerDone(resumed, CHIP_NO_ERROR);
+}
+
+void SubscriptionResumptionSessionEstablisher::HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId,
+                                                                             CHIP_ERROR error)
+{
+    ChipLogError(DataManagement, "Failed to establish CASE for subscription-resumption with error '%" CHIP_ERROR_FORMAT "'",
+                 error.Format());
+
+    auto * establisher = static_cast<SubscriptionResumptionSessionEstablisher *>(context);
+    size_t failed      = 0;
+    while (establisher != nullptr)
+    {
+        AutoDeleteEstablisher current(establisher);
+        establisher = establisher->mpNextInPeerGroup;
+        current->OnSessionFailure();
+        failed++;
+    }
+    InteractionModelEngine::GetInstance()->OnSubscriptionResumptionPeerDone(failed, error);
+}
+
+void SubscriptionResumptionSessionEstablisher::OnSessionEstablished(const SessionHandle & sessionHandle)
+{
+    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo = mSubscriptionInfo;
     InteractionModelEngine * imEngine                                  = InteractionModelEngine::GetInstance();
 
     // Decrement the number of subscriptions to resume since we have completed our retry attempt for a given subscription.
@@ -110,27 +174,24 @@ void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * cont
         ChipLogProgress(InteractionModel, "no resource for ReadHandler creation");
         return;
     }
-    readHandler->OnSubscriptionResumed(sessionHandle, *establisher);
+    readHandler->OnSubscriptionResumed(sessionHandle, *this);
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
-    // Reset the resumption retries to 0 if subscription is resumed
-    subscriptionInfo.mResumptionRetries = 0;
     imEngine->ResetNumSubscriptionsRetries();
+    // Reset the resumption retries to 0 if subscription is resumed. When they already are 0, as after a plain reboot, the
+    // stored subscription is unchanged: skip rewriting it, which would also load all the others.
     auto * subscriptionResumptionStorage = InteractionModelEngine::GetInstance()->GetSubscriptionResumptionStorage();
-    if (subscriptionResumptionStorage)
+    if (subscriptionResumptionStorage && subscriptionInfo.mResumptionRetries != 0)
     {
+        subscriptionInfo.mResumptionRetries = 0;
         subscriptionResumptionStorage->Save(subscriptionInfo);
     }
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 }
 
-void SubscriptionResumptionSessionEstablisher::HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId,
-                                                                             CHIP_ERROR error)
+void SubscriptionResumptionSessionEstablisher::OnSessionFailure()
 {
-    AutoDeleteEstablisher establisher(static_cast<SubscriptionResumptionSessionEstablisher *>(context));
     InteractionModelEngine * imEngine                                  = InteractionModelEngine::GetInstance();
-    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo = establisher->mSubscriptionInfo;
-    ChipLogError(DataManagement, "Failed to establish CASE for subscription-resumption with error '%" CHIP_ERROR_FORMAT "'",
-                 error.Format());
+    SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo = mSubscriptionInfo;
 
     // Decrement the number of subscriptions to resume since we have completed our retry attempt for a given subscription.
     // We do this here since we were not able to connect to the subscriber thus we have completed our resumption attempt.
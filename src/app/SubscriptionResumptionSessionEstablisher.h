@@ -20,6 +20,7 @@
 #include <app/AttributePathParams.h>
 #include <app/CASESessionManager.h>
 #include <app/SubscriptionResumptionStorage.h>
+#include <lib/support/IntrusiveList.h>
 
 namespace chip {
 namespace app {
@@ -29,16 +30,42 @@ namespace app {
  *  ResumeSubscription(), followed by the creation and intialization of a ReadHandler. This class helps prevent
  *  a scenario where all ReadHandlers in the pool grab the invalid session handle. In such scenario, if the device
  *  receives a new subscription request, it will crash as there is no evictable ReadHandler.
+ *
+ *  Establishers of subscriptions to the same peer can be grouped with AddToPeerGroup(): only the first one of the group
+ *  establishes a session, and all the subscriptions of the group are resumed on it (or fail with it).
  */
 
-class SubscriptionResumptionSessionEstablisher
+class SubscriptionResumptionSessionEstablisher : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     SubscriptionResumptionSessionEstablisher();
 
+    /**
+     * Copy the subscription to resume, without establishing the session yet.
+     */
+    CHIP_ERROR Init(const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+
+    /**
+     * Establish the session to the peer of the group, and resume the subscriptions of the group once it is established.
+     * The establishers of the group are deleted when done.
+     */
+    void EstablishSession(CASESessionManager & caseSessionManager);
+
     CHIP_ERROR ResumeSubscription(CASESessionManager & caseSessionManager,
                                   const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
 
+    ScopedNodeId GetPeer() const { return ScopedNodeId(mSubscriptionInfo.mNodeId, mSubscriptionInfo.mFabricIndex); }
+
+    /**
+     * Add an establisher for the same peer to the group of this one, which takes ownership of it.
+     */
+    void AddToPeerGroup(SubscriptionResumptionSessionEstablisher * establisher);
+
+    /**
+     * Delete this establisher and all the others of its group, without resuming their subscriptions.
+     */
+    void DeletePeerGroup();
+
     SubscriptionResumptionStorage::SubscriptionInfo mSubscriptionInfo;
 
 private:
@@ -47,9 +74,16 @@ private:
                                       const SessionHandle & sessionHandle);
     static void HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
 
+    // Resume, or give up on, the subscription of this establisher only.
+    void OnSessionEstablished(const SessionHandle & sessionHandle);
+    void OnSessionFailure();
+
     // Callbacks to handle server-initiated session success/failure
     chip::Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
     chip::Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
+
+    // Next establisher of the peer group.
+    SubscriptionResumptionSessionEstablisher * mpNextInPeerGroup = nullptr;
 };
 } // namespace app
 } // namespace chip
@@ -508,6 +508,16 @@ void Instance::InvokeCommand(HandlerContext & ctxt)
     }
 }
 
+CommandHandlerInterface::DispatchPolicy Instance::GetDispatchPolicy(const ConcreteCommandPath & aCommandPath) const
+{
+    DispatchPolicy policy;
+    // The instance handles a single asynchronous command at a time, and answers Busy to the commands that arrive while it
+    // is in progress: the commands that follow it in a batched invoke request wait for its response instead.
+    policy.concurrencySafe =
+        (aCommandPath.mCommandId != Commands::ScanNetworks::Id && aCommandPath.mCommandId != Commands::ConnectNetwork::Id);
+    return policy;
+}
+
 CHIP_ERROR Instance::Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder)
 {
     switch (aPath.mAttributeId)
@@ -28,11 +28,14 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/EventLogging.h>
+#include <app/PersistentListAttributeWriter.h>
 #include <app/server/Server.h>
 #include <app/util/attribute-storage.h>
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/core/TLV.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/PersistentList.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 
@@ -56,6 +59,9 @@ constexpr uint8_t kFabricSensitiveCharLength = 128;
 // The maximum length of the fabric sensitive integer list within the TestFabricScoped struct.
 constexpr uint8_t kFabricSensitiveIntListLength = 8;
 
+// The maximum length of a TestFabricScoped struct, as stored in persistent storage.
+constexpr size_t kListFabricScopedEntryLength = 256;
+
 // The maximum buffer size allowed in TestBatchHelperResponse
 constexpr uint16_t kTestBatchHelperResponseBufferMax = 800;
 
@@ -84,9 +90,9 @@ public:
 
     CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override;
     CHIP_ERROR Write(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder) override;
+    void OnListWriteEnd(const ConcreteAttributePath & aPath, bool aWriteWasSuccessful) override;
 
 private:
-    CHIP_ERROR WriteListFabricScopedListEntry(const Structs::TestFabricScoped::DecodableType & entry, size_t index);
 
     CHIP_ERROR ReadListInt8uAttribute(AttributeValueEncoder & aEncoder);
     CHIP_ERROR WriteListInt8uAttribute(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder);
@@ -134,10 +140,12 @@ Globals::Structs::TestGlobalStruct::Type gGlobalStructAttributeValue;
 NullableStruct::TypeInfo::Type gNullableStructAttributeValue;
 DataModel::Nullable<Globals::Structs::TestGlobalStruct::Type> gNullableGlobalStructAttributeValue;
 
-chip::app::Clusters::UnitTesting::Structs::TestFabricScoped::Type gListFabricScopedAttributeValue[kAttributeListLength];
-uint8_t gListFabricScoped_fabricSensitiveInt8uList[kAttributeListLength][kFabricSensitiveIntListLength];
-size_t gListFabricScopedAttributeLen = 0;
-char gListFabricScoped_fabricSensitiveCharBuf[kAttributeListLength][kFabricSensitiveCharLength];
+// The ListFabricScoped attribute is kept in persistent storage, and written one element at a time.
+using ListFabricScopedWriter =
+    PersistentListAttributeWriter<Structs::TestFabricScoped::DecodableType, kListFabricScopedEntryLength>;
+const StorageKeyName gListFabricScopedKeyPrefix = DefaultStorageKeyAllocator::UnitTestingListFabricScoped();
+PersistentList gListFabricScoped;
+ListFabricScopedWriter gListFabricScopedWriter(gListFabricScoped);
 
 //                                                     /16             /32             /48             /64
 const char sLongOctetStringBuf[513] = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef"  // 64
@@ -643,37 +651,34 @@ CHIP_ERROR TestAttrAccess::WriteGlobalStruct(AttributeValueDecoder & aDecoder)
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TestAttrAccess::ReadListFabricScopedAttribute(AttributeValueEncoder & aEncoder)
+// Fills aValue with aEntry, copying its integer list into aIntList.
+CHIP_ERROR ToListFabricScopedValue(const Structs::TestFabricScoped::DecodableType & aEntry,
+                                   Structs::TestFabricScoped::Type & aValue, uint8_t (&aIntList)[kFabricSensitiveIntListLength])
 {
-    return aEncoder.EncodeList([](const auto & encoder) -> CHIP_ERROR {
-        for (size_t index = 0; index < gListFabricScopedAttributeLen; index++)
-        {
-            ReturnErrorOnFailure(encoder.Encode(gListFabricScopedAttributeValue[index]));
-        }
+    aValue.fabricIndex                          = aEntry.fabricIndex;
+    aValue.fabricSensitiveInt8u                 = aEntry.fabricSensitiveInt8u;
+    aValue.optionalFabricSensitiveInt8u         = aEntry.optionalFabricSensitiveInt8u;
+    aValue.nullableFabricSensitiveInt8u         = aEntry.nullableFabricSensitiveInt8u;
+    aValue.nullableOptionalFabricSensitiveInt8u = aEntry.nullableOptionalFabricSensitiveInt8u;
+    aValue.fabricSensitiveCharString            = aEntry.fabricSensitiveCharString;
+    aValue.fabricSensitiveStruct                = aEntry.fabricSensitiveStruct;
+
+    auto intIter = aEntry.fabricSensitiveInt8uList.begin();
+    size_t i     = 0;
+    while (intIter.Next())
+    {
+        VerifyOrReturnError(i < kFabricSensitiveIntListLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+        aIntList[i++] = intIter.GetValue();
+    }
+    ReturnErrorOnFailure(intIter.GetStatus());
 
-        return CHIP_NO_ERROR;
-    });
+    aValue.fabricSensitiveInt8uList = DataModel::List<const uint8_t>(aIntList, i);
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TestAttrAccess::WriteListFabricScopedListEntry(const Structs::TestFabricScoped::DecodableType & entry, size_t index)
+CHIP_ERROR SerializeListFabricScopedEntry(const Structs::TestFabricScoped::DecodableType & entry, MutableByteSpan & out)
 {
-    VerifyOrReturnError(index < kAttributeListLength, CHIP_ERROR_BUFFER_TOO_SMALL);
-
-    //
-    // The fabric index in the entry has already been set to the right index
-    // by the decoder.
-    //
-    gListFabricScopedAttributeValue[index].fabricIndex = entry.fabricIndex;
-
-    gListFabricScopedAttributeValue[index].optionalFabricSensitiveInt8u         = entry.optionalFabricSensitiveInt8u;
-    gListFabricScopedAttributeValue[index].nullableFabricSensitiveInt8u         = entry.nullableFabricSensitiveInt8u;
-    gListFabricScopedAttributeValue[index].nullableOptionalFabricSensitiveInt8u = entry.nullableOptionalFabricSensitiveInt8u;
-
     VerifyOrReturnError(entry.fabricSensitiveCharString.size() < kFabricSensitiveCharLength, CHIP_ERROR_BUFFER_TOO_SMALL);
-    memcpy(gListFabricScoped_fabricSensitiveCharBuf[index], entry.fabricSensitiveCharString.data(),
-           entry.fabricSensitiveCharString.size());
-    gListFabricScopedAttributeValue[index].fabricSensitiveCharString =
-        CharSpan(gListFabricScoped_fabricSensitiveCharBuf[index], entry.fabricSensitiveCharString.size());
 
     //
     // For now, we're not permitting the SimpleStruct's contents to have valid strings, since that just
@@ -683,92 +688,88 @@ CHIP_ERROR TestAttrAccess::WriteListFabricScopedListEntry(const Structs::TestFab
     VerifyOrReturnError(entry.fabricSensitiveStruct.d.size() == 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(entry.fabricSensitiveStruct.e.size() == 0, CHIP_ERROR_INVALID_ARGUMENT);
 
-    gListFabricScopedAttributeValue[index].fabricSensitiveStruct = entry.fabricSensitiveStruct;
-    gListFabricScopedAttributeValue[index].fabricSensitiveInt8u  = entry.fabricSensitiveInt8u;
-
-    auto intIter = entry.fabricSensitiveInt8uList.begin();
-    size_t i     = 0;
-    while (intIter.Next())
-    {
-        VerifyOrReturnError(i < kFabricSensitiveIntListLength, CHIP_ERROR_BUFFER_TOO_SMALL);
-        gListFabricScoped_fabricSensitiveInt8uList[index][i++] = intIter.GetValue();
-    }
-    ReturnErrorOnFailure(intIter.GetStatus());
-
-    gListFabricScopedAttributeValue[index].fabricSensitiveInt8uList =
-        DataModel::List<uint8_t>(gListFabricScoped_fabricSensitiveInt8uList[index], i);
+    uint8_t intList[kFabricSensitiveIntListLength];
+    Structs::TestFabricScoped::Type value;
+    ReturnErrorOnFailure(ToListFabricScopedValue(entry, value, intList));
 
+    //
+    // The fabric index in the entry has already been set to the right index by the decoder; encoding for that fabric
+    // keeps the fabric-sensitive fields.
+    //
+    TLV::TLVWriter writer;
+    writer.Init(out);
+    ReturnErrorOnFailure(value.EncodeForRead(writer, TLV::AnonymousTag(), value.fabricIndex));
+    ReturnErrorOnFailure(writer.Finalize());
+    out.reduce_size(writer.GetLengthWritten());
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TestAttrAccess::WriteListFabricScopedAttribute(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder)
+CHIP_ERROR TestAttrAccess::ReadListFabricScopedAttribute(AttributeValueEncoder & aEncoder)
 {
-    if (!aPath.IsListItemOperation())
-    {
-        ListFabricScoped::TypeInfo::DecodableType list;
-
-        ReturnErrorOnFailure(aDecoder.Decode(list));
-
-        //
-        // Delete all existing entries matching the accessing fabric. This is achieved by 'shifting down'
-        // entries that don't match the accessing fabric into the slots occupied by the deleted entries.
-        //
-        size_t srcIndex = 0, dstIndex = 0;
-        while (srcIndex < gListFabricScopedAttributeLen)
+    return aEncoder.EncodeList([](const auto & encoder) -> CHIP_ERROR {
+        for (uint16_t index = 0; index < gListFabricScoped.Count(); index++)
         {
-            if (gListFabricScopedAttributeValue[srcIndex].fabricIndex != aDecoder.AccessingFabricIndex())
-            {
-                auto & dstEntry = gListFabricScopedAttributeValue[dstIndex];
-                auto & srcEntry = gListFabricScopedAttributeValue[srcIndex];
-
-                dstEntry = srcEntry;
-
-                //
-                // We copy the data referenced by spans over to the right slot in the backing buffers.
-                //
-                memcpy(gListFabricScoped_fabricSensitiveCharBuf[dstIndex], srcEntry.fabricSensitiveCharString.data(),
-                       srcEntry.fabricSensitiveCharString.size());
-                dstEntry.fabricSensitiveCharString =
-                    CharSpan(gListFabricScoped_fabricSensitiveCharBuf[dstIndex], srcEntry.fabricSensitiveCharString.size());
-
-                memcpy(gListFabricScoped_fabricSensitiveInt8uList[dstIndex], gListFabricScoped_fabricSensitiveInt8uList[srcIndex],
-                       srcEntry.fabricSensitiveInt8uList.size() * sizeof(uint8_t));
-                gListFabricScopedAttributeValue[dstIndex].fabricSensitiveInt8uList = DataModel::List<uint8_t>(
-                    gListFabricScoped_fabricSensitiveInt8uList[dstIndex], srcEntry.fabricSensitiveInt8uList.size());
-
-                dstIndex++;
-            }
-
-            srcIndex++;
+            uint8_t buffer[ListFabricScopedWriter::kMaxStoredElementSize];
+            ByteSpan serialized;
+            FabricIndex fabricIndex;
+            ReturnErrorOnFailure(
+                ListFabricScopedWriter::ReadElement(gListFabricScoped, index, MutableByteSpan(buffer), serialized, fabricIndex));
+
+            TLV::TLVReader reader;
+            reader.Init(serialized);
+            ReturnErrorOnFailure(reader.Next());
+            Structs::TestFabricScoped::DecodableType entry;
+            ReturnErrorOnFailure(DataModel::Decode(reader, entry));
+
+            uint8_t intList[kFabricSensitiveIntListLength];
+            Structs::TestFabricScoped::Type value;
+            ReturnErrorOnFailure(ToListFabricScopedValue(entry, value, intList));
+            ReturnErrorOnFailure(encoder.Encode(value));
         }
 
-        size_t size;
-        ReturnErrorOnFailure(list.ComputeSize(&size));
+        return CHIP_NO_ERROR;
+    });
+}
 
-        auto iter = list.begin();
-        while (iter.Next())
-        {
-            auto & entry = iter.GetValue();
-            ReturnErrorOnFailure(WriteListFabricScopedListEntry(entry, dstIndex++));
-        }
+CHIP_ERROR TestAttrAccess::WriteListFabricScopedAttribute(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder)
+{
+    // A ReplaceAll only replaces the entries of the accessing fabric.
+    CHIP_ERROR err = gListFabricScopedWriter.Write(aPath, aDecoder, SerializeListFabricScopedEntry);
 
-        gListFabricScopedAttributeLen = dstIndex;
-        return iter.GetStatus();
-    }
-    if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
+    // A full list fails an append with INVALID_ARGUMENT, and a replace with BUFFER_TOO_SMALL, like the other lists of this
+    // cluster.
+    if (err == CHIP_IM_GLOBAL_STATUS(ResourceExhausted))
     {
-        VerifyOrReturnError(gListFabricScopedAttributeLen < kAttributeListLength, CHIP_ERROR_INVALID_ARGUMENT);
+        return (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem) ? CHIP_ERROR_INVALID_ARGUMENT
+                                                                                       : CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+    return err;
+}
 
-        Structs::TestFabricScoped::DecodableType listEntry;
-        ReturnErrorOnFailure(aDecoder.Decode(listEntry));
-        ReturnErrorOnFailure(WriteListFabricScopedListEntry(listEntry, gListFabricScopedAttributeLen));
+void TestAttrAccess::OnListWriteEnd(const ConcreteAttributePath & aPath, bool aWriteWasSuccessful)
+{
+    if (aPath.mAttributeId == ListFabricScoped::Id)
+    {
+        LogErrorOnFailure(gListFabricScopedWriter.OnListWriteEnd(aWriteWasSuccessful));
+    }
+}
 
-        gListFabricScopedAttributeLen++;
-        return CHIP_NO_ERROR;
+// Removes the ListFabricScoped entries of a fabric when the fabric is removed.
+class ListFabricScopedFabricTableDelegate : public FabricTable::Delegate
+{
+public:
+    void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override
+    {
+        CHIP_ERROR err = gListFabricScopedWriter.RemoveFabric(fabricIndex);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Zcl, "Failed to remove the ListFabricScoped entries of fabric %u: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(fabricIndex), err.Format());
+        }
     }
+};
 
-    return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-}
+ListFabricScopedFabricTableDelegate gListFabricScopedFabricDelegate;
 
 } // namespace
 
@@ -1185,6 +1186,13 @@ bool emberAfUnitTestingClusterGlobalEchoRequestCallback(CommandHandler * command
 
 void MatterUnitTestingPluginServerInitCallback()
 {
+    CHIP_ERROR err = gListFabricScoped.Init(&Server::GetInstance().GetPersistentStorage(), gListFabricScopedKeyPrefix.KeyName(),
+                                            kAttributeListLength);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Failed to load the ListFabricScoped attribute: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    Server::GetInstance().GetFabricTable().AddFabricDelegate(&gListFabricScopedFabricDelegate);
     AttributeAccessInterfaceRegistry::Instance().Register(&gAttrAccess);
 }
 
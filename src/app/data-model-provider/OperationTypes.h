@@ -21,6 +21,7 @@
 #include <app/ConcreteCommandPath.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/BitFlags.h>
+#include <system/SystemClock.h>
 
 #include <cstdint>
 #include <optional>
@@ -108,6 +109,24 @@ struct InvokeRequest : OperationRequest
     BitFlags<InvokeFlags> invokeFlags;
 };
 
+/// How a command is dispatched when it is part of a batched invoke request.
+///
+/// Whatever the policy, the responses of the commands of a request are sent in the order of the request.
+struct InvokeDispatchPolicy
+{
+    /// Whether the command may be dispatched while earlier commands of the same request are still awaiting their
+    /// (asynchronous) response, and lets the following commands be dispatched while it awaits its own.
+    ///
+    /// Commands that are not concurrency-safe are only dispatched once all the commands dispatched before them have
+    /// responded, and the following commands are not dispatched until they have responded. Handlers that keep state
+    /// across an asynchronous command, and cannot have several of those in progress at once, should use this.
+    bool concurrencySafe = true;
+
+    /// How long the command may take to respond once dispatched, or zero for no limit. When this runs out, the command
+    /// is responded to with a Timeout status and any later response from its handler is dropped.
+    System::Clock::Timeout timeout = System::Clock::kZero;
+};
+
 } // namespace DataModel
 } // namespace app
 } // namespace chip
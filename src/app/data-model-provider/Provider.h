@@ -72,6 +72,14 @@ public:
     ///        data allowed) or further encoding can be retried (AllowPartialData true for list encoding)
     virtual ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) = 0;
 
+    /// Whether the value of the attribute at `path` is kept in storage that versions it: every change of the value
+    /// either changes the data version of the cluster or drops the reports cached by the reporting engine. Values of
+    /// such attributes that were read at some data version may be reported again for as long as that version does not
+    /// change.
+    ///
+    /// The default is false, as values read through cluster code may change without a data version change.
+    virtual bool IsVersionedStorageAttribute(const ConcreteAttributePath & path) { return false; }
+
     /// Requests a write of an attribute.
     ///
     /// When this is invoked, caller is expected to have already done some validations:
@@ -117,6 +125,12 @@ public:
     virtual std::optional<ActionReturnStatus> InvokeCommand(const InvokeRequest & request, chip::TLV::TLVReader & input_arguments,
                                                             CommandHandler * handler) = 0;
 
+    /// How the command at `path` is dispatched when it is part of a batched invoke request.
+    ///
+    /// The default lets all the commands of a request be dispatched without waiting for each other's response, with
+    /// no timeout.
+    virtual InvokeDispatchPolicy GetInvokeDispatchPolicy(const ConcreteCommandPath & path) { return InvokeDispatchPolicy(); }
+
 protected:
     InteractionModelContext mContext = {};
 };
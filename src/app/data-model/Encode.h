@@ -23,6 +23,7 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/Optional.h>
 #include <lib/core/TLV.h>
+#include <lib/core/TLVCountingWriter.h>
 #include <protocols/interaction_model/Constants.h>
 
 #include <type_traits>
@@ -253,6 +254,34 @@ CHIP_ERROR EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricIndex acce
 #pragma GCC diagnostic pop
 }
 
+/*
+ * @brief
+ * Computes the number of bytes Encode() would write for the given value and tag, without
+ * writing them anywhere.
+ */
+template <typename X>
+CHIP_ERROR EncodedLength(TLV::Tag tag, const X & x, uint32_t & length)
+{
+    TLV::CountingTLVWriter writer;
+    ReturnErrorOnFailure(Encode(writer, tag, x));
+    length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * @brief
+ * Computes the number of bytes EncodeForRead() would write for the given value and tag, without
+ * writing them anywhere.
+ */
+template <typename X>
+CHIP_ERROR EncodedLengthForRead(TLV::Tag tag, FabricIndex accessingFabricIndex, const X & x, uint32_t & length)
+{
+    TLV::CountingTLVWriter writer;
+    ReturnErrorOnFailure(EncodeForRead(writer, tag, accessingFabricIndex, x));
+    length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
 } // namespace DataModel
 } // namespace app
 } // namespace chip
@@ -16,6 +16,7 @@
  */
 
 #include <app/icd/client/DefaultICDClientStorage.h>
+#include <algorithm>
 #include <iterator>
 #include <lib/core/Global.h>
 #include <lib/support/Base64.h>
@@ -395,6 +396,21 @@ CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
         static_cast<uint16_t>(len)));
 
     ReturnErrorOnFailure(IncreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
+    if (mClientInfoCacheLoaded)
+    {
+        // StoreEntry runs on every check-in, so a cached client is updated where it is to keep the order
+        // ProcessCheckInPayload has built up. A newly registered client is the most likely to check in next.
+        auto it = std::find_if(mClientInfoCache.begin(), mClientInfoCache.end(),
+                               [&clientInfo](const ICDClientInfo & info) { return info.peer_node == clientInfo.peer_node; });
+        if (it != mClientInfoCache.end())
+        {
+            *it = clientInfo;
+        }
+        else
+        {
+            mClientInfoCache.insert(mClientInfoCache.begin(), clientInfo);
+        }
+    }
     ChipLogProgress(ICD,
                     "Store ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId
                     " and checkin nodeId " ChipLogFormatScopedNodeId,
@@ -481,6 +497,7 @@ CHIP_ERROR DefaultICDClientStorage::DeleteEntry(const ScopedNodeId & peerNode)
                                            backingBuffer.Get(), static_cast<uint16_t>(len)));
 
     ReturnErrorOnFailure(DecreaseEntryCountForFabric(peerNode.GetFabricIndex()));
+    RemoveFromClientInfoCache(peerNode);
     ChipLogProgress(ICD, "Remove ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(peerNode));
     return CHIP_NO_ERROR;
@@ -502,6 +519,7 @@ CHIP_ERROR DefaultICDClientStorage::DeleteAllEntries(FabricIndex fabricIndex)
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricIndex).KeyName()));
     ReturnErrorOnFailure(
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricICDClientInfoCounter(fabricIndex).KeyName()));
+    RemoveFromClientInfoCache(fabricIndex);
 
     for (auto fabric = mFabricList.begin(); fabric != mFabricList.end(); fabric++)
     {
@@ -522,24 +540,60 @@ CHIP_ERROR DefaultICDClientStorage::DeleteAllEntries(FabricIndex fabricIndex)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DefaultICDClientStorage::EnsureClientInfoCacheLoaded()
+{
+    VerifyOrReturnError(!mClientInfoCacheLoaded, CHIP_NO_ERROR);
+
+    mClientInfoCache.clear();
+    for (auto & fabric_idx : mFabricList)
+    {
+        size_t clientInfoSize = 0;
+        ReturnErrorOnFailure(Load(fabric_idx, mClientInfoCache, clientInfoSize));
+    }
+    mClientInfoCacheLoaded = true;
+    return CHIP_NO_ERROR;
+}
+
+void DefaultICDClientStorage::RemoveFromClientInfoCache(const ScopedNodeId & peerNode)
+{
+    mClientInfoCache.erase(std::remove_if(mClientInfoCache.begin(), mClientInfoCache.end(),
+                                          [&peerNode](const ICDClientInfo & info) { return info.peer_node == peerNode; }),
+                           mClientInfoCache.end());
+}
+
+void DefaultICDClientStorage::RemoveFromClientInfoCache(FabricIndex fabricIndex)
+{
+    mClientInfoCache.erase(
+        std::remove_if(mClientInfoCache.begin(), mClientInfoCache.end(),
+                       [fabricIndex](const ICDClientInfo & info) { return info.peer_node.GetFabricIndex() == fabricIndex; }),
+        mClientInfoCache.end());
+}
+
 CHIP_ERROR DefaultICDClientStorage::ProcessCheckInPayload(const ByteSpan & payload, ICDClientInfo & clientInfo,
                                                           Protocols::SecureChannel::CounterType & counter)
 {
     uint8_t appDataBuffer[kAppDataLength];
     MutableByteSpan appData(appDataBuffer);
-    auto * iterator = IterateICDClientInfo();
-    VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
-    while (iterator->Next(clientInfo))
+    ReturnErrorOnFailure(EnsureClientInfoCacheLoaded());
+
+    for (auto it = mClientInfoCache.begin(); it != mClientInfoCache.end(); it++)
     {
         CHIP_ERROR err = chip::Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
-            clientInfo.aes_key_handle, clientInfo.hmac_key_handle, payload, counter, appData);
+            it->aes_key_handle, it->hmac_key_handle, payload, counter, appData);
         if (CHIP_NO_ERROR == err)
         {
-            iterator->Release();
+            // Move the matching entry one place towards the front, so that clients which check in more often than the
+            // others need fewer trial decryptions. Moving it all the way to the front would make every check-in of
+            // clients with the same check-in interval the most expensive one.
+            if (it != mClientInfoCache.begin())
+            {
+                std::iter_swap(it, it - 1);
+                it--;
+            }
+            clientInfo = *it;
             return CHIP_NO_ERROR;
         }
     }
-    iterator->Release();
     return CHIP_ERROR_NOT_FOUND;
 }
 
@@ -549,6 +603,8 @@ void DefaultICDClientStorage::Shutdown()
     mpClientInfoStore = nullptr;
     mpKeyStore        = nullptr;
     mFabricList.clear();
+    mClientInfoCache.clear();
+    mClientInfoCacheLoaded = false;
 }
 
 } // namespace app
@@ -129,6 +129,8 @@ public:
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     size_t GetFabricListSize() { return mFabricList.size(); }
 
+    size_t GetClientInfoCacheSize() { return mClientInfoCache.size(); }
+
     PersistentStorageDelegate * GetClientInfoStore() { return mpClientInfoStore; }
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
@@ -198,11 +200,24 @@ private:
     CHIP_ERROR SerializeToTlv(TLV::TLVWriter & writer, const std::vector<ICDClientInfo> & clientInfoVector);
     CHIP_ERROR Load(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector, size_t & clientInfoSize);
 
+    /**
+     * Populate mClientInfoCache from persistent storage if it has not been loaded yet.
+     */
+    CHIP_ERROR EnsureClientInfoCacheLoaded();
+    void RemoveFromClientInfoCache(const ScopedNodeId & peerNode);
+    void RemoveFromClientInfoCache(FabricIndex fabricIndex);
+
     ObjectPool<ICDClientInfoIteratorImpl, kIteratorsMax> mICDClientInfoIterators;
 
     PersistentStorageDelegate * mpClientInfoStore = nullptr;
     Crypto::SymmetricKeystore * mpKeyStore        = nullptr;
     std::vector<FabricIndex> mFabricList;
+
+    // In-memory copy of all persisted ICDClientInfos, used to match check-in messages without going through persistent
+    // storage. Each successful check-in moves its entry one place towards the front, so that clients which check in
+    // more often than the others are tried first when decrypting a check-in payload.
+    std::vector<ICDClientInfo> mClientInfoCache;
+    bool mClientInfoCacheLoaded = false;
 };
 } // namespace app
 } // namespace chip
@@ -18,6 +18,8 @@
 
 #include <access/AccessRestrictionProvider.h>
 #include <access/Privilege.h>
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
 #include <app/AppConfig.h>
 #include <app/AttributePathExpandIterator.h>
 #include <app/ConcreteEventPath.h>
@@ -60,8 +62,11 @@ using Protocols::InteractionModel::Status;
 ///
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
+///
+///   `info` is set to the metadata of the attribute, if the data model knows about it.
 std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
-                                                   const ConcreteReadAttributePath & path)
+                                                   const ConcreteReadAttributePath & path,
+                                                   std::optional<DataModel::AttributeEntry> & info)
 {
 
     RequestPath requestPath{ .cluster     = path.mClusterId,
@@ -71,7 +76,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
 
     DataModel::AttributeFinder finder(dataModel);
 
-    std::optional<DataModel::AttributeEntry> info = finder.Find(path);
+    info = finder.Find(path);
 
     // If the attribute exists, we know whether it is readable (readPrivilege has value)
     // and what the required access privilege is. However for attributes missing from the metatada
@@ -127,9 +132,45 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
     return err == CHIP_ERROR_ACCESS_DENIED ? CHIP_IM_GLOBAL_STATUS(UnsupportedAccess) : CHIP_IM_GLOBAL_STATUS(AccessRestricted);
 }
 
+/// Decides whether the value read for `path` may be served from a ReportFragmentCache and fills in `key` if so.
+///
+/// Only fresh (non-chunked) reads of attributes known to the data model are cached. The cache is keyed by data
+/// version, so only attributes whose storage versions their values are cached: values computed by cluster code may
+/// change without a data version change. Attributes that are not reported on change (`C` quality) are never cached,
+/// and values that depend on the accessing fabric are keyed by that fabric.
+bool GetReportFragmentCacheKey(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
+                               bool isFabricFiltered, const ConcreteReadAttributePath & path, DataVersion version,
+                               const DataModel::AttributeEntry & info, const AttributeEncodeState * encoderState,
+                               ReportFragmentCache::Key & key)
+{
+    using DataModel::AttributeQualityFlags;
+
+    if (encoderState != nullptr &&
+        (encoderState->AllowPartialData() || encoderState->CurrentEncodingListIndex() != kInvalidListIndex))
+    {
+        return false;
+    }
+    VerifyOrReturnValue(!info.HasFlags(AttributeQualityFlags::kChangesOmitted), false);
+    VerifyOrReturnValue(dataModel->IsVersionedStorageAttribute(path), false);
+
+    key.path        = path;
+    key.dataVersion = version;
+
+    // CurrentFabricIndex has no fabric qualities, but its value is the accessing fabric.
+    if (info.HasFlags(AttributeQualityFlags::kFabricScoped) || info.HasFlags(AttributeQualityFlags::kFabricSensitive) ||
+        (path.mClusterId == Clusters::OperationalCredentials::Id &&
+         path.mAttributeId == Clusters::OperationalCredentials::Attributes::CurrentFabricIndex::Id))
+    {
+        key.fabricIndex    = subjectDescriptor.fabricIndex;
+        key.fabricFiltered = isFabricFiltered;
+    }
+    return true;
+}
+
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
                                                   bool isFabricFiltered, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  ReportFragmentCache * cache)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
@@ -152,6 +193,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     else
     {
         ChipLogError(DataManagement, "Read request on unknown cluster - no data version available");
+        cache = nullptr;
     }
 
     TLV::TLVWriter checkpoint;
@@ -166,7 +208,8 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     //
     //       See https://github.com/project-chip/connectedhomeip/issues/37410
 
-    if (auto access_status = ValidateReadAttributeACL(dataModel, subjectDescriptor, path); access_status.has_value())
+    std::optional<DataModel::AttributeEntry> info;
+    if (auto access_status = ValidateReadAttributeACL(dataModel, subjectDescriptor, path, info); access_status.has_value())
     {
         status = *access_status;
     }
@@ -178,7 +221,29 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     }
     else
     {
-        status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+        ReportFragmentCache::Key cacheKey;
+        const bool cacheable = cache != nullptr && info.has_value() &&
+            GetReportFragmentCacheKey(dataModel, subjectDescriptor, isFabricFiltered, path, version, *info, encoderState, cacheKey);
+
+        if (cacheable && cache->Append(cacheKey, reportBuilder) == CHIP_NO_ERROR)
+        {
+            status = CHIP_NO_ERROR;
+        }
+        else
+        {
+            status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
+
+            // Keep what this read encoded for the next subscription, unless it did not end up contiguous in the report buffer.
+            if (cacheable && status.IsSuccess())
+            {
+                TLV::TLVWriter * writer = reportBuilder.GetWriter();
+                const uint32_t length   = writer->GetLengthWritten() - checkpoint.GetLengthWritten();
+                if (writer->GetWritePoint() == checkpoint.GetWritePoint() + length)
+                {
+                    cache->Store(cacheKey, ByteSpan(checkpoint.GetWritePoint(), length));
+                }
+            }
+        }
     }
 
     if (status.IsSuccess())
@@ -245,6 +310,9 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+#if CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES > 0
+    mReportFragmentCache.InvalidateAll();
+#endif
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -372,9 +440,17 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(),
-                                    apReadHandler->IsFabricFiltered(), attributeReportIBs, pathForRetrieval, &encodeState);
+            ReportFragmentCache * fragmentCache = nullptr;
+#if CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES > 0
+            // Subscriptions are the ones that repeatedly report the same values to several peers.
+            if (apReadHandler->IsType(ReadHandler::InteractionType::Subscribe))
+            {
+                fragmentCache = &mReportFragmentCache;
+            }
+#endif
+            DataModel::ActionReturnStatus status = RetrieveClusterData(
+                mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                attributeReportIBs, pathForRetrieval, &encodeState, fragmentCache);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -1052,6 +1128,8 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
+    InvalidateCachedReports(aAttributePath);
+
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
     mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
@@ -1148,7 +1226,7 @@ CHIP_ERROR Engine::NewEventGenerated(ConcreteEventPath & aPath, uint32_t aBytesC
     // we don't need to call schedule run for event.
     // If schedule run is called, actually we would not delivery events as well.
     // Just wanna save one schedule run here
-    if (mpImEngine->mEventPathPool.Allocated() == 0)
+    if (mpImEngine->mEventPathCount == 0)
     {
         return CHIP_NO_ERROR;
     }
@@ -1204,6 +1282,13 @@ void Engine::ScheduleUrgentEventDeliverySync(Optional<FabricIndex> fabricIndex)
     Run();
 }
 
+void Engine::InvalidateCachedReports(const AttributePathParams & aAttributePath)
+{
+#if CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES > 0
+    mReportFragmentCache.Invalidate(aAttributePath);
+#endif
+}
+
 void Engine::MarkDirty(const AttributePathParams & path)
 {
     CHIP_ERROR err = SetDirty(path);
@@ -29,6 +29,7 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/ReportFragmentCache.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -99,6 +100,12 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Drops the encoded reports cached for the attributes covered by aAttributePathParams. SetDirty does this too; this
+     * is for values that changed without their data version changing and without being marked dirty.
+     */
+    void InvalidateCachedReports(const AttributePathParams & aAttributePathParams);
+
     /*
      * Resets the tracker that tracks the currently serviced read handler.
      * apReadHandler can be non-null to indicate that the reset is due to a
@@ -283,6 +290,15 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+#if CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES > 0
+    /**
+     * Encoded attribute reports shared between subscriptions, see ReportFragmentCache. Entries covered by a
+     * dirty path are dropped in SetDirty, and in InvalidateCachedReports.
+     */
+    ReportFragmentCache::Entry mReportFragmentCacheEntries[CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES];
+    ReportFragmentCache mReportFragmentCache{ Span<ReportFragmentCache::Entry>(mReportFragmentCacheEntries) };
+#endif
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportFragmentCache.h>
+
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR ReportFragmentCache::Append(const Key & key, AttributeReportIBs::Builder & builder)
+{
+    Entry * entry = Find(key);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NOT_FOUND);
+    VerifyOrReturnError(entry->length != Entry::kOversized, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    entry->lastUsed = NextUseCounter();
+
+    TLV::TLVReader reader;
+    reader.Init(entry->data, entry->length);
+
+    TLV::TLVWriter * writer = builder.GetWriter();
+    TLV::TLVWriter checkpoint;
+    builder.Checkpoint(checkpoint);
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        err = writer->CopyElement(reader);
+        if (err != CHIP_NO_ERROR)
+        {
+            builder.Rollback(checkpoint);
+            return err;
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return CHIP_NO_ERROR;
+}
+
+void ReportFragmentCache::Store(const Key & key, ByteSpan encodedReports)
+{
+    VerifyOrReturn(!mEntries.empty());
+
+    Entry * entry = Find(key);
+    if (entry == nullptr)
+    {
+        entry = &LeastRecentlyUsed();
+    }
+
+    if (encodedReports.size() > sizeof(entry->data))
+    {
+        entry->Store(key, Entry::kOversized, NextUseCounter());
+        return;
+    }
+
+    memcpy(entry->data, encodedReports.data(), encodedReports.size());
+    entry->Store(key, static_cast<uint16_t>(encodedReports.size()), NextUseCounter());
+}
+
+void ReportFragmentCache::Invalidate(const AttributePathParams & path)
+{
+    for (auto & entry : mEntries)
+    {
+        if (!entry.IsEmpty() && path.IsAttributePathSupersetOf(entry.key.path))
+        {
+            entry.Clear();
+        }
+    }
+}
+
+void ReportFragmentCache::InvalidateAll()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+ReportFragmentCache::Entry * ReportFragmentCache::Find(const Key & key)
+{
+    for (auto & entry : mEntries)
+    {
+        if (!entry.IsEmpty() && entry.key == key)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+ReportFragmentCache::Entry & ReportFragmentCache::LeastRecentlyUsed()
+{
+    Entry * candidate = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if (entry.IsEmpty())
+        {
+            return entry;
+        }
+        if (entry.lastUsed < candidate->lastUsed)
+        {
+            candidate = &entry;
+        }
+    }
+    return *candidate;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
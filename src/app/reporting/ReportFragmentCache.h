@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Keeps the encoded AttributeReportIBs of recently reported attributes, so that several subscriptions reporting the
+ * same attribute at the same data version only read and encode it once.
+ *
+ * Entries are keyed by the concrete attribute path and the cluster data version. Values that depend on the accessing
+ * fabric are additionally keyed by the fabric index and fabric filtering of the read; callers are responsible for
+ * deciding which values fall into that category.
+ *
+ * The entries are provided by the owner of the cache, and replaced in least recently used order. A value that does not
+ * fit into an entry is remembered as oversized, so that further reports of the same version go straight to the data
+ * model.
+ */
+class ReportFragmentCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath path;
+        DataVersion dataVersion = 0;
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        bool fabricFiltered     = false;
+
+        bool operator==(const Key & other) const
+        {
+            return path == other.path && dataVersion == other.dataVersion && fabricIndex == other.fabricIndex &&
+                fabricFiltered == other.fabricFiltered;
+        }
+    };
+
+    /**
+     * Storage for one cached value. Only meant to be used by ReportFragmentCache.
+     */
+    struct Entry
+    {
+        static constexpr uint16_t kEmpty     = 0;
+        static constexpr uint16_t kOversized = UINT16_MAX;
+
+        Key key;
+        uint32_t lastUsed = 0;
+        uint16_t length   = kEmpty;
+        uint8_t data[CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE];
+
+        bool IsEmpty() const { return length == kEmpty; }
+        void Clear() { length = kEmpty; }
+        void Store(const Key & aKey, uint16_t aLength, uint32_t aLastUsed)
+        {
+            key      = aKey;
+            length   = aLength;
+            lastUsed = aLastUsed;
+        }
+    };
+
+    explicit ReportFragmentCache(Span<Entry> entries) : mEntries(entries) {}
+
+    /**
+     * Appends the cached AttributeReportIBs for `key` to `builder`.
+     *
+     * @retval CHIP_NO_ERROR               The cached reports were appended.
+     * @retval CHIP_ERROR_NOT_FOUND        Nothing is cached for `key`.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL The value for `key` is too large to be cached.
+     * @retval other                       Appending failed (e.g. out of space); `builder` is rolled back.
+     */
+    CHIP_ERROR Append(const Key & key, AttributeReportIBs::Builder & builder);
+
+    /**
+     * Keeps `encodedReports`, the AttributeReportIBs encoded by reading the value for `key`, in the entry for `key` or
+     * else in the least recently used entry. If they do not fit, `key` is recorded as oversized.
+     */
+    void Store(const Key & key, ByteSpan encodedReports);
+
+    /// Drops all entries for attributes covered by `path`.
+    void Invalidate(const AttributePathParams & path);
+
+    /// Drops all entries.
+    void InvalidateAll();
+
+private:
+    static_assert(CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE < Entry::kOversized, "Cache entry size must fit the length field");
+
+    Entry * Find(const Key & key);
+    Entry & LeastRecentlyUsed();
+    uint32_t NextUseCounter() { return ++mUseCounter; }
+
+    Span<Entry> mEntries;
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -131,6 +131,7 @@ public:
             mReadHandler = aReadHandler;
             SetIntervalTimeStamps(aReadHandler, now);
         }
+        ~ReadHandlerNode() { SetEngineRunScheduled(false); }
         ReadHandler * GetReadHandler() const { return mReadHandler; }
 
         /// @brief Check if the Node is reportable now, meaning its readhandler was made reportable by attribute dirtying and
@@ -152,7 +153,16 @@ public:
         bool IsEngineRunScheduled() const { return mFlags.Has(ReadHandlerNodeFlags::EngineRunScheduled); }
         void SetEngineRunScheduled(bool aEngineRunScheduled)
         {
+            VerifyOrReturn(aEngineRunScheduled != IsEngineRunScheduled());
             mFlags.Set(ReadHandlerNodeFlags::EngineRunScheduled, aEngineRunScheduled);
+            if (aEngineRunScheduled)
+            {
+                mScheduler->mNumEngineRunScheduledNodes++;
+            }
+            else
+            {
+                mScheduler->mNumEngineRunScheduledNodes--;
+            }
         }
         bool CanBeSynced() const { return mFlags.Has(ReadHandlerNodeFlags::CanBeSynced); }
         void SetCanBeSynced(bool aCanBeSynced) { mFlags.Set(ReadHandlerNodeFlags::CanBeSynced, aCanBeSynced); }
@@ -178,11 +188,16 @@ public:
         System::Clock::Timestamp GetMinTimestamp() const { return mMinTimestamp; }
         System::Clock::Timestamp GetMaxTimestamp() const { return mMaxTimestamp; }
 
+        /// @brief Timestamp at which the last timer started for this node is due to fire
+        System::Clock::Timestamp GetScheduledTimestamp() const { return mScheduledTimestamp; }
+        void SetScheduledTimestamp(const Timestamp & aScheduledTimestamp) { mScheduledTimestamp = aScheduledTimestamp; }
+
     private:
         ReadHandler * mReadHandler;
         ReportScheduler * mScheduler;
         Timestamp mMinTimestamp;
         Timestamp mMaxTimestamp;
+        Timestamp mScheduledTimestamp;
 
         BitFlags<ReadHandlerNodeFlags> mFlags;
     };
@@ -249,6 +264,9 @@ protected:
         return foundNode;
     }
 
+    /// @brief Number of nodes whose report timer fired and that are waiting for the reporting engine to run, kept up to date
+    /// by ReadHandlerNode::SetEngineRunScheduled.
+    uint32_t mNumEngineRunScheduledNodes = 0;
     ObjectPool<ReadHandlerNode, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mNodesPool;
     TimerDelegate * mTimerDelegate;
 };
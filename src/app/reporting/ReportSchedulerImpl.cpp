@@ -18,6 +18,9 @@
 #include <app/AppConfig.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/ReportSchedulerImpl.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
 
 namespace chip {
 namespace app {
@@ -30,6 +33,7 @@ using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
 /// the engine already verifies that read handlers are reportable before sending a report
 void ReportSchedulerImpl::ReportTimerCallback()
 {
+    RecordQueueDepth();
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
 }
 
@@ -95,6 +99,7 @@ void ReportSchedulerImpl::OnSubscriptionReportSent(ReadHandler * aReadHandler)
     // This method is called after the report is sent, so the ReadHandler is no longer reportable, and thus CanBeSynced and
     // EngineRunScheduled of the node associated with the ReadHandler are set to false here.
     node->SetCanBeSynced(false);
+    RecordReportLateness(node, now);
     node->SetIntervalTimeStamps(aReadHandler, now);
     Milliseconds32 newTimeout;
     // Reset the EngineRunScheduled flag so that the next report is scheduled correctly
@@ -118,6 +123,7 @@ CHIP_ERROR ReportSchedulerImpl::ScheduleReport(Timeout timeout, ReadHandlerNode
 {
     // Cancel Report if it is currently scheduled
     mTimerDelegate->CancelTimer(node);
+    node->SetScheduledTimestamp(now + timeout);
     if (timeout == Milliseconds32(0))
     {
         node->TimerFired();
@@ -143,6 +149,22 @@ void ReportSchedulerImpl::UnregisterAllHandlers()
     });
 }
 
+void ReportSchedulerImpl::RecordQueueDepth()
+{
+    mMetrics.maxQueueDepth = std::max(mMetrics.maxQueueDepth, mNumEngineRunScheduledNodes);
+    MATTER_LOG_METRIC(Tracing::kMetricReportSchedulerQueueDepth, mNumEngineRunScheduledNodes);
+}
+
+void ReportSchedulerImpl::RecordReportLateness(ReadHandlerNode * node, const Timestamp & now)
+{
+    VerifyOrReturn(now > node->GetMaxTimestamp());
+
+    Milliseconds32 lateness = std::chrono::duration_cast<Milliseconds32>(now - node->GetMaxTimestamp());
+    mMetrics.lateReports++;
+    mMetrics.maxLateness = std::max(mMetrics.maxLateness, lateness);
+    MATTER_LOG_METRIC(Tracing::kMetricReportSchedulerLateness, lateness.count());
+}
+
 bool ReportSchedulerImpl::IsReportScheduled(ReadHandler * aReadHandler)
 {
     ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
@@ -62,6 +62,19 @@ class ReportSchedulerImpl : public ReportScheduler
 public:
     using Timeout = System::Clock::Timeout;
 
+    /**
+     * @brief Reporting statistics gathered by the scheduler, also emitted as tracing metrics.
+     */
+    struct Metrics
+    {
+        /// Largest number of ReadHandlers waiting for an engine run at once when a report timer fired.
+        uint32_t maxQueueDepth = 0;
+        /// Number of subscription reports sent after the max interval of their subscription had elapsed.
+        uint32_t lateReports = 0;
+        /// Largest delay between the max interval of a subscription elapsing and its report being sent.
+        System::Clock::Milliseconds32 maxLateness = System::Clock::kZero;
+    };
+
     ReportSchedulerImpl(TimerDelegate * aTimerDelegate);
     ~ReportSchedulerImpl() override { UnregisterAllHandlers(); }
 
@@ -135,6 +148,9 @@ public:
 
     void ReportTimerCallback() override;
 
+    const Metrics & GetMetrics() const { return mMetrics; }
+    void ResetMetrics() { mMetrics = Metrics(); }
+
 protected:
     /**
      * @brief Schedule a report for the ReadHandler associated with a ReadHandlerNode.
@@ -151,8 +167,15 @@ protected:
     void CancelReport(ReadHandler * aReadHandler);
     virtual void UnregisterAllHandlers();
 
-private:
-    friend class chip::app::reporting::TestReportScheduler;
+    /**
+     * @brief Record the number of ReadHandlers whose report timer fired and that are waiting for an engine run in the metrics.
+     */
+    void RecordQueueDepth();
+
+    /**
+     * @brief Record how late a report was sent for a node, relative to its max timestamp, in the metrics.
+     */
+    void RecordReportLateness(ReadHandlerNode * node, const Timestamp & now);
 
     /**
      * @brief Find the next timestamp when a report should be scheduled for a ReadHandler.
@@ -165,6 +188,11 @@ private:
      *
      */
     virtual CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now);
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
+
+    Metrics mMetrics;
 };
 
 } // namespace reporting
@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/SpreadReportSchedulerImpl.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+using namespace System::Clock;
+
+CHIP_ERROR SpreadReportSchedulerImpl::CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now)
+{
+    ReturnErrorOnFailure(ReportSchedulerImpl::CalculateNextReportTimeout(timeout, aNode, now));
+
+    // Reports for dirty handlers (attribute changes, urgent events) go out as soon as the min interval allows. Only reports that
+    // are waiting for the max interval are placed in slots.
+    VerifyOrReturnError(timeout != Milliseconds32(0) && !IsReadHandlerReportable(aNode->GetReadHandler()), CHIP_NO_ERROR);
+
+    Timestamp earliest = std::max(now, aNode->GetMinTimestamp());
+    Timestamp target   = SelectSlot(aNode, earliest, now + timeout);
+    timeout            = std::chrono::duration_cast<Timeout>(target - now);
+
+    return CHIP_NO_ERROR;
+}
+
+SpreadReportSchedulerImpl::Timestamp SpreadReportSchedulerImpl::SelectSlot(ReadHandlerNode * aNode, const Timestamp & earliest,
+                                                                      const Timestamp & deadline)
+{
+    const uint64_t deadlineSlot = SlotIndex(deadline);
+
+    // occupancy[i] is the number of other nodes scheduled in the i-th slot before the deadline slot.
+    uint32_t occupancy[kSpreadSlots] = {};
+    mNodesPool.ForEachActiveObject([&](ReadHandlerNode * node) {
+        if (node != aNode && mTimerDelegate->IsTimerActive(node))
+        {
+            uint64_t slot = SlotIndex(node->GetScheduledTimestamp());
+            if (slot <= deadlineSlot && (deadlineSlot - slot) < kSpreadSlots)
+            {
+                occupancy[deadlineSlot - slot]++;
+            }
+        }
+        return Loop::Continue;
+    });
+
+    for (size_t i = 0; i < kSpreadSlots && i <= deadlineSlot; i++)
+    {
+        Timestamp slotStart = SlotStart(deadlineSlot - i);
+        if (slotStart < earliest)
+        {
+            break;
+        }
+        if (occupancy[i] < CHIP_IM_MAX_REPORTS_IN_FLIGHT)
+        {
+            return slotStart;
+        }
+    }
+
+    return deadline;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
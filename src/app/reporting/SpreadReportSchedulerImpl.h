@@ -0,0 +1,86 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <lib/core/CHIPConfig.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class SpreadReportSchedulerImpl
+ *
+ * @brief This class extends ReportSchedulerImpl to smooth out bursts of max interval reports.
+ *
+ * ## Scheduling Logic
+ *
+ * Like ReportSchedulerImpl, each node has its own timer, and nodes whose ReadHandler is reportable (dirty attributes or urgent
+ * events) are scheduled as soon as their min interval allows. Those reports are never delayed or moved.
+ *
+ * Nodes that are only waiting for their max interval are scheduled on time slots of CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS:
+ *
+ * - The node is scheduled at the start of the slot containing its max timestamp, so that subscriptions whose max interval
+ *   elapses close together are reported by the same engine run.
+ *
+ * - A slot holds at most CHIP_IM_MAX_REPORTS_IN_FLIGHT nodes, which is what a single engine run can send. If the slot is full,
+ *   the node is moved to an earlier slot, up to CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS slots back, but never before its min
+ *   timestamp.
+ *
+ * - If no slot within reach has room, the node is scheduled at its max timestamp.
+ *
+ * Reports are therefore always sent between the min and max intervals of the subscription, possibly up to
+ * CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS slots before the max interval.
+ */
+class SpreadReportSchedulerImpl : public ReportSchedulerImpl
+{
+public:
+    SpreadReportSchedulerImpl(TimerDelegate * aTimerDelegate) : ReportSchedulerImpl(aTimerDelegate) {}
+    ~SpreadReportSchedulerImpl() override { UnregisterAllHandlers(); }
+
+    static constexpr System::Clock::Milliseconds64 kSlotDuration =
+        System::Clock::Milliseconds64(CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS);
+    static constexpr size_t kSpreadSlots = CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS;
+
+protected:
+    CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now) override;
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
+
+    static_assert(CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS > 0, "Report scheduler slots must not be empty");
+    static_assert(CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS > 0, "At least the slot of the max interval must be considered");
+
+    /**
+     * @brief Pick the timestamp at which a node waiting for its max interval should report.
+     *
+     * @param[in] aNode The node to schedule, not counted in the slot occupancy.
+     * @param[in] earliest The earliest timestamp the node may report at (its min timestamp, or now).
+     * @param[in] deadline The max timestamp of the node.
+     */
+    Timestamp SelectSlot(ReadHandlerNode * aNode, const Timestamp & earliest, const Timestamp & deadline);
+
+    static uint64_t SlotIndex(const Timestamp & timestamp) { return timestamp.count() / kSlotDuration.count(); }
+    static Timestamp SlotStart(uint64_t slot) { return Timestamp(slot * kSlotDuration.count()); }
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
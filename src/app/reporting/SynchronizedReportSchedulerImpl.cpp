@@ -216,6 +216,7 @@ void SynchronizedReportSchedulerImpl::TimerFired()
     else
     {
         // If we have a reportable handler, we can schedule an engine run
+        RecordQueueDepth();
         InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
     }
 }
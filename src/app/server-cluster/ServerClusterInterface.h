@@ -181,6 +181,16 @@ public:
     virtual std::optional<DataModel::ActionReturnStatus>
     InvokeCommand(const DataModel::InvokeRequest & request, chip::TLV::TLVReader & input_arguments, CommandHandler * handler) = 0;
 
+    /// How the command at `path` is dispatched when it is part of a batched invoke request, see
+    /// DataModel::InvokeDispatchPolicy.
+    ///
+    /// Precondition:
+    ///   - `path` endpoint+cluster part MUST match one of the paths returned by GetPaths.
+    virtual DataModel::InvokeDispatchPolicy GetInvokeDispatchPolicy(const ConcreteCommandPath & path)
+    {
+        return DataModel::InvokeDispatchPolicy();
+    }
+
     /// Retrieves a list of commands accepted by this cluster.
     ///
     /// Returning `CHIP_NO_ERROR` without adding anything to the `builder` list is expected
@@ -367,6 +367,18 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     app::DnssdServer::Instance().StartServer();
 #endif
 
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    err = mCASEEphemeralKeypairPool.Init(CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE);
+    SuccessOrExit(err);
+    mCASEServer.SetEphemeralKeypairPool(&mCASEEphemeralKeypairPool);
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+
+#if CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
+    err = mCASECertChainCache.Init(&mFabrics, CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE);
+    SuccessOrExit(err);
+    mCASEServer.SetCertChainCache(&mCASECertChainCache);
+#endif // CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
+
     caseSessionManagerConfig = {
         .sessionInitParams =  {
             .sessionManager    = &mSessions,
@@ -375,6 +387,12 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
             .exchangeMgr       = &mExchangeMgr,
             .fabricTable       = &mFabrics,
             .groupDataProvider = mGroupsProvider,
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+            .ephemeralKeypairPool = &mCASEEphemeralKeypairPool,
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+#if CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
+            .certChainCache = &mCASECertChainCache,
+#endif // CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
             // Don't provide an MRP local config, so each CASE initiation will use
             // the then-current value.
             .mrpLocalConfig = NullOptional,
@@ -648,6 +666,14 @@ void Server::Shutdown()
     PlatformMgr().RemoveEventHandler(OnPlatformEventWrapper, 0);
     mCASEServer.Shutdown();
     mCASESessionManager.Shutdown();
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    mCASEServer.SetEphemeralKeypairPool(nullptr);
+    mCASEEphemeralKeypairPool.Shutdown();
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+#if CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
+    mCASEServer.SetCertChainCache(nullptr);
+    mCASECertChainCache.Shutdown();
+#endif // CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::DnssdServer::Instance().SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -828,7 +854,11 @@ PersistentStorageOperationalKeystore CommonCaseDeviceServerInitParams::sPersiste
 Credentials::PersistentStorageOpCertStore CommonCaseDeviceServerInitParams::sPersistentStorageOpCertStore;
 Credentials::GroupDataProviderImpl CommonCaseDeviceServerInitParams::sGroupDataProvider;
 app::DefaultTimerDelegate CommonCaseDeviceServerInitParams::sTimerDelegate;
+#if CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+app::reporting::SpreadReportSchedulerImpl
+#else
 app::reporting::ReportSchedulerImpl
+#endif
     CommonCaseDeviceServerInitParams::sReportScheduler(&CommonCaseDeviceServerInitParams::sTimerDelegate);
 #if CHIP_CONFIG_ENABLE_SESSION_RESUMPTION
 SimpleSessionResumptionStorage CommonCaseDeviceServerInitParams::sSessionResumptionStorage;
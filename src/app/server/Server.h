@@ -70,6 +70,9 @@
 #endif
 #include <app/TimerDelegates.h>
 #include <app/reporting/ReportSchedulerImpl.h>
+#if CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+#include <app/reporting/SpreadReportSchedulerImpl.h>
+#endif
 #include <transport/raw/UDP.h>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -323,7 +326,11 @@ private:
     static Credentials::PersistentStorageOpCertStore sPersistentStorageOpCertStore;
     static Credentials::GroupDataProviderImpl sGroupDataProvider;
     static chip::app::DefaultTimerDelegate sTimerDelegate;
+#if CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+    static app::reporting::SpreadReportSchedulerImpl sReportScheduler;
+#else
     static app::reporting::ReportSchedulerImpl sReportScheduler;
+#endif
 
 #if CHIP_CONFIG_ENABLE_SESSION_RESUMPTION
     static SimpleSessionResumptionStorage sSessionResumptionStorage;
@@ -662,6 +669,12 @@ private:
     ServerTransportMgr mTransports;
     SessionManager mSessions;
     CASEServer mCASEServer;
+#if CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+    CASEEphemeralKeypairPool mCASEEphemeralKeypairPool;
+#endif // CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE > 0
+#if CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
+    Credentials::ValidatedCertChainCache mCASECertChainCache;
+#endif // CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE > 0
 
     CASESessionManager mCASESessionManager;
     CASEClientPool<CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS> mCASEClientPool;
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <lib/core/CHIPConfig.h>
+
+#include <memory>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+class TestAttributeAccess : public AttributeAccessInterface
+{
+public:
+    TestAttributeAccess(Optional<EndpointId> endpointId, ClusterId clusterId) : AttributeAccessInterface(endpointId, clusterId) {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override { return CHIP_NO_ERROR; }
+};
+
+TEST(TestAttributeAccessInterfaceRegistry, RegisterUnregister)
+{
+    TestAttributeAccess a(Optional<EndpointId>(1), 1);
+    TestAttributeAccess b(Optional<EndpointId>(2), 1);
+    TestAttributeAccess wildcard(NullOptional, 3);
+
+    AttributeAccessInterfaceRegistry registry;
+    EXPECT_TRUE(registry.Register(&a));
+    EXPECT_TRUE(registry.Register(&b));
+    EXPECT_TRUE(registry.Register(&wildcard));
+
+    EXPECT_EQ(registry.Get(1, 1), &a);
+    EXPECT_EQ(registry.Get(2, 1), &b);
+    EXPECT_EQ(registry.Get(3, 1), nullptr);
+    EXPECT_EQ(registry.Get(1, 3), &wildcard);
+    EXPECT_EQ(registry.Get(7, 3), &wildcard);
+
+    // Conflicts with an existing registration for the same endpoint, or for all endpoints.
+    TestAttributeAccess sameEndpoint(Optional<EndpointId>(1), 1);
+    TestAttributeAccess underWildcard(Optional<EndpointId>(4), 3);
+    TestAttributeAccess overSpecific(NullOptional, 1);
+    EXPECT_FALSE(registry.Register(&sameEndpoint));
+    EXPECT_FALSE(registry.Register(&underWildcard));
+    EXPECT_FALSE(registry.Register(&overSpecific));
+
+    registry.Unregister(&a);
+    EXPECT_EQ(registry.Get(1, 1), nullptr);
+    EXPECT_EQ(registry.Get(2, 1), &b);
+    EXPECT_TRUE(registry.Register(&sameEndpoint));
+    EXPECT_EQ(registry.Get(1, 1), &sameEndpoint);
+
+    registry.UnregisterAllForEndpoint(2);
+    EXPECT_EQ(registry.Get(2, 1), nullptr);
+    EXPECT_EQ(registry.Get(2, 3), &wildcard);
+
+    registry.Unregister(&wildcard);
+    registry.Unregister(&sameEndpoint);
+    EXPECT_EQ(registry.Get(2, 3), nullptr);
+    EXPECT_EQ(registry.Get(1, 1), nullptr);
+}
+
+// A bridge registers per-endpoint interfaces for many endpoints, more than fit in the index if it is enabled. Wildcard reads
+// look up every (endpoint, cluster) pair of the device.
+TEST(TestAttributeAccessInterfaceRegistry, ManyBridgedEndpoints)
+{
+    constexpr EndpointId kEndpointCount = CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE + 40;
+    constexpr ClusterId kClusters[]     = { 0x0006, 0x0008, 0x0039 };
+    constexpr ClusterId kUnusedCluster  = 0x0300;
+
+    std::vector<std::unique_ptr<TestAttributeAccess>> overrides;
+    AttributeAccessInterfaceRegistry registry;
+
+    TestAttributeAccess descriptor(NullOptional, 0x001D);
+    EXPECT_TRUE(registry.Register(&descriptor));
+
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        for (ClusterId cluster : kClusters)
+        {
+            overrides.push_back(std::make_unique<TestAttributeAccess>(MakeOptional(endpoint), cluster));
+            EXPECT_TRUE(registry.Register(overrides.back().get()));
+        }
+    }
+
+    // The overrides of the last endpoints did not fit in the index, but must still prevent conflicts and be found.
+    TestAttributeAccess conflict(Optional<EndpointId>(kEndpointCount), kClusters[0]);
+    EXPECT_FALSE(registry.Register(&conflict));
+
+    // Overrides of endpoints [1, removedBelow] and [removedAbove, kEndpointCount] are expected to be gone.
+    auto checkAll = [&](EndpointId removedBelow, EndpointId removedAbove) {
+        size_t index = 0;
+        for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+        {
+            for (ClusterId cluster : kClusters)
+            {
+                bool removed = (endpoint <= removedBelow || endpoint >= removedAbove);
+                ASSERT_EQ(registry.Get(endpoint, cluster), removed ? nullptr : overrides[index].get());
+                index++;
+            }
+            ASSERT_EQ(registry.Get(endpoint, 0x001D), &descriptor);
+            ASSERT_EQ(registry.Get(endpoint, kUnusedCluster), nullptr);
+        }
+    };
+
+    checkAll(0, static_cast<EndpointId>(kEndpointCount + 1));
+
+    // Endpoint 1 is in the index if it is enabled, the last endpoints are not.
+    registry.UnregisterAllForEndpoint(1);
+    registry.UnregisterAllForEndpoint(kEndpointCount);
+    checkAll(1, kEndpointCount);
+
+    for (auto & attrOverride : overrides)
+    {
+        registry.Unregister(attrOverride.get());
+    }
+    registry.Unregister(&descriptor);
+    EXPECT_EQ(registry.Get(2, kClusters[0]), nullptr);
+    EXPECT_EQ(registry.Get(2, 0x001D), nullptr);
+}
+
+} // namespace
@@ -859,6 +859,104 @@ TEST(TestAttributeValueEncoder, TestEncodeFabricFilteredListOfPreEncoded)
     VERIFY_BUFFER_STATE(test, expected);
 }
 
+TEST(TestAttributeValueEncoder, TestEncodeListChunkingLargeItems)
+{
+    AttributeEncodeState state;
+
+    const CharSpan list[] = { "0123456789"_span, "abcdefghij"_span, "ABCDEFGHIJ"_span };
+    auto listEncoder      = [&list](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : list)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    {
+        // Only the first item fits in the initial list.
+        LimitedTestSetup<45> test1(kTestFabricIndex);
+        CHIP_ERROR err = test1.encoder.EncodeList(listEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        state = test1.encoder.GetState();
+        EXPECT_EQ(state.CurrentEncodingListIndex(), 1u);
+        EXPECT_TRUE(state.AllowPartialData());
+
+        const uint8_t expected[] = {
+            // clang-format off
+            0x15, 0x36, 0x01, // Test overhead, Start Anonymous struct + Start 1 byte Tag Array + Tag (01)
+            0x15, // Start anonymous struct
+              0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+                0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+                0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+                  0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+                  0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+                  0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+                0x18, // End of container
+                0x36, 0x02, // Start 1 byte tag array + Tag (02) (Attribute Value)
+                  0x0C, 0x0A, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, // "0123456789"
+                0x18, // End of array
+              0x18, // End of attribute data structure
+            0x18, // End of attribute structure
+            // clang-format on
+        };
+        VERIFY_BUFFER_STATE(test1, expected);
+    }
+    {
+        // The next chunk has room for exactly one AttributeReportIB, once the end of the containers the test opened is
+        // accounted for, so the third item is measured and left for the next chunk.
+        LimitedTestSetup<40> test2(kTestFabricIndex, state);
+        CHIP_ERROR err = test2.encoder.EncodeList(listEncoder);
+        EXPECT_EQ(err, CHIP_ERROR_NO_MEMORY);
+        EXPECT_EQ(test2.encoder.GetState().CurrentEncodingListIndex(), 2u);
+        EXPECT_EQ(test2.writer.GetLengthWritten(), 38u);
+    }
+    {
+        // One byte less, and the chunk ends before the second item, which is rolled back since nothing was measured yet.
+        LimitedTestSetup<39> test2(kTestFabricIndex, state);
+        CHIP_ERROR err = test2.encoder.EncodeList(listEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(test2.encoder.GetState().CurrentEncodingListIndex(), 1u);
+        EXPECT_EQ(test2.writer.GetLengthWritten(), 3u);
+    }
+    {
+        // The next chunk continues with the second item.
+        LimitedTestSetup<1024> test2(kTestFabricIndex, state);
+        CHIP_ERROR err = test2.encoder.EncodeList(listEncoder);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+
+        const uint8_t expected[] = {
+            // clang-format off
+            0x15, 0x36, 0x01, // Test overhead, Start Anonymous struct + Start 1 byte Tag Array + Tag (01)
+            0x15, // Start anonymous struct
+              0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+                0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+                0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+                  0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+                  0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+                  0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+                  0x34, 0x05, // Tag (05) Null
+                0x18, // End of container
+                0x2C, 0x02, 0x0A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, // Tag (02) "abcdefghij"
+              0x18, // End of attribute data structure
+            0x18, // End of attribute structure
+            0x15, // Start anonymous struct
+              0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+                0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+                0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+                  0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+                  0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+                  0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+                  0x34, 0x05, // Tag (05) Null
+                0x18, // End of container
+                0x2C, 0x02, 0x0A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, // Tag (02) "ABCDEFGHIJ"
+              0x18, // End of attribute data structure
+            0x18, // End of attribute structure
+            // clang-format on
+        };
+        VERIFY_BUFFER_STATE(test2, expected);
+    }
+}
+
 #undef VERIFY_BUFFER_STATE
 
 } // anonymous namespace
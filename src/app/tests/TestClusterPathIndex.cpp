@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/ClusterPathIndex.h>
+
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+struct Value
+{
+    int id;
+};
+
+TEST(TestClusterPathIndex, InsertGetRemove)
+{
+    ClusterPathIndex<Value, 16> index;
+    Value a{ 1 }, b{ 2 }, c{ 3 };
+
+    EXPECT_TRUE(index.Insert(1, 6, &a));
+    EXPECT_TRUE(index.Insert(2, 6, &b));
+    EXPECT_TRUE(index.Insert(1, 8, &c));
+    EXPECT_FALSE(index.Insert(1, 9, nullptr));
+    // A pair has at most one entry: the registries fall back to their lists for the others.
+    EXPECT_FALSE(index.Insert(1, 6, &b));
+    EXPECT_EQ(index.Count(), 3u);
+
+    EXPECT_EQ(index.Get(1, 6), &a);
+    EXPECT_EQ(index.Get(2, 6), &b);
+    EXPECT_EQ(index.Get(1, 8), &c);
+    EXPECT_EQ(index.Get(2, 8), nullptr);
+
+    // Removal must match the value as well.
+    EXPECT_FALSE(index.Remove(1, 6, &b));
+    EXPECT_FALSE(index.Remove(3, 6, &a));
+    EXPECT_TRUE(index.Remove(1, 6, &a));
+    EXPECT_FALSE(index.Remove(1, 6, &a));
+    EXPECT_EQ(index.Get(1, 6), nullptr);
+    EXPECT_EQ(index.Get(2, 6), &b);
+    EXPECT_EQ(index.Count(), 2u);
+
+    index.Clear();
+    EXPECT_EQ(index.Count(), 0u);
+    EXPECT_EQ(index.Get(2, 6), nullptr);
+}
+
+TEST(TestClusterPathIndex, WildcardEndpoint)
+{
+    ClusterPathIndex<Value, 16> index;
+    Value wildcard{ 1 }, specific{ 2 };
+
+    EXPECT_TRUE(index.Insert(kInvalidEndpointId, 6, &wildcard));
+    EXPECT_TRUE(index.Insert(3, 8, &specific));
+
+    EXPECT_EQ(index.Get(1, 6), nullptr);
+    EXPECT_EQ(index.Find(1, 6), &wildcard);
+    EXPECT_EQ(index.Find(200, 6), &wildcard);
+    EXPECT_EQ(index.Find(3, 8), &specific);
+    EXPECT_EQ(index.Find(4, 8), nullptr);
+}
+
+TEST(TestClusterPathIndex, RefusesInsertWhenFull)
+{
+    constexpr size_t kCapacity = 6;
+    ClusterPathIndex<Value, kCapacity> index;
+    Value values[kCapacity + 1];
+
+    for (EndpointId i = 0; i < kCapacity; i++)
+    {
+        EXPECT_EQ(index.Remaining(), kCapacity - i);
+        EXPECT_TRUE(index.Insert(i, 6, &values[i]));
+    }
+    EXPECT_EQ(index.Remaining(), 0u);
+    EXPECT_FALSE(index.Insert(100, 6, &values[kCapacity]));
+
+    EXPECT_TRUE(index.Remove(0, 6, &values[0]));
+    EXPECT_EQ(index.Remaining(), 1u);
+    EXPECT_TRUE(index.Insert(100, 6, &values[kCapacity]));
+    for (EndpointId i = 1; i < kCapacity; i++)
+    {
+        EXPECT_EQ(index.Get(i, 6), &values[i]);
+    }
+    EXPECT_EQ(index.Get(100, 6), &values[kCapacity]);
+}
+
+TEST(TestClusterPathIndex, Disabled)
+{
+    ClusterPathIndex<Value, 0> index;
+    Value a{ 1 };
+
+    EXPECT_EQ(index.Remaining(), 0u);
+    EXPECT_FALSE(index.Insert(1, 6, &a));
+    EXPECT_FALSE(index.Insert(kInvalidEndpointId, 6, &a));
+    EXPECT_EQ(index.Count(), 0u);
+    EXPECT_EQ(index.Get(1, 6), nullptr);
+    EXPECT_EQ(index.Find(1, 6), nullptr);
+    EXPECT_FALSE(index.Remove(1, 6, &a));
+}
+
+TEST(TestClusterPathIndex, ChurnMatchesReference)
+{
+    // Small index, so that probe runs are long and wrap around the end of the table.
+    constexpr size_t kCapacity = 12;
+    ClusterPathIndex<Value, kCapacity> index;
+    std::map<std::pair<EndpointId, ClusterId>, Value *> reference;
+    Value values[4];
+
+    srand(4321);
+    for (int i = 0; i < 5000; i++)
+    {
+        auto key = std::make_pair(static_cast<EndpointId>(rand() % 6), static_cast<ClusterId>(rand() % 6));
+        auto it  = reference.find(key);
+        if (it == reference.end())
+        {
+            Value * value = &values[rand() % 4];
+            bool inserted = index.Insert(key.first, key.second, value);
+            EXPECT_EQ(inserted, reference.size() < kCapacity);
+            if (inserted)
+            {
+                reference[key] = value;
+            }
+        }
+        else
+        {
+            EXPECT_TRUE(index.Remove(key.first, key.second, it->second));
+            reference.erase(it);
+        }
+
+        ASSERT_EQ(index.Count(), reference.size());
+        for (EndpointId endpoint = 0; endpoint < 6; endpoint++)
+        {
+            for (ClusterId cluster = 0; cluster < 6; cluster++)
+            {
+                auto found = reference.find(std::make_pair(endpoint, cluster));
+                ASSERT_EQ(index.Get(endpoint, cluster), found == reference.end() ? nullptr : found->second);
+            }
+        }
+    }
+}
+
+} // namespace
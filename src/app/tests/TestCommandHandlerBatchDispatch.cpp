@@ -0,0 +1,549 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/CommandHandlerImpl.h>
+#include <app/CommandPathRegistry.h>
+#include <app/MessageDef/InvokeRequestMessage.h>
+#include <app/MessageDef/InvokeResponseMessage.h>
+#include <app/StatusResponse.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/TLVPacketBufferBackingStore.h>
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+using Status = chip::Protocols::InteractionModel::Status;
+
+namespace chip {
+namespace System {
+
+// Same as the one of TestClosureControlClusterLogic: fires the timers as the mock clock is advanced.
+class TimerAndMockClock : public Clock::Internal::MockClock, public Layer
+{
+public:
+    // System Layer overrides
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override { Clear(); }
+    void Clear()
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+
+    CHIP_ERROR StartTimer(Clock::Timeout aDelay, TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        Clock::Timestamp awakenTime = GetMonotonicMilliseconds64() + std::chrono::duration_cast<Clock::Milliseconds64>(aDelay);
+        TimerList::Node * node      = mTimerNodes.Create(*this, awakenTime, aComplete, aAppState);
+        mTimerList.Add(node);
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout aDelay, TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != Clock::Timeout(0);
+    }
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback aComplete, void * aAppState) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    // Clock overrides
+    void SetMonotonic(Clock::Milliseconds64 timestamp)
+    {
+        MockClock::SetMonotonic(timestamp);
+        // Find all the timers that fired at this time or before and invoke the callbacks
+        TimerList::Node * node;
+        while ((node = mTimerList.Earliest()) != nullptr && node->AwakenTime() <= timestamp)
+        {
+            mTimerList.PopEarliest();
+            // Invoke auto-releases
+            mTimerNodes.Invoke(node);
+        }
+    }
+
+    void AdvanceMonotonic(Clock::Milliseconds64 increment) { SetMonotonic(GetMonotonicMilliseconds64() + increment); }
+
+private:
+    TimerPool<> mTimerNodes;
+    TimerList mTimerList;
+};
+
+} // namespace System
+} // namespace chip
+
+namespace {
+
+constexpr EndpointId kTestEndpointId = 1;
+constexpr ClusterId kTestClusterId   = 6;
+constexpr size_t kCommandCount       = 6;
+constexpr CommandId kIndexResponseCommandId = 0x80;
+
+// The fields of a response command: the index of the command it responds to.
+class IndexResponse : public DataModel::EncodableToTLV
+{
+public:
+    IndexResponse(CommandId commandId) : mCommandId(commandId) {}
+
+    CHIP_ERROR EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag) const override
+    {
+        TLV::TLVType outerType;
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outerType));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), mCommandId));
+        return writer.EndContainer(outerType);
+    }
+
+private:
+    CommandId mCommandId;
+};
+
+DataModel::InvokeDispatchPolicy ConcurrencyUnsafePolicy()
+{
+    DataModel::InvokeDispatchPolicy policy;
+    policy.concurrencySafe = false;
+    return policy;
+}
+
+class MockCommandResponder : public CommandHandlerExchangeInterface
+{
+public:
+    Messaging::ExchangeContext * GetExchangeContext() const override { return nullptr; }
+    void HandlingSlowCommand() override {}
+    Access::SubjectDescriptor GetSubjectDescriptor() const override { return Access::SubjectDescriptor(); }
+    FabricIndex GetAccessingFabricIndex() const override { return kUndefinedFabricIndex; }
+
+    Optional<GroupId> GetGroupId() const override { return NullOptional; }
+
+    void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override { mChunks.AddToEnd(std::move(aPacket)); }
+    void ResponseDropped() override { mResponseDropped = true; }
+
+    size_t GetCommandResponseMaxBufferSize() override { return kMaxSecureSduLengthBytes; }
+
+    System::PacketBufferHandle mChunks;
+    bool mResponseDropped = false;
+};
+
+// Commands are identified by their index in the request, which is both their command id and their CommandRef.
+class BatchCallback : public CommandHandlerImpl::Callback
+{
+public:
+    struct PendingCommand
+    {
+        ConcreteCommandPath path;
+        CommandHandler::Handle handle;
+    };
+
+    void OnDone(CommandHandlerImpl & apCommandObj) override { mDoneCount++; }
+
+    void DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
+                         TLV::TLVReader & apPayload) override
+    {
+        mDispatched.push_back(aCommandPath.mCommandId);
+        if (mAsyncCommands.count(aCommandPath.mCommandId) == 0)
+        {
+            Respond(apCommandObj, aCommandPath);
+            return;
+        }
+        mPending.push_back({ aCommandPath, CommandHandler::Handle(&apCommandObj) });
+    }
+
+    Status ValidateCommandCanBeDispatched(const DataModel::InvokeRequest & request) override { return Status::Success; }
+
+    DataModel::InvokeDispatchPolicy GetDispatchPolicy(const ConcreteCommandPath & aCommandPath) override
+    {
+        auto policy = mPolicies.find(aCommandPath.mCommandId);
+        return policy == mPolicies.end() ? DataModel::InvokeDispatchPolicy() : policy->second;
+    }
+
+    // Completes the pending command of the given index, returning whether its handler could still respond.
+    bool Complete(CommandId commandId)
+    {
+        for (auto it = mPending.begin(); it != mPending.end(); ++it)
+        {
+            if (it->path.mCommandId != commandId)
+            {
+                continue;
+            }
+            CommandHandler * handler = it->handle.Get();
+            if (handler != nullptr)
+            {
+                Respond(*handler, it->path);
+            }
+            mPending.erase(it);
+            return handler != nullptr;
+        }
+        return false;
+    }
+
+    // Commands answered with a response command carrying their index, instead of a Success status.
+    void Respond(CommandHandler & handler, const ConcreteCommandPath & aCommandPath)
+    {
+        if (mDataCommands.count(aCommandPath.mCommandId) == 0)
+        {
+            handler.AddStatus(aCommandPath, Status::Success);
+            return;
+        }
+        IndexResponse response(aCommandPath.mCommandId);
+        handler.AddResponse(aCommandPath, kIndexResponseCommandId, response);
+    }
+
+    std::map<CommandId, DataModel::InvokeDispatchPolicy> mPolicies;
+    std::map<CommandId, bool> mAsyncCommands;
+    std::map<CommandId, bool> mDataCommands;
+    std::vector<CommandId> mDispatched;
+    // Not a vector: handles register themselves with the handler, moving them is not free of side effects.
+    std::list<PendingCommand> mPending;
+    int mDoneCount = 0;
+};
+
+System::PacketBufferHandle GenerateInvokeRequest(size_t commandCount)
+{
+    System::PacketBufferHandle payload = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    InvokeRequestMessage::Builder invokeRequestMessageBuilder;
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(payload));
+
+    EXPECT_EQ(invokeRequestMessageBuilder.Init(&writer), CHIP_NO_ERROR);
+    invokeRequestMessageBuilder.SuppressResponse(false).TimedRequest(false);
+    InvokeRequests::Builder & invokeRequests = invokeRequestMessageBuilder.CreateInvokeRequests();
+
+    for (size_t i = 0; i < commandCount; i++)
+    {
+        CommandDataIB::Builder & commandDataIBBuilder = invokeRequests.CreateCommandData();
+        CommandPathIB::Builder & commandPathBuilder   = commandDataIBBuilder.CreatePath();
+        commandPathBuilder.EndpointId(kTestEndpointId)
+            .ClusterId(kTestClusterId)
+            .CommandId(static_cast<CommandId>(i))
+            .EndOfCommandPathIB();
+        EXPECT_EQ(commandDataIBBuilder.Ref(static_cast<uint16_t>(i)), CHIP_NO_ERROR);
+        commandDataIBBuilder.EndOfCommandDataIB();
+        EXPECT_EQ(commandDataIBBuilder.GetError(), CHIP_NO_ERROR);
+    }
+
+    invokeRequests.EndOfInvokeRequests();
+    invokeRequestMessageBuilder.EndOfInvokeRequestMessage();
+    EXPECT_EQ(invokeRequestMessageBuilder.GetError(), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(&payload), CHIP_NO_ERROR);
+    return payload;
+}
+
+// Statuses of the response chunks, by CommandRef, in the order they were added. A response command counts as a Success
+// status once checked to carry the index of the command it responds to.
+std::vector<std::pair<uint16_t, Status>> ParseResponses(System::PacketBufferHandle & chunks)
+{
+    std::vector<std::pair<uint16_t, Status>> responses;
+    while (!chunks.IsNull())
+    {
+        System::PacketBufferHandle chunk = chunks.PopHead();
+        System::PacketBufferTLVReader reader;
+        reader.Init(std::move(chunk));
+
+        InvokeResponseMessage::Parser invokeResponseMessage;
+        InvokeResponseIBs::Parser invokeResponses;
+        EXPECT_EQ(invokeResponseMessage.Init(reader), CHIP_NO_ERROR);
+        EXPECT_EQ(invokeResponseMessage.GetInvokeResponses(&invokeResponses), CHIP_NO_ERROR);
+
+        TLV::TLVReader invokeResponsesReader;
+        invokeResponses.GetReader(&invokeResponsesReader);
+        while (invokeResponsesReader.Next() == CHIP_NO_ERROR)
+        {
+            InvokeResponseIB::Parser invokeResponse;
+            CommandDataIB::Parser commandData;
+            CommandStatusIB::Parser commandStatus;
+            StatusIB::Parser statusParser;
+            StatusIB status;
+            uint16_t ref = 0;
+            EXPECT_EQ(invokeResponse.Init(invokeResponsesReader), CHIP_NO_ERROR);
+            if (invokeResponse.GetCommand(&commandData) == CHIP_NO_ERROR)
+            {
+                TLV::TLVReader fieldsReader;
+                TLV::TLVType outerType;
+                CommandId index = kInvalidCommandId;
+                EXPECT_EQ(commandData.GetRef(&ref), CHIP_NO_ERROR);
+                EXPECT_EQ(commandData.GetFields(&fieldsReader), CHIP_NO_ERROR);
+                EXPECT_EQ(fieldsReader.EnterContainer(outerType), CHIP_NO_ERROR);
+                EXPECT_EQ(fieldsReader.Next(TLV::ContextTag(0)), CHIP_NO_ERROR);
+                EXPECT_EQ(fieldsReader.Get(index), CHIP_NO_ERROR);
+                EXPECT_EQ(index, ref);
+                responses.push_back({ ref, Status::Success });
+                continue;
+            }
+            EXPECT_EQ(invokeResponse.GetStatus(&commandStatus), CHIP_NO_ERROR);
+            EXPECT_EQ(commandStatus.GetRef(&ref), CHIP_NO_ERROR);
+            EXPECT_EQ(commandStatus.GetErrorStatus(&statusParser), CHIP_NO_ERROR);
+            EXPECT_EQ(statusParser.DecodeStatusIB(status), CHIP_NO_ERROR);
+            responses.push_back({ ref, status.mStatus });
+        }
+    }
+    return responses;
+}
+
+class TestCommandHandlerBatchDispatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+protected:
+    void SetUp() override
+    {
+        mSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mTimerAndClock);
+    }
+    void TearDown() override
+    {
+        mTimerAndClock.Clear();
+        System::Clock::Internal::SetSystemClockForTesting(mSavedClock);
+    }
+
+    Status Invoke(CommandHandlerImpl & handler, size_t commandCount = kCommandCount)
+    {
+        return handler.OnInvokeCommandRequest(mResponder, GenerateInvokeRequest(commandCount), /* isTimedInvoke = */ false);
+    }
+
+    System::TimerAndMockClock mTimerAndClock;
+    System::Clock::ClockBase * mSavedClock = nullptr;
+    BasicCommandPathRegistry<kCommandCount> mRegistry;
+    MockCommandResponder mResponder;
+    CommandHandlerImpl::TestOnlyOverrides mOverrides{ &mRegistry, &mResponder, &mTimerAndClock };
+    BatchCallback mCallback;
+};
+
+TEST_F(TestCommandHandlerBatchDispatch, SynchronousCommandsAreDispatchedInOrder)
+{
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler), Status::Success);
+
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+    EXPECT_EQ(ParseResponses(mResponder.mChunks).size(), kCommandCount);
+}
+
+std::vector<uint16_t> ParseSuccessfulResponseRefs(System::PacketBufferHandle & chunks)
+{
+    std::vector<uint16_t> refs;
+    for (auto & response : ParseResponses(chunks))
+    {
+        refs.push_back(response.first);
+        EXPECT_EQ(response.second, Status::Success);
+    }
+    return refs;
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, AsyncCommandsDoNotHoldBackTheFollowingOnesByDefault)
+{
+    mCallback.mAsyncCommands[1] = true;
+    mCallback.mDataCommands[3]  = true;
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler, 4), Status::Success);
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(mCallback.mDoneCount, 0);
+
+    // The responses of the following commands, including the fields of a response command, are held until then.
+    EXPECT_TRUE(mCallback.Complete(1));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+    EXPECT_EQ(ParseSuccessfulResponseRefs(mResponder.mChunks), (std::vector<uint16_t>{ 0, 1, 2, 3 }));
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, HeldResponsesAreBoundedByTheConcurrencyLimit)
+{
+    mCallback.mAsyncCommands[1] = true;
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler), Status::Success);
+    // Command 0 responded, 1 is in progress, and the held responses of the next ones fill the remaining entries.
+    EXPECT_EQ(mCallback.mDispatched.size(),
+              std::min(kCommandCount, static_cast<size_t>(CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE + 1)));
+
+    EXPECT_TRUE(mCallback.Complete(1));
+    EXPECT_EQ(mCallback.mDispatched.size(), kCommandCount);
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+    EXPECT_EQ(ParseSuccessfulResponseRefs(mResponder.mChunks), (std::vector<uint16_t>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, AsyncCommandHoldsBackTheFollowingOnes)
+{
+    mCallback.mAsyncCommands[1] = true;
+    mCallback.mPolicies[1]      = ConcurrencyUnsafePolicy();
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler), Status::Success);
+
+    // Commands after the one still in progress wait for it, so that handlers see the effects of the earlier commands.
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1 }));
+    EXPECT_EQ(mCallback.mDoneCount, 0);
+
+    EXPECT_TRUE(mCallback.Complete(1));
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+
+    auto responses = ParseResponses(mResponder.mChunks);
+    ASSERT_EQ(responses.size(), kCommandCount);
+    for (size_t i = 0; i < kCommandCount; i++)
+    {
+        EXPECT_EQ(responses[i].first, i);
+        EXPECT_EQ(responses[i].second, Status::Success);
+    }
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, ConcurrencySafeCommandsRunConcurrently)
+{
+    for (CommandId id = 0; id < kCommandCount; id++)
+    {
+        mCallback.mAsyncCommands[id] = true;
+    }
+    // An unsafe command must wait for all the safe ones in progress, and holds back those that follow.
+    mCallback.mPolicies[3] = ConcurrencyUnsafePolicy();
+    mCallback.mDataCommands[0] = true;
+    mCallback.mDataCommands[5] = true;
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler), Status::Success);
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2 }));
+
+    EXPECT_TRUE(mCallback.Complete(2));
+    EXPECT_TRUE(mCallback.Complete(0));
+    EXPECT_EQ(mCallback.mDispatched.size(), 3u);
+    EXPECT_TRUE(mCallback.Complete(1));
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2, 3 }));
+    EXPECT_TRUE(mCallback.Complete(3));
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2, 3, 4, 5 }));
+
+    EXPECT_TRUE(mCallback.Complete(5));
+    EXPECT_TRUE(mCallback.Complete(4));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+
+    // Whatever the order the commands complete in, the responses are in the order of the request.
+    EXPECT_EQ(ParseSuccessfulResponseRefs(mResponder.mChunks), (std::vector<uint16_t>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, ConcurrencyIsLimited)
+{
+    for (CommandId id = 0; id < kCommandCount; id++)
+    {
+        mCallback.mAsyncCommands[id] = true;
+    }
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler), Status::Success);
+    EXPECT_EQ(mCallback.mDispatched.size(), static_cast<size_t>(CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE));
+
+    for (CommandId id = 0; id < kCommandCount; id++)
+    {
+        EXPECT_TRUE(mCallback.Complete(id));
+    }
+    EXPECT_EQ(mCallback.mDispatched.size(), kCommandCount);
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+    EXPECT_EQ(ParseSuccessfulResponseRefs(mResponder.mChunks), (std::vector<uint16_t>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, ResponsesOfLaterCommandsWaitForEarlierOnes)
+{
+    mCallback.mAsyncCommands[0] = true;
+    mCallback.mAsyncCommands[2] = true;
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler, 4), Status::Success);
+
+    // 2 completes first, then 0: the responses of 1 and 3 wait with that of 2 until 0 has responded.
+    EXPECT_TRUE(mCallback.Complete(2));
+    EXPECT_EQ(mCallback.mDoneCount, 0);
+    EXPECT_TRUE(mCallback.Complete(0));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+    EXPECT_EQ(ParseSuccessfulResponseRefs(mResponder.mChunks), (std::vector<uint16_t>{ 0, 1, 2, 3 }));
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, CommandTimeout)
+{
+    DataModel::InvokeDispatchPolicy withTimeout;
+    withTimeout.timeout         = 100_ms;
+    withTimeout.concurrencySafe = false;
+    mCallback.mAsyncCommands[0] = true;
+    mCallback.mAsyncCommands[1] = true;
+    mCallback.mPolicies[0]      = ConcurrencyUnsafePolicy();
+    mCallback.mPolicies[1]      = withTimeout;
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler, 3), Status::Success);
+    EXPECT_TRUE(mCallback.Complete(0));
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1 }));
+
+    mTimerAndClock.AdvanceMonotonic(50_ms);
+    EXPECT_EQ(mCallback.mDispatched.size(), 2u);
+
+    // The timeout fails the command, and the remaining ones run without waiting for its handler anymore.
+    mTimerAndClock.AdvanceMonotonic(50_ms);
+    EXPECT_EQ(mCallback.mDispatched, (std::vector<CommandId>{ 0, 1, 2 }));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+
+    // The handle of the timed out command was invalidated.
+    EXPECT_FALSE(mCallback.Complete(1));
+
+    auto responses = ParseResponses(mResponder.mChunks);
+    ASSERT_EQ(responses.size(), 3u);
+    EXPECT_EQ(responses[0], std::make_pair(static_cast<uint16_t>(0), Status::Success));
+    EXPECT_EQ(responses[1], std::make_pair(static_cast<uint16_t>(1), Status::Timeout));
+    EXPECT_EQ(responses[2], std::make_pair(static_cast<uint16_t>(2), Status::Success));
+}
+
+TEST_F(TestCommandHandlerBatchDispatch, ResponseWithinTimeout)
+{
+    DataModel::InvokeDispatchPolicy withTimeout;
+    withTimeout.timeout         = 100_ms;
+    mCallback.mAsyncCommands[0] = true;
+    mCallback.mPolicies[0]      = withTimeout;
+
+    CommandHandlerImpl handler(mOverrides, &mCallback);
+    EXPECT_EQ(Invoke(handler, 2), Status::Success);
+    mTimerAndClock.AdvanceMonotonic(99_ms);
+    EXPECT_TRUE(mCallback.Complete(0));
+    EXPECT_EQ(mCallback.mDoneCount, 1);
+
+    // No timer is left behind.
+    mTimerAndClock.AdvanceMonotonic(10_ms);
+    auto responses = ParseResponses(mResponder.mChunks);
+    ASSERT_EQ(responses.size(), 2u);
+    EXPECT_EQ(responses[0].second, Status::Success);
+    EXPECT_EQ(responses[1].second, Status::Success);
+}
+
+} // namespace
@@ -20,8 +20,11 @@
 #include <pw_unit_test/framework.h>
 
 #include <app/CommandHandlerInterfaceRegistry.h>
+#include <lib/core/CHIPConfig.h>
 
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace chip {
 namespace app {
@@ -99,5 +102,44 @@ TEST(TestCommandHandlerInterfaceRegistry, TestUnregisterAll)
     EXPECT_EQ(registry.GetCommandHandler(5, 3), &d);
 }
 
+TEST(TestCommandHandlerInterfaceRegistry, TestManyHandlers)
+{
+    // More handlers than fit in the registry index, if it is enabled: the ones that do not fit must still be found.
+    constexpr EndpointId kEndpointCount = CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE + 40;
+
+    std::vector<std::unique_ptr<TestCommandHandlerInterface>> handlers;
+    CommandHandlerInterfaceRegistry registry;
+
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        handlers.push_back(std::make_unique<TestCommandHandlerInterface>(Optional<EndpointId>(endpoint), 6));
+        EXPECT_EQ(registry.RegisterCommandHandler(handlers.back().get()), CHIP_NO_ERROR);
+    }
+    TestCommandHandlerInterface wildcard(NullOptional, 8);
+    EXPECT_EQ(registry.RegisterCommandHandler(&wildcard), CHIP_NO_ERROR);
+
+    TestCommandHandlerInterface conflicting(Optional<EndpointId>(kEndpointCount), 6);
+    EXPECT_EQ(registry.RegisterCommandHandler(&conflicting), CHIP_ERROR_INCORRECT_STATE);
+
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        EXPECT_EQ(registry.GetCommandHandler(endpoint, 6), handlers[endpoint - 1].get());
+        EXPECT_EQ(registry.GetCommandHandler(endpoint, 8), &wildcard);
+        EXPECT_EQ(registry.GetCommandHandler(endpoint, 9), nullptr);
+    }
+
+    registry.UnregisterAllCommandHandlersForEndpoint(1);
+    EXPECT_EQ(registry.UnregisterCommandHandler(handlers.back().get()), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.GetCommandHandler(1, 6), nullptr);
+    EXPECT_EQ(registry.GetCommandHandler(kEndpointCount, 6), nullptr);
+    EXPECT_EQ(registry.GetCommandHandler(2, 6), handlers[1].get());
+
+    registry.UnregisterAllHandlers();
+    EXPECT_EQ(registry.GetCommandHandler(2, 6), nullptr);
+    EXPECT_EQ(registry.GetCommandHandler(2, 8), nullptr);
+    EXPECT_EQ(registry.RegisterCommandHandler(handlers[1].get()), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.GetCommandHandler(2, 6), handlers[1].get());
+}
+
 } // namespace app
 } // namespace chip
@@ -395,3 +395,89 @@ TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithEmptyIcdStorage
     ByteSpan payload1{ buffer->Start(), buffer->DataLength() };
     EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
 }
+
+TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithMultipleClients)
+{
+    FabricIndex fabricId = 1;
+    NodeId nodeId1       = 6666;
+    NodeId nodeId2       = 6667;
+    NodeId nodeId3       = 6668;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo1;
+    clientInfo1.peer_node = ScopedNodeId(nodeId1, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo1, ByteSpan(kKeyBuffer1)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo1), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo2;
+    clientInfo2.peer_node = ScopedNodeId(nodeId2, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo2, ByteSpan(kKeyBuffer2)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo2), CHIP_NO_ERROR);
+
+    uint32_t counter                  = 1;
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+
+    // Check-in from the first registered client loads the cache
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo1.aes_key_handle, clientInfo1.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo1.peer_node);
+    EXPECT_EQ(checkInCounter, counter);
+    EXPECT_EQ(manager.GetClientInfoCacheSize(), 2u);
+
+    // Entries stored after the cache is loaded are matched without reloading from storage
+    ICDClientInfo clientInfo3;
+    clientInfo3.peer_node = ScopedNodeId(nodeId3, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo3, ByteSpan(kKeyBuffer3)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo3), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetClientInfoCacheSize(), 3u);
+
+    counter++;
+    output = MutableByteSpan{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo3.aes_key_handle, clientInfo3.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload1{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo3.peer_node);
+    EXPECT_EQ(checkInCounter, counter);
+
+    // Storing a cached entry again, as every check-in does, updates it in the cache
+    decodeClientInfo.offset = counter;
+    EXPECT_EQ(manager.StoreEntry(decodeClientInfo), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetClientInfoCacheSize(), 3u);
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo3.peer_node);
+    EXPECT_EQ(decodeClientInfo.offset, counter);
+
+    // Deleted entries are no longer matched
+    counter++;
+    output = MutableByteSpan{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo2.aes_key_handle, clientInfo2.hmac_key_handle, counter, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    buffer->SetDataLength(static_cast<uint16_t>(output.size()));
+    ByteSpan payload2{ buffer->Start(), buffer->DataLength() };
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload2, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo2.peer_node);
+
+    EXPECT_EQ(manager.DeleteEntry(clientInfo2.peer_node), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetClientInfoCacheSize(), 2u);
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload2, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
+
+    EXPECT_EQ(manager.DeleteAllEntries(fabricId), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.GetClientInfoCacheSize(), 0u);
+    EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
+}
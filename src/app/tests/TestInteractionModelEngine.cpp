@@ -37,8 +37,20 @@
 #include <pw_unit_test/framework.h>
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+#include <app/CASESessionManager.h>
+#include <app/OperationalSessionSetupPool.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
+#include <app/SubscriptionResumptionSessionEstablisher.h>
+#include <credentials/GroupDataProviderImpl.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
+#include <tracing/backend.h>
+#include <tracing/metric_event.h>
+#include <tracing/metric_keys.h>
+#include <tracing/registry.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 namespace {
@@ -54,6 +66,51 @@ public:
     }
 };
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+// Fails every session establishment synchronously, as when no session setup can be allocated, and records the peers whose
+// session was requested along with the number of peers in progress at that time.
+class FailingSessionSetupPool : public chip::OperationalSessionSetupPoolDelegate
+{
+public:
+    chip::OperationalSessionSetup * Allocate(const chip::CASEClientInitParams & params, chip::CASEClientPoolDelegate * clientPool,
+                                             chip::ScopedNodeId peerId,
+                                             chip::OperationalSessionReleaseDelegate * releaseDelegate) override
+    {
+        mPeers.push_back(peerId);
+        mMaxPeersInProgress = std::max(
+            mMaxPeersInProgress,
+            chip::app::InteractionModelEngine::GetInstance()->GetSubscriptionResumptionMetrics().peersInProgress);
+        return nullptr;
+    }
+
+    void Release(chip::OperationalSessionSetup * device) override {}
+    chip::OperationalSessionSetup * FindSessionSetup(chip::ScopedNodeId peerId, bool forAddressUpdate) override
+    {
+        return nullptr;
+    }
+    void ReleaseAllSessionSetupsForFabric(chip::FabricIndex fabricIndex) override {}
+    void ReleaseAllSessionSetup() override {}
+
+    std::vector<chip::ScopedNodeId> mPeers;
+    uint32_t mMaxPeersInProgress = 0;
+};
+
+// Keeps a log of the subscription resumption metric events.
+class SubscriptionResumptionMetricBackend : public chip::Tracing::Backend
+{
+public:
+    void LogMetricEvent(const chip::Tracing::MetricEvent & event) override
+    {
+        if (std::string(event.key()) == chip::Tracing::kMetricSubscriptionResumption)
+        {
+            mEvents.push_back(event);
+        }
+    }
+
+    std::vector<chip::Tracing::MetricEvent> mEvents;
+};
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 } // namespace
 
 namespace chip {
@@ -68,9 +125,20 @@ public:
     void TestSubjectHasActiveSubscriptionSubWithCAT();
     void TestSubscriptionResumptionTimer();
     void TestDecrementNumSubscriptionsToResume();
+    void TestQueueSubscriptionResumptionGroupsByPeer();
+    void TestStartQueuedSubscriptionResumptionsPerPeer();
+    void TestStartQueuedSubscriptionResumptionsBoundsConcurrentPeers();
+    void TestReleaseQueuedSubscriptionResumptionsEndsMetric();
     void TestFabricHasAtLeastOneActiveSubscription();
     void TestFabricHasAtLeastOneActiveSubscriptionWithMixedStates();
     static int GetAttributePathListLength(SingleLinkedListNode<AttributePathParams> * apattributePathParamsList);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    static void QueueSubscriptionResumption(InteractionModelEngine & engine, const ScopedNodeId & peer,
+                                            SubscriptionId subscriptionId);
+    CHIP_ERROR InitCASESessionManager(CASESessionManager & caseSessionManager, OperationalSessionSetupPoolDelegate & pool);
+
+    Credentials::GroupDataProviderImpl mGroupDataProvider;
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 };
 
 int TestInteractionModelEngine::GetAttributePathListLength(SingleLinkedListNode<AttributePathParams> * apAttributePathParamsList)
@@ -85,6 +153,34 @@ int TestInteractionModelEngine::GetAttributePathListLength(SingleLinkedListNode<
     return length;
 }
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+void TestInteractionModelEngine::QueueSubscriptionResumption(InteractionModelEngine & engine, const ScopedNodeId & peer,
+                                                             SubscriptionId subscriptionId)
+{
+    SubscriptionResumptionStorage::SubscriptionInfo info;
+    info.mNodeId         = peer.GetNodeId();
+    info.mFabricIndex    = peer.GetFabricIndex();
+    info.mSubscriptionId = subscriptionId;
+
+    auto * establisher = Platform::New<SubscriptionResumptionSessionEstablisher>();
+    ASSERT_NE(establisher, nullptr);
+    ASSERT_EQ(establisher->Init(info), CHIP_NO_ERROR);
+    engine.QueueSubscriptionResumption(establisher);
+}
+
+CHIP_ERROR TestInteractionModelEngine::InitCASESessionManager(CASESessionManager & caseSessionManager,
+                                                              OperationalSessionSetupPoolDelegate & pool)
+{
+    CASESessionManagerConfig config;
+    config.sessionInitParams.sessionManager    = &GetSecureSessionManager();
+    config.sessionInitParams.exchangeMgr       = &GetExchangeManager();
+    config.sessionInitParams.fabricTable       = &GetFabricTable();
+    config.sessionInitParams.groupDataProvider = &mGroupDataProvider;
+    config.sessionSetupPool                    = &pool;
+    return caseSessionManager.Init(&GetSystemLayer(), config);
+}
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 TEST_F(TestInteractionModelEngine, TestAttributePathParamsPushRelease)
 {
 
@@ -713,6 +809,168 @@ TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestDecrementNumSubscriptionsToR
     engine->SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_CIP && CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && !CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 }
+
+TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestQueueSubscriptionResumptionGroupsByPeer)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    engine->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()), CHIP_NO_ERROR);
+
+    // The same node id on another fabric is another peer.
+    const ScopedNodeId peerA(1, 1);
+    const ScopedNodeId peerB(2, 1);
+    const ScopedNodeId peerC(1, 2);
+
+    QueueSubscriptionResumption(*engine, peerA, 1);
+    QueueSubscriptionResumption(*engine, peerB, 2);
+    QueueSubscriptionResumption(*engine, peerA, 3);
+    QueueSubscriptionResumption(*engine, peerC, 4);
+    QueueSubscriptionResumption(*engine, peerA, 5);
+
+    // One entry per peer, in the order their first subscription was queued.
+    EXPECT_EQ(engine->GetSubscriptionResumptionMetrics().peersQueued, 3u);
+    std::vector<ScopedNodeId> queuedPeers;
+    for (auto & establisher : engine->mPendingSubscriptionResumptions)
+    {
+        queuedPeers.push_back(establisher.GetPeer());
+    }
+    ASSERT_EQ(queuedPeers.size(), 3u);
+    EXPECT_TRUE(queuedPeers[0] == peerA);
+    EXPECT_TRUE(queuedPeers[1] == peerB);
+    EXPECT_TRUE(queuedPeers[2] == peerC);
+
+    // Releasing the queue frees the whole group of each peer.
+    engine->ReleaseQueuedSubscriptionResumptions();
+    EXPECT_TRUE(engine->mPendingSubscriptionResumptions.Empty());
+    EXPECT_EQ(engine->GetSubscriptionResumptionMetrics().peersQueued, 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestStartQueuedSubscriptionResumptionsPerPeer)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+    FailingSessionSetupPool pool;
+    CASESessionManager caseSessionManager;
+    ASSERT_EQ(InitCASESessionManager(caseSessionManager, pool), CHIP_NO_ERROR);
+
+    engine->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler(),
+                           &caseSessionManager),
+              CHIP_NO_ERROR);
+
+    const ScopedNodeId peerA(1, 1);
+    const ScopedNodeId peerB(2, 1);
+    const ScopedNodeId peerC(3, 1);
+
+    QueueSubscriptionResumption(*engine, peerA, 1);
+    QueueSubscriptionResumption(*engine, peerB, 2);
+    QueueSubscriptionResumption(*engine, peerA, 3);
+    QueueSubscriptionResumption(*engine, peerC, 4);
+    QueueSubscriptionResumption(*engine, peerB, 5);
+
+    engine->mSubscriptionResumptionInProgress = true;
+    engine->StartQueuedSubscriptionResumptions();
+
+    // One session is requested per peer, and its failure fails all the subscriptions of the peer.
+    ASSERT_EQ(pool.mPeers.size(), 3u);
+    EXPECT_TRUE(pool.mPeers[0] == peerA);
+    EXPECT_TRUE(pool.mPeers[1] == peerB);
+    EXPECT_TRUE(pool.mPeers[2] == peerC);
+
+    const auto & metrics = engine->GetSubscriptionResumptionMetrics();
+    EXPECT_EQ(metrics.peersQueued, 0u);
+    EXPECT_EQ(metrics.peersInProgress, 0u);
+    EXPECT_EQ(metrics.resumed, 0u);
+    EXPECT_EQ(metrics.failed, 5u);
+    EXPECT_FALSE(engine->mSubscriptionResumptionInProgress);
+
+    caseSessionManager.Shutdown();
+}
+
+TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestStartQueuedSubscriptionResumptionsBoundsConcurrentPeers)
+{
+    constexpr uint32_t kMaxPeers  = CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS;
+    constexpr uint32_t kPeerCount = kMaxPeers + 2;
+
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+    FailingSessionSetupPool pool;
+    CASESessionManager caseSessionManager;
+    ASSERT_EQ(InitCASESessionManager(caseSessionManager, pool), CHIP_NO_ERROR);
+
+    engine->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler(),
+                           &caseSessionManager),
+              CHIP_NO_ERROR);
+
+    for (uint32_t i = 0; i < kPeerCount; i++)
+    {
+        QueueSubscriptionResumption(*engine, ScopedNodeId(i + 1, 1), i + 1);
+    }
+
+    // While as many peers as allowed have their session being established, no other peer starts.
+    engine->mSubscriptionResumptionInProgress              = true;
+    engine->mSubscriptionResumptionMetrics.peersInProgress = kMaxPeers;
+    engine->StartQueuedSubscriptionResumptions();
+    EXPECT_TRUE(pool.mPeers.empty());
+    EXPECT_EQ(engine->GetSubscriptionResumptionMetrics().peersQueued, kPeerCount);
+
+    // Once one of them is done, the queued peers start, never more than the bound at once.
+    engine->OnSubscriptionResumptionPeerDone(1, CHIP_NO_ERROR);
+    EXPECT_EQ(pool.mPeers.size(), kPeerCount);
+    EXPECT_EQ(pool.mMaxPeersInProgress, kMaxPeers);
+
+    const auto & metrics = engine->GetSubscriptionResumptionMetrics();
+    EXPECT_EQ(metrics.peersQueued, 0u);
+    EXPECT_EQ(metrics.peersInProgress, kMaxPeers - 1);
+    EXPECT_EQ(metrics.resumed, 1u);
+    EXPECT_EQ(metrics.failed, kPeerCount);
+    EXPECT_TRUE(engine->mSubscriptionResumptionInProgress);
+
+    engine->ReleaseQueuedSubscriptionResumptions();
+    caseSessionManager.Shutdown();
+}
+
+#if MATTER_TRACING_ENABLED
+TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestReleaseQueuedSubscriptionResumptionsEndsMetric)
+{
+    SubscriptionResumptionMetricBackend backend;
+    Tracing::ScopedRegistration registration(backend);
+
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+    FailingSessionSetupPool pool;
+    CASESessionManager caseSessionManager;
+    ASSERT_EQ(InitCASESessionManager(caseSessionManager, pool), CHIP_NO_ERROR);
+
+    chip::TestPersistentStorageDelegate storage;
+    chip::app::SimpleSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+
+    SubscriptionResumptionStorage::SubscriptionInfo info = { .mNodeId = 1, .mFabricIndex = 1, .mSubscriptionId = 1 };
+    EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+
+    engine->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler(),
+                           &caseSessionManager, &subscriptionStorage),
+              CHIP_NO_ERROR);
+
+    // The persisted subscription is queued behind peers whose session is being established.
+    engine->mSubscriptionResumptionMetrics.peersInProgress = CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS;
+    InteractionModelEngine::ResumeSubscriptionsTimerCallback(nullptr, engine);
+    EXPECT_TRUE(pool.mPeers.empty());
+    ASSERT_EQ(backend.mEvents.size(), 1u);
+    EXPECT_TRUE(backend.mEvents[0].type() == Tracing::MetricEvent::Type::kBeginEvent);
+
+    // Shutting down with resumptions still queued ends the metric.
+    engine->Shutdown();
+    ASSERT_EQ(backend.mEvents.size(), 2u);
+    EXPECT_TRUE(backend.mEvents[1].type() == Tracing::MetricEvent::Type::kEndEvent);
+    EXPECT_EQ(backend.mEvents[1].ValueErrorCode(), CHIP_ERROR_CANCELLED.AsInteger());
+    EXPECT_FALSE(engine->mSubscriptionResumptionInProgress);
+
+    subscriptionStorage.DeleteAll(1);
+    caseSessionManager.Shutdown();
+}
+#endif // MATTER_TRACING_ENABLED
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 TEST_F_FROM_FIXTURE(TestInteractionModelEngine, TestFabricHasAtLeastOneActiveSubscription)
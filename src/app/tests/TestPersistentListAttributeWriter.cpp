@@ -0,0 +1,223 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/PersistentListAttributeWriter.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using ListOperation = ConcreteDataAttributePath::ListOperation;
+
+constexpr uint16_t kInvalidElement = 0xFFFF;
+
+CHIP_ERROR SerializeElement(const uint16_t & element, MutableByteSpan & out)
+{
+    VerifyOrReturnError(element != kInvalidElement, CHIP_IM_GLOBAL_STATUS(ConstraintError));
+    VerifyOrReturnError(out.size() >= sizeof(element), CHIP_ERROR_BUFFER_TOO_SMALL);
+    Encoding::LittleEndian::Put16(out.data(), element);
+    out.reduce_size(sizeof(element));
+    return CHIP_NO_ERROR;
+}
+
+// An element of a fabric-scoped list: a value, and the fabric it belongs to.
+struct FabricScopedElement
+{
+    static constexpr bool kIsFabricScoped = true;
+
+    uint16_t value          = 0;
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return reader.Get(value); }
+    FabricIndex GetFabricIndex() const { return fabricIndex; }
+    void SetFabricIndex(FabricIndex aFabricIndex) { fabricIndex = aFabricIndex; }
+};
+
+CHIP_ERROR SerializeFabricScopedElement(const FabricScopedElement & element, MutableByteSpan & out)
+{
+    return SerializeElement(element.value, out);
+}
+
+class TestPersistentListAttributeWriter : public ::testing::Test
+{
+protected:
+    void SetUp() override { ASSERT_EQ(mList.Init(&mStorage, "g/wl", 8), CHIP_NO_ERROR); }
+
+    CHIP_ERROR Write(ListOperation operation, const std::vector<uint16_t> & elements)
+    {
+        return Write(mWriter, SerializeElement, operation, elements, kUndefinedFabricIndex);
+    }
+
+    // Writes `elements` as a whole list for ReplaceAll/NotList, or its first element for AppendItem.
+    template <typename Writer, typename Serializer>
+    static CHIP_ERROR Write(Writer & listWriter, Serializer && serialize, ListOperation operation,
+                            const std::vector<uint16_t> & elements, FabricIndex fabricIndex)
+    {
+        uint8_t buffer[128];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        if (operation == ListOperation::AppendItem)
+        {
+            ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), elements[0]));
+        }
+        else
+        {
+            TLV::TLVType outer;
+            ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outer));
+            for (uint16_t element : elements)
+            {
+                ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), element));
+            }
+            ReturnErrorOnFailure(writer.EndContainer(outer));
+        }
+        ReturnErrorOnFailure(writer.Finalize());
+
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        ReturnErrorOnFailure(reader.Next());
+
+        ConcreteDataAttributePath path(1, 2, 3);
+        path.mListOp = operation;
+        Access::SubjectDescriptor subjectDescriptor;
+        subjectDescriptor.fabricIndex = fabricIndex;
+        AttributeValueDecoder decoder(reader, subjectDescriptor);
+        return listWriter.Write(path, decoder, serialize);
+    }
+
+    std::vector<uint16_t> Stored()
+    {
+        std::vector<uint16_t> elements;
+        for (uint16_t i = 0; i < mList.Count(); i++)
+        {
+            uint8_t buffer[2];
+            MutableByteSpan element(buffer);
+            EXPECT_EQ(mList.Get(i, element), CHIP_NO_ERROR);
+            elements.push_back(Encoding::LittleEndian::Get16(buffer));
+        }
+        return elements;
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    PersistentList mList;
+    PersistentListAttributeWriter<uint16_t, 2> mWriter{ mList };
+};
+
+TEST_F(TestPersistentListAttributeWriter, ChunkedWrite)
+{
+    // A chunked list write: an empty ReplaceAll, then the elements one at a time.
+    EXPECT_EQ(Write(ListOperation::ReplaceAll, {}), CHIP_NO_ERROR);
+    EXPECT_EQ(Write(ListOperation::AppendItem, { 1 }), CHIP_NO_ERROR);
+    EXPECT_EQ(Write(ListOperation::AppendItem, { 2 }), CHIP_NO_ERROR);
+    EXPECT_EQ(Stored(), std::vector<uint16_t>{});
+
+    EXPECT_EQ(mWriter.OnListWriteEnd(true), CHIP_NO_ERROR);
+    EXPECT_EQ(Stored(), (std::vector<uint16_t>{ 1, 2 }));
+
+    // A later AppendItem-only write adds to the list.
+    EXPECT_EQ(Write(ListOperation::AppendItem, { 3 }), CHIP_NO_ERROR);
+    EXPECT_EQ(mWriter.OnListWriteEnd(true), CHIP_NO_ERROR);
+    EXPECT_EQ(Stored(), (std::vector<uint16_t>{ 1, 2, 3 }));
+}
+
+TEST_F(TestPersistentListAttributeWriter, FailedWriteIsRolledBack)
+{
+    EXPECT_EQ(Write(ListOperation::ReplaceAll, { 1, 2 }), CHIP_NO_ERROR);
+    EXPECT_EQ(mWriter.OnListWriteEnd(true), CHIP_NO_ERROR);
+
+    EXPECT_EQ(Write(ListOperation::ReplaceAll, { 5 }), CHIP_NO_ERROR);
+    EXPECT_EQ(Write(ListOperation::AppendItem, { kInvalidElement }), CHIP_IM_GLOBAL_STATUS(ConstraintError));
+    EXPECT_EQ(mWriter.OnListWriteEnd(false), CHIP_NO_ERROR);
+    EXPECT_EQ(Stored(), (std::vector<uint16_t>{ 1, 2 }));
+
+    // Too many elements.
+    EXPECT_EQ(Write(ListOperation::ReplaceAll, { 1, 2, 3, 4, 5, 6, 7, 8, 9 }), CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
+    EXPECT_EQ(mWriter.OnListWriteEnd(false), CHIP_NO_ERROR);
+    EXPECT_EQ(Stored(), (std::vector<uint16_t>{ 1, 2 }));
+    EXPECT_EQ(mStorage.GetNumKeys(), 3u);
+}
+
+TEST_F(TestPersistentListAttributeWriter, NotListWriteCommitsImmediately)
+{
+    EXPECT_EQ(Write(ListOperation::NotList, { 4, 5, 6 }), CHIP_NO_ERROR);
+    EXPECT_FALSE(mList.IsWriting());
+    EXPECT_EQ(Stored(), (std::vector<uint16_t>{ 4, 5, 6 }));
+
+    EXPECT_EQ(Write(ListOperation::NotList, { 7, kInvalidElement }), CHIP_IM_GLOBAL_STATUS(ConstraintError));
+    EXPECT_FALSE(mList.IsWriting());
+    EXPECT_EQ(Stored(), (std::vector<uint16_t>{ 4, 5, 6 }));
+}
+
+TEST_F(TestPersistentListAttributeWriter, FabricScopedReplaceAllKeepsOtherFabrics)
+{
+    using Writer = PersistentListAttributeWriter<FabricScopedElement, 2>;
+    Writer writer(mList);
+
+    auto write = [&](ListOperation operation, const std::vector<uint16_t> & elements, FabricIndex fabricIndex) {
+        return Write(writer, SerializeFabricScopedElement, operation, elements, fabricIndex);
+    };
+    auto stored = [&]() {
+        std::vector<std::pair<FabricIndex, uint16_t>> elements;
+        for (uint16_t i = 0; i < mList.Count(); i++)
+        {
+            uint8_t buffer[Writer::kMaxStoredElementSize];
+            ByteSpan element;
+            FabricIndex fabricIndex;
+            EXPECT_EQ(Writer::ReadElement(mList, i, MutableByteSpan(buffer), element, fabricIndex), CHIP_NO_ERROR);
+            EXPECT_EQ(element.size(), 2u);
+            elements.push_back({ fabricIndex, Encoding::LittleEndian::Get16(element.data()) });
+        }
+        return elements;
+    };
+
+    EXPECT_EQ(write(ListOperation::NotList, { 1, 2 }, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(write(ListOperation::NotList, { 3 }, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(stored(), (std::vector<std::pair<FabricIndex, uint16_t>>{ { 1, 1 }, { 1, 2 }, { 2, 3 } }));
+
+    // A chunked write from fabric 1 only replaces the elements of fabric 1.
+    EXPECT_EQ(write(ListOperation::ReplaceAll, {}, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(write(ListOperation::AppendItem, { 4 }, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.OnListWriteEnd(true), CHIP_NO_ERROR);
+    EXPECT_EQ(stored(), (std::vector<std::pair<FabricIndex, uint16_t>>{ { 2, 3 }, { 1, 4 } }));
+
+    // The elements kept for the other fabrics count against the capacity of the list.
+    EXPECT_EQ(write(ListOperation::NotList, { 5, 6, 7, 8, 9, 10, 11, 12 }, 1), CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
+    EXPECT_EQ(stored(), (std::vector<std::pair<FabricIndex, uint16_t>>{ { 2, 3 }, { 1, 4 } }));
+
+    // An empty list from fabric 2 removes its elements only.
+    EXPECT_EQ(write(ListOperation::NotList, {}, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(stored(), (std::vector<std::pair<FabricIndex, uint16_t>>{ { 1, 4 } }));
+
+    // Removing a fabric removes its elements, and abandons a list write in progress.
+    EXPECT_EQ(write(ListOperation::NotList, { 5, 6 }, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(write(ListOperation::ReplaceAll, { 7 }, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.RemoveFabric(1), CHIP_NO_ERROR);
+    EXPECT_FALSE(mList.IsWriting());
+    EXPECT_EQ(stored(), (std::vector<std::pair<FabricIndex, uint16_t>>{ { 2, 5 }, { 2, 6 } }));
+    EXPECT_EQ(mStorage.GetNumKeys(), 3u);
+}
+
+} // namespace
@@ -0,0 +1,226 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/AttributeValueEncoder.h>
+#include <app/reporting/ReportFragmentCache.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr EndpointId kTestEndpointId   = 0x55;
+constexpr ClusterId kTestClusterId     = 0xaa;
+constexpr AttributeId kTestAttributeId = 0xcc;
+constexpr DataVersion kTestDataVersion = 0x99;
+constexpr AttributeId kTestEntries     = 4;
+
+ReportFragmentCache::Key MakeKey(AttributeId attributeId = kTestAttributeId, DataVersion dataVersion = kTestDataVersion,
+                                 FabricIndex fabricIndex = kUndefinedFabricIndex)
+{
+    ReportFragmentCache::Key key;
+    key.path        = ConcreteAttributePath(kTestEndpointId, kTestClusterId, attributeId);
+    key.dataVersion = dataVersion;
+    key.fabricIndex = fabricIndex;
+    return key;
+}
+
+// Encodes `value` the way the reporting engine would for the attribute in `key`.
+template <typename T>
+CHIP_ERROR EncodeValue(AttributeReportIBs::Builder & builder, const ReportFragmentCache::Key & key, const T & value)
+{
+    AttributeValueEncoder encoder(builder, Access::SubjectDescriptor(), key.path, key.dataVersion);
+    return encoder.Encode(value);
+}
+
+template <typename EncodeFunction>
+CHIP_ERROR BuildReports(MutableByteSpan & buffer, EncodeFunction && encode)
+{
+    TLV::TLVWriter writer;
+    AttributeReportIBs::Builder builder;
+
+    writer.Init(buffer);
+    ReturnErrorOnFailure(builder.Init(&writer));
+    ReturnErrorOnFailure(encode(builder));
+    ReturnErrorOnFailure(builder.EndOfAttributeReportIBs());
+    ReturnErrorOnFailure(writer.Finalize());
+    buffer.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+// Stores what `encode` writes into a report, the way the reporting engine does after reading the attribute in `key`.
+template <typename EncodeFunction>
+CHIP_ERROR Store(ReportFragmentCache & cache, const ReportFragmentCache::Key & key, EncodeFunction && encode)
+{
+    uint8_t buffer[2 * CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE];
+    TLV::TLVWriter writer;
+    AttributeReportIBs::Builder builder;
+
+    writer.Init(buffer);
+    ReturnErrorOnFailure(builder.Init(&writer));
+
+    TLV::TLVWriter checkpoint;
+    builder.Checkpoint(checkpoint);
+    ReturnErrorOnFailure(encode(builder));
+    cache.Store(key, ByteSpan(checkpoint.GetWritePoint(), writer.GetLengthWritten() - checkpoint.GetLengthWritten()));
+    return CHIP_NO_ERROR;
+}
+
+TEST(TestReportFragmentCache, AppendMatchesDirectEncoding)
+{
+    ReportFragmentCache::Entry entries[kTestEntries];
+    ReportFragmentCache cache{ Span<ReportFragmentCache::Entry>(entries) };
+    auto key = MakeKey();
+
+    uint8_t directBuffer[128];
+    MutableByteSpan direct(directBuffer);
+    ASSERT_EQ(BuildReports(direct, [&](auto & builder) { return EncodeValue(builder, key, static_cast<uint32_t>(1234)); }),
+              CHIP_NO_ERROR);
+
+    uint8_t cachedBuffer[128];
+    MutableByteSpan cached(cachedBuffer);
+    EXPECT_EQ(BuildReports(cached, [&](auto & builder) { return cache.Append(key, builder); }), CHIP_ERROR_NOT_FOUND);
+
+    EXPECT_EQ(Store(cache, key, [&](auto & builder) { return EncodeValue(builder, key, static_cast<uint32_t>(1234)); }),
+              CHIP_NO_ERROR);
+
+    // Several reports (i.e. subscriptions) can be served from the same entry.
+    for (int i = 0; i < 2; i++)
+    {
+        cached = MutableByteSpan(cachedBuffer);
+        ASSERT_EQ(BuildReports(cached, [&](auto & builder) { return cache.Append(key, builder); }), CHIP_NO_ERROR);
+        EXPECT_TRUE(cached.data_equal(direct));
+    }
+}
+
+TEST(TestReportFragmentCache, KeyMustMatch)
+{
+    ReportFragmentCache::Entry entries[kTestEntries];
+    ReportFragmentCache cache{ Span<ReportFragmentCache::Entry>(entries) };
+    auto key = MakeKey();
+
+    EXPECT_EQ(Store(cache, key, [&](auto & builder) { return EncodeValue(builder, key, true); }), CHIP_NO_ERROR);
+
+    uint8_t buffer[128];
+    for (const auto & other : { MakeKey(kTestAttributeId + 1), MakeKey(kTestAttributeId, kTestDataVersion + 1),
+                                MakeKey(kTestAttributeId, kTestDataVersion, 1) })
+    {
+        MutableByteSpan output(buffer);
+        EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(other, builder); }), CHIP_ERROR_NOT_FOUND);
+    }
+
+    auto filtered           = MakeKey();
+    filtered.fabricFiltered = true;
+    MutableByteSpan output(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(filtered, builder); }), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST(TestReportFragmentCache, OversizedValue)
+{
+    ReportFragmentCache::Entry entries[kTestEntries];
+    ReportFragmentCache cache{ Span<ReportFragmentCache::Entry>(entries) };
+    auto key = MakeKey();
+
+    uint8_t large[CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE] = {};
+    EXPECT_EQ(Store(cache, key, [&](auto & builder) { return EncodeValue(builder, key, ByteSpan(large)); }), CHIP_NO_ERROR);
+
+    uint8_t buffer[2 * CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE];
+    MutableByteSpan output(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(key, builder); }), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST(TestReportFragmentCache, AppendOutOfSpaceRollsBack)
+{
+    ReportFragmentCache::Entry entries[kTestEntries];
+    ReportFragmentCache cache{ Span<ReportFragmentCache::Entry>(entries) };
+    auto key = MakeKey();
+
+    uint8_t value[32] = {};
+    EXPECT_EQ(Store(cache, key, [&](auto & builder) { return EncodeValue(builder, key, ByteSpan(value)); }), CHIP_NO_ERROR);
+
+    uint8_t buffer[24];
+    TLV::TLVWriter writer;
+    AttributeReportIBs::Builder builder;
+    writer.Init(buffer);
+    ASSERT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+    uint32_t lengthBefore = writer.GetLengthWritten();
+
+    CHIP_ERROR err = cache.Append(key, builder);
+    EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(writer.GetLengthWritten(), lengthBefore);
+}
+
+TEST(TestReportFragmentCache, Invalidate)
+{
+    ReportFragmentCache::Entry entries[kTestEntries];
+    ReportFragmentCache cache{ Span<ReportFragmentCache::Entry>(entries) };
+    auto first  = MakeKey(1);
+    auto second = MakeKey(2);
+
+    EXPECT_EQ(Store(cache, first, [&](auto & builder) { return EncodeValue(builder, first, true); }), CHIP_NO_ERROR);
+    EXPECT_EQ(Store(cache, second, [&](auto & builder) { return EncodeValue(builder, second, true); }), CHIP_NO_ERROR);
+
+    uint8_t buffer[128];
+    MutableByteSpan output(buffer);
+
+    cache.Invalidate(AttributePathParams(kTestEndpointId, kTestClusterId, 1));
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(first, builder); }), CHIP_ERROR_NOT_FOUND);
+    output = MutableByteSpan(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(second, builder); }), CHIP_NO_ERROR);
+
+    // Wildcard attribute paths cover the whole cluster.
+    cache.Invalidate(AttributePathParams(kTestEndpointId, kTestClusterId));
+    output = MutableByteSpan(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(second, builder); }), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST(TestReportFragmentCache, EvictsLeastRecentlyUsed)
+{
+    ReportFragmentCache::Entry entries[kTestEntries];
+    ReportFragmentCache cache{ Span<ReportFragmentCache::Entry>(entries) };
+    uint8_t buffer[128];
+    MutableByteSpan output(buffer);
+
+    for (AttributeId id = 0; id < kTestEntries; id++)
+    {
+        auto key = MakeKey(id);
+        EXPECT_EQ(Store(cache, key, [&](auto & builder) { return EncodeValue(builder, key, id); }), CHIP_NO_ERROR);
+    }
+
+    // Touch the oldest entry so that the second one becomes the least recently used.
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(MakeKey(0), builder); }), CHIP_NO_ERROR);
+
+    auto newKey = MakeKey(kTestEntries);
+    EXPECT_EQ(Store(cache, newKey, [&](auto & builder) { return EncodeValue(builder, newKey, true); }), CHIP_NO_ERROR);
+
+    output = MutableByteSpan(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(MakeKey(0), builder); }), CHIP_NO_ERROR);
+    output = MutableByteSpan(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(MakeKey(1), builder); }), CHIP_ERROR_NOT_FOUND);
+    output = MutableByteSpan(buffer);
+    EXPECT_EQ(BuildReports(output, [&](auto & builder) { return cache.Append(newKey, builder); }), CHIP_NO_ERROR);
+}
+
+} // namespace
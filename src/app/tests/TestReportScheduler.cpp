@@ -18,6 +18,7 @@
 
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/ReportSchedulerImpl.h>
+#include <app/reporting/SpreadReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 #include <app/tests/AppTestContext.h>
 #include <data-model-providers/codegen/Instance.h>
@@ -58,6 +59,7 @@ public:
     void TestReportTiming();
     void TestObserverCallbacks();
     void TestSynchronizedScheduler();
+    void TestSpreadScheduler();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -260,6 +262,9 @@ ReportSchedulerImpl sScheduler(&sTestTimerDelegate);
 TestTimerSynchronizedDelegate sTestTimerSynchronizedDelegate;
 SynchronizedReportSchedulerImpl syncScheduler(&sTestTimerSynchronizedDelegate);
 
+TestTimerDelegate sTestSpreadTimerDelegate;
+SpreadReportSchedulerImpl spreadScheduler(&sTestSpreadTimerDelegate);
+
 TEST_F_FROM_FIXTURE(TestReportScheduler, TestReadHandlerList)
 {
 
@@ -807,6 +812,78 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedScheduler)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestSpreadScheduler)
+{
+    NullReadHandlerCallback nullCallback;
+    // exchange context
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+
+    // Read handler pool
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Start in the middle of a slot so that the alignment on slot boundaries is visible
+    sTestSpreadTimerDelegate.SetMockSystemTimestamp(Milliseconds64(500));
+    spreadScheduler.ResetMetrics();
+
+    // One more slot worth of subscriptions than a single engine run can report, all with the same intervals
+    constexpr size_t kSlotCapacity = CHIP_IM_MAX_REPORTS_IN_FLIGHT;
+    ReadHandler * handlers[kSlotCapacity + 2];
+    for (auto & handler : handlers)
+    {
+        handler =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &spreadScheduler);
+        ASSERT_NE(nullptr, handler);
+        EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(handler, &spreadScheduler, 0, 10));
+    }
+
+    // The max interval elapses at 10.5s. The first handlers are scheduled at the start of that slot, the remaining ones are moved
+    // to the previous slot.
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(handlers); i++)
+    {
+        ReadHandlerNode * node = spreadScheduler.FindReadHandlerNode(handlers[i]);
+        ASSERT_NE(nullptr, node);
+        EXPECT_TRUE(spreadScheduler.IsReportScheduled(handlers[i]));
+        EXPECT_EQ(node->GetScheduledTimestamp().count(), (i < kSlotCapacity) ? 10000u : 9000u);
+    }
+
+    // A dirty handler is scheduled for its min interval, regardless of slot occupancy
+    ReadHandler * dirtyHandler =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &spreadScheduler);
+    ASSERT_NE(nullptr, dirtyHandler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(dirtyHandler, &spreadScheduler, 1, 10));
+    dirtyHandler->ForceDirtyState();
+    ReadHandlerNode * dirtyNode = spreadScheduler.FindReadHandlerNode(dirtyHandler);
+    ASSERT_NE(nullptr, dirtyNode);
+    EXPECT_EQ(dirtyNode->GetScheduledTimestamp().count(), 1500u);
+
+    // Handlers moved to an earlier slot report there, before their max interval
+    sTestSpreadTimerDelegate.IncrementMockTimestamp(Milliseconds64(8500));
+    EXPECT_TRUE(spreadScheduler.IsReportableNow(dirtyHandler));
+    EXPECT_TRUE(spreadScheduler.IsReportableNow(handlers[kSlotCapacity]));
+    EXPECT_TRUE(spreadScheduler.IsReportableNow(handlers[kSlotCapacity + 1]));
+    EXPECT_FALSE(spreadScheduler.IsReportableNow(handlers[0]));
+    EXPECT_GE(spreadScheduler.GetMetrics().maxQueueDepth, 2u);
+
+    // Reports sent before the max interval are not late
+    spreadScheduler.OnSubscriptionReportSent(handlers[kSlotCapacity]);
+    EXPECT_EQ(spreadScheduler.GetMetrics().lateReports, 0u);
+
+    // Reports sent after the max interval are
+    sTestSpreadTimerDelegate.IncrementMockTimestamp(Milliseconds64(2000));
+    EXPECT_TRUE(spreadScheduler.IsReportableNow(handlers[0]));
+    spreadScheduler.OnSubscriptionReportSent(handlers[0]);
+    EXPECT_EQ(spreadScheduler.GetMetrics().lateReports, 1u);
+    EXPECT_EQ(spreadScheduler.GetMetrics().maxLateness.count(), 500u);
+
+    // Handlers destroyed while waiting for an engine run no longer count towards the queue depth
+    EXPECT_GT(spreadScheduler.mNumEngineRunScheduledNodes, 0u);
+    spreadScheduler.UnregisterAllHandlers();
+    EXPECT_EQ(spreadScheduler.mNumEngineRunScheduledNodes, 0u);
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
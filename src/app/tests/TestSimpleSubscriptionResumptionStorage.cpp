@@ -21,6 +21,8 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <pw_unit_test/framework.h>
 
+#include <cstring>
+
 class TestSimpleSubscriptionResumptionStorage : public ::testing::Test
 {
 public:
@@ -403,3 +405,44 @@ TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionStateJunkData)
     EXPECT_EQ(iterator->Count(), 0u);
     iterator->Release();
 }
+
+TEST_F(TestSimpleSubscriptionResumptionStorage, TestSubscriptionStateJunkDataBeforeValidSubscription)
+{
+    chip::TestPersistentStorageDelegate storage;
+    SimpleSubscriptionResumptionStorageTest subscriptionStorage;
+    subscriptionStorage.Init(&storage);
+
+    chip::app::SubscriptionResumptionStorage::SubscriptionInfo subscriptionInfo1 = {
+        .mNodeId         = 6666,
+        .mFabricIndex    = 46,
+        .mSubscriptionId = 6,
+        .mMinInterval    = 6,
+        .mMaxInterval    = 16,
+        .mFabricFiltered = true,
+    };
+    subscriptionInfo1.mEventPaths.Calloc(1);
+    subscriptionInfo1.mEventPaths[0].mEndpointId    = 13;
+    subscriptionInfo1.mEventPaths[0].mClusterId     = 13;
+    subscriptionInfo1.mEventPaths[0].mEventId       = 13;
+    subscriptionInfo1.mEventPaths[0].mIsUrgentEvent = true;
+
+    // Junk in the first slot, so that the subscription is saved in the second one: the iterator loads both with the same
+    // buffer.
+    chip::Platform::ScopedMemoryBuffer<uint8_t> junkBytes;
+    junkBytes.Calloc(subscriptionStorage.TestMaxSubscriptionSize() / 2);
+    ASSERT_NE(junkBytes.Get(), nullptr);
+    memset(junkBytes.Get(), 0xFF, subscriptionStorage.TestMaxSubscriptionSize() / 2);
+    EXPECT_EQ(storage.SyncSetKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumption(0).KeyName(), junkBytes.Get(),
+                                      static_cast<uint16_t>(subscriptionStorage.TestMaxSubscriptionSize() / 2)),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(subscriptionStorage.Save(subscriptionInfo1), CHIP_NO_ERROR);
+
+    auto * iterator = subscriptionStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 2u);
+    TestSubscriptionInfo subscriptionInfo;
+    EXPECT_TRUE(iterator->Next(subscriptionInfo));
+    EXPECT_EQ(subscriptionInfo, subscriptionInfo1);
+    EXPECT_FALSE(iterator->Next(subscriptionInfo));
+    EXPECT_EQ(iterator->Count(), 1u);
+    iterator->Release();
+}
@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of the lookup of attribute access interfaces on a bridge that registers per-endpoint interfaces for
+ *      many endpoints, as done for each (endpoint, cluster) pair of a wildcard read.
+ *
+ *      AttributeAccessInterfaceRegistry::Get is measured as configured by CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE, next to
+ *      a ClusterPathIndex sized for the largest number of interfaces; build with CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE set
+ *      to compare the registry with and without its index.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/ClusterPathIndex.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Each bridged endpoint has interfaces for the clusters below; the wildcard read also looks up clusters without one.
+constexpr ClusterId kClustersWithInterface[]    = { 0x0006, 0x0008, 0x0300 };
+constexpr ClusterId kClustersWithoutInterface[] = { 0x001D, 0x0039 };
+constexpr size_t kInterfaceCounts[]             = { 24, 96, 384 };
+constexpr size_t kMaxInterfaces                 = 384;
+constexpr size_t kLookups                       = 1 << 16;
+constexpr size_t kMeasurements                  = 5;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile uintptr_t gSink;
+
+class BenchmarkAttributeAccess : public AttributeAccessInterface
+{
+public:
+    BenchmarkAttributeAccess(EndpointId endpointId, ClusterId clusterId) :
+        AttributeAccessInterface(MakeOptional(endpointId), clusterId)
+    {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override { return CHIP_NO_ERROR; }
+};
+
+struct Lookup
+{
+    EndpointId endpointId;
+    ClusterId clusterId;
+};
+
+// The (endpoint, cluster) pairs in the order of a wildcard read over the bridged endpoints.
+std::vector<Lookup> WildcardReadOrder(EndpointId endpointCount)
+{
+    std::vector<Lookup> lookups;
+    for (EndpointId endpointId = 1; endpointId <= endpointCount; endpointId++)
+    {
+        for (ClusterId clusterId : kClustersWithoutInterface)
+        {
+            lookups.push_back({ endpointId, clusterId });
+        }
+        for (ClusterId clusterId : kClustersWithInterface)
+        {
+            lookups.push_back({ endpointId, clusterId });
+        }
+    }
+    return lookups;
+}
+
+template <typename Function>
+double MeasureNsPerOperation(size_t operations, Function function)
+{
+    // Warm up the caches.
+    function(0);
+
+    double fastest = 0;
+    for (size_t measurement = 0; measurement < kMeasurements; measurement++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < operations; i++)
+        {
+            function(i);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double ns      = seconds * 1e9 / static_cast<double>(operations);
+        fastest        = (measurement == 0) ? ns : std::min(fastest, ns);
+    }
+    return fastest;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    AttributeAccessInterfaceRegistry & registry = AttributeAccessInterfaceRegistry::Instance();
+    static ClusterPathIndex<AttributeAccessInterface, kMaxInterfaces> index;
+
+    printf("CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE = %zu\n", static_cast<size_t>(CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE));
+    printf("ClusterPathIndex for %zu interfaces: %zu bytes\n\n", kMaxInterfaces, sizeof(index));
+    printf("%-12s %16s %16s\n", "interfaces", "registry ns", "index ns");
+
+    for (size_t interfaceCount : kInterfaceCounts)
+    {
+        const auto endpointCount = static_cast<EndpointId>(interfaceCount / MATTER_ARRAY_SIZE(kClustersWithInterface));
+
+        std::vector<std::unique_ptr<BenchmarkAttributeAccess>> interfaces;
+        for (EndpointId endpointId = 1; endpointId <= endpointCount; endpointId++)
+        {
+            for (ClusterId clusterId : kClustersWithInterface)
+            {
+                interfaces.push_back(std::make_unique<BenchmarkAttributeAccess>(endpointId, clusterId));
+                VerifyOrDie(registry.Register(interfaces.back().get()));
+                VerifyOrDie(index.Insert(endpointId, clusterId, interfaces.back().get()));
+            }
+        }
+
+        const std::vector<Lookup> lookups = WildcardReadOrder(endpointCount);
+
+        const double registryNs = MeasureNsPerOperation(kLookups, [&](size_t i) {
+            const Lookup & lookup = lookups[i % lookups.size()];
+            gSink                 = reinterpret_cast<uintptr_t>(registry.Get(lookup.endpointId, lookup.clusterId));
+        });
+        const double indexNs = MeasureNsPerOperation(kLookups, [&](size_t i) {
+            const Lookup & lookup = lookups[i % lookups.size()];
+            gSink                 = reinterpret_cast<uintptr_t>(index.Find(lookup.endpointId, lookup.clusterId));
+        });
+        printf("%-12zu %16.1f %16.1f\n", interfaceCount, registryNs, indexNs);
+
+        for (auto & attributeAccess : interfaces)
+        {
+            registry.Unregister(attributeAccess.get());
+        }
+        index.Clear();
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
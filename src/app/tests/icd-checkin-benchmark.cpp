@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of the matching of ICD check-in messages against the registered clients of a DefaultICDClientStorage,
+ *      as a function of the number of registered clients.
+ *
+ *      Each client count is measured with all the clients checking in round robin (as clients with the same check-in
+ *      interval do), with one busy client sending every other check-in, and with the same client checking in
+ *      repeatedly. The lookup alone is measured with ProcessCheckInPayload, which matches against an in-memory cache of the
+ *      client infos. The full check-in path, which also stores the updated client info as CheckInHandler does, is
+ *      measured both with ProcessCheckInPayload and with the walk of the persisted client infos that
+ *      ProcessCheckInPayload used to do.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <app/icd/client/DefaultICDClientStorage.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/secure_channel/CheckinMessage.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using chip::Protocols::SecureChannel::CheckinMessage;
+
+namespace {
+
+constexpr FabricIndex kFabricIndex  = 1;
+constexpr NodeId kFirstNodeId       = 0x1000;
+constexpr size_t kClientCounts[]    = { 1, 8, 32, 128 };
+constexpr size_t kCheckInsPerClient = 64;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile uint32_t gSink;
+
+// Keeps the logs of each client registration out of the results.
+void DiscardLog(const char *, uint8_t, const char *, va_list) {}
+
+struct CheckIn
+{
+    uint8_t payload[CheckinMessage::kMinPayloadSize];
+    size_t payloadLength;
+};
+
+CheckIn MakeCheckIn(const ICDClientInfo & clientInfo, uint32_t counter)
+{
+    CheckIn checkIn;
+    MutableByteSpan output(checkIn.payload);
+    VerifyOrDie(CheckinMessage::GenerateCheckinMessagePayload(clientInfo.aes_key_handle, clientInfo.hmac_key_handle, counter,
+                                                              ByteSpan(), output) == CHIP_NO_ERROR);
+    checkIn.payloadLength = output.size();
+    return checkIn;
+}
+
+// Previous implementation of ProcessCheckInPayload, which reloaded the client infos from persistent storage.
+CHIP_ERROR ProcessCheckInPayloadFromStorage(DefaultICDClientStorage & storage, const ByteSpan & payload,
+                                            ICDClientInfo & clientInfo, uint32_t & counter)
+{
+    uint8_t appDataBuffer[CheckinMessage::kMinPayloadSize];
+    MutableByteSpan appData(appDataBuffer);
+    auto * iterator = storage.IterateICDClientInfo();
+    VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
+    while (iterator->Next(clientInfo))
+    {
+        if (CheckinMessage::ParseCheckinMessagePayload(clientInfo.aes_key_handle, clientInfo.hmac_key_handle, payload, counter,
+                                                       appData) == CHIP_NO_ERROR)
+        {
+            iterator->Release();
+            return CHIP_NO_ERROR;
+        }
+    }
+    iterator->Release();
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+template <typename Function>
+double MeasureNsPerCheckIn(const std::vector<CheckIn> & checkIns, Function function)
+{
+    // Warm up the caches.
+    function(checkIns.front());
+
+    auto start = std::chrono::steady_clock::now();
+    for (const CheckIn & checkIn : checkIns)
+    {
+        function(checkIn);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / static_cast<double>(checkIns.size());
+}
+
+void RunClientCount(size_t clientCount)
+{
+    TestPersistentStorageDelegate clientInfoStorage;
+    Crypto::DefaultSessionKeystore keystore;
+    DefaultICDClientStorage storage;
+    VerifyOrDie(storage.Init(&clientInfoStorage, &keystore) == CHIP_NO_ERROR);
+    VerifyOrDie(storage.UpdateFabricList(kFabricIndex) == CHIP_NO_ERROR);
+
+    std::vector<ICDClientInfo> clientInfos(clientCount);
+    for (size_t i = 0; i < clientCount; i++)
+    {
+        uint8_t key[Crypto::kAES_CCM128_Key_Length] = {};
+        key[0]                                      = static_cast<uint8_t>(i);
+        key[1]                                      = static_cast<uint8_t>(i >> 8);
+
+        clientInfos[i].peer_node = ScopedNodeId(kFirstNodeId + i, kFabricIndex);
+        VerifyOrDie(storage.SetKey(clientInfos[i], ByteSpan(key)) == CHIP_NO_ERROR);
+        VerifyOrDie(storage.StoreEntry(clientInfos[i]) == CHIP_NO_ERROR);
+    }
+
+    std::vector<CheckIn> roundRobin;
+    std::vector<CheckIn> busyClient;
+    std::vector<CheckIn> sameClient;
+    uint32_t counter = 1;
+    for (size_t i = 0; i < clientCount * kCheckInsPerClient; i++)
+    {
+        roundRobin.push_back(MakeCheckIn(clientInfos[i % clientCount], counter));
+        busyClient.push_back(MakeCheckIn(clientInfos[(i % 2 == 0) ? clientCount - 1 : (i / 2) % clientCount], counter));
+        sameClient.push_back(MakeCheckIn(clientInfos.back(), counter));
+        counter++;
+    }
+
+    auto lookupCached = [&storage](const CheckIn & checkIn) {
+        ICDClientInfo clientInfo;
+        uint32_t checkInCounter;
+        VerifyOrDie(storage.ProcessCheckInPayload(ByteSpan(checkIn.payload, checkIn.payloadLength), clientInfo, checkInCounter) ==
+                    CHIP_NO_ERROR);
+        gSink = checkInCounter;
+    };
+    // The lookup followed by the StoreEntry that CheckInHandler does for every check-in which needs no key refresh.
+    auto checkInCached = [&storage](const CheckIn & checkIn) {
+        ICDClientInfo clientInfo;
+        uint32_t checkInCounter;
+        VerifyOrDie(storage.ProcessCheckInPayload(ByteSpan(checkIn.payload, checkIn.payloadLength), clientInfo, checkInCounter) ==
+                    CHIP_NO_ERROR);
+        clientInfo.offset = checkInCounter - clientInfo.start_icd_counter;
+        VerifyOrDie(storage.StoreEntry(clientInfo) == CHIP_NO_ERROR);
+        gSink = checkInCounter;
+    };
+    auto checkInPersisted = [&storage](const CheckIn & checkIn) {
+        ICDClientInfo clientInfo;
+        uint32_t checkInCounter;
+        VerifyOrDie(ProcessCheckInPayloadFromStorage(storage, ByteSpan(checkIn.payload, checkIn.payloadLength), clientInfo,
+                                                     checkInCounter) == CHIP_NO_ERROR);
+        clientInfo.offset = checkInCounter - clientInfo.start_icd_counter;
+        VerifyOrDie(storage.StoreEntry(clientInfo) == CHIP_NO_ERROR);
+        gSink = checkInCounter;
+    };
+
+    const struct
+    {
+        const char * name;
+        const std::vector<CheckIn> & checkIns;
+    } patterns[] = {
+        { "round robin", roundRobin },
+        { "busy client", busyClient },
+        { "same client", sameClient },
+    };
+    for (const auto & pattern : patterns)
+    {
+        double lookupNs    = MeasureNsPerCheckIn(pattern.checkIns, lookupCached);
+        double cachedNs    = MeasureNsPerCheckIn(pattern.checkIns, checkInCached);
+        double persistedNs = MeasureNsPerCheckIn(pattern.checkIns, checkInPersisted);
+        printf("%8zu %-12s %16.0f %16.0f %16.0f\n", clientCount, pattern.name, lookupNs, cachedNs, persistedNs);
+    }
+
+    storage.Shutdown();
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    Logging::SetLogRedirectCallback(DiscardLog);
+
+    printf("%8s %-12s %16s %16s %16s\n", "clients", "check-ins", "cache lookup", "cache + store", "walk + store");
+    printf("%8s %-12s %16s %16s %16s\n", "", "", "ns / check-in", "ns / check-in", "ns / check-in");
+    for (size_t clientCount : kClientCounts)
+    {
+        RunClientCount(clientCount);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
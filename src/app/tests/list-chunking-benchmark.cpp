@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of the encoding of large list attributes by AttributeValueEncoder, chunked across as many reports as
+ *      needed, as a function of the number of list items.
+ *
+ *      Each list is encoded into fixed-size report buffers, one report after the other, the way the reporting engine
+ *      does, so that the time includes AttributeValueEncoder working out which list items go in each report.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+using AccessControlEntry  = AccessControl::Structs::AccessControlEntryStruct::Type;
+using AccessControlTarget = AccessControl::Structs::AccessControlTargetStruct::Type;
+
+constexpr FabricIndex kFabricIndex        = 1;
+constexpr uint32_t kReportBufferSize      = 1024;
+constexpr size_t kAccessControlEntries[]  = { 16, 64, 256 };
+constexpr size_t kStrings[]               = { 64, 512, 2048 };
+constexpr size_t kMeasurements            = 5;
+constexpr size_t kListItemsPerMeasurement = 1 << 16;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile uint32_t gSink;
+
+// Encodes the whole list, one report at a time, as the reporting engine does.  Returns the number of reports.
+template <typename ListGenerator>
+uint32_t EncodeListInReports(ListGenerator generator)
+{
+    Access::SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = kFabricIndex;
+    const ConcreteAttributePath path(1, AccessControl::Id, AccessControl::Attributes::Acl::Id);
+
+    AttributeEncodeState state;
+    uint32_t reports = 0;
+    while (true)
+    {
+        uint8_t reportBuffer[kReportBufferSize];
+        TLV::TLVWriter writer;
+        writer.Init(reportBuffer);
+        AttributeReportIBs::Builder attributeReportIBs;
+        VerifyOrDie(attributeReportIBs.Init(&writer) == CHIP_NO_ERROR);
+
+        AttributeValueEncoder encoder(attributeReportIBs, subjectDescriptor, path, 0, false, state);
+        CHIP_ERROR err = encoder.EncodeList(generator);
+        gSink          = writer.GetLengthWritten();
+        reports++;
+        if (err == CHIP_NO_ERROR)
+        {
+            return reports;
+        }
+
+        VerifyOrDie(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        state = encoder.GetState();
+        VerifyOrDie(state.AllowPartialData());
+    }
+}
+
+template <typename ListGenerator>
+void Measure(const char * name, size_t listItems, ListGenerator generator)
+{
+    // Warm up the caches.
+    const uint32_t reports = EncodeListInReports(generator);
+
+    const size_t iterations = std::max<size_t>(kListItemsPerMeasurement / listItems, 1);
+    double fastest          = 0;
+    for (size_t measurement = 0; measurement < kMeasurements; measurement++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            EncodeListInReports(generator);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double ns      = seconds * 1e9 / static_cast<double>(iterations);
+        fastest        = (measurement == 0) ? ns : std::min(fastest, ns);
+    }
+
+    printf("%-12s %8zu %8u %12.0f %12.1f\n", name, listItems, reports, fastest, fastest / static_cast<double>(listItems));
+}
+
+void MeasureAccessControlEntries(size_t count)
+{
+    static const uint64_t subjects[] = { 0x0000000000000001, 0x0000000000000002, 0xFFFFFFFD00010001, 0x000000000000ABCD };
+    AccessControlTarget targets[3];
+    targets[0].cluster.SetNonNull(OnOff::Id);
+    targets[1].endpoint.SetNonNull(1);
+    targets[2].deviceType.SetNonNull(0x0100);
+
+    std::vector<AccessControlEntry> entries(count);
+    for (auto & entry : entries)
+    {
+        entry.privilege = AccessControl::AccessControlEntryPrivilegeEnum::kOperate;
+        entry.authMode  = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+        entry.subjects.SetNonNull(subjects);
+        entry.targets.SetNonNull(targets);
+        entry.fabricIndex = kFabricIndex;
+    }
+
+    Measure("acl entries", count, [&entries](const auto & encoder) -> CHIP_ERROR {
+        for (const auto & entry : entries)
+        {
+            ReturnErrorOnFailure(encoder.Encode(entry));
+        }
+        return CHIP_NO_ERROR;
+    });
+}
+
+void MeasureStrings(size_t count)
+{
+    std::vector<CharSpan> strings(count, "endpoint-label"_span);
+
+    Measure("strings", count, [&strings](const auto & encoder) -> CHIP_ERROR {
+        for (const auto & string : strings)
+        {
+            ReturnErrorOnFailure(encoder.Encode(string));
+        }
+        return CHIP_NO_ERROR;
+    });
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    printf("%-12s %8s %8s %12s %12s\n", "list", "items", "reports", "ns / list", "ns / item");
+    for (size_t count : kAccessControlEntries)
+    {
+        MeasureAccessControlEntries(count);
+    }
+    for (size_t count : kStrings)
+    {
+        MeasureStrings(count);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
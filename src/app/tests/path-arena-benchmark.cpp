@@ -0,0 +1,194 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the path lists that a ReadHandler builds for each read or subscription, with heap pools: nodes
+ *      from the heap ObjectPools of the InteractionModelEngine (one node at a time) against nodes from per-list
+ *      PathArenas (released with the list).
+ *
+ *      Each setup builds an attribute path list, an event path list and a data version filter list, then releases them,
+ *      while a few other subscriptions hold paths of the same size in the shared pools.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/DataVersionFilter.h>
+#include <app/EventPathParams.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ChunkedArena.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/Pool.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using PathArena = ChunkedArena<CHIP_IM_PATH_ARENA_CHUNK_SIZE>;
+
+constexpr size_t kOtherSubscriptions = 4;
+constexpr size_t kIterations         = 200;
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+template <typename T>
+using NodePool = ObjectPool<SingleLinkedListNode<T>, 0, ObjectPoolMem::kHeap>;
+// A heap ObjectPool allocates each object, and a node to track it.
+constexpr size_t kPoolAllocationsPerNode = 2;
+template <typename T>
+constexpr size_t kPoolBytesPerNode = sizeof(SingleLinkedListNode<T>) + sizeof(internal::HeapObjectListNode);
+#else
+// Static pools have no allocations, but no arenas either: this only measures the pools.
+template <typename T>
+using NodePool = ObjectPool<SingleLinkedListNode<T>, 1024 * (kOtherSubscriptions + 1), ObjectPoolMem::kInline>;
+constexpr size_t kPoolAllocationsPerNode = 0;
+template <typename T>
+constexpr size_t kPoolBytesPerNode = 0;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+NodePool<AttributePathParams> gAttributePathPool;
+NodePool<EventPathParams> gEventPathPool;
+NodePool<DataVersionFilter> gDataVersionFilterPool;
+
+// Same as InteractionModelEngine::PushFront and ReleasePool.
+template <typename T>
+bool PushFront(SingleLinkedListNode<T> *& list, const T & value, NodePool<T> & pool, PathArena * arena)
+{
+    SingleLinkedListNode<T> * node = (arena != nullptr) ? arena->New<SingleLinkedListNode<T>>() : pool.CreateObject();
+    VerifyOrReturnValue(node != nullptr, false);
+    node->mValue = value;
+    node->mpNext = list;
+    list         = node;
+    return true;
+}
+
+template <typename T>
+void Release(SingleLinkedListNode<T> *& list, NodePool<T> & pool, PathArena * arena)
+{
+    if (arena != nullptr)
+    {
+        arena->Release();
+    }
+    while (arena == nullptr && list != nullptr)
+    {
+        SingleLinkedListNode<T> * next = list->mpNext;
+        pool.ReleaseObject(list);
+        list = next;
+    }
+    list = nullptr;
+}
+
+struct Handler
+{
+    SingleLinkedListNode<AttributePathParams> * attributePaths = nullptr;
+    SingleLinkedListNode<EventPathParams> * eventPaths         = nullptr;
+    SingleLinkedListNode<DataVersionFilter> * filters          = nullptr;
+    PathArena attributePathArena;
+    PathArena eventPathArena;
+    PathArena filterArena;
+
+    // Heap allocations and bytes, allocator overhead excluded, held by the lists.
+    struct Usage
+    {
+        size_t allocations;
+        size_t bytes;
+    };
+
+    Usage Setup(size_t pathCount, bool useArenas)
+    {
+        for (size_t i = 0; i < pathCount; i++)
+        {
+            AttributePathParams path(static_cast<EndpointId>(i % 8), static_cast<ClusterId>(i), static_cast<AttributeId>(i));
+            VerifyOrDie(PushFront(attributePaths, path, gAttributePathPool, useArenas ? &attributePathArena : nullptr));
+        }
+        for (size_t i = 0; i < pathCount / 8; i++)
+        {
+            EventPathParams path(static_cast<EndpointId>(i % 8), static_cast<ClusterId>(i), static_cast<EventId>(i));
+            VerifyOrDie(PushFront(eventPaths, path, gEventPathPool, useArenas ? &eventPathArena : nullptr));
+        }
+        for (size_t i = 0; i < pathCount / 2; i++)
+        {
+            DataVersionFilter filter(static_cast<EndpointId>(i % 8), static_cast<ClusterId>(i), static_cast<DataVersion>(i));
+            VerifyOrDie(PushFront(filters, filter, gDataVersionFilterPool, useArenas ? &filterArena : nullptr));
+        }
+
+        if (useArenas)
+        {
+            return { attributePathArena.ChunkCount() + eventPathArena.ChunkCount() + filterArena.ChunkCount(),
+                     attributePathArena.AllocatedSize() + eventPathArena.AllocatedSize() + filterArena.AllocatedSize() };
+        }
+        return { kPoolAllocationsPerNode * (pathCount + pathCount / 8 + pathCount / 2),
+                 kPoolBytesPerNode<AttributePathParams> * pathCount + kPoolBytesPerNode<EventPathParams> * (pathCount / 8) +
+                     kPoolBytesPerNode<DataVersionFilter> * (pathCount / 2) };
+    }
+
+    void Teardown(bool useArenas)
+    {
+        Release(attributePaths, gAttributePathPool, useArenas ? &attributePathArena : nullptr);
+        Release(eventPaths, gEventPathPool, useArenas ? &eventPathArena : nullptr);
+        Release(filters, gDataVersionFilterPool, useArenas ? &filterArena : nullptr);
+    }
+};
+
+void Run(size_t pathCount, bool useArenas)
+{
+    Handler others[kOtherSubscriptions];
+    for (auto & other : others)
+    {
+        other.Setup(pathCount, useArenas);
+    }
+
+    Handler::Usage usage = {};
+    auto start           = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        Handler handler;
+        usage = handler.Setup(pathCount, useArenas);
+        handler.Teardown(useArenas);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    for (auto & other : others)
+    {
+        other.Teardown(useArenas);
+    }
+
+    double us = std::chrono::duration<double, std::micro>(end - start).count() / kIterations;
+    printf("%-12s %6zu %12zu %12zu %16.1f\n", useArenas ? "arenas" : "heap pools", pathCount, usage.allocations, usage.bytes,
+           us);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    printf("%-12s %6s %12s %12s %16s\n", "nodes from", "paths", "allocations", "heap bytes", "setup+teardown (us)");
+    for (size_t pathCount : { 1, 16, 128, 512 })
+    {
+        Run(pathCount, false);
+        Run(pathCount, true);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of chunked list attribute writes (an empty ReplaceAll followed by one AppendItem write per element),
+ *      as delivered to an AttributeAccessInterface by the WriteHandler:
+ *        - streamed into a PersistentList by PersistentListAttributeWriter, committed by the list write end;
+ *        - buffered in RAM until the list write end, then stored as a single value, as most clusters do today.
+ *
+ *      The storage is the in-memory TestPersistentStorageDelegate, so the latency is the cost of the write path itself,
+ *      without the cost of a flash write. The transient RAM is what the write holds between its first element and the
+ *      list write end: one element for the streaming writer, the whole list for the buffered one.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <app/AttributeValueDecoder.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/PersistentListAttributeWriter.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/PersistentList.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using ListOperation = ConcreteDataAttributePath::ListOperation;
+
+constexpr size_t kElementSize     = 32;
+constexpr size_t kListLengths[]   = { 10, 100, 1000 };
+constexpr uint16_t kMaxElements   = 1000;
+constexpr size_t kMeasurements    = 5;
+constexpr char kKeyPrefix[]       = "g/bench";
+constexpr char kBufferedListKey[] = "g/bench/buffered";
+
+using Writer = PersistentListAttributeWriter<ByteSpan, kElementSize>;
+
+CHIP_ERROR SerializeElement(const ByteSpan & element, MutableByteSpan & out)
+{
+    return CopySpanToMutableSpan(element, out);
+}
+
+// The TLV of one AppendItem write of the element `index`, or of an empty list for the ReplaceAll.
+std::vector<uint8_t> EncodeWrite(bool emptyList, size_t index)
+{
+    std::vector<uint8_t> buffer(kElementSize + 16);
+    TLV::TLVWriter writer;
+    writer.Init(buffer.data(), buffer.size());
+    if (emptyList)
+    {
+        TLV::TLVType outer;
+        VerifyOrDie(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outer) == CHIP_NO_ERROR);
+        VerifyOrDie(writer.EndContainer(outer) == CHIP_NO_ERROR);
+    }
+    else
+    {
+        uint8_t element[kElementSize];
+        memset(element, static_cast<int>(index & 0xFF), sizeof(element));
+        VerifyOrDie(writer.Put(TLV::AnonymousTag(), ByteSpan(element)) == CHIP_NO_ERROR);
+    }
+    VerifyOrDie(writer.Finalize() == CHIP_NO_ERROR);
+    buffer.resize(writer.GetLengthWritten());
+    return buffer;
+}
+
+// Delivers the writes of a chunked list write to `write`, as the WriteHandler does.
+template <typename Function>
+void DeliverChunkedWrite(const std::vector<std::vector<uint8_t>> & writes, Function write)
+{
+    for (size_t i = 0; i < writes.size(); i++)
+    {
+        TLV::TLVReader reader;
+        reader.Init(writes[i].data(), writes[i].size());
+        VerifyOrDie(reader.Next() == CHIP_NO_ERROR);
+
+        ConcreteDataAttributePath path(1, 2, 3);
+        path.mListOp = (i == 0) ? ListOperation::ReplaceAll : ListOperation::AppendItem;
+        AttributeValueDecoder decoder(reader, Access::SubjectDescriptor());
+        VerifyOrDie(write(path, decoder) == CHIP_NO_ERROR);
+    }
+}
+
+template <typename Function>
+double MeasureMsPerWrite(Function function)
+{
+    // Warm up the caches.
+    function();
+
+    double fastest = 0;
+    for (size_t measurement = 0; measurement < kMeasurements; measurement++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        fastest   = (measurement == 0) ? ms : std::min(fastest, ms);
+    }
+    return fastest;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    printf("%zu-byte elements, chunked list writes into TestPersistentStorageDelegate\n\n", kElementSize);
+    printf("%-10s %14s %14s %16s %16s %12s\n", "elements", "streamed ms", "buffered ms", "streamed RAM B", "buffered RAM B",
+           "stored keys");
+
+    for (size_t length : kListLengths)
+    {
+        std::vector<std::vector<uint8_t>> writes;
+        writes.push_back(EncodeWrite(/* emptyList = */ true, 0));
+        for (size_t i = 0; i < length; i++)
+        {
+            writes.push_back(EncodeWrite(/* emptyList = */ false, i));
+        }
+
+        TestPersistentStorageDelegate streamedStorage;
+        PersistentList list;
+        VerifyOrDie(list.Init(&streamedStorage, kKeyPrefix, kMaxElements) == CHIP_NO_ERROR);
+        Writer writer(list);
+
+        const double streamedMs = MeasureMsPerWrite([&]() {
+            DeliverChunkedWrite(writes, [&](const ConcreteDataAttributePath & path, AttributeValueDecoder & decoder) {
+                return writer.Write(path, decoder, SerializeElement);
+            });
+            VerifyOrDie(writer.OnListWriteEnd(true) == CHIP_NO_ERROR);
+        });
+        VerifyOrDie(list.Count() == length);
+
+        TestPersistentStorageDelegate bufferedStorage;
+        std::vector<uint8_t> bufferedList;
+        const double bufferedMs = MeasureMsPerWrite([&]() {
+            // The whole list is held until the list write end, then stored at once.
+            bufferedList.clear();
+            bufferedList.reserve(length * kElementSize);
+            DeliverChunkedWrite(writes, [&](const ConcreteDataAttributePath & path, AttributeValueDecoder & decoder) {
+                VerifyOrReturnError(path.mListOp == ListOperation::AppendItem, CHIP_NO_ERROR);
+                ByteSpan element;
+                ReturnErrorOnFailure(decoder.Decode(element));
+                bufferedList.insert(bufferedList.end(), element.begin(), element.end());
+                return CHIP_NO_ERROR;
+            });
+            VerifyOrDie(bufferedStorage.SyncSetKeyValue(kBufferedListKey, bufferedList.data(),
+                                                        static_cast<uint16_t>(bufferedList.size())) == CHIP_NO_ERROR);
+        });
+
+        printf("%-10zu %14.3f %14.3f %16zu %16zu %12zu\n", length, streamedMs, bufferedMs,
+               Writer::kMaxStoredElementSize + sizeof(PersistentList), bufferedList.capacity(), streamedStorage.GetNumKeys());
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,325 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of the TLV parsing of ReportData messages: walking every element, skipping the whole message, and
+ *      parsing the attribute reports the way ReadClient does.
+ *
+ *      Each payload is parsed from a contiguous buffer, and from the same buffer handed out by a TLVBackingStore,
+ *      which makes TLVReader take its general, buffer by buffer, path.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/ReportDataMessage.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::TLV;
+
+namespace {
+
+// Amount of payload parsed by each measurement, and number of measurements of which the fastest is reported.
+constexpr size_t kBytesPerMeasurement = 16 * 1024 * 1024;
+constexpr size_t kMeasurements        = 5;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile size_t gSink;
+
+/**
+ * A backing store that hands out a whole payload as its only buffer.
+ */
+class SingleBufferBackingStore : public TLVBackingStore
+{
+public:
+    SingleBufferBackingStore(const std::vector<uint8_t> & payload) : mPayload(payload) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mPayload.data();
+        bufLen   = static_cast<uint32_t>(mPayload.size());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufLen = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const std::vector<uint8_t> & mPayload;
+};
+
+/**
+ * Builds a ReportData message with one attribute report per call of writeValue, which writes the value of the
+ * attribute to the given writer with the given tag.
+ */
+template <typename WriteValue>
+std::vector<uint8_t> BuildReportData(size_t attributeCount, size_t bufferSize, WriteValue writeValue)
+{
+    std::vector<uint8_t> payload(bufferSize);
+    TLVWriter writer;
+    writer.Init(payload.data(), payload.size());
+
+    ReportDataMessage::Builder reportData;
+    VerifyOrDie(reportData.Init(&writer) == CHIP_NO_ERROR);
+    reportData.SubscriptionId(0x12345678);
+    AttributeReportIBs::Builder & attributeReports = reportData.CreateAttributeReportIBs();
+    for (size_t i = 0; i < attributeCount; i++)
+    {
+        AttributeDataIB::Builder & attributeData = attributeReports.CreateAttributeReport().CreateAttributeData();
+        attributeData.DataVersion(static_cast<DataVersion>(0x5A000000 + i));
+        attributeData.CreatePath()
+            .Endpoint(static_cast<EndpointId>(1 + i % 4))
+            .Cluster(static_cast<ClusterId>(0x0006 + i % 3))
+            .Attribute(static_cast<AttributeId>(i))
+            .EndOfAttributePathIB();
+        VerifyOrDie(writeValue(*attributeData.GetWriter(), ContextTag(AttributeDataIB::Tag::kData), i) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeData.EndOfAttributeDataIB() == CHIP_NO_ERROR);
+        VerifyOrDie(attributeReports.GetAttributeReport().EndOfAttributeReportIB() == CHIP_NO_ERROR);
+    }
+    VerifyOrDie(attributeReports.EndOfAttributeReportIBs() == CHIP_NO_ERROR);
+    reportData.MoreChunkedMessages(false);
+    VerifyOrDie(reportData.EndOfReportDataMessage() == CHIP_NO_ERROR);
+    VerifyOrDie(writer.Finalize() == CHIP_NO_ERROR);
+
+    payload.resize(writer.GetLengthWritten());
+    return payload;
+}
+
+// Scalar and short string attributes, as in the reports of a subscription to a light.
+CHIP_ERROR WriteScalarValue(TLVWriter & writer, Tag tag, size_t i)
+{
+    switch (i % 4)
+    {
+    case 0:
+        return writer.PutBoolean(tag, (i & 1) != 0);
+    case 1:
+        return writer.Put(tag, static_cast<uint8_t>(i));
+    case 2:
+        return writer.Put(tag, static_cast<uint32_t>(i * 1000));
+    default:
+        return writer.PutString(tag, "Kitchen light");
+    }
+}
+
+// A list of structures like the fabric descriptors of the Operational Credentials cluster.
+template <size_t kEntryCount>
+CHIP_ERROR WriteStructListValue(TLVWriter & writer, Tag tag, size_t i)
+{
+    static const uint8_t kRootPublicKey[65] = { 0x04 };
+    TLVType listType;
+    ReturnErrorOnFailure(writer.StartContainer(tag, kTLVType_Array, listType));
+    for (size_t entry = 0; entry < kEntryCount; entry++)
+    {
+        TLVType structType;
+        ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, structType));
+        ReturnErrorOnFailure(writer.Put(ContextTag(1), ByteSpan(kRootPublicKey)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<uint16_t>(0xFFF1)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(3), static_cast<uint64_t>(0x2906C908D115D362 + entry)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(4), static_cast<uint64_t>(0xDEDEDEDE00010001 + entry)));
+        ReturnErrorOnFailure(writer.PutString(ContextTag(5), "Home"));
+        ReturnErrorOnFailure(writer.Put(ContextTag(254), static_cast<uint8_t>(1 + entry % 254)));
+        ReturnErrorOnFailure(writer.EndContainer(structType));
+    }
+    return writer.EndContainer(listType);
+}
+
+CHIP_ERROR WalkElements(TLVReader & reader, size_t & elementCount)
+{
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        elementCount++;
+        if (TLVTypeIsContainer(reader.GetType()))
+        {
+            TLVType containerType;
+            ReturnErrorOnFailure(reader.EnterContainer(containerType));
+            ReturnErrorOnFailure(WalkElements(reader, elementCount));
+            ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        }
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+size_t WalkMessage(TLVReader & reader)
+{
+    size_t elementCount = 0;
+    VerifyOrDie(WalkElements(reader, elementCount) == CHIP_NO_ERROR);
+    return elementCount;
+}
+
+size_t SkipMessage(TLVReader & reader)
+{
+    VerifyOrDie(reader.Next() == CHIP_NO_ERROR);
+    VerifyOrDie(reader.Next() == CHIP_END_OF_TLV);
+    return reader.GetLengthRead();
+}
+
+// Parses the attribute reports of the message as ReadClient does, and walks the data of each attribute as its decoding
+// would.
+size_t ParseMessage(TLVReader & reader)
+{
+    ReportDataMessage::Parser reportData;
+    AttributeReportIBs::Parser attributeReports;
+    TLVReader attributeReportsReader;
+    SubscriptionId subscriptionId;
+    bool moreChunkedMessages;
+    size_t elementCount = 0;
+
+    VerifyOrDie(reportData.Init(reader) == CHIP_NO_ERROR);
+    VerifyOrDie(reportData.GetSubscriptionId(&subscriptionId) == CHIP_NO_ERROR);
+    VerifyOrDie(reportData.GetMoreChunkedMessages(&moreChunkedMessages) == CHIP_NO_ERROR);
+    VerifyOrDie(reportData.GetAttributeReportIBs(&attributeReports) == CHIP_NO_ERROR);
+
+    attributeReports.GetReader(&attributeReportsReader);
+    CHIP_ERROR err;
+    while ((err = attributeReportsReader.Next()) == CHIP_NO_ERROR)
+    {
+        AttributeReportIB::Parser attributeReport;
+        AttributeStatusIB::Parser attributeStatus;
+        AttributeDataIB::Parser attributeData;
+        AttributePathIB::Parser path;
+        ConcreteDataAttributePath attributePath;
+        DataVersion version;
+        TLVReader dataReader;
+
+        TLVReader attributeReportReader = attributeReportsReader;
+        VerifyOrDie(attributeReport.Init(attributeReportReader) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeReport.GetAttributeStatus(&attributeStatus) == CHIP_END_OF_TLV);
+        VerifyOrDie(attributeReport.GetAttributeData(&attributeData) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeData.GetPath(&path) == CHIP_NO_ERROR);
+        VerifyOrDie(path.GetConcreteAttributePath(attributePath) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeData.GetDataVersion(&version) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeData.GetData(&dataReader) == CHIP_NO_ERROR);
+
+        elementCount++;
+        if (TLVTypeIsContainer(dataReader.GetType()))
+        {
+            TLVType containerType;
+            VerifyOrDie(dataReader.EnterContainer(containerType) == CHIP_NO_ERROR);
+            VerifyOrDie(WalkElements(dataReader, elementCount) == CHIP_NO_ERROR);
+        }
+    }
+    VerifyOrDie(err == CHIP_END_OF_TLV);
+    VerifyOrDie(reportData.ExitContainer() == CHIP_NO_ERROR);
+    return elementCount;
+}
+
+template <typename Function>
+double MeasureNsPerMessage(const std::vector<uint8_t> & payload, bool useBackingStore, Function function)
+{
+    SingleBufferBackingStore backingStore(payload);
+    size_t iterations = kBytesPerMeasurement / payload.size();
+
+    auto parse = [&]() {
+        TLVReader reader;
+        if (useBackingStore)
+        {
+            VerifyOrDie(reader.Init(backingStore, static_cast<uint32_t>(payload.size())) == CHIP_NO_ERROR);
+        }
+        else
+        {
+            reader.Init(payload.data(), payload.size());
+        }
+        gSink = function(reader);
+    };
+
+    // Warm up the caches.
+    parse();
+
+    double fastestSeconds = 0;
+    for (size_t measurement = 0; measurement < kMeasurements; measurement++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            parse();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (measurement == 0 || seconds < fastestSeconds)
+        {
+            fastestSeconds = seconds;
+        }
+    }
+    return fastestSeconds * 1e9 / static_cast<double>(iterations);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    const struct
+    {
+        const char * name;
+        std::vector<uint8_t> payload;
+    } payloads[] = {
+        { "scalars", BuildReportData(24, 2048, WriteScalarValue) },
+        { "struct list", BuildReportData(1, 2048, WriteStructListValue<8>) },
+        { "large list", BuildReportData(1, 128 * 1024, WriteStructListValue<512>) },
+    };
+
+    const struct
+    {
+        const char * name;
+        size_t (*function)(TLVReader & reader);
+    } operations[] = {
+        { "walk all elements", WalkMessage },
+        { "skip message", SkipMessage },
+        { "parse as ReadClient", ParseMessage },
+    };
+
+    printf("%-12s %8s %-20s %16s %16s\n", "payload", "bytes", "operation", "contiguous", "backing store");
+    printf("%-12s %8s %-20s %16s %16s\n", "", "", "", "ns / message", "ns / message");
+    for (const auto & payload : payloads)
+    {
+        for (const auto & operation : operations)
+        {
+            double contiguousNs   = MeasureNsPerMessage(payload.payload, false, operation.function);
+            double backingStoreNs = MeasureNsPerMessage(payload.payload, true, operation.function);
+            printf("%-12s %8zu %-20s %16.0f %16.0f\n", payload.name, payload.payload.size(), operation.name, contiguousNs,
+                   backingStoreNs);
+        }
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
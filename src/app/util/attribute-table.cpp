@@ -26,6 +26,7 @@
 #include <app/util/odd-sized-integers.h>
 #include <lib/core/CHIPConfig.h>
 
+#include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
 #include <protocols/interaction_model/Constants.h>
 
@@ -470,6 +471,12 @@ Status emAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWrite
     {
         emberAfAttributeChanged(path.mEndpointId, path.mClusterId, path.mAttributeId, input.changeListener);
     }
+    else
+    {
+        // The data version stays the same, so reports encoded from the previous value must not be reused.
+        InteractionModelEngine::GetInstance()->GetReportingEngine().InvalidateCachedReports(
+            AttributePathParams(path.mEndpointId, path.mClusterId, path.mAttributeId));
+    }
 
     // Post write attribute callback for all attributes changes, regardless
     // of cluster.
@@ -537,6 +537,10 @@ CHIP_ERROR DeviceCommissioner::Init(CommissionerInitParams params)
     mSetUpCodePairer.SetBleLayer(mSystemState->BleLayer());
 #endif // CONFIG_NETWORK_LAYER_BLE
 
+#if CHIP_CONFIG_PASE_WS_CACHE_SIZE > 0
+    ReturnErrorOnFailure(mPASEWSCache.Init(CHIP_CONFIG_PASE_WS_CACHE_SIZE));
+#endif
+
     return CHIP_NO_ERROR;
 }
 
@@ -558,6 +562,10 @@ void DeviceCommissioner::Shutdown()
 
     CancelCommissioningInteractions();
 
+    // The queued nodes are released with the rest of the commissionee devices below.
+    mSystemState->SystemLayer()->CancelTimer(StartQueuedCommissioning, this);
+    mNumQueuedCommissionings = 0;
+
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
     if (mUdcTransportMgr != nullptr)
     {
@@ -584,6 +592,10 @@ void DeviceCommissioner::Shutdown()
         return Loop::Continue;
     });
 
+#if CHIP_CONFIG_PASE_WS_CACHE_SIZE > 0
+    mPASEWSCache.Shutdown();
+#endif
+
     DeviceController::Shutdown();
 }
 
@@ -866,6 +878,12 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
     exchangeCtxt = mSystemState->ExchangeMgr()->NewContext(session.Value(), &device->GetPairing());
     VerifyOrExit(exchangeCtxt != nullptr, err = CHIP_ERROR_INTERNAL);
 
+#if CHIP_CONFIG_PASE_WS_CACHE_SIZE > 0
+    device->GetPairing().SetSpake2pWSCache(&mPASEWSCache);
+#endif
+#if CHIP_CONFIG_PASE_COMPUTE_WS_IN_BACKGROUND
+    device->GetPairing().SetComputeWSInBackground(true);
+#endif
     err = device->GetPairing().Pair(*mSystemState->SessionMgr(), params.GetSetupPINCode(), GetLocalMRPConfig(), exchangeCtxt, this);
     SuccessOrExit(err);
 
@@ -1016,6 +1034,91 @@ CHIP_ERROR DeviceCommissioner::Commission(NodeId remoteDeviceId)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DeviceCommissioner::QueueCommissioning(NodeId remoteDeviceId, const CommissioningParameters & params)
+{
+    MATTER_TRACE_SCOPE("QueueCommissioning", "DeviceCommissioner");
+    VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDefaultCommissioner != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    CommissioneeDeviceProxy * device = FindCommissioneeDevice(remoteDeviceId);
+    VerifyOrReturnError(device != nullptr && device->IsSecureConnected(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(device->GetDeviceTransportType() != Transport::Type::kBle, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(device != mDeviceBeingCommissioned, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mCommissioningStage == CommissioningStage::kSecurePairing && mNumQueuedCommissionings == 0)
+    {
+        ReturnErrorOnFailure(mDefaultCommissioner->SetCommissioningParameters(params));
+        return Commission(remoteDeviceId);
+    }
+
+    for (uint16_t i = 0; i < mNumQueuedCommissionings; i++)
+    {
+        VerifyOrReturnError(mQueuedCommissionings[i].nodeId != remoteDeviceId, CHIP_ERROR_INCORRECT_STATE);
+    }
+    VerifyOrReturnError(mNumQueuedCommissionings < MATTER_ARRAY_SIZE(mQueuedCommissionings), CHIP_ERROR_NO_MEMORY);
+
+    mQueuedCommissionings[mNumQueuedCommissionings++] = { remoteDeviceId, &params };
+    ChipLogProgress(Controller, "Queued commissioning of node ID 0x" ChipLogFormatX64 " (%u waiting)",
+                    ChipLogValueX64(remoteDeviceId), mNumQueuedCommissionings);
+    return CHIP_NO_ERROR;
+}
+
+void DeviceCommissioner::StartQueuedCommissioning(System::Layer * layer, void * context)
+{
+    auto * self = static_cast<DeviceCommissioner *>(context);
+
+    // A commissioning started with Commission goes first; the queue resumes once it is done.
+    while (self->mNumQueuedCommissionings > 0 && self->mCommissioningStage == CommissioningStage::kSecurePairing)
+    {
+        QueuedCommissioning next = self->mQueuedCommissionings[0];
+        self->DequeueCommissioning(next.nodeId);
+
+        CHIP_ERROR err = self->mDefaultCommissioner->SetCommissioningParameters(*next.params);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = self->Commission(next.nodeId);
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        ChipLogError(Controller, "Could not start queued commissioning of node ID 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(next.nodeId), err.Format());
+        self->DropQueuedCommissioning(next.nodeId, err);
+    }
+}
+
+bool DeviceCommissioner::DequeueCommissioning(NodeId nodeId)
+{
+    for (uint16_t i = 0; i < mNumQueuedCommissionings; i++)
+    {
+        if (mQueuedCommissionings[i].nodeId == nodeId)
+        {
+            mNumQueuedCommissionings--;
+            for (; i < mNumQueuedCommissionings; i++)
+            {
+                mQueuedCommissionings[i] = mQueuedCommissionings[i + 1];
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void DeviceCommissioner::DropQueuedCommissioning(NodeId nodeId, CHIP_ERROR error)
+{
+    CommissioneeDeviceProxy * device = FindCommissioneeDevice(nodeId);
+    if (device != nullptr)
+    {
+        ReleaseCommissioneeDevice(device);
+    }
+    if (mPairingDelegate != nullptr)
+    {
+        mPairingDelegate->OnCommissioningComplete(nodeId, error);
+    }
+}
+
 CHIP_ERROR
 DeviceCommissioner::ContinueCommissioningAfterDeviceAttestation(DeviceProxy * device,
                                                                 Credentials::AttestationVerificationResult attestationResult)
@@ -1086,6 +1189,13 @@ CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
         return CHIP_NO_ERROR;
     }
 
+    // A queued node has not started commissioning: it just gives up its turn.
+    if (DequeueCommissioning(remoteDeviceId))
+    {
+        DropQueuedCommissioning(remoteDeviceId, CHIP_ERROR_CANCELLED);
+        return CHIP_NO_ERROR;
+    }
+
     // Otherwise we might be pairing and / or commissioning it.
     CommissioneeDeviceProxy * device = FindCommissioneeDevice(remoteDeviceId);
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
@@ -2047,6 +2157,22 @@ void DeviceCommissioner::SendCommissioningCompleteCallbacks(NodeId nodeId, const
                     (completionStatus.err == CHIP_NO_ERROR ? "success" : completionStatus.err.AsString()));
     mCommissioningStage = CommissioningStage::kSecurePairing;
 
+    // Start the next queued node once the callbacks below are done, rather than from within them.
+    if (mNumQueuedCommissionings > 0)
+    {
+        CHIP_ERROR err = mSystemState->SystemLayer()->StartTimer(System::Clock::kZero, StartQueuedCommissioning, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Could not schedule the queued commissionings: %" CHIP_ERROR_FORMAT, err.Format());
+            while (mNumQueuedCommissionings > 0)
+            {
+                NodeId queuedNodeId = mQueuedCommissionings[0].nodeId;
+                DequeueCommissioning(queuedNodeId);
+                DropQueuedCommissioning(queuedNodeId, err);
+            }
+        }
+    }
+
     if (mPairingDelegate == nullptr)
     {
         return;
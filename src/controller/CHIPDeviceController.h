@@ -61,6 +61,7 @@
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/MessageCounterManager.h>
 #include <protocols/secure_channel/RendezvousParameters.h>
+#include <protocols/secure_channel/Spake2pWSCache.h>
 #include <protocols/user_directed_commissioning/UserDirectedCommissioning.h>
 #include <system/SystemClock.h>
 #include <transport/SessionManager.h>
@@ -605,6 +606,24 @@ public:
     CHIP_ERROR Commission(NodeId remoteDeviceId, CommissioningParameters & params);
     CHIP_ERROR Commission(NodeId remoteDeviceId);
 
+    /**
+     * @brief
+     *   Commission a node a PASE connection is established with, once the nodes queued before it are commissioned.
+     *
+     *   Unlike Commission, this can be called while another node is being commissioned: the node keeps its PASE
+     *   connection until its turn comes, so that PASE connections to the next nodes can be established while the
+     *   current one is commissioned. Once this returns CHIP_NO_ERROR, the DevicePairingDelegate receives
+     *   OnCommissioningComplete for the node, whether its commissioning succeeds, fails to start or is stopped with
+     *   StopPairing.
+     *
+     *   Only nodes connected over IP can be queued, since the commissioner keeps a single BLE connection.
+     *
+     * @param[in] remoteDeviceId        The remote device Id.
+     * @param[in] params                The commissioning parameters. They must remain valid until the commissioning of
+     *                                  the node starts or is stopped.
+     */
+    CHIP_ERROR QueueCommissioning(NodeId remoteDeviceId, const CommissioningParameters & params);
+
     /**
      * @brief
      *   This function instructs the commissioner to proceed to the next stage of commissioning after
@@ -845,11 +864,26 @@ private:
     uint8_t mReadCommissioningInfoProgress = 0; // see ContinueReadingCommissioningInfo()
 
     bool mRunCommissioningAfterConnection = false;
+
+    struct QueuedCommissioning
+    {
+        NodeId nodeId;
+        const CommissioningParameters * params;
+    };
+    // Nodes passed to QueueCommissioning that are waiting for the commissioning in progress, oldest first.
+    QueuedCommissioning mQueuedCommissionings[kNumMaxActiveDevices];
+    uint16_t mNumQueuedCommissionings = 0;
+
     Internal::InvokeCancelFn mInvokeCancelFn;
     Internal::WriteCancelFn mWriteCancelFn;
 
     ObjectPool<CommissioneeDeviceProxy, kNumMaxActiveDevices> mCommissioneeDevicePool;
 
+#if CHIP_CONFIG_PASE_WS_CACHE_SIZE > 0
+    // PBKDF2 results of the PASE sessions, for retries.
+    Spake2pWSCache mPASEWSCache;
+#endif
+
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
     Protocols::UserDirectedCommissioning::UserDirectedCommissioningServer * mUdcServer = nullptr;
     // mUdcTransportMgr is for insecure communication (ex. user directed commissioning)
@@ -1071,6 +1105,13 @@ private:
     static CHIP_ERROR
     ConvertFromOperationalCertStatus(chip::app::Clusters::OperationalCredentials::NodeOperationalCertStatusEnum err);
 
+    // Starts the commissioning of the next queued node, if no commissioning is in progress.
+    static void StartQueuedCommissioning(System::Layer * layer, void * context);
+    // Takes a node out of mQueuedCommissionings. Returns false if it was not queued.
+    bool DequeueCommissioning(NodeId nodeId);
+    // Releases the PASE connection of a queued node that will not be commissioned, and reports it to the delegate.
+    void DropQueuedCommissioning(NodeId nodeId, CHIP_ERROR error);
+
     // Sends commissioning complete callbacks to the delegate depending on the status. Sends
     // OnCommissioningComplete and either OnCommissioningSuccess or OnCommissioningFailure depending on the given completion status.
     void SendCommissioningCompleteCallbacks(NodeId nodeId, const CompletionStatus & completionStatus);
@@ -0,0 +1,338 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningPipeline.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+using namespace chip::Tracing;
+
+CHIP_ERROR CommissioningPipeline::Init(DeviceCommissioner & commissioner, System::Layer & systemLayer, Delegate * delegate)
+{
+    VerifyOrReturnError(mCommissioner == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mCommissioner                = &commissioner;
+    mSystemLayer                 = &systemLayer;
+    mDelegate                    = delegate;
+    mCommissionerPairingDelegate = commissioner.GetPairingDelegate();
+    mMetrics                     = Metrics();
+    commissioner.RegisterPairingDelegate(this);
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::Shutdown()
+{
+    VerifyOrReturn(mCommissioner != nullptr);
+
+    mSystemLayer->CancelTimer(StartQueuedDevices, this);
+    mStartScheduled = false;
+    mQueue.clear();
+
+    // Forget the devices in progress first, so that stopping them does not report them.
+    std::vector<NodeId> inProgress;
+    inProgress.swap(mInProgress);
+    mPairingNodeId = kUndefinedNodeId;
+    for (NodeId nodeId : inProgress)
+    {
+        StopPairing(nodeId);
+    }
+    UpdateCounts();
+
+    if (mBatchInProgress)
+    {
+        mBatchInProgress = false;
+        MATTER_LOG_METRIC_END(kMetricCommissioningPipelineBatch, CHIP_ERROR_CANCELLED);
+    }
+
+    mCommissioner->RegisterPairingDelegate(mCommissionerPairingDelegate);
+    mCommissioner                = nullptr;
+    mSystemLayer                 = nullptr;
+    mDelegate                    = nullptr;
+    mCommissionerPairingDelegate = nullptr;
+}
+
+CHIP_ERROR CommissioningPipeline::SetCommissioningParameters(const CommissioningParameters & params)
+{
+    VerifyOrReturnError(!params.GetCSRNonce().HasValue() && !params.GetAttestationNonce().HasValue() &&
+                            !params.GetNOCChainGenerationParameters().HasValue() && !params.GetRootCert().HasValue() &&
+                            !params.GetNoc().HasValue() && !params.GetIcac().HasValue() && !params.GetIpk().HasValue() &&
+                            !params.GetAttestationElements().HasValue() && !params.GetAttestationSignature().HasValue() &&
+                            !params.GetPAI().HasValue() && !params.GetDAC().HasValue(),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!params.GetTimeZone().HasValue() && !params.GetDSTOffsets().HasValue() &&
+                            !params.GetDefaultNTP().HasValue(),
+                        CHIP_ERROR_NOT_IMPLEMENTED);
+
+    // Check the sizes before anything is copied, so that the parameters are left unchanged on error.
+    if (params.GetWiFiCredentials().HasValue())
+    {
+        const WiFiCredentials & creds = params.GetWiFiCredentials().Value();
+        VerifyOrReturnError(creds.ssid.size() <= sizeof(mSsid) && creds.credentials.size() <= sizeof(mCredentials),
+                            CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    VerifyOrReturnError(params.GetThreadOperationalDataset().ValueOr(ByteSpan()).size() <= sizeof(mThreadOperationalDataset),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.GetCountryCode().ValueOr(CharSpan()).size() <= sizeof(mCountryCode), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.GetICDSymmetricKey().ValueOr(ByteSpan(mICDSymmetricKey)).size() == sizeof(mICDSymmetricKey),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mParams = params;
+    mParams.ClearExternalBufferDependentValues();
+
+    if (params.GetWiFiCredentials().HasValue())
+    {
+        const WiFiCredentials & creds = params.GetWiFiCredentials().Value();
+        memmove(mSsid, creds.ssid.data(), creds.ssid.size());
+        memmove(mCredentials, creds.credentials.data(), creds.credentials.size());
+        mParams.SetWiFiCredentials(
+            WiFiCredentials(ByteSpan(mSsid, creds.ssid.size()), ByteSpan(mCredentials, creds.credentials.size())));
+    }
+    if (params.GetThreadOperationalDataset().HasValue())
+    {
+        ByteSpan dataset = params.GetThreadOperationalDataset().Value();
+        memmove(mThreadOperationalDataset, dataset.data(), dataset.size());
+        mParams.SetThreadOperationalDataset(ByteSpan(mThreadOperationalDataset, dataset.size()));
+    }
+    if (params.GetCountryCode().HasValue())
+    {
+        CharSpan code = params.GetCountryCode().Value();
+        memmove(mCountryCode, code.data(), code.size());
+        mParams.SetCountryCode(CharSpan(mCountryCode, code.size()));
+    }
+    if (params.GetICDSymmetricKey().HasValue())
+    {
+        memmove(mICDSymmetricKey, params.GetICDSymmetricKey().Value().data(), sizeof(mICDSymmetricKey));
+        mParams.SetICDSymmetricKey(ByteSpan(mICDSymmetricKey));
+    }
+    auto extraReadPaths = params.GetExtraReadPaths();
+    mExtraReadPaths.assign(extraReadPaths.begin(), extraReadPaths.end());
+    mParams.SetExtraReadPaths(Span<const app::AttributePathParams>(mExtraReadPaths.data(), mExtraReadPaths.size()));
+
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::SetMaxConcurrency(size_t maxConcurrency)
+{
+    mMaxConcurrency = std::clamp<size_t>(maxConcurrency, 1, kMaxConcurrency);
+    VerifyOrReturn(mCommissioner != nullptr);
+    ScheduleQueuedDevicesOrFail();
+}
+
+CHIP_ERROR CommissioningPipeline::AddDevice(NodeId nodeId, const char * setUpCode)
+{
+    VerifyOrReturnError(mCommissioner != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nodeId != kUndefinedNodeId && setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueue.push_back({ nodeId, setUpCode });
+    CHIP_ERROR err = ScheduleQueuedDevices();
+    if (err != CHIP_NO_ERROR)
+    {
+        mQueue.pop_back();
+        return err;
+    }
+    UpdateCounts();
+
+    if (!mBatchInProgress)
+    {
+        mBatchInProgress = true;
+        MATTER_LOG_METRIC_BEGIN(kMetricCommissioningPipelineBatch);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::OnPairingComplete(CHIP_ERROR error)
+{
+    VerifyOrReturn(mPairingNodeId != kUndefinedNodeId);
+    NodeId nodeId  = mPairingNodeId;
+    mPairingNodeId = kUndefinedNodeId;
+
+    if (error == CHIP_NO_ERROR)
+    {
+        // The commissioner commissions the device once it is done with the devices queued before it. Meanwhile the PASE
+        // connection to the next device can be established.
+        error = QueueCommissioning(nodeId, mParams);
+        if (error != CHIP_NO_ERROR)
+        {
+            StopPairing(nodeId);
+        }
+    }
+
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Pipeline: could not pair " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT, ChipLogValueX64(nodeId),
+                     error.Format());
+        RemoveInProgress(nodeId);
+        ReportDone(nodeId, error);
+    }
+
+    ScheduleQueuedDevicesOrFail();
+}
+
+void CommissioningPipeline::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(RemoveInProgress(deviceId));
+
+    if (error == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(Controller, "Pipeline: commissioned " ChipLogFormatX64, ChipLogValueX64(deviceId));
+    }
+    else
+    {
+        ChipLogError(Controller, "Pipeline: failed to commission " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(deviceId), error.Format());
+    }
+
+    ReportDone(deviceId, error);
+    ScheduleQueuedDevicesOrFail();
+}
+
+CHIP_ERROR CommissioningPipeline::EstablishPASEConnection(NodeId nodeId, const char * setUpCode)
+{
+    return mCommissioner->EstablishPASEConnection(nodeId, setUpCode, DiscoveryType::kDiscoveryNetworkOnly);
+}
+
+CHIP_ERROR CommissioningPipeline::QueueCommissioning(NodeId nodeId, const CommissioningParameters & params)
+{
+    return mCommissioner->QueueCommissioning(nodeId, params);
+}
+
+void CommissioningPipeline::StopPairing(NodeId nodeId)
+{
+    LogErrorOnFailure(mCommissioner->StopPairing(nodeId));
+}
+
+void CommissioningPipeline::StartQueuedDevices(System::Layer * layer, void * context)
+{
+    auto * self           = static_cast<CommissioningPipeline *>(context);
+    self->mStartScheduled = false;
+
+    // The commissioner establishes a single PASE connection at a time; the next device starts once it is done.
+    while (self->mPairingNodeId == kUndefinedNodeId && !self->mQueue.empty() && self->mInProgress.size() < self->mMaxConcurrency)
+    {
+        self->StartNextDevice();
+    }
+}
+
+CHIP_ERROR CommissioningPipeline::ScheduleQueuedDevices()
+{
+    VerifyOrReturnError(!mStartScheduled && !mQueue.empty(), CHIP_NO_ERROR);
+
+    // Devices are never started from within the callbacks of the commissioner.
+    ReturnErrorOnFailure(mSystemLayer->StartTimer(System::Clock::kZero, StartQueuedDevices, this));
+    mStartScheduled = true;
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::ScheduleQueuedDevicesOrFail()
+{
+    CHIP_ERROR err = ScheduleQueuedDevices();
+    VerifyOrReturn(err != CHIP_NO_ERROR);
+
+    // Nothing would start the queued devices: fail them rather than leave them waiting.
+    ChipLogError(Controller, "Pipeline: could not schedule the queued devices: %" CHIP_ERROR_FORMAT, err.Format());
+    while (!mQueue.empty())
+    {
+        NodeId nodeId = mQueue.front().nodeId;
+        mQueue.pop_front();
+        ReportDone(nodeId, err);
+    }
+}
+
+void CommissioningPipeline::StartNextDevice()
+{
+    PendingDevice device = std::move(mQueue.front());
+    mQueue.pop_front();
+
+    mInProgress.push_back(device.nodeId);
+    mPairingNodeId = device.nodeId;
+    UpdateCounts();
+
+    // If the commissioner is connected to the device already, OnPairingComplete is called before this returns.
+    CHIP_ERROR err = EstablishPASEConnection(device.nodeId, device.setUpCode.c_str());
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Pipeline: could not start pairing " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(device.nodeId), err.Format());
+        mPairingNodeId = kUndefinedNodeId;
+        RemoveInProgress(device.nodeId);
+        ReportDone(device.nodeId, err);
+    }
+}
+
+bool CommissioningPipeline::RemoveInProgress(NodeId nodeId)
+{
+    auto it = std::find(mInProgress.begin(), mInProgress.end(), nodeId);
+    VerifyOrReturnValue(it != mInProgress.end(), false);
+    mInProgress.erase(it);
+    UpdateCounts();
+    return true;
+}
+
+void CommissioningPipeline::ReportDone(NodeId nodeId, CHIP_ERROR error)
+{
+    UpdateCounts();
+    if (error == CHIP_NO_ERROR)
+    {
+        mMetrics.succeeded++;
+    }
+    else
+    {
+        mMetrics.failed++;
+    }
+
+    if (mDelegate != nullptr)
+    {
+        mDelegate->OnDeviceCommissioned(nodeId, error);
+    }
+
+    // The delegate may have queued more devices.
+    if (mBatchInProgress && IsIdle())
+    {
+        mBatchInProgress = false;
+        MATTER_LOG_METRIC_END(kMetricCommissioningPipelineBatch, CHIP_NO_ERROR);
+        if (mDelegate != nullptr)
+        {
+            mDelegate->OnPipelineIdle();
+        }
+    }
+}
+
+void CommissioningPipeline::UpdateCounts()
+{
+    const auto inProgress = static_cast<uint32_t>(mInProgress.size());
+    if (inProgress != mMetrics.inProgress)
+    {
+        MATTER_LOG_METRIC(kMetricCommissioningPipelineInProgress, inProgress);
+    }
+
+    mMetrics.queued        = static_cast<uint32_t>(mQueue.size());
+    mMetrics.inProgress    = inProgress;
+    mMetrics.maxInProgress = std::max(mMetrics.maxInProgress, inProgress);
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,187 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Commissioning of a batch of on-network devices by a single DeviceCommissioner.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <system/SystemLayer.h>
+
+#include <algorithm>
+#include <deque>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Commissions a batch of on-network devices with a DeviceCommissioner, overlapping the stages of consecutive devices.
+ *
+ * For each device, the pipeline discovers it and establishes a PASE connection with its setup code, then hands it to
+ * DeviceCommissioner::QueueCommissioning. The commissioner commissions the devices one after the other, while the pipeline
+ * goes on discovering and establishing PASE connections with the next devices, so that the next device is ready as soon as
+ * the commissioner is done with the current one.
+ *
+ * The pipeline is the pairing delegate of the commissioner from Init to Shutdown.
+ */
+class CommissioningPipeline : public DevicePairingDelegate
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called when the commissioning of a device is done, with CHIP_NO_ERROR if it succeeded.
+         */
+        virtual void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) {}
+
+        /**
+         * Called when the last queued device is done and no commissioning is in progress.
+         */
+        virtual void OnPipelineIdle() {}
+    };
+
+    struct Metrics
+    {
+        uint32_t queued        = 0; // Devices waiting for their PASE connection to be established.
+        uint32_t inProgress    = 0; // Devices being paired, waiting for the commissioner or being commissioned.
+        uint32_t maxInProgress = 0; // Highest value of inProgress so far.
+        uint32_t succeeded     = 0;
+        uint32_t failed        = 0;
+    };
+
+    /**
+     * The commissioner commissions one device at a time and establishes one PASE connection at a time, so only the PASE
+     * connection with the next device overlaps the commissioning of the current one. Every other device in progress would
+     * only hold an open PASE session while waiting for its turn.
+     */
+    static constexpr size_t kMaxConcurrency = std::min<size_t>(2, CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES);
+
+    CommissioningPipeline() = default;
+    virtual ~CommissioningPipeline() { Shutdown(); }
+
+    CommissioningPipeline(const CommissioningPipeline &)             = delete;
+    CommissioningPipeline & operator=(const CommissioningPipeline &) = delete;
+
+    /**
+     * @param[in] commissioner  The commissioner to commission the devices with. The pipeline replaces its pairing delegate
+     *                          until Shutdown.
+     * @param[in] systemLayer   The system layer the commissioner runs on.
+     * @param[in] delegate      Optional delegate notified of the progress of the pipeline.
+     */
+    CHIP_ERROR Init(DeviceCommissioner & commissioner, System::Layer & systemLayer, Delegate * delegate = nullptr);
+
+    /**
+     * Drop the queued devices, stop the commissionings in progress without reporting them, and give the commissioner its
+     * pairing delegate back.
+     */
+    void Shutdown();
+
+    /**
+     * Set the parameters used to commission the devices. They are copied, and apply to the devices that have not started
+     * commissioning yet.
+     *
+     * Parameters that are specific to a device (nonces, certificates, attestation information) are rejected, as are the time
+     * zone, DST offsets and default NTP server, which the pipeline does not keep a copy of.
+     */
+    CHIP_ERROR SetCommissioningParameters(const CommissioningParameters & params);
+
+    /**
+     * Limit the number of devices in progress, from the start of their discovery to the end of their commissioning, to at
+     * most kMaxConcurrency (the default). A limit of 1 commissions the devices strictly one after the other.
+     */
+    void SetMaxConcurrency(size_t maxConcurrency);
+
+    /**
+     * Queue a device for commissioning. It starts once a PASE connection can be established with it.
+     *
+     * The setup code is copied.
+     */
+    CHIP_ERROR AddDevice(NodeId nodeId, const char * setUpCode);
+
+    const Metrics & GetMetrics() const { return mMetrics; }
+    bool IsIdle() const { return mMetrics.queued == 0 && mMetrics.inProgress == 0; }
+
+    // DevicePairingDelegate
+    void OnPairingComplete(CHIP_ERROR error) override;
+    void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+protected:
+    // The calls into the commissioner, which the tests replace.
+    virtual CHIP_ERROR EstablishPASEConnection(NodeId nodeId, const char * setUpCode);
+    virtual CHIP_ERROR QueueCommissioning(NodeId nodeId, const CommissioningParameters & params);
+    virtual void StopPairing(NodeId nodeId);
+
+private:
+    struct PendingDevice
+    {
+        NodeId nodeId;
+        std::string setUpCode;
+    };
+
+    static void StartQueuedDevices(System::Layer * layer, void * context);
+    CHIP_ERROR ScheduleQueuedDevices();
+    void ScheduleQueuedDevicesOrFail();
+    void StartNextDevice();
+    bool RemoveInProgress(NodeId nodeId);
+    void ReportDone(NodeId nodeId, CHIP_ERROR error);
+    void UpdateCounts();
+
+    DeviceCommissioner * mCommissioner                   = nullptr;
+    System::Layer * mSystemLayer                         = nullptr;
+    Delegate * mDelegate                                 = nullptr;
+    DevicePairingDelegate * mCommissionerPairingDelegate = nullptr;
+    size_t mMaxConcurrency                               = kMaxConcurrency;
+
+    std::deque<PendingDevice> mQueue;
+    // Devices started, from their discovery to the end of their commissioning.
+    std::vector<NodeId> mInProgress;
+    // The device the PASE connection is being established with; the commissioner establishes one at a time.
+    NodeId mPairingNodeId = kUndefinedNodeId;
+    bool mStartScheduled  = false;
+    bool mBatchInProgress = false;
+    Metrics mMetrics;
+
+    // The commissioning parameters, with copies of the buffers they point to, as the devices queued in the commissioner
+    // refer to them until their commissioning starts.
+    CommissioningParameters mParams;
+    uint8_t mSsid[CommissioningParameters::kMaxSsidLen];
+    uint8_t mCredentials[CommissioningParameters::kMaxCredentialsLen];
+    uint8_t mThreadOperationalDataset[CommissioningParameters::kMaxThreadDatasetLen];
+    char mCountryCode[CommissioningParameters::kMaxCountryCodeLen];
+    uint8_t mICDSymmetricKey[Crypto::kAES_CCM128_Key_Length];
+    std::vector<app::AttributePathParams> mExtraReadPaths;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -683,15 +683,81 @@ void SetUpCodePairer::OnPairingDeleted(CHIP_ERROR error)
     }
 }
 
+// The commissioning callbacks below are for another node, commissioned with DeviceCommissioner::QueueCommissioning while
+// we establish PASE with this one.
 void SetUpCodePairer::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
 {
-    // Not really expecting this, but handle it anyway.
     if (mPairingDelegate)
     {
         mPairingDelegate->OnCommissioningComplete(deviceId, error);
     }
 }
 
+void SetUpCodePairer::OnCommissioningSuccess(PeerId peerId)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnCommissioningSuccess(peerId);
+    }
+}
+
+void SetUpCodePairer::OnCommissioningFailure(PeerId peerId, CHIP_ERROR error, CommissioningStage stageFailed,
+                                             Optional<Credentials::AttestationVerificationResult> additionalErrorInfo)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnCommissioningFailure(peerId, error, stageFailed, additionalErrorInfo);
+    }
+}
+
+void SetUpCodePairer::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnCommissioningStatusUpdate(peerId, stageCompleted, error);
+    }
+}
+
+void SetUpCodePairer::OnReadCommissioningInfo(const ReadCommissioningInfo & info)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnReadCommissioningInfo(info);
+    }
+}
+
+void SetUpCodePairer::OnFabricCheck(NodeId matchingNodeId)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnFabricCheck(matchingNodeId);
+    }
+}
+
+void SetUpCodePairer::OnICDRegistrationInfoRequired()
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnICDRegistrationInfoRequired();
+    }
+}
+
+void SetUpCodePairer::OnICDRegistrationComplete(ScopedNodeId icdNodeId, uint32_t icdCounter)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnICDRegistrationComplete(icdNodeId, icdCounter);
+    }
+}
+
+void SetUpCodePairer::OnICDStayActiveComplete(ScopedNodeId icdNodeId, uint32_t promisedActiveDurationMsec)
+{
+    if (mPairingDelegate)
+    {
+        mPairingDelegate->OnICDStayActiveComplete(icdNodeId, promisedActiveDurationMsec);
+    }
+}
+
 void SetUpCodePairer::OnDeviceDiscoveredTimeoutCallback(System::Layer * layer, void * context)
 {
     ChipLogError(Controller, "Discovery timed out");
@@ -103,6 +103,15 @@ private:
     void OnPairingComplete(CHIP_ERROR error) override;
     void OnPairingDeleted(CHIP_ERROR error) override;
     void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+    void OnCommissioningSuccess(PeerId peerId) override;
+    void OnCommissioningFailure(PeerId peerId, CHIP_ERROR error, CommissioningStage stageFailed,
+                                Optional<Credentials::AttestationVerificationResult> additionalErrorInfo) override;
+    void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+    void OnReadCommissioningInfo(const ReadCommissioningInfo & info) override;
+    void OnFabricCheck(NodeId matchingNodeId) override;
+    void OnICDRegistrationInfoRequired() override;
+    void OnICDRegistrationComplete(ScopedNodeId icdNodeId, uint32_t icdCounter) override;
+    void OnICDStayActiveComplete(ScopedNodeId icdNodeId, uint32_t promisedActiveDurationMsec) override;
 
     CHIP_ERROR Connect(SetupPayload & paload);
     CHIP_ERROR StartDiscoveryOverBLE(SetupPayload & payload);
@@ -50,6 +50,7 @@
 #include <controller/CHIPDeviceController.h>
 #include <controller/CHIPDeviceControllerFactory.h>
 #include <controller/CommissioningDelegate.h>
+#include <controller/CommissioningPipeline.h>
 #include <controller/CommissioningWindowOpener.h>
 #include <controller/CurrentFabricRemover.h>
 #include <controller/ExampleOperationalCredentialsIssuer.h>
@@ -98,6 +99,7 @@ typedef void (*LogMessageFunct)(uint64_t time, uint64_t timeUS, const char * mod
 typedef void (*DeviceAvailableFunc)(chip::Controller::Python::PyObject * context, DeviceProxy * device, PyChipError err);
 typedef void (*ChipThreadTaskRunnerFunct)(intptr_t context);
 typedef void (*DeviceUnpairingCompleteFunct)(uint64_t nodeId, PyChipError error);
+typedef void (*CommissioningPipelineIdleFunct)();
 }
 
 namespace {
@@ -176,6 +178,14 @@ PyChipError pychip_DeviceController_OnNetworkCommission(chip::Controller::Device
                                                         uint64_t nodeId, uint32_t setupPasscode, const uint8_t filterType,
                                                         const char * filterParam, uint32_t discoveryTimeoutMsec);
 
+struct ScriptCommissioningPipeline;
+PyChipError
+pychip_DeviceController_CommissionBatch(chip::Controller::DeviceCommissioner * devCtrl, const char * const * setUpCodes,
+                                        size_t count, chip::NodeId firstNodeId, uint16_t maxConcurrency,
+                                        chip::Controller::DevicePairingDelegate_OnCommissioningCompleteFunct onDevice,
+                                        CommissioningPipelineIdleFunct onIdle, ScriptCommissioningPipeline ** outPipeline);
+PyChipError pychip_CommissioningPipeline_Delete(ScriptCommissioningPipeline * pipeline);
+
 PyChipError pychip_DeviceController_PostTaskOnChipThread(ChipThreadTaskRunnerFunct callback, void * pythonContext);
 
 PyChipError pychip_DeviceController_OpenCommissioningWindow(chip::Controller::DeviceCommissioner * devCtrl,
@@ -493,6 +503,55 @@ PyChipError pychip_DeviceController_UnpairDevice(chip::Controller::DeviceCommiss
     return ToPyChipError(err);
 }
 
+// Commissions a batch of devices with a CommissioningPipeline, reporting each device and the end of the batch to Python.
+// The commissioner gets its pairing delegate back when Python deletes the pipeline.
+struct ScriptCommissioningPipeline : public chip::Controller::CommissioningPipeline::Delegate
+{
+    ScriptCommissioningPipeline(chip::Controller::DevicePairingDelegate_OnCommissioningCompleteFunct onDevice,
+                                CommissioningPipelineIdleFunct onIdle) :
+        mOnDevice(onDevice),
+        mOnIdle(onIdle)
+    {}
+
+    void OnDeviceCommissioned(chip::NodeId nodeId, CHIP_ERROR error) override { mOnDevice(nodeId, ToPyChipError(error)); }
+    void OnPipelineIdle() override { mOnIdle(); }
+
+    chip::Controller::DevicePairingDelegate_OnCommissioningCompleteFunct mOnDevice;
+    CommissioningPipelineIdleFunct mOnIdle;
+    chip::Controller::CommissioningPipeline mPipeline;
+};
+
+PyChipError
+pychip_DeviceController_CommissionBatch(chip::Controller::DeviceCommissioner * devCtrl, const char * const * setUpCodes,
+                                        size_t count, chip::NodeId firstNodeId, uint16_t maxConcurrency,
+                                        chip::Controller::DevicePairingDelegate_OnCommissioningCompleteFunct onDevice,
+                                        CommissioningPipelineIdleFunct onIdle, ScriptCommissioningPipeline ** outPipeline)
+{
+    VerifyOrReturnError(count > 0 && onDevice != nullptr && onIdle != nullptr && outPipeline != nullptr,
+                        ToPyChipError(CHIP_ERROR_INVALID_ARGUMENT));
+
+    auto pipeline = std::make_unique<ScriptCommissioningPipeline>(onDevice, onIdle);
+    PyReturnErrorOnFailure(ToPyChipError(pipeline->mPipeline.Init(*devCtrl, DeviceLayer::SystemLayer(), pipeline.get())));
+    PyReturnErrorOnFailure(ToPyChipError(pipeline->mPipeline.SetCommissioningParameters(sCommissioningParameters)));
+    if (maxConcurrency != 0)
+    {
+        pipeline->mPipeline.SetMaxConcurrency(maxConcurrency);
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        PyReturnErrorOnFailure(ToPyChipError(pipeline->mPipeline.AddDevice(firstNodeId + i, setUpCodes[i])));
+    }
+
+    *outPipeline = pipeline.release();
+    return ToPyChipError(CHIP_NO_ERROR);
+}
+
+PyChipError pychip_CommissioningPipeline_Delete(ScriptCommissioningPipeline * pipeline)
+{
+    delete pipeline;
+    return ToPyChipError(CHIP_NO_ERROR);
+}
+
 PyChipError pychip_DeviceController_OnNetworkCommission(chip::Controller::DeviceCommissioner * devCtrl,
                                                         chip::Controller::ScriptDevicePairingDelegate * pairingDelegate,
                                                         uint64_t nodeId, uint32_t setupPasscode, const uint8_t filterType,
@@ -76,6 +76,7 @@ _DevicePairingDelegate_OnCommissioningStatusUpdateFunct = CFUNCTYPE(
     None, c_uint64, c_uint8, PyChipError)
 _DevicePairingDelegate_OnFabricCheckFunct = CFUNCTYPE(
     None, c_uint64)
+_CommissioningPipelineIdleFunct = CFUNCTYPE(None)
 # void (*)(Device *, CHIP_ERROR).
 #
 # CHIP_ERROR is actually signed, so using c_uint32 is weird, but everything
@@ -2137,6 +2138,14 @@ class ChipDeviceControllerBase():
                 c_void_p, c_char_p, c_uint64, c_uint8]
             self._dmLib.pychip_DeviceController_ConnectWithCode.restype = PyChipError
 
+            self._dmLib.pychip_DeviceController_CommissionBatch.argtypes = [
+                c_void_p, POINTER(c_char_p), c_size_t, c_uint64, c_uint16, _DevicePairingDelegate_OnCommissioningCompleteFunct,
+                _CommissioningPipelineIdleFunct, POINTER(c_void_p)]
+            self._dmLib.pychip_DeviceController_CommissionBatch.restype = PyChipError
+
+            self._dmLib.pychip_CommissioningPipeline_Delete.argtypes = [c_void_p]
+            self._dmLib.pychip_CommissioningPipeline_Delete.restype = PyChipError
+
             self._dmLib.pychip_DeviceController_UnpairDevice.argtypes = [
                 c_void_p, c_uint64, _DeviceUnpairingCompleteFunct]
             self._dmLib.pychip_DeviceController_UnpairDevice.restype = PyChipError
@@ -2668,6 +2677,50 @@ class ChipDeviceController(ChipDeviceControllerBase):
 
             return await asyncio.futures.wrap_future(ctx.future)
 
+    async def CommissionBatch(self, setupPayloads: typing.List[str], firstNodeId: int,
+                              maxConcurrency: int = 0) -> typing.Dict[int, typing.Optional[Exception]]:
+        '''
+        Commission several on-network devices, giving them consecutive node ids from firstNodeId.
+        The PASE session with the next device is established while the current device is commissioned.
+        maxConcurrency limits the number of devices in progress at once, to 1 or 2; 0 keeps the default of the SDK, 2.
+
+        Raises:
+            ChipStackError: If the batch could not be started.
+
+        Returns:
+            For each node id, None if the device was commissioned, or the error it failed with.
+        '''
+        self.CheckIsActive()
+
+        results: typing.Dict[int, typing.Optional[Exception]] = {}
+        done: concurrent.futures.Future = concurrent.futures.Future()
+
+        def HandleDeviceCommissioned(nodeId: int, err: PyChipError):
+            results[nodeId] = None if err.is_success else err.to_exception()
+
+        def HandleIdle():
+            done.set_result(None)
+
+        onDevice = _DevicePairingDelegate_OnCommissioningCompleteFunct(HandleDeviceCommissioned)
+        onIdle = _CommissioningPipelineIdleFunct(HandleIdle)
+        setUpCodes = (c_char_p * len(setupPayloads))(*[payload.encode("utf-8") for payload in setupPayloads])
+        pipeline = c_void_p(None)
+
+        async with self._commissioning_context:
+            try:
+                await self._ChipStack.CallAsync(
+                    lambda: self._dmLib.pychip_DeviceController_CommissionBatch(
+                        self.devCtrl, setUpCodes, len(setupPayloads), firstNodeId, maxConcurrency, onDevice, onIdle,
+                        byref(pipeline))
+                )
+                await asyncio.futures.wrap_future(done)
+            finally:
+                # Gives the controller its pairing delegate back.
+                if pipeline.value is not None:
+                    await self._ChipStack.CallAsync(lambda: self._dmLib.pychip_CommissioningPipeline_Delete(pipeline))
+
+        return results
+
     async def CommissionIP(self, ipaddr: str, setupPinCode: int, nodeid: int) -> int:
         '''
         DEPRECATED, DO NOT USE! Use `CommissionOnNetwork` or `CommissionWithCode`
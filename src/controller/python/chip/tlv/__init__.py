@@ -458,12 +458,15 @@ class TLVReader(object):
 
     @property
     def decoding(self):
+        """Per-element description of the tlv data. Only built on demand, as get() does not need it."""
+        if not self._decodings and self._bytesRead == 0 and len(self._tlv) > 0:
+            self._get(self._tlv, self._decodings, {})
         return self._decodings
 
     def get(self):
         """Get the dictionary representation of tlv data"""
         out = {}
-        self._get(self._tlv, self._decodings, out)
+        _decodeElements(self._tlv, 0, len(self._tlv), out)
         return out
 
     def _decodeControlByte(self, tlv, decoding):
@@ -699,6 +702,132 @@ class TLVReader(object):
                     raise ValueError("Attempt to decode unsupported TLV tag")
 
 
+# Fast decoding path used by TLVReader.get(). It produces the same values as the per-element decoding of TLVReader._get,
+# without building the description of every element, re-slicing the remaining input for each element or dispatching on
+# type names. Attribute reports and events of the controller are decoded through this path.
+
+_UINT8 = struct.Struct("<B")
+_UINT16 = struct.Struct("<H")
+_UINT32 = struct.Struct("<L")
+_UINT64 = struct.Struct("<Q")
+_PROFILE_ID = struct.Struct("<HH")
+
+# Element type -> (decoder, wrapper applied to the decoded value)
+_SCALAR_TYPES = {
+    0x00: (struct.Struct("<b"), None),
+    0x01: (struct.Struct("<h"), None),
+    0x02: (struct.Struct("<l"), None),
+    0x03: (struct.Struct("<q"), None),
+    0x04: (_UINT8, uint),
+    0x05: (_UINT16, uint),
+    0x06: (_UINT32, uint),
+    0x07: (_UINT64, uint),
+    0x0A: (struct.Struct("<f"), float32),
+    0x0B: (struct.Struct("<d"), None),
+}
+
+# Element type of strings -> decoder of their length
+_STRING_LENGTHS = {
+    0x0C: _UINT8,
+    0x0D: _UINT16,
+    0x0E: _UINT32,
+    0x0F: _UINT64,
+    0x10: _UINT8,
+    0x11: _UINT16,
+    0x12: _UINT32,
+    0x13: _UINT64,
+}
+
+# Tag control -> (decoder, implied profile) of the profile tags that do not carry their profile id
+_PROFILE_TAGS = {
+    TLV_TAG_CONTROL_COMMON_PROFILE_2Bytes: (_UINT16, 0),
+    TLV_TAG_CONTROL_COMMON_PROFILE_4Bytes: (_UINT32, 0),
+    TLV_TAG_CONTROL_IMPLICIT_PROFILE_2Bytes: (_UINT16, None),
+    TLV_TAG_CONTROL_IMPLICIT_PROFILE_4Bytes: (_UINT32, None),
+}
+
+
+def _decodeElements(tlv, offset, end, out):
+    """Decode the elements of tlv starting at offset into out (a dict, list or TLVList) until the end of the enclosing
+    container or of the data. Returns the offset following the last decoded element."""
+    isMapping = isinstance(out, Mapping)
+    isTLVList = isinstance(out, TLVList)
+
+    while offset < end:
+        controlByte = tlv[offset]
+        offset += 1
+        tagControl = controlByte & 0xE0
+        elementType = controlByte & 0x1F
+
+        profileTag = None
+        tag = None
+        if tagControl == TLV_TAG_CONTROL_CONTEXT_SPECIFIC:
+            tag = tlv[offset]
+            offset += 1
+        elif tagControl in _PROFILE_TAGS:
+            (decoder, profile) = _PROFILE_TAGS[tagControl]
+            (tagNumber,) = decoder.unpack_from(tlv, offset)
+            offset += decoder.size
+            profileTag = (profile, tagNumber)
+        elif tagControl != TLV_TAG_CONTROL_ANONYMOUS:
+            (vendorId, profileNum) = _PROFILE_ID.unpack_from(tlv, offset)
+            decoder = _UINT16 if tagControl == TLV_TAG_CONTROL_FULLY_QUALIFIED_6Bytes else _UINT32
+            (tagNumber,) = decoder.unpack_from(tlv, offset + 4)
+            offset += 4 + decoder.size
+            profileTag = ((vendorId << 16) | profileNum, tagNumber)
+
+        scalar = _SCALAR_TYPES.get(elementType)
+        if scalar is not None:
+            (decoder, wrapper) = scalar
+            (value,) = decoder.unpack_from(tlv, offset)
+            offset += decoder.size
+            if wrapper is not None:
+                value = wrapper(value)
+        elif elementType in _STRING_LENGTHS:
+            decoder = _STRING_LENGTHS[elementType]
+            (length,) = decoder.unpack_from(tlv, offset)
+            offset += decoder.size
+            if offset + length > end:
+                raise struct.error("TLV string extends past the end of the data")
+            value = bytes(tlv[offset:offset + length])
+            offset += length
+            if elementType < TLV_TYPE_BYTE_STRING:
+                try:
+                    value = str(value, "utf-8")
+                except Exception:
+                    pass
+        elif elementType == TLV_TYPE_STRUCTURE:
+            value = {}
+            offset = _decodeElements(tlv, offset, end, value)
+        elif elementType == TLV_TYPE_ARRAY:
+            value = []
+            offset = _decodeElements(tlv, offset, end, value)
+        elif elementType == TLV_TYPE_PATH:
+            value = TLVList()
+            offset = _decodeElements(tlv, offset, end, value)
+        elif elementType == TLVBoolean_False:
+            value = False
+        elif elementType == TLVBoolean_True:
+            value = True
+        elif elementType == TLV_TYPE_NULL:
+            value = None
+        elif elementType == TLVEndOfContainer:
+            return offset
+        else:
+            raise ValueError("Attempt to decode unsupported TLV type")
+
+        if profileTag is not None:
+            out[profileTag] = value
+        elif isMapping:
+            out[tag if tag is not None else "Any"] = value
+        elif isTLVList:
+            out.append(tag, value)
+        else:
+            out.append(value)
+
+    return offset
+
+
 def tlvTagToSortKey(tag):
     if tag is None:
         return -1
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+
+#
+#    Copyright (c) 2025 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Compares TLVReader.get() with the per-element TLV decoding over report payloads.
+
+Reports are read from files given on the command line, either raw binary TLV or, with --hex, one hex-encoded payload per
+line (e.g. captured from controller logs). Without files, a wildcard read report of a bridge is synthesized.
+"""
+
+import argparse
+import sys
+import timeit
+
+from chip.tlv import TLVList, TLVReader, TLVWriter, uint
+
+
+def synthesize_bridge_report(endpoints, clusters, attributes):
+    """A ReportDataMessage with one AttributeReportIB per attribute of every bridged endpoint."""
+    reports = []
+    for endpoint in range(1, endpoints + 1):
+        for cluster in range(clusters):
+            for attribute in range(attributes):
+                path = TLVList([(2, uint(endpoint)), (3, uint(0x0006 + cluster)), (4, uint(attribute))])
+                if attribute % 3 == 0:
+                    data = "Bridged device %d" % endpoint
+                elif attribute % 3 == 1:
+                    data = [uint(attribute), uint(endpoint), True]
+                else:
+                    data = uint(endpoint * attribute)
+                reports.append({1: {0: uint(0x12345678), 1: path, 2: data}})
+
+    writer = TLVWriter()
+    writer.put(None, {1: reports, 4: uint(1), 0xFF: uint(12)})
+    return bytes(writer.encoding)
+
+
+def load_reports(args):
+    if not args.files:
+        return [synthesize_bridge_report(args.endpoints, args.clusters, args.attributes)]
+
+    reports = []
+    for path in args.files:
+        if args.hex:
+            with open(path, "r") as f:
+                reports.extend(bytes.fromhex(line.strip()) for line in f if line.strip())
+        else:
+            with open(path, "rb") as f:
+                reports.append(f.read())
+    return reports
+
+
+def decode_per_element(tlv):
+    out = {}
+    TLVReader(tlv)._get(tlv, [], out)
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("files", nargs="*", help="Files holding captured report payloads")
+    parser.add_argument("--hex", action="store_true", help="Files hold one hex-encoded payload per line")
+    parser.add_argument("--endpoints", type=int, default=50, help="Bridged endpoints of the synthesized report")
+    parser.add_argument("--clusters", type=int, default=3, help="Clusters per endpoint of the synthesized report")
+    parser.add_argument("--attributes", type=int, default=10, help="Attributes per cluster of the synthesized report")
+    parser.add_argument("--repeat", type=int, default=5, help="Timed decodings of every payload")
+    args = parser.parse_args()
+
+    reports = load_reports(args)
+    totalBytes = sum(len(report) for report in reports)
+    print("%d payload(s), %d bytes" % (len(reports), totalBytes))
+
+    for report in reports:
+        if TLVReader(report).get() != decode_per_element(report):
+            print("Decoders disagree on a payload", file=sys.stderr)
+            return 1
+
+    results = {}
+    for name, decode in (("per-element", decode_per_element), ("TLVReader.get", lambda tlv: TLVReader(tlv).get())):
+        seconds = min(timeit.repeat(lambda: [decode(report) for report in reports], number=1, repeat=args.repeat))
+        results[name] = seconds
+        print("%-14s %9.2f ms  %8.2f MB/s" % (name, seconds * 1000, totalBytes / seconds / 1e6))
+
+    print("speedup: %.1fx" % (results["per-element"] / results["TLVReader.get"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
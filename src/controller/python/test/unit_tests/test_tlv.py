@@ -195,6 +195,50 @@ class TestTLVReader(unittest.TestCase):
                          0x18   # End of container
                          ], TLVList([(None, 1), (None, TLVList([(None, 2), (3, 4)]))]))
 
+    def _assert_same_as_element_decoding(self, tlv):
+        # TLVReader.get() decodes through a fast path; it must give exactly what the per-element decoding does.
+        expected = {}
+        TLVReader(tlv)._get(tlv, [], expected)
+        decoded = TLVReader(tlv).get()
+        self.assertEqual(decoded, expected)
+        self.assertEqual(repr(decoded), repr(expected))
+
+    def test_same_as_element_decoding(self):
+        writer = TLVWriter()
+        writer.put(None, {
+            0: -5,
+            1: tlvUint(300),
+            2: 1.5,
+            3: "Hello",
+            4: b"\xde\xad\xbe\xef",
+            5: [True, False, None, tlvUint(2**40), -(2**40)],
+            6: {0: {1: "nested"}, 1: []},
+            (0x235A0000, 42): "fully qualified",
+            (None, 42): "implicit profile",
+            (None, 0x12345): "implicit profile, 4-byte tag",
+        })
+        test_cases = [
+            writer.encoding,
+            bytes(writer.encoding),
+            # Float32, double, path, strings with 2-byte lengths, invalid UTF-8, common profile tags
+            b'\x15\x2a\x01\x00\x00\xc0\x3f\x2b\x02\x00\x00\x00\x00\x00\x00\xf8\x3f'
+            b'\x37\x03\x24\x01\x05\x04\x06\x18'
+            b'\x2d\x04\x03\x00abc\x31\x05\x02\x00\x01\x02\x2c\x06\x02\xff\xfe'
+            b'\x44\x01\x00\x07\x64\x01\x00\x01\x00\x08\x18',
+            # Unterminated containers and trailing elements after the end of the top-level container
+            b'\x15\x36\x01\x24\x00\x01',
+            b'\x15\x24\x00\x01\x18\x24\x01\x02',
+        ]
+        for tlv in test_cases:
+            with self.subTest(tlv=tlv):
+                self._assert_same_as_element_decoding(tlv)
+
+    def test_decoding_description(self):
+        reader = TLVReader(bytearray([0b00000100, 0x7c]))
+        self.assertEqual(reader.get(), {"Any": tlvUint(0x7c)})
+        self.assertEqual(len(reader.decoding), 1)
+        self.assertEqual(reader.decoding[0]["type"], "Unsigned Integer 1-byte value")
+
 
 class TestTLVTypes(unittest.TestCase):
     def test_list(self):
@@ -0,0 +1,273 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <app/tests/AppTestContext.h>
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningPipeline.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <string>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr char kSetUpCode[] = "MT:-24J0AFN00KA0648G00";
+
+// Records the calls into the commissioner, which the test completes by hand.
+class TestPipeline : public CommissioningPipeline
+{
+public:
+    std::vector<NodeId> mPaired;
+    std::vector<NodeId> mQueued;
+    std::vector<NodeId> mStopped;
+    std::string mSetUpCode;
+    const CommissioningParameters * mParams = nullptr;
+    CHIP_ERROR mPairingError                = CHIP_NO_ERROR;
+    CHIP_ERROR mQueueError                  = CHIP_NO_ERROR;
+
+protected:
+    CHIP_ERROR EstablishPASEConnection(NodeId nodeId, const char * setUpCode) override
+    {
+        ReturnErrorOnFailure(mPairingError);
+        mPaired.push_back(nodeId);
+        mSetUpCode = setUpCode;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR QueueCommissioning(NodeId nodeId, const CommissioningParameters & params) override
+    {
+        ReturnErrorOnFailure(mQueueError);
+        mQueued.push_back(nodeId);
+        mParams = &params;
+        return CHIP_NO_ERROR;
+    }
+
+    void StopPairing(NodeId nodeId) override { mStopped.push_back(nodeId); }
+};
+
+class RecordingDelegate : public CommissioningPipeline::Delegate
+{
+public:
+    void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) override { mDone.push_back({ nodeId, error }); }
+    void OnPipelineIdle() override { mIdleCount++; }
+
+    std::vector<std::pair<NodeId, CHIP_ERROR>> mDone;
+    unsigned mIdleCount = 0;
+};
+
+class TestCommissioningPipeline : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        ASSERT_EQ(mPipeline.Init(mCommissioner, GetSystemLayer(), &mDelegate), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mPipeline.Shutdown();
+        AppContext::TearDown();
+    }
+
+protected:
+    DeviceCommissioner mCommissioner;
+    RecordingDelegate mDelegate;
+    TestPipeline mPipeline;
+};
+
+TEST_F(TestCommissioningPipeline, OverlapsPairingAndCommissioning)
+{
+    EXPECT_EQ(mCommissioner.GetPairingDelegate(), &mPipeline);
+    for (NodeId nodeId = 1; nodeId <= 3; nodeId++)
+    {
+        EXPECT_EQ(mPipeline.AddDevice(nodeId, kSetUpCode), CHIP_NO_ERROR);
+    }
+
+    // Devices start from the event loop, one PASE connection at a time.
+    EXPECT_TRUE(mPipeline.mPaired.empty());
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1 }));
+    EXPECT_EQ(mPipeline.mSetUpCode, kSetUpCode);
+    EXPECT_EQ(mPipeline.GetMetrics().queued, 2u);
+    EXPECT_EQ(mPipeline.GetMetrics().inProgress, 1u);
+
+    // Once paired, the device is queued in the commissioner and the next device is paired, from the event loop again.
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    EXPECT_EQ(mPipeline.mQueued, std::vector<NodeId>({ 1 }));
+    EXPECT_EQ(mPipeline.mPaired.size(), 1u);
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1, 2 }));
+
+    // The third device waits for the commissioning of the first one: it would only hold a PASE session open.
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1, 2 }));
+    EXPECT_EQ(mPipeline.GetMetrics().queued, 1u);
+    EXPECT_EQ(mPipeline.GetMetrics().inProgress, 2u);
+
+    mPipeline.OnCommissioningComplete(1, CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1, 2, 3 }));
+    EXPECT_EQ(mPipeline.GetMetrics().queued, 0u);
+
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    mPipeline.OnCommissioningComplete(2, CHIP_ERROR_TIMEOUT);
+    EXPECT_EQ(mDelegate.mIdleCount, 0u);
+    mPipeline.OnCommissioningComplete(3, CHIP_NO_ERROR);
+
+    // Completions for devices the pipeline does not know about are ignored.
+    mPipeline.OnCommissioningComplete(4, CHIP_NO_ERROR);
+
+    EXPECT_TRUE(mPipeline.IsIdle());
+    EXPECT_EQ(mDelegate.mIdleCount, 1u);
+    ASSERT_EQ(mDelegate.mDone.size(), 3u);
+    EXPECT_EQ(mDelegate.mDone[1].first, 2u);
+    EXPECT_EQ(mDelegate.mDone[1].second, CHIP_ERROR_TIMEOUT);
+
+    const auto & metrics = mPipeline.GetMetrics();
+    EXPECT_EQ(metrics.succeeded, 2u);
+    EXPECT_EQ(metrics.failed, 1u);
+    EXPECT_EQ(metrics.maxInProgress, 2u);
+}
+
+TEST_F(TestCommissioningPipeline, MaxConcurrency)
+{
+    mPipeline.SetMaxConcurrency(1);
+    EXPECT_EQ(mPipeline.AddDevice(1, kSetUpCode), CHIP_NO_ERROR);
+    EXPECT_EQ(mPipeline.AddDevice(2, kSetUpCode), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    // The first device is still being commissioned.
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1 }));
+
+    mPipeline.OnCommissioningComplete(1, CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1, 2 }));
+
+    // Raising the limit lets the next device pair while this one is commissioned.
+    mPipeline.SetMaxConcurrency(2);
+    EXPECT_EQ(mPipeline.AddDevice(3, kSetUpCode), CHIP_NO_ERROR);
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1, 2, 3 }));
+    EXPECT_EQ(mPipeline.GetMetrics().maxInProgress, 2u);
+
+    // Higher limits are capped, since the commissioner works on one device at a time.
+    mPipeline.SetMaxConcurrency(8);
+    EXPECT_EQ(mPipeline.AddDevice(4, kSetUpCode), CHIP_NO_ERROR);
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(mPipeline.mPaired, std::vector<NodeId>({ 1, 2, 3 }));
+    EXPECT_EQ(mPipeline.GetMetrics().inProgress, 2u);
+    EXPECT_EQ(mPipeline.GetMetrics().maxInProgress, 2u);
+}
+
+TEST_F(TestCommissioningPipeline, PairingFailures)
+{
+    // A device that cannot be paired fails on its own.
+    mPipeline.mPairingError = CHIP_ERROR_NO_MEMORY;
+    EXPECT_EQ(mPipeline.AddDevice(1, kSetUpCode), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    ASSERT_EQ(mDelegate.mDone.size(), 1u);
+    EXPECT_EQ(mDelegate.mDone[0].second, CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(mDelegate.mIdleCount, 1u);
+
+    mPipeline.mPairingError = CHIP_NO_ERROR;
+    EXPECT_EQ(mPipeline.AddDevice(2, kSetUpCode), CHIP_NO_ERROR);
+    EXPECT_EQ(mPipeline.AddDevice(3, kSetUpCode), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    mPipeline.OnPairingComplete(CHIP_ERROR_TIMEOUT);
+    DrainAndServiceIO();
+    ASSERT_EQ(mDelegate.mDone.size(), 2u);
+    EXPECT_EQ(mDelegate.mDone[1].first, 2u);
+    EXPECT_EQ(mDelegate.mDone[1].second, CHIP_ERROR_TIMEOUT);
+    EXPECT_TRUE(mPipeline.mStopped.empty());
+
+    // A paired device the commissioner does not take is disconnected.
+    mPipeline.mQueueError = CHIP_ERROR_NO_MEMORY;
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    EXPECT_EQ(mPipeline.mStopped, std::vector<NodeId>({ 3 }));
+    ASSERT_EQ(mDelegate.mDone.size(), 3u);
+    EXPECT_EQ(mDelegate.mDone[2].second, CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(mPipeline.GetMetrics().failed, 3u);
+    EXPECT_EQ(mDelegate.mIdleCount, 2u);
+}
+
+TEST_F(TestCommissioningPipeline, CopiesParameters)
+{
+    char countryCode[] = { 'F', 'R' };
+    CommissioningParameters params;
+    params.SetCountryCode(CharSpan(countryCode));
+    params.SetFailsafeTimerSeconds(120);
+    EXPECT_EQ(mPipeline.SetCommissioningParameters(params), CHIP_NO_ERROR);
+    countryCode[0] = 'X';
+
+    EXPECT_EQ(mPipeline.AddDevice(1, kSetUpCode), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    ASSERT_NE(mPipeline.mParams, nullptr);
+    EXPECT_TRUE(mPipeline.mParams->GetCountryCode().Value().data_equal("FR"_span));
+    EXPECT_EQ(mPipeline.mParams->GetFailsafeTimerSeconds().Value(), 120u);
+
+    // Nonces would be used for every device; time zones are not copied.
+    uint8_t nonce[32] = {};
+    CommissioningParameters withNonce;
+    withNonce.SetCSRNonce(ByteSpan(nonce));
+    EXPECT_EQ(mPipeline.SetCommissioningParameters(withNonce), CHIP_ERROR_INVALID_ARGUMENT);
+
+    app::Clusters::TimeSynchronization::Structs::TimeZoneStruct::Type timeZone;
+    CommissioningParameters withTimeZone;
+    withTimeZone.SetTimeZone(app::DataModel::List<app::Clusters::TimeSynchronization::Structs::TimeZoneStruct::Type>(&timeZone, 1));
+    EXPECT_EQ(mPipeline.SetCommissioningParameters(withTimeZone), CHIP_ERROR_NOT_IMPLEMENTED);
+
+    // The rejected parameters left the previous ones in place.
+    EXPECT_TRUE(mPipeline.mParams->GetCountryCode().Value().data_equal("FR"_span));
+}
+
+TEST_F(TestCommissioningPipeline, ShutdownStopsDevicesInProgress)
+{
+    EXPECT_EQ(mPipeline.AddDevice(1, kSetUpCode), CHIP_NO_ERROR);
+    EXPECT_EQ(mPipeline.AddDevice(2, kSetUpCode), CHIP_NO_ERROR);
+    EXPECT_EQ(mPipeline.AddDevice(3, kSetUpCode), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    mPipeline.OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    mPipeline.Shutdown();
+    EXPECT_EQ(mPipeline.mStopped, std::vector<NodeId>({ 1, 2 }));
+    EXPECT_EQ(mCommissioner.GetPairingDelegate(), nullptr);
+    EXPECT_TRUE(mPipeline.IsIdle());
+
+    // The third device never starts, and the stopped devices are not reported.
+    DrainAndServiceIO();
+    mPipeline.OnCommissioningComplete(1, CHIP_ERROR_CANCELLED);
+    EXPECT_EQ(mPipeline.mPaired.size(), 2u);
+    EXPECT_TRUE(mDelegate.mDone.empty());
+    EXPECT_EQ(mPipeline.AddDevice(4, kSetUpCode), CHIP_ERROR_INCORRECT_STATE);
+}
+
+} // namespace
@@ -244,7 +244,14 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
             return;
         }
 
-        if (gCommandResponseDirective == CommandResponseDirective::kSendDataResponse)
+        CommandResponseDirective directive = gCommandResponseDirective;
+        if (directive == CommandResponseDirective::kAsyncOnTestEndpoint)
+        {
+            directive = (aCommandPath.mEndpointId == kTestEndpointId) ? CommandResponseDirective::kAsync
+                                                                       : CommandResponseDirective::kSendDataResponse;
+        }
+
+        if (directive == CommandResponseDirective::kSendDataResponse)
         {
             Clusters::UnitTesting::Commands::TestStructArrayArgumentResponse::Type dataResponse;
             Clusters::UnitTesting::Structs::NestedStructList::Type nestedStructList[4];
@@ -264,11 +271,11 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
 
             apCommandObj->AddResponse(aCommandPath, dataResponse);
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kSendSuccessStatusCode)
+        else if (directive == CommandResponseDirective::kSendSuccessStatusCode)
         {
             apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Success);
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kSendMultipleSuccessStatusCodes)
+        else if (directive == CommandResponseDirective::kSendMultipleSuccessStatusCodes)
         {
             apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Success,
                                     "No error but testing status success case");
@@ -283,11 +290,11 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
             // And one failure on the end.
             (void) apCommandObj->FallibleAddStatus(aCommandPath, Protocols::InteractionModel::Status::Failure);
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kSendError)
+        else if (directive == CommandResponseDirective::kSendError)
         {
             apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Failure);
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kSendMultipleErrors)
+        else if (directive == CommandResponseDirective::kSendMultipleErrors)
         {
             apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Failure);
 
@@ -298,17 +305,17 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
                 (void) apCommandObj->FallibleAddStatus(aCommandPath, Protocols::InteractionModel::Status::Failure);
             }
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kSendSuccessStatusCodeWithClusterStatus)
+        else if (directive == CommandResponseDirective::kSendSuccessStatusCodeWithClusterStatus)
         {
             apCommandObj->AddStatus(
                 aCommandPath, Protocols::InteractionModel::ClusterStatusCode::ClusterSpecificSuccess(kTestSuccessClusterStatus));
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kSendErrorWithClusterStatus)
+        else if (directive == CommandResponseDirective::kSendErrorWithClusterStatus)
         {
             apCommandObj->AddStatus(
                 aCommandPath, Protocols::InteractionModel::ClusterStatusCode::ClusterSpecificFailure(kTestFailureClusterStatus));
         }
-        else if (gCommandResponseDirective == CommandResponseDirective::kAsync)
+        else if (directive == CommandResponseDirective::kAsync)
         {
             gAsyncCommandHandle = apCommandObj;
         }
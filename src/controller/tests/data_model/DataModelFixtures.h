@@ -93,10 +93,12 @@ enum class CommandResponseDirective
     kSendSuccessStatusCodeWithClusterStatus,
     kSendErrorWithClusterStatus,
     kAsync,
+    // kAsync for the commands to kTestEndpointId, kSendDataResponse for the commands to other endpoints.
+    kAsyncOnTestEndpoint,
 };
 extern ScopedChangeOnly<CommandResponseDirective> gCommandResponseDirective;
 
-// Populated with the command handle when gCommandResponseDirective == kAsync
+// Populated with the command handle when gCommandResponseDirective == kAsync or kAsyncOnTestEndpoint
 extern CommandHandler::Handle gAsyncCommandHandle;
 
 /// A customized class for read/write/invoke that matches functionality
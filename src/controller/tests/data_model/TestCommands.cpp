@@ -29,7 +29,9 @@
 
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/AppConfig.h>
+#include <app/CommandSender.h>
 #include <app/InteractionModelEngine.h>
+#include <app/PendingResponseTrackerImpl.h>
 #include <app/data-model/NullObject.h>
 #include <app/tests/AppTestContext.h>
 #include <controller/InvokeInteraction.h>
@@ -42,6 +44,8 @@
 #include <protocols/interaction_model/Constants.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <vector>
+
 using namespace chip;
 using namespace chip::app;
 using namespace chip::app::Clusters;
@@ -50,6 +54,8 @@ using namespace chip::Protocols;
 
 namespace {
 
+constexpr EndpointId kSecondTestEndpointId = kTestEndpointId + 1;
+
 const chip::Test::MockNodeConfig & TestMockNodeConfig()
 {
     using namespace chip::app;
@@ -69,11 +75,42 @@ const chip::Test::MockNodeConfig & TestMockNodeConfig()
             {} // generated commands
           ),
         }),
+        MockEndpointConfig(kSecondTestEndpointId, {
+            MockClusterConfig(Clusters::UnitTesting::Id, {
+                ClusterRevision::Id, FeatureMap::Id,
+            },
+            {},      // events
+            {
+               Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Id,
+            }, // accepted commands
+            {} // generated commands
+          ),
+        }),
     });
     // clang-format on
     return config;
 }
 
+class BatchedResponseRecorder : public CommandSender::ExtendableCallback
+{
+public:
+    void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+    {
+        ASSERT_TRUE(aResponseData.commandRef.HasValue());
+        commandRefs.push_back(aResponseData.commandRef.Value());
+        statuses.push_back(aResponseData.statusIB.mStatus);
+        withData.push_back(aResponseData.data != nullptr);
+    }
+    void OnError(const CommandSender * apCommandSender, const CommandSender::ErrorData & aErrorData) override { errors++; }
+    void OnDone(CommandSender * apCommandSender) override { done = true; }
+
+    std::vector<uint16_t> commandRefs;
+    std::vector<Protocols::InteractionModel::Status> statuses;
+    std::vector<bool> withData;
+    int errors = 0;
+    bool done  = false;
+};
+
 class TestCommands : public chip::Test::AppContext
 {
 public:
@@ -86,6 +123,7 @@ public:
 
     void TearDown() override
     {
+        InteractionModelEngine::GetInstance()->SetCommandPathRegistryOverride(nullptr);
         chip::Test::ResetMockNodeConfig();
         InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
         AppContext::TearDown();
@@ -427,4 +465,59 @@ TEST_F(TestCommands, TestFailureWithClusterStatus)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F(TestCommands, TestBatchedResponsesAreSentInRequestOrder)
+{
+    // The IM engine only accepts batched invoke requests with a command path registry that can hold them.
+    BasicCommandPathRegistry<2> commandPathRegistry;
+    InteractionModelEngine::GetInstance()->SetCommandPathRegistryOverride(&commandPathRegistry);
+
+    // The first command responds asynchronously, the second one right away: its response is held until the first one has
+    // responded.
+    ScopedChange directive(gCommandResponseDirective, CommandResponseDirective::kAsyncOnTestEndpoint);
+
+    BatchedResponseRecorder recorder;
+    PendingResponseTrackerImpl pendingResponseTracker;
+    CommandSender commandSender(CommandSender::TestOnlyMarker(), &recorder, &GetExchangeManager(), &pendingResponseTracker);
+
+    CommandSender::ConfigParameters config;
+    config.SetRemoteMaxPathsPerInvoke(2);
+    ASSERT_EQ(commandSender.SetCommandSenderConfig(config), CHIP_NO_ERROR);
+
+    Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
+    request.arg1                 = true;
+    const EndpointId endpoints[] = { kTestEndpointId, kSecondTestEndpointId };
+    for (uint16_t i = 0; i < 2; i++)
+    {
+        CommandPathParams commandPath(endpoints[i], 0, request.GetClusterId(), request.GetCommandId(),
+                                      CommandPathFlags::kEndpointIdValid);
+        CommandSender::AddRequestDataParameters addRequestDataParams;
+        addRequestDataParams.SetCommandRef(i);
+        ASSERT_EQ(commandSender.AddRequestData(commandPath, request, addRequestDataParams), CHIP_NO_ERROR);
+    }
+
+    ASSERT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+
+    EXPECT_TRUE(recorder.commandRefs.empty());
+    EXPECT_FALSE(recorder.done);
+
+    CommandHandler * commandHandle = gAsyncCommandHandle.Get();
+    ASSERT_NE(commandHandle, nullptr);
+    commandHandle->AddStatus(ConcreteCommandPath(kTestEndpointId, request.GetClusterId(), request.GetCommandId()),
+                             Protocols::InteractionModel::Status::Success);
+    gAsyncCommandHandle.Release();
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(recorder.commandRefs, (std::vector<uint16_t>{ 0, 1 }));
+    EXPECT_EQ(recorder.statuses,
+              (std::vector<Protocols::InteractionModel::Status>{ Protocols::InteractionModel::Status::Success,
+                                                                  Protocols::InteractionModel::Status::Success }));
+    EXPECT_EQ(recorder.withData, (std::vector<bool>{ false, true }));
+    EXPECT_EQ(recorder.errors, 0);
+    EXPECT_TRUE(recorder.done);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace
@@ -27,6 +27,7 @@
 
 #include <stddef.h>
 
+#include <credentials/CHIPCertView.h>
 #include <credentials/CHIPCert_Internal.h>
 #include <credentials/CHIPCertificateSet.h>
 #include <lib/asn1/ASN1.h>
@@ -227,6 +228,11 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
 }
 
 CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    return VerifyCertSignature(cert, signer.mPublicKey);
+}
+
+CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const P256PublicKeySpan & signerPublicKeySpan)
 {
     VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(cert.mSigAlgoOID == kOID_SigAlgo_ECDSAWithSHA256, CHIP_ERROR_UNSUPPORTED_SIGNATURE_TYPE);
@@ -241,7 +247,7 @@ CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCerti
     ReturnErrorOnFailure(signature.SetLength(cert.mSignature.size()));
     memcpy(signature.Bytes(), cert.mSignature.data(), cert.mSignature.size());
 
-    memcpy(signerPublicKey, signer.mPublicKey.data(), signer.mPublicKey.size());
+    memcpy(signerPublicKey, signerPublicKeySpan.data(), signerPublicKeySpan.size());
 
     ReturnErrorOnFailure(
         signerPublicKey.ECDSA_validate_hash_signature(cert.mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature));
@@ -249,6 +255,55 @@ CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCerti
     return CHIP_NO_ERROR;
 }
 
+CertificateValidityResult EvaluateCertificateValidity(uint32_t notBeforeTime, uint32_t notAfterTime,
+                                                      const EffectiveTime & effectiveTime)
+{
+    // See also ASN1ToChipEpochTime().
+    //
+    // X.509/RFC5280 defines the special time 99991231235959Z to mean 'no
+    // well-defined expiration date'.  In CHIP TLV-encoded certificates, this
+    // special value is represented as a CHIP Epoch time value of 0 sec
+    // (2000-01-01 00:00:00 UTC).
+    if (effectiveTime.Is<CurrentChipEpochTime>())
+    {
+        uint32_t currentTime = effectiveTime.Get<CurrentChipEpochTime>().count();
+        if (currentTime < notBeforeTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotBeforeTime (%" PRIu32 ") is after current time (%" PRIu32 ")",
+                          notBeforeTime, currentTime);
+            return CertificateValidityResult::kNotYetValid;
+        }
+        if (notAfterTime != kNullCertTime && currentTime > notAfterTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before current time (%" PRIu32 ")",
+                          notAfterTime, currentTime);
+            return CertificateValidityResult::kExpired;
+        }
+        return CertificateValidityResult::kValid;
+    }
+
+    if (effectiveTime.Is<LastKnownGoodChipEpochTime>())
+    {
+        // Last Known Good Time may not be moved forward except at the time of
+        // commissioning or firmware update, so we can't use it to validate
+        // NotBefore.  However, so long as firmware build times are properly
+        // recorded and certificates loaded during commissioning are in fact
+        // valid at the time of commissioning, observing a NotAfter that falls
+        // before Last Known Good Time is a reliable indicator that the
+        // certificate in question is expired.  Check for this.
+        uint32_t lastKnownGoodTime = effectiveTime.Get<LastKnownGoodChipEpochTime>().count();
+        if (notAfterTime != kNullCertTime && lastKnownGoodTime > notAfterTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before last known good time (%" PRIu32 ")",
+                          notAfterTime, lastKnownGoodTime);
+            return CertificateValidityResult::kExpiredAtLastKnownGoodTime;
+        }
+        return CertificateValidityResult::kNotExpiredAtLastKnownGoodTime;
+    }
+
+    return CertificateValidityResult::kTimeUnknown;
+}
+
 CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, ValidationContext & context, uint8_t depth)
 {
     CHIP_ERROR err                     = CHIP_NO_ERROR;
@@ -316,58 +371,8 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
 
     // Verify NotBefore and NotAfter validity of the certificates.
-    //
-    // See also ASN1ToChipEpochTime().
-    //
-    // X.509/RFC5280 defines the special time 99991231235959Z to mean 'no
-    // well-defined expiration date'.  In CHIP TLV-encoded certificates, this
-    // special value is represented as a CHIP Epoch time value of 0 sec
-    // (2000-01-01 00:00:00 UTC).
     CertificateValidityResult validityResult;
-    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
-    {
-        if (context.mEffectiveTime.Get<CurrentChipEpochTime>().count() < cert->mNotBeforeTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotBeforeTime (%" PRIu32 ") is after current time (%" PRIu32 ")",
-                          cert->mNotBeforeTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kNotYetValid;
-        }
-        else if (cert->mNotAfterTime != kNullCertTime &&
-                 context.mEffectiveTime.Get<CurrentChipEpochTime>().count() > cert->mNotAfterTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before current time (%" PRIu32 ")",
-                          cert->mNotAfterTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kExpired;
-        }
-        else
-        {
-            validityResult = CertificateValidityResult::kValid;
-        }
-    }
-    else if (context.mEffectiveTime.Is<LastKnownGoodChipEpochTime>())
-    {
-        // Last Known Good Time may not be moved forward except at the time of
-        // commissioning or firmware update, so we can't use it to validate
-        // NotBefore.  However, so long as firmware build times are properly
-        // recorded and certificates loaded during commissioning are in fact
-        // valid at the time of commissioning, observing a NotAfter that falls
-        // before Last Known Good Time is a reliable indicator that the
-        // certificate in question is expired.  Check for this.
-        if (cert->mNotAfterTime != 0 && context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count() > cert->mNotAfterTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before last known good time (%" PRIu32 ")",
-                          cert->mNotAfterTime, context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kExpiredAtLastKnownGoodTime;
-        }
-        else
-        {
-            validityResult = CertificateValidityResult::kNotExpiredAtLastKnownGoodTime;
-        }
-    }
-    else
-    {
-        validityResult = CertificateValidityResult::kTimeUnknown;
-    }
+    validityResult = EvaluateCertificateValidity(cert->mNotBeforeTime, cert->mNotAfterTime, context.mEffectiveTime);
 
     if (context.mValidityPolicy != nullptr)
     {
@@ -1246,12 +1251,16 @@ CHIP_ERROR ExtractNodeIdFabricIdFromOpCert(const ChipCertificateData & opcert, N
     // Since we assume the cert is pre-validated, we are going to assume that
     // its subject in fact has both a node id and a fabric id.
     VerifyOrReturnError(outNodeId != nullptr && outFabricId != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    return ExtractNodeIdFabricIdFromSubjectDN(opcert.mSubjectDN, *outNodeId, *outFabricId);
+}
+
+CHIP_ERROR ExtractNodeIdFabricIdFromSubjectDN(const ChipDN & subjectDN, NodeId & outNodeId, FabricId & outFabricId)
+{
     NodeId nodeId      = 0;
     FabricId fabricId  = kUndefinedFabricId;
     bool foundNodeId   = false;
     bool foundFabricId = false;
 
-    const ChipDN & subjectDN = opcert.mSubjectDN;
     for (uint8_t i = 0; i < subjectDN.RDNCount(); ++i)
     {
         const auto & rdn = subjectDN.rdn[i];
@@ -1271,8 +1280,8 @@ CHIP_ERROR ExtractNodeIdFabricIdFromOpCert(const ChipCertificateData & opcert, N
         return CHIP_ERROR_NOT_FOUND;
     }
 
-    *outNodeId   = nodeId;
-    *outFabricId = fabricId;
+    outNodeId   = nodeId;
+    outFabricId = fabricId;
     return CHIP_NO_ERROR;
 }
 
@@ -1298,13 +1307,17 @@ CHIP_ERROR ExtractNodeIdCompressedFabricIdFromOpCerts(ByteSpan rcac, ByteSpan no
 
 CHIP_ERROR ExtractFabricIdFromCert(const ChipCertificateData & cert, FabricId * fabricId)
 {
-    const ChipDN & subjectDN = cert.mSubjectDN;
+    return ExtractFabricIdFromSubjectDN(cert.mSubjectDN, *fabricId);
+}
+
+CHIP_ERROR ExtractFabricIdFromSubjectDN(const ChipDN & subjectDN, FabricId & fabricId)
+{
     for (uint8_t i = 0; i < subjectDN.RDNCount(); ++i)
     {
         const auto & rdn = subjectDN.rdn[i];
         if (rdn.mAttrOID == ASN1::kOID_AttributeType_MatterFabricId)
         {
-            *fabricId = rdn.mChipVal;
+            fabricId = rdn.mChipVal;
             return CHIP_NO_ERROR;
         }
     }
@@ -1314,25 +1327,24 @@ CHIP_ERROR ExtractFabricIdFromCert(const ChipCertificateData & cert, FabricId *
 
 CHIP_ERROR ExtractCATsFromOpCert(const ByteSpan & opcert, CATValues & cats)
 {
-    ChipCertificateSet certSet;
-    ChipCertificateData certData;
-
-    ReturnErrorOnFailure(certSet.Init(&certData, 1));
-
-    ReturnErrorOnFailure(certSet.LoadCert(opcert, BitFlags<CertDecodeFlags>()));
-
-    return ExtractCATsFromOpCert(certData, cats);
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(opcert));
+    return certView.GetCATs(cats);
 }
 
 CHIP_ERROR ExtractCATsFromOpCert(const ChipCertificateData & opcert, CATValues & cats)
+{
+    return ExtractCATsFromSubjectDN(opcert.mSubjectDN, cats);
+}
+
+CHIP_ERROR ExtractCATsFromSubjectDN(const ChipDN & subjectDN, CATValues & cats)
 {
     uint8_t catCount = 0;
     CertType certType;
 
-    ReturnErrorOnFailure(opcert.mSubjectDN.GetCertType(certType));
+    ReturnErrorOnFailure(subjectDN.GetCertType(certType));
     VerifyOrReturnError(certType == CertType::kNode, CHIP_ERROR_INVALID_ARGUMENT);
 
-    const ChipDN & subjectDN = opcert.mSubjectDN;
     for (uint8_t i = 0; i < subjectDN.RDNCount(); ++i)
     {
         const auto & rdn = subjectDN.rdn[i];
@@ -1359,49 +1371,47 @@ CHIP_ERROR ExtractCATsFromOpCert(const ChipCertificateData & opcert, CATValues &
 
 CHIP_ERROR ExtractFabricIdFromCert(const ByteSpan & opcert, FabricId * fabricId)
 {
-    ChipCertificateData certData;
-    ReturnErrorOnFailure(DecodeChipCert(opcert, certData));
-    return ExtractFabricIdFromCert(certData, fabricId);
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(opcert));
+    return certView.GetFabricId(*fabricId);
 }
 
 CHIP_ERROR ExtractNodeIdFabricIdFromOpCert(const ByteSpan & opcert, NodeId * nodeId, FabricId * fabricId)
 {
-    ChipCertificateData certData;
-    ReturnErrorOnFailure(DecodeChipCert(opcert, certData));
-    return ExtractNodeIdFabricIdFromOpCert(certData, nodeId, fabricId);
+    VerifyOrReturnError(nodeId != nullptr && fabricId != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(opcert));
+    return certView.GetNodeIdFabricId(*nodeId, *fabricId);
 }
 
 CHIP_ERROR ExtractPublicKeyFromChipCert(const ByteSpan & chipCert, P256PublicKeySpan & publicKey)
 {
-    ChipCertificateData certData;
-    ReturnErrorOnFailure(DecodeChipCert(chipCert, certData));
-    publicKey = certData.mPublicKey;
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(chipCert));
+    publicKey = certView.GetPublicKey();
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ExtractNotBeforeFromChipCert(const ByteSpan & chipCert, chip::System::Clock::Seconds32 & notBeforeChipEpochTime)
 {
-    ChipCertificateData certData;
-    ReturnErrorOnFailure(DecodeChipCert(chipCert, certData));
-    notBeforeChipEpochTime = chip::System::Clock::Seconds32(certData.mNotBeforeTime);
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(chipCert));
+    notBeforeChipEpochTime = chip::System::Clock::Seconds32(certView.GetNotBeforeTime());
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ExtractSKIDFromChipCert(const ByteSpan & chipCert, CertificateKeyId & skid)
 {
-    ChipCertificateData certData;
-    ReturnErrorOnFailure(DecodeChipCert(chipCert, certData));
-    VerifyOrReturnError(certData.mCertFlags.Has(CertFlags::kExtPresent_AuthKeyId), CHIP_ERROR_NOT_FOUND);
-    skid = certData.mSubjectKeyId;
-    return CHIP_NO_ERROR;
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(chipCert));
+    return certView.GetSubjectKeyId(skid);
 }
 
 CHIP_ERROR ExtractSubjectDNFromChipCert(const ByteSpan & chipCert, ChipDN & dn)
 {
-    ChipCertificateData certData;
-    ReturnErrorOnFailure(DecodeChipCert(chipCert, certData));
-    dn = certData.mSubjectDN;
-    return CHIP_NO_ERROR;
+    ChipCertificateView certView;
+    ReturnErrorOnFailure(certView.Init(chipCert));
+    return certView.GetSubjectDN(dn);
 }
 
 CHIP_ERROR ExtractSubjectDNFromX509Cert(const ByteSpan & x509Cert, ChipDN & dn)
@@ -520,6 +520,28 @@ CHIP_ERROR ConvertX509CertToChipCert(const ByteSpan x509Cert, MutableByteSpan &
  **/
 CHIP_ERROR ConvertChipCertToX509Cert(const ByteSpan chipCert, MutableByteSpan & x509Cert);
 
+/**
+ * @brief Compute the exact size of the CHIP TLV encoding of a standard X.509 certificate,
+ *        i.e. the size of the output of ConvertX509CertToChipCert(), without producing it.
+ *
+ * @param x509Cert        CHIP X.509 DER encoded certificate.
+ * @param chipCertLen     Size of the certificate in CHIP format.
+ *
+ * @return Returns a CHIP_ERROR if the certificate cannot be converted, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR CalculateChipCertLength(const ByteSpan x509Cert, size_t & chipCertLen);
+
+/**
+ * @brief Compute the exact size of the X.509 DER encoding of a CHIP certificate,
+ *        i.e. the size of the output of ConvertChipCertToX509Cert(), without producing it.
+ *
+ * @param chipCert        CHIP certificate in CHIP TLV encoding.
+ * @param x509CertLen     Size of the certificate in X.509 DER format.
+ *
+ * @return Returns a CHIP_ERROR if the certificate cannot be converted, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR CalculateX509CertLength(const ByteSpan chipCert, size_t & x509CertLen);
+
 /**
  * @brief Verifies the signature of a certificate.
  *
@@ -535,6 +557,13 @@ CHIP_ERROR ConvertChipCertToX509Cert(const ByteSpan chipCert, MutableByteSpan &
  **/
 CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer);
 
+/**
+ * @brief Verifies the signature of a certificate with the public key of its signer.
+ *
+ * @see VerifyCertSignature(const ChipCertificateData &, const ChipCertificateData &)
+ **/
+CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const P256PublicKeySpan & signerPublicKeySpan);
+
 /**
  * Validate CHIP Root CA Certificate (RCAC) in ByteSpan TLV-encoded form.
  * This function performs RCAC parsing, checks SubjectDN validity, verifies that SubjectDN
@@ -33,6 +33,7 @@
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/core/Optional.h>
 #include <lib/core/TLV.h>
+#include <lib/core/TLVCountingWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
@@ -516,6 +517,8 @@ static CHIP_ERROR ConvertCertificate(ASN1Reader & reader, TLVWriter & writer, Ta
                 err = reader.Next();
             }
 
+            // No other element is allowed in the TBSCertificate.
+            VerifyOrExit(err != CHIP_NO_ERROR, err = ASN1_ERROR_UNSUPPORTED_ENCODING);
             if (err != ASN1_END)
             {
                 ExitNow();
@@ -572,5 +575,24 @@ CHIP_ERROR ConvertX509CertToChipCert(const ByteSpan x509Cert, MutableByteSpan &
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CalculateChipCertLength(const ByteSpan x509Cert, size_t & chipCertLen)
+{
+    ASN1Reader reader;
+    CountingTLVWriter writer;
+
+    VerifyOrReturnError(!x509Cert.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<uint32_t>(x509Cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    reader.Init(x509Cert);
+
+    ReturnErrorOnFailure(ConvertCertificate(reader, writer, AnonymousTag()));
+
+    ReturnErrorOnFailure(writer.Finalize());
+
+    chipCertLen = writer.GetLengthWritten();
+
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Credentials
 } // namespace chip
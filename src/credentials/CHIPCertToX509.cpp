@@ -655,6 +655,25 @@ DLL_EXPORT CHIP_ERROR ConvertChipCertToX509Cert(const ByteSpan chipCert, Mutable
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CalculateX509CertLength(const ByteSpan chipCert, size_t & x509CertLen)
+{
+    TLVReader reader;
+    ASN1Writer writer;
+    ChipCertificateData certData;
+
+    reader.Init(chipCert);
+
+    writer.InitCountingWriter();
+
+    certData.Clear();
+
+    ReturnErrorOnFailure(DecodeConvertCert(reader, writer, writer, certData));
+
+    x509CertLen = writer.GetLengthWritten();
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR DecodeChipCert(const ByteSpan chipCert, ChipCertificateData & certData, BitFlags<CertDecodeFlags> decodeFlags)
 {
     TLVReader reader;
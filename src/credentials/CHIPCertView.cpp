@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a lightweight, read-only view of a CHIP certificate
+ *      in its TLV encoding.
+ *
+ */
+
+#include <credentials/CHIPCertView.h>
+
+#include <credentials/CHIPCert_Internal.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Credentials {
+
+using namespace chip::ASN1;
+using namespace chip::TLV;
+
+CHIP_ERROR ChipCertificateView::Init(const ByteSpan & chipCert)
+{
+    TLVReader reader;
+    TLVType containerType;
+    uint8_t algoId;
+
+    mCert = ByteSpan();
+
+    reader.Init(chipCert);
+    ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    // Only the top-level elements are read here: the DNs and the extensions are skipped over, and
+    // decoded by the accessors. The checks are those of DecodeChipCert() on the same elements.
+    ReturnErrorOnFailure(reader.Next());
+    mIsCompactNetworkIdentity = (reader.GetTag() == ContextTag(kTag_EllipticCurvePublicKey));
+    if (mIsCompactNetworkIdentity)
+    {
+        ReturnErrorOnFailure(reader.Expect(kTLVType_ByteString, ContextTag(kTag_EllipticCurvePublicKey)));
+        ReturnErrorOnFailure(reader.Get(mPublicKey));
+
+        mNotBeforeTime = kNetworkIdentityNotBeforeTime;
+        mNotAfterTime  = kNetworkIdentityNotAfterTime;
+    }
+    else
+    {
+        ReturnErrorOnFailure(reader.Expect(kTLVType_ByteString, ContextTag(kTag_SerialNumber)));
+        ReturnErrorOnFailure(reader.Next(ContextTag(kTag_SignatureAlgorithm)));
+        ReturnErrorOnFailure(reader.Get(algoId));
+
+        ReturnErrorOnFailure(reader.Next(kTLVType_List, ContextTag(kTag_Issuer)));
+        mIssuerReader.Init(reader);
+
+        ReturnErrorOnFailure(reader.Next(ContextTag(kTag_NotBefore)));
+        ReturnErrorOnFailure(reader.Get(mNotBeforeTime));
+        ReturnErrorOnFailure(reader.Next(ContextTag(kTag_NotAfter)));
+        ReturnErrorOnFailure(reader.Get(mNotAfterTime));
+        if (mNotAfterTime != kNullCertTime)
+        {
+            VerifyOrReturnError(mNotBeforeTime < mNotAfterTime, CHIP_ERROR_UNSUPPORTED_CERT_FORMAT);
+        }
+
+        ReturnErrorOnFailure(reader.Next(kTLVType_List, ContextTag(kTag_Subject)));
+        mSubjectReader.Init(reader);
+
+        ReturnErrorOnFailure(reader.Next(ContextTag(kTag_PublicKeyAlgorithm)));
+        ReturnErrorOnFailure(reader.Get(algoId));
+        VerifyOrReturnError(GetOID(kOIDCategory_PubKeyAlgo, algoId) == kOID_PubKeyAlgo_ECPublicKey,
+                            CHIP_ERROR_UNSUPPORTED_CERT_FORMAT);
+
+        ReturnErrorOnFailure(reader.Next(ContextTag(kTag_EllipticCurveIdentifier)));
+        ReturnErrorOnFailure(reader.Get(algoId));
+        VerifyOrReturnError(GetOID(kOIDCategory_EllipticCurve, algoId) == kOID_EllipticCurve_prime256v1,
+                            CHIP_ERROR_UNSUPPORTED_ELLIPTIC_CURVE);
+
+        ReturnErrorOnFailure(reader.Next(kTLVType_ByteString, ContextTag(kTag_EllipticCurvePublicKey)));
+        ReturnErrorOnFailure(reader.Get(mPublicKey));
+
+        ReturnErrorOnFailure(reader.Next(kTLVType_List, ContextTag(kTag_Extensions)));
+        mExtensionsReader.Init(reader);
+    }
+
+    ReturnErrorOnFailure(reader.Next(kTLVType_ByteString, ContextTag(kTag_ECDSASignature)));
+    ReturnErrorOnFailure(reader.Get(mSignature));
+
+    // Verify no more elements in certificate.
+    ReturnErrorOnFailure(reader.VerifyEndOfContainer());
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    mCert = chipCert;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipCertificateView::GetDN(const TLVReader & dnReader, ChipDN & dn) const
+{
+    VerifyOrReturnError(!mCert.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    dn.Clear();
+    if (mIsCompactNetworkIdentity)
+    {
+        InitNetworkIdentitySubject(dn);
+        return CHIP_NO_ERROR;
+    }
+
+    TLVReader reader;
+    reader.Init(dnReader);
+    return dn.DecodeFromTLV(reader);
+}
+
+CHIP_ERROR ChipCertificateView::GetSubjectDN(ChipDN & dn) const
+{
+    return GetDN(mSubjectReader, dn);
+}
+
+CHIP_ERROR ChipCertificateView::GetIssuerDN(ChipDN & dn) const
+{
+    return GetDN(mIssuerReader, dn);
+}
+
+CHIP_ERROR ChipCertificateView::GetNodeIdFabricId(NodeId & nodeId, FabricId & fabricId) const
+{
+    ChipDN subjectDN;
+    ReturnErrorOnFailure(GetSubjectDN(subjectDN));
+    return ExtractNodeIdFabricIdFromSubjectDN(subjectDN, nodeId, fabricId);
+}
+
+CHIP_ERROR ChipCertificateView::GetFabricId(FabricId & fabricId) const
+{
+    ChipDN subjectDN;
+    ReturnErrorOnFailure(GetSubjectDN(subjectDN));
+    return ExtractFabricIdFromSubjectDN(subjectDN, fabricId);
+}
+
+CHIP_ERROR ChipCertificateView::GetCATs(CATValues & cats) const
+{
+    ChipDN subjectDN;
+    ReturnErrorOnFailure(GetSubjectDN(subjectDN));
+    return ExtractCATsFromSubjectDN(subjectDN, cats);
+}
+
+CHIP_ERROR ChipCertificateView::GetKeyIdExtension(uint8_t extensionTag, CertificateKeyId & keyId) const
+{
+    CHIP_ERROR err;
+    TLVReader reader;
+    TLVType outerContainer;
+
+    VerifyOrReturnError(!mCert.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mIsCompactNetworkIdentity, CHIP_ERROR_NOT_FOUND);
+
+    reader.Init(mExtensionsReader);
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainer));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == ContextTag(extensionTag))
+        {
+            ReturnErrorOnFailure(reader.Expect(kTLVType_ByteString, ContextTag(extensionTag)));
+            return reader.Get(keyId);
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+CHIP_ERROR ChipCertificateView::GetSubjectKeyId(CertificateKeyId & skid) const
+{
+    return GetKeyIdExtension(kTag_SubjectKeyIdentifier, skid);
+}
+
+CHIP_ERROR ChipCertificateView::GetAuthorityKeyId(CertificateKeyId & akid) const
+{
+    return GetKeyIdExtension(kTag_AuthorityKeyIdentifier, akid);
+}
+
+CHIP_ERROR ChipCertificateView::VerifySignature(const P256PublicKeySpan & signerPublicKey) const
+{
+    VerifyOrReturnError(!mCert.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    // The TBS hash is computed over the X.509 form of the certificate, which requires a full decoding.
+    ChipCertificateData certData;
+    ReturnErrorOnFailure(DecodeChipCert(mCert, certData, CertDecodeFlags::kGenerateTBSHash));
+    return VerifyCertSignature(certData, signerPublicKey);
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a lightweight, read-only view of a CHIP certificate
+ *      in its TLV encoding.
+ *
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ *  @class ChipCertificateView
+ *
+ *  @brief
+ *    A read-only view of a CHIP TLV certificate, for callers which only need a few of its fields.
+ *
+ *    Unlike DecodeChipCert(), which decodes every field of the certificate into a ChipCertificateData
+ *    and converts it to X.509 on the way, Init() only walks the top-level elements of the certificate.
+ *    The distinguished names and the extensions are decoded on demand by the accessors, and the TBS
+ *    hash is only computed by VerifySignature().
+ *
+ *    Nothing is copied: the certificate buffer must remain valid while the view, and the spans returned
+ *    by it, are used. Init() does not validate the distinguished names and the extensions, so a
+ *    certificate which has not been validated must still be decoded with DecodeChipCert() or loaded
+ *    into a ChipCertificateSet before it is trusted.
+ */
+class ChipCertificateView
+{
+public:
+    /**
+     * @brief Initialize the view over a CHIP certificate, in full or compact-pdc-identity TLV form.
+     *
+     * @param chipCert  Buffer containing the CHIP certificate.
+     *
+     * @return Returns a CHIP_ERROR if the top-level structure of the certificate is invalid, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(const ByteSpan & chipCert);
+
+    /**
+     * @brief Whether the certificate is a Network (Client) Identity in compact-pdc-identity format,
+     *        whose fields other than the public key have the values mandated by the specification.
+     **/
+    bool IsCompactNetworkIdentity() const { return mIsCompactNetworkIdentity; }
+
+    ByteSpan GetCertificate() const { return mCert; }
+    uint32_t GetNotBeforeTime() const { return mNotBeforeTime; }
+    uint32_t GetNotAfterTime() const { return mNotAfterTime; }
+    const P256PublicKeySpan & GetPublicKey() const { return mPublicKey; }
+    const P256ECDSASignatureSpan & GetSignature() const { return mSignature; }
+
+    /**
+     * @brief Decode the subject DN of the certificate.
+     **/
+    CHIP_ERROR GetSubjectDN(ChipDN & dn) const;
+
+    /**
+     * @brief Decode the issuer DN of the certificate.
+     **/
+    CHIP_ERROR GetIssuerDN(ChipDN & dn) const;
+
+    /**
+     * @brief Retrieve the Node ID and the Fabric ID from the subject DN of an operational certificate.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if the subject DN lacks either of them.
+     **/
+    CHIP_ERROR GetNodeIdFabricId(NodeId & nodeId, FabricId & fabricId) const;
+
+    /**
+     * @brief Retrieve the Fabric ID from the subject DN of a NOC, ICAC or RCAC.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if the subject DN has no Fabric ID.
+     **/
+    CHIP_ERROR GetFabricId(FabricId & fabricId) const;
+
+    /**
+     * @brief Retrieve the CASE Authenticated Tags from the subject DN of a NOC.
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if the certificate is not a NOC.
+     **/
+    CHIP_ERROR GetCATs(CATValues & cats) const;
+
+    /**
+     * @brief Retrieve the Subject Key Identifier extension of the certificate.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if the certificate has no such extension.
+     **/
+    CHIP_ERROR GetSubjectKeyId(CertificateKeyId & skid) const;
+
+    /**
+     * @brief Retrieve the Authority Key Identifier extension of the certificate.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if the certificate has no such extension.
+     **/
+    CHIP_ERROR GetAuthorityKeyId(CertificateKeyId & akid) const;
+
+    /**
+     * @brief Verify the signature of the certificate.
+     *
+     * This is the only operation which fully decodes the certificate, in order to compute its TBS hash.
+     * As with VerifyCertSignature(), no other validation is performed.
+     *
+     * @param signerPublicKey  The public key of the certificate which signed this one.
+     **/
+    CHIP_ERROR VerifySignature(const P256PublicKeySpan & signerPublicKey) const;
+
+private:
+    CHIP_ERROR GetDN(const TLV::TLVReader & dnReader, ChipDN & dn) const;
+    CHIP_ERROR GetKeyIdExtension(uint8_t extensionTag, CertificateKeyId & keyId) const;
+
+    ByteSpan mCert;
+    TLV::TLVReader mIssuerReader;     /**< Positioned on the issuer DN, unless a compact-pdc-identity. */
+    TLV::TLVReader mSubjectReader;    /**< Positioned on the subject DN, unless a compact-pdc-identity. */
+    TLV::TLVReader mExtensionsReader; /**< Positioned on the extensions, unless a compact-pdc-identity. */
+    uint32_t mNotBeforeTime = 0;
+    uint32_t mNotAfterTime  = 0;
+    P256PublicKeySpan mPublicKey;
+    P256ECDSASignatureSpan mSignature;
+    bool mIsCompactNetworkIdentity = false;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -42,6 +42,12 @@ inline constexpr auto kNetworkIdentityKeyUsage = BitFlags<KeyUsageFlags>(KeyUsag
 inline constexpr auto kNetworkIdentityKeyPurpose =
     BitFlags<KeyPurposeFlags>(KeyPurposeFlags::kClientAuth, KeyPurposeFlags::kServerAuth);
 
+// Extract the Node ID and Fabric ID, the Fabric ID or the CATs from the subject DN of a certificate,
+// as in the corresponding Extract*FromOpCert / ExtractFabricIdFromCert functions.
+CHIP_ERROR ExtractNodeIdFabricIdFromSubjectDN(const ChipDN & subjectDN, NodeId & nodeId, FabricId & fabricId);
+CHIP_ERROR ExtractFabricIdFromSubjectDN(const ChipDN & subjectDN, FabricId & fabricId);
+CHIP_ERROR ExtractCATsFromSubjectDN(const ChipDN & subjectDN, CATValues & cats);
+
 // Initializes a ChipDN as CN=kNetworkIdentityCN
 void InitNetworkIdentitySubject(ChipDN & name);
 
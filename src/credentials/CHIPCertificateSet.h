@@ -102,6 +102,19 @@ struct ValidationContext
     }
 };
 
+/**
+ * @brief Evaluate a certificate validity period against an effective time.
+ *
+ * This is the evaluation done by ChipCertificateSet::ValidateCert() for each certificate of a chain, before the
+ * certificate validity policy is applied to its result.
+ *
+ * @param notBeforeTime  Certificate NotBefore time, in CHIP epoch seconds.
+ * @param notAfterTime   Certificate NotAfter time, in CHIP epoch seconds, or kNullCertTime for no expiration.
+ * @param effectiveTime  Current or last known good CHIP epoch time.
+ */
+CertificateValidityResult EvaluateCertificateValidity(uint32_t notBeforeTime, uint32_t notAfterTime,
+                                                      const EffectiveTime & effectiveTime);
+
 /**
  *  @class ChipCertificateSet
  *
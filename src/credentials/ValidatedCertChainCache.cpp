@@ -0,0 +1,253 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ValidatedCertChainCache.h"
+
+#include <credentials/CHIPCertView.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <platform/LockTracker.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+CHIP_ERROR ValidatedCertChainCache::Init(FabricTable * fabricTable, size_t capacity)
+{
+    VerifyOrReturnError(fabricTable != nullptr && capacity > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mFabricTable == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mEntries.Calloc(capacity);
+    VerifyOrReturnError(mEntries, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR err = fabricTable->AddFabricDelegate(this);
+    if (err != CHIP_NO_ERROR)
+    {
+        mEntries.Free();
+        return err;
+    }
+    mFabricTable = fabricTable;
+    return CHIP_NO_ERROR;
+}
+
+void ValidatedCertChainCache::Shutdown()
+{
+    if (mFabricTable != nullptr)
+    {
+        mFabricTable->RemoveFabricDelegate(this);
+        mFabricTable = nullptr;
+    }
+    Clear();
+    mEntries.Free();
+}
+
+CHIP_ERROR ValidatedCertChainCache::Find(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
+                                         const ByteSpan & rcac, const ValidationContext & context, ValidatedCertChain & outChain)
+{
+    assertChipStackLockedByCurrentThread();
+
+    ChainKey key;
+    ReturnErrorOnFailure(ComputeChainKey(noc, icac, rcac, key));
+
+    Entry * entry = FindEntry(fabricIndex, key);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NOT_FOUND);
+
+    // A chain validated for other uses would have been checked against other requirements.
+    VerifyOrReturnError(entry->requiredKeyUsages == context.mRequiredKeyUsages &&
+                            entry->requiredKeyPurposes == context.mRequiredKeyPurposes &&
+                            entry->requiredCertType == context.mRequiredCertType,
+                        CHIP_ERROR_NOT_FOUND);
+
+    // Leave rejected chains to a full validation, which reports why they are rejected.
+    const ByteSpan certs[kMaxCertsInChain] = { noc, icac.empty() ? rcac : icac, rcac };
+    if (CheckValidity(*entry, certs, context) != CHIP_NO_ERROR)
+    {
+        *entry = Entry();
+        return CHIP_ERROR_NOT_FOUND;
+    }
+
+    outChain.fabricId     = entry->fabricId;
+    outChain.nodeId       = entry->nodeId;
+    outChain.nocPublicKey = Crypto::P256PublicKey(entry->nocPublicKey);
+    outChain.cats         = entry->cats;
+    entry->lastUsed       = ++mUseCounter;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ValidatedCertChainCache::Insert(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
+                                           const ByteSpan & rcac, const ValidationContext & context,
+                                           const ValidatedCertChain & chain)
+{
+    assertChipStackLockedByCurrentThread();
+    VerifyOrReturnError(mEntries, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(fabricIndex != kUndefinedFabricIndex, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ChainKey key;
+    ReturnErrorOnFailure(ComputeChainKey(noc, icac, rcac, key));
+
+    Entry newEntry;
+    newEntry.fabricIndex = fabricIndex;
+    memcpy(newEntry.key, key, sizeof(key));
+
+    // Only the validity periods are needed from the certificates, which were just validated: a view is enough.
+    const ByteSpan certs[kMaxCertsInChain] = { noc, icac, rcac };
+    newEntry.certCount                     = 0;
+    for (const ByteSpan & cert : certs)
+    {
+        if (cert.empty())
+        {
+            continue;
+        }
+        ChipCertificateView certView;
+        ReturnErrorOnFailure(certView.Init(cert));
+        newEntry.notBeforeTime[newEntry.certCount] = certView.GetNotBeforeTime();
+        newEntry.notAfterTime[newEntry.certCount]  = certView.GetNotAfterTime();
+        newEntry.certCount++;
+    }
+
+    newEntry.requiredKeyUsages   = context.mRequiredKeyUsages;
+    newEntry.requiredKeyPurposes = context.mRequiredKeyPurposes;
+    newEntry.requiredCertType    = context.mRequiredCertType;
+
+    newEntry.fabricId = chain.fabricId;
+    newEntry.nodeId   = chain.nodeId;
+    memcpy(newEntry.nocPublicKey, chain.nocPublicKey.ConstBytes(), sizeof(newEntry.nocPublicKey));
+    newEntry.cats     = chain.cats;
+    newEntry.lastUsed = ++mUseCounter;
+
+    // Replace the same chain if it is already cached, else use a free entry or the least recently used one.
+    Entry * entry = FindEntry(fabricIndex, key);
+    for (size_t i = 0; entry == nullptr && i < mEntries.AllocatedSize(); i++)
+    {
+        if (mEntries[i].fabricIndex == kUndefinedFabricIndex)
+        {
+            entry = &mEntries[i];
+        }
+    }
+    if (entry == nullptr)
+    {
+        entry = &mEntries[0];
+        for (size_t i = 1; i < mEntries.AllocatedSize(); i++)
+        {
+            if (mEntries[i].lastUsed < entry->lastUsed)
+            {
+                entry = &mEntries[i];
+            }
+        }
+    }
+
+    *entry = newEntry;
+    return CHIP_NO_ERROR;
+}
+
+void ValidatedCertChainCache::InvalidateFabric(FabricIndex fabricIndex)
+{
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        if (mEntries[i].fabricIndex == fabricIndex)
+        {
+            mEntries[i] = Entry();
+        }
+    }
+}
+
+void ValidatedCertChainCache::Clear()
+{
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        mEntries[i] = Entry();
+    }
+    mUseCounter = 0;
+}
+
+size_t ValidatedCertChainCache::Count() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        if (mEntries[i].fabricIndex != kUndefinedFabricIndex)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+CHIP_ERROR ValidatedCertChainCache::ComputeChainKey(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                                    ChainKey & outKey)
+{
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+
+    // Prefix each certificate with its length, so that the boundaries between certificates are part of the key.
+    for (const ByteSpan & cert : { noc, icac, rcac })
+    {
+        uint8_t length[sizeof(uint16_t)];
+        VerifyOrReturnError(CanCastTo<uint16_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(cert.size()));
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+        ReturnErrorOnFailure(hash.AddData(cert));
+    }
+
+    MutableByteSpan keySpan(outKey);
+    return hash.Finish(keySpan);
+}
+
+CHIP_ERROR ValidatedCertChainCache::CheckValidity(const Entry & entry, const ByteSpan (&certs)[kMaxCertsInChain],
+                                                  const ValidationContext & context)
+{
+    // Same evaluation as ChipCertificateSet::ValidateCert, for each certificate from the NOC to the RCAC.
+    for (uint8_t depth = 0; depth < entry.certCount; depth++)
+    {
+        CertificateValidityResult result =
+            EvaluateCertificateValidity(entry.notBeforeTime[depth], entry.notAfterTime[depth], context.mEffectiveTime);
+
+        if (context.mValidityPolicy != nullptr)
+        {
+            // Application policies may look at the certificate itself.
+            ChipCertificateData certData;
+            ReturnErrorOnFailure(DecodeChipCert(certs[depth], certData));
+            ReturnErrorOnFailure(context.mValidityPolicy->ApplyCertificateValidityPolicy(&certData, depth, result));
+        }
+        else
+        {
+            // The default policy only depends on the result.
+            ReturnErrorOnFailure(CertificateValidityPolicy::ApplyDefaultPolicy(nullptr, depth, result));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+ValidatedCertChainCache::Entry * ValidatedCertChainCache::FindEntry(FabricIndex fabricIndex, const ChainKey & key)
+{
+    VerifyOrReturnValue(fabricIndex != kUndefinedFabricIndex, nullptr);
+
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        if (mEntries[i].fabricIndex == fabricIndex && memcmp(mEntries[i].key, key, sizeof(key)) == 0)
+        {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <credentials/FabricTable.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CASEAuthTag.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ScopedBuffer.h>
+
+namespace chip {
+namespace Credentials {
+
+/// Results of the validation of a peer operational certificate chain.
+struct ValidatedCertChain
+{
+    FabricId fabricId = kUndefinedFabricId;
+    NodeId nodeId     = kUndefinedNodeId;
+    Crypto::P256PublicKey nocPublicKey;
+    CATValues cats;
+};
+
+/**
+ * Bounded cache of the peer certificate chains (NOC, optional ICAC, and the RCAC of the local fabric) that passed
+ * FabricTable::VerifyCredentials, so that a peer re-establishing CASE with the same chain does not cost a new decoding
+ * and ECDSA validation of the chain.
+ *
+ * Entries are keyed by fabric index and a SHA-256 hash of the three certificates, and hold the results of the validation
+ * along with the validity period of each certificate. A hit is only returned if the entry was validated with the same
+ * key usage, key purpose and certificate type requirements as the given context, and if the validity periods are still
+ * accepted at the effective time of that context, by its validity policy or the default policy. Entries of a fabric are
+ * dropped when its credentials are updated, committed or removed. Least recently used entries are evicted once the cache
+ * is full.
+ *
+ * All methods must be called from the Matter thread.
+ */
+class ValidatedCertChainCache : public FabricTable::Delegate
+{
+public:
+    ValidatedCertChainCache() = default;
+    ~ValidatedCertChainCache() override { Shutdown(); }
+
+    ValidatedCertChainCache(const ValidatedCertChainCache &)             = delete;
+    ValidatedCertChainCache & operator=(const ValidatedCertChainCache &) = delete;
+
+    /**
+     * Allocate the cache and register it as a delegate of the fabric table.
+     *
+     * @param fabricTable Fabric table whose changes invalidate entries.
+     * @param capacity    Maximum number of cached chains.
+     */
+    CHIP_ERROR Init(FabricTable * fabricTable, size_t capacity);
+
+    /// Drop all the entries, and unregister from the fabric table.
+    void Shutdown();
+
+    /**
+     * Look up a previously validated chain.
+     *
+     * @param fabricIndex Fabric of the local node the chain was received on.
+     * @param noc         Peer NOC.
+     * @param icac        Peer ICAC, empty if none.
+     * @param rcac        RCAC of the fabric.
+     * @param context     Validation context, with the effective time set.
+     * @param outChain    Results of the validation, on success.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if the chain is not in the cache, or is in the cache but must be validated again.
+     */
+    CHIP_ERROR Find(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                    const ValidationContext & context, ValidatedCertChain & outChain);
+
+    /**
+     * Add a chain that was validated by FabricTable::VerifyCredentials with the given context.
+     */
+    CHIP_ERROR Insert(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                      const ValidationContext & context, const ValidatedCertChain & chain);
+
+    /// Drop the entries of a fabric.
+    void InvalidateFabric(FabricIndex fabricIndex);
+
+    /// Drop all the entries.
+    void Clear();
+
+    /// Number of cached chains.
+    size_t Count() const;
+
+    size_t Capacity() const { return mEntries.AllocatedSize(); }
+
+    // FabricTable::Delegate
+    void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+    void OnFabricCommitted(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+    void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+
+private:
+    // NOC, ICAC and RCAC.
+    static constexpr uint8_t kMaxCertsInChain = 3;
+
+    using ChainKey = uint8_t[Crypto::kSHA256_Hash_Length];
+
+    struct Entry
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        ChainKey key;
+
+        // Validity periods, from the NOC (depth 0) to the RCAC.
+        uint8_t certCount;
+        uint32_t notBeforeTime[kMaxCertsInChain];
+        uint32_t notAfterTime[kMaxCertsInChain];
+
+        // Requirements of the context the chain was validated with.
+        BitFlags<KeyUsageFlags> requiredKeyUsages;
+        BitFlags<KeyPurposeFlags> requiredKeyPurposes;
+        CertType requiredCertType;
+
+        FabricId fabricId;
+        NodeId nodeId;
+        uint8_t nocPublicKey[Crypto::kP256_PublicKey_Length];
+        CATValues cats;
+
+        uint32_t lastUsed;
+    };
+
+    static CHIP_ERROR ComputeChainKey(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac, ChainKey & outKey);
+    static CHIP_ERROR CheckValidity(const Entry & entry, const ByteSpan (&certs)[kMaxCertsInChain],
+                                    const ValidationContext & context);
+
+    Entry * FindEntry(FabricIndex fabricIndex, const ChainKey & key);
+
+    FabricTable * mFabricTable = nullptr;
+    Platform::ScopedMemoryBufferWithSize<Entry> mEntries;
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -65,6 +65,43 @@ void ChipCertFuzzer(const std::vector<std::uint8_t> & bytes)
 
 FUZZ_TEST(FuzzChipCert, ChipCertFuzzer).WithDomains(Arbitrary<std::vector<std::uint8_t>>());
 
+// The length predicted for the conversion of a certificate, in either direction, is the length of its conversion.
+void CertConversionLengthFuzzer(const std::vector<std::uint8_t> & bytes)
+{
+    ByteSpan span(bytes.data(), bytes.size());
+    size_t length;
+
+    if (CalculateX509CertLength(span, length) == CHIP_NO_ERROR)
+    {
+        std::vector<uint8_t> outCertBuf(length);
+        MutableByteSpan outCert(outCertBuf.data(), outCertBuf.size());
+        ASSERT_EQ(ConvertChipCertToX509Cert(span, outCert), CHIP_NO_ERROR);
+        ASSERT_EQ(outCert.size(), length);
+    }
+    else
+    {
+        uint8_t outCertBuf[kMaxDERCertLength];
+        MutableByteSpan outCert(outCertBuf);
+        ASSERT_NE(ConvertChipCertToX509Cert(span, outCert), CHIP_NO_ERROR);
+    }
+
+    if (CalculateChipCertLength(span, length) == CHIP_NO_ERROR)
+    {
+        std::vector<uint8_t> outCertBuf(length);
+        MutableByteSpan outCert(outCertBuf.data(), outCertBuf.size());
+        ASSERT_EQ(ConvertX509CertToChipCert(span, outCert), CHIP_NO_ERROR);
+        ASSERT_EQ(outCert.size(), length);
+    }
+    else
+    {
+        uint8_t outCertBuf[kMaxCHIPCertLength];
+        MutableByteSpan outCert(outCertBuf);
+        ASSERT_NE(ConvertX509CertToChipCert(span, outCert), CHIP_NO_ERROR);
+    }
+}
+
+FUZZ_TEST(FuzzChipCert, CertConversionLengthFuzzer).WithDomains(Arbitrary<std::vector<std::uint8_t>>());
+
 // The Property function for DecodeChipCertFuzzer, The FUZZ_TEST Macro will call this function.
 void DecodeChipCertFuzzer(const std::vector<std::uint8_t> & bytes, BitFlags<CertDecodeFlags> aDecodeFlag)
 {
@@ -40,6 +40,8 @@
 #include "CHIPCert_error_test_vectors.h"
 #include "CHIPCert_test_vectors.h"
 
+#include <vector>
+
 using namespace chip;
 using namespace chip::ASN1;
 using namespace chip::TLV;
@@ -301,6 +303,105 @@ TEST_F(TestChipCert, TestChipCert_X509ToChip_ErrorCases)
     }
 }
 
+// Check that the length predicted for the conversion of a certificate is the length of its conversion, and that
+// the prediction fails whenever the conversion does, unless the conversion only fails for lack of space.
+static void CheckChipToX509Length(const ByteSpan & chipCert)
+{
+    uint8_t outCertBuf[kMaxDERCertLength];
+    MutableByteSpan outCert(outCertBuf);
+    size_t x509CertLen = 0;
+
+    CHIP_ERROR err = ConvertChipCertToX509Cert(chipCert, outCert);
+    if (err == ASN1_ERROR_OVERFLOW)
+    {
+        EXPECT_EQ(CalculateX509CertLength(chipCert, x509CertLen), CHIP_NO_ERROR);
+        EXPECT_GT(x509CertLen, sizeof(outCertBuf));
+        return;
+    }
+    EXPECT_EQ(CalculateX509CertLength(chipCert, x509CertLen), err);
+    if (err == CHIP_NO_ERROR)
+    {
+        EXPECT_EQ(x509CertLen, outCert.size());
+
+        MutableByteSpan exactCert(outCertBuf, x509CertLen);
+        EXPECT_EQ(ConvertChipCertToX509Cert(chipCert, exactCert), CHIP_NO_ERROR);
+        MutableByteSpan shortCert(outCertBuf, x509CertLen - 1);
+        EXPECT_NE(ConvertChipCertToX509Cert(chipCert, shortCert), CHIP_NO_ERROR);
+    }
+}
+
+static void CheckX509ToChipLength(const ByteSpan & x509Cert)
+{
+    uint8_t outCertBuf[kMaxCHIPCertLength];
+    MutableByteSpan outCert(outCertBuf);
+    size_t chipCertLen = 0;
+
+    CHIP_ERROR err = ConvertX509CertToChipCert(x509Cert, outCert);
+    if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        EXPECT_EQ(CalculateChipCertLength(x509Cert, chipCertLen), CHIP_NO_ERROR);
+        EXPECT_GT(chipCertLen, sizeof(outCertBuf));
+        return;
+    }
+    EXPECT_EQ(CalculateChipCertLength(x509Cert, chipCertLen), err);
+    if (err == CHIP_NO_ERROR)
+    {
+        EXPECT_EQ(chipCertLen, outCert.size());
+
+        MutableByteSpan exactCert(outCertBuf, chipCertLen);
+        EXPECT_EQ(ConvertX509CertToChipCert(x509Cert, exactCert), CHIP_NO_ERROR);
+        MutableByteSpan shortCert(outCertBuf, chipCertLen - 1);
+        EXPECT_NE(ConvertX509CertToChipCert(x509Cert, shortCert), CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestChipCert, TestChipCert_ConversionLength)
+{
+    // Both forms of every certificate are checked in both directions, as either form is an error case of the other direction.
+    std::vector<ByteSpan> certs = { sTestCert_PDCID01_ChipCompact };
+
+    for (size_t i = 0; i < gNumTestCerts; i++)
+    {
+        ByteSpan cert;
+        ASSERT_EQ(GetTestCert(gTestCerts[i], sNullLoadFlag, cert), CHIP_NO_ERROR);
+        certs.push_back(cert);
+        ASSERT_EQ(GetTestCert(gTestCerts[i], sDerFormFlag, cert), CHIP_NO_ERROR);
+        certs.push_back(cert);
+    }
+
+    // Every truncation, and a few corruptions of every byte, of the valid certificates.
+    const uint8_t kMasks[] = { 0x01, 0x80, 0xFF };
+    for (const ByteSpan & cert : certs)
+    {
+        std::vector<uint8_t> mutatedCert(cert.begin(), cert.end());
+        ByteSpan mutatedCertSpan(mutatedCert.data(), mutatedCert.size());
+
+        for (size_t i = 0; i < cert.size(); i++)
+        {
+            for (uint8_t mask : kMasks)
+            {
+                mutatedCert[i] ^= mask;
+                CheckChipToX509Length(mutatedCertSpan);
+                CheckX509ToChipLength(mutatedCertSpan);
+                mutatedCert[i] ^= mask;
+            }
+            CheckChipToX509Length(cert.SubSpan(0, i));
+            CheckX509ToChipLength(cert.SubSpan(0, i));
+        }
+        CheckChipToX509Length(cert);
+        CheckX509ToChipLength(cert);
+    }
+
+    for (auto chipCert : gTestCert_ChipToX509_ErrorCases)
+    {
+        CheckChipToX509Length(chipCert);
+    }
+    for (auto derCert : gTestCert_X509ToChip_ErrorCases)
+    {
+        CheckX509ToChipLength(derCert);
+    }
+}
+
 TEST_F(TestChipCert, TestChipCert_ChipDN)
 {
     const static char noc_rdn[]     = "Test NOC";
@@ -0,0 +1,178 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for ChipCertificateView, against the
+ *      full decoding of the same certificates with DecodeChipCert().
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertView.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <lib/support/CHIPMem.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+struct TestChipCertView : public ::testing::Test
+{
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+#if CHIP_CRYPTO_PSA
+        ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+#endif
+    }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+void CheckKeyId(CHIP_ERROR err, const CertificateKeyId & keyId, bool expectedPresent, const CertificateKeyId & expectedKeyId)
+{
+    if (expectedPresent)
+    {
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_TRUE(keyId.data_equal(expectedKeyId));
+    }
+    else
+    {
+        EXPECT_EQ(err, CHIP_ERROR_NOT_FOUND);
+    }
+}
+
+void CheckViewMatchesDecodedCert(const ByteSpan & cert)
+{
+    ChipCertificateData certData;
+    ASSERT_EQ(DecodeChipCert(cert, certData), CHIP_NO_ERROR);
+
+    ChipCertificateView certView;
+    ASSERT_EQ(certView.Init(cert), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(certView.GetCertificate().data_equal(cert));
+    EXPECT_EQ(certView.GetNotBeforeTime(), certData.mNotBeforeTime);
+    EXPECT_EQ(certView.GetNotAfterTime(), certData.mNotAfterTime);
+    EXPECT_TRUE(certView.GetPublicKey().data_equal(certData.mPublicKey));
+    EXPECT_TRUE(certView.GetSignature().data_equal(certData.mSignature));
+
+    ChipDN dn;
+    EXPECT_EQ(certView.GetSubjectDN(dn), CHIP_NO_ERROR);
+    EXPECT_TRUE(dn.IsEqual(certData.mSubjectDN));
+    EXPECT_EQ(certView.GetIssuerDN(dn), CHIP_NO_ERROR);
+    EXPECT_TRUE(dn.IsEqual(certData.mIssuerDN));
+
+    CertificateKeyId keyId;
+    CheckKeyId(certView.GetSubjectKeyId(keyId), keyId, certData.mCertFlags.Has(CertFlags::kExtPresent_SubjectKeyId),
+               certData.mSubjectKeyId);
+    CheckKeyId(certView.GetAuthorityKeyId(keyId), keyId, certData.mCertFlags.Has(CertFlags::kExtPresent_AuthKeyId),
+               certData.mAuthKeyId);
+
+    NodeId nodeId = 0, expectedNodeId = 0;
+    FabricId fabricId = 0, expectedFabricId = 0;
+    CHIP_ERROR expectedErr = ExtractNodeIdFabricIdFromOpCert(certData, &expectedNodeId, &expectedFabricId);
+    EXPECT_EQ(certView.GetNodeIdFabricId(nodeId, fabricId), expectedErr);
+    EXPECT_EQ(nodeId, expectedNodeId);
+    EXPECT_EQ(fabricId, expectedFabricId);
+
+    expectedErr = ExtractFabricIdFromCert(certData, &expectedFabricId);
+    EXPECT_EQ(certView.GetFabricId(fabricId), expectedErr);
+    EXPECT_EQ(fabricId, expectedFabricId);
+
+    CATValues cats, expectedCats;
+    expectedErr = ExtractCATsFromOpCert(certData, expectedCats);
+    EXPECT_EQ(certView.GetCATs(cats), expectedErr);
+    if (expectedErr == CHIP_NO_ERROR)
+    {
+        EXPECT_EQ(cats, expectedCats);
+    }
+}
+
+TEST_F(TestChipCertView, TestMatchesDecodedCert)
+{
+    for (size_t i = 0; i < gNumTestCerts; i++)
+    {
+        ByteSpan cert;
+        ASSERT_EQ(GetTestCert(gTestCerts[i], BitFlags<TestCertLoadFlags>(), cert), CHIP_NO_ERROR);
+        CheckViewMatchesDecodedCert(cert);
+    }
+
+    // The view of a compact-pdc-identity has the values mandated by the specification.
+    CheckViewMatchesDecodedCert(sTestCert_PDCID01_ChipCompact);
+
+    ChipCertificateView certView;
+    ASSERT_EQ(certView.Init(sTestCert_PDCID01_ChipCompact), CHIP_NO_ERROR);
+    EXPECT_TRUE(certView.IsCompactNetworkIdentity());
+    ASSERT_EQ(certView.Init(sTestCert_PDCID01_Chip), CHIP_NO_ERROR);
+    EXPECT_FALSE(certView.IsCompactNetworkIdentity());
+}
+
+TEST_F(TestChipCertView, TestVerifySignature)
+{
+    ChipCertificateView rootView, icaView, nodeView;
+    ASSERT_EQ(rootView.Init(sTestCert_Root01_Chip), CHIP_NO_ERROR);
+    ASSERT_EQ(icaView.Init(sTestCert_ICA01_Chip), CHIP_NO_ERROR);
+    ASSERT_EQ(nodeView.Init(sTestCert_Node01_01_Chip), CHIP_NO_ERROR);
+
+    EXPECT_EQ(rootView.VerifySignature(rootView.GetPublicKey()), CHIP_NO_ERROR);
+    EXPECT_EQ(icaView.VerifySignature(rootView.GetPublicKey()), CHIP_NO_ERROR);
+    EXPECT_EQ(nodeView.VerifySignature(icaView.GetPublicKey()), CHIP_NO_ERROR);
+
+    EXPECT_EQ(nodeView.VerifySignature(rootView.GetPublicKey()), CHIP_ERROR_INVALID_SIGNATURE);
+    EXPECT_EQ(icaView.VerifySignature(icaView.GetPublicKey()), CHIP_ERROR_INVALID_SIGNATURE);
+
+    // Network (Client) Identities are self-signed, in both forms.
+    for (auto && cert : { sTestCert_PDCID01_Chip, sTestCert_PDCID01_ChipCompact })
+    {
+        ChipCertificateView pdcView;
+        ASSERT_EQ(pdcView.Init(cert), CHIP_NO_ERROR);
+        EXPECT_EQ(pdcView.VerifySignature(pdcView.GetPublicKey()), CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestChipCertView, TestErrors)
+{
+    ChipCertificateView certView;
+    ChipDN dn;
+    CertificateKeyId keyId;
+
+    // Not initialized.
+    EXPECT_EQ(certView.GetSubjectDN(dn), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(certView.GetSubjectKeyId(keyId), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(certView.VerifySignature(P256PublicKeySpan(sTestCert_Root01_PublicKey.data())), CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_NE(certView.Init(ByteSpan()), CHIP_NO_ERROR);
+
+    // Every truncation of a certificate is rejected, and leaves the view uninitialized.
+    const ByteSpan cert = sTestCert_Node02_08_Chip;
+    for (size_t length = 1; length < cert.size(); length++)
+    {
+        EXPECT_NE(certView.Init(cert.SubSpan(0, length)), CHIP_NO_ERROR);
+        EXPECT_TRUE(certView.GetCertificate().empty());
+    }
+    EXPECT_EQ(certView.Init(cert), CHIP_NO_ERROR);
+}
+
+} // namespace
@@ -0,0 +1,248 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <credentials/FabricTable.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/ValidatedCertChainCache.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <platform/ConfigurationManager.h>
+
+#include <algorithm>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+struct TestValidatedCertChainCache : public ::testing::Test
+{
+    static void SetUpTestSuite()
+    {
+        DeviceLayer::SetConfigurationMgr(&DeviceLayer::ConfigurationManagerImpl::GetDefaultInstance());
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+#if CHIP_CRYPTO_PSA
+        ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+#endif
+    }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        FabricTable::InitParams initParams;
+        initParams.storage             = &mStorage;
+        initParams.operationalKeystore = &mOpKeyStore;
+        initParams.opCertStore         = &mOpCertStore;
+
+        ASSERT_EQ(mOpKeyStore.Init(&mStorage), CHIP_NO_ERROR);
+        ASSERT_EQ(mOpCertStore.Init(&mStorage), CHIP_NO_ERROR);
+        ASSERT_EQ(mFabricTable.Init(initParams), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mFabricTable.Shutdown();
+        mOpCertStore.Finish();
+        mOpKeyStore.Finish();
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    PersistentStorageOperationalKeystore mOpKeyStore;
+    PersistentStorageOpCertStore mOpCertStore;
+    FabricTable mFabricTable;
+};
+
+// Root01:ICA01:Node01_01 and Root01:Node01_02 chains.
+const ByteSpan kRcac      = TestCerts::sTestCert_Root01_Chip;
+const ByteSpan kIcac      = TestCerts::sTestCert_ICA01_Chip;
+const ByteSpan kNoc       = TestCerts::sTestCert_Node01_01_Chip;
+const ByteSpan kNocNoIcac = TestCerts::sTestCert_Node01_02_Chip;
+
+// A time within the validity periods of all the certificates of the chain.
+uint32_t ValidTime(std::initializer_list<ByteSpan> certs)
+{
+    uint32_t time = 0;
+    for (const ByteSpan & cert : certs)
+    {
+        ChipCertificateData certData;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        time = std::max(time, certData.mNotBeforeTime + 1);
+    }
+    return time;
+}
+
+uint32_t NotAfterTime(const ByteSpan & cert)
+{
+    ChipCertificateData certData;
+    VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+    return certData.mNotAfterTime;
+}
+
+ValidationContext MakeContext(uint32_t chipEpochTime)
+{
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(chipEpochTime));
+    return context;
+}
+
+// Validate the chain as CASESession does, to fill the cache with actual results.
+ValidatedCertChain Validate(const ByteSpan & noc, const ByteSpan & icac, ValidationContext & context)
+{
+    ValidatedCertChain chain;
+    CompressedFabricId unused;
+    VerifyOrDie(FabricTable::VerifyCredentials(noc, icac, kRcac, context, unused, chain.fabricId, chain.nodeId,
+                                               chain.nocPublicKey) == CHIP_NO_ERROR);
+    VerifyOrDie(ExtractCATsFromOpCert(noc, chain.cats) == CHIP_NO_ERROR);
+    return chain;
+}
+
+TEST_F(TestValidatedCertChainCache, FindsInsertedChain)
+{
+    ValidatedCertChainCache cache;
+    ASSERT_EQ(cache.Init(&mFabricTable, 4), CHIP_NO_ERROR);
+
+    ValidationContext context = MakeContext(ValidTime({ kRcac, kIcac, kNoc }));
+    ValidatedCertChain found;
+    EXPECT_EQ(cache.Find(1, kNoc, kIcac, kRcac, context, found), CHIP_ERROR_NOT_FOUND);
+
+    ValidatedCertChain validated = Validate(kNoc, kIcac, context);
+    EXPECT_EQ(cache.Insert(1, kNoc, kIcac, kRcac, context, validated), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+
+    ASSERT_EQ(cache.Find(1, kNoc, kIcac, kRcac, context, found), CHIP_NO_ERROR);
+    EXPECT_EQ(found.fabricId, TestCerts::kTestCert_Node01_01_FabricId);
+    EXPECT_EQ(found.nodeId, TestCerts::kTestCert_Node01_01_NodeId);
+    EXPECT_TRUE(found.nocPublicKey.Matches(validated.nocPublicKey));
+    EXPECT_EQ(found.cats, validated.cats);
+
+    // Another fabric, another chain or the same NOC presented without its ICAC do not match.
+    EXPECT_EQ(cache.Find(2, kNoc, kIcac, kRcac, context, found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(1, kNocNoIcac, ByteSpan(), kRcac, context, found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(1, kNoc, ByteSpan(), kRcac, context, found), CHIP_ERROR_NOT_FOUND);
+
+    // Re-inserting the same chain replaces its entry.
+    EXPECT_EQ(cache.Insert(1, kNoc, kIcac, kRcac, context, validated), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+}
+
+TEST_F(TestValidatedCertChainCache, RechecksContext)
+{
+    ValidatedCertChainCache cache;
+    ASSERT_EQ(cache.Init(&mFabricTable, 4), CHIP_NO_ERROR);
+
+    ValidationContext context = MakeContext(ValidTime({ kRcac, kNocNoIcac }));
+    ValidatedCertChain validated = Validate(kNocNoIcac, ByteSpan(), context);
+    EXPECT_EQ(cache.Insert(1, kNocNoIcac, ByteSpan(), kRcac, context, validated), CHIP_NO_ERROR);
+
+    // Requirements other than the ones the chain was validated against.
+    ValidatedCertChain found;
+    ValidationContext otherContext = context;
+    otherContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+    EXPECT_EQ(cache.Find(1, kNocNoIcac, ByteSpan(), kRcac, otherContext, found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Count(), 1u);
+
+    // Without a known current time, the default policy accepts the chain, as a full validation would.
+    ValidationContext lastKnownGoodTimeContext = context;
+    lastKnownGoodTimeContext.SetEffectiveTime<LastKnownGoodChipEpochTime>(System::Clock::Seconds32(0));
+    EXPECT_EQ(cache.Find(1, kNocNoIcac, ByteSpan(), kRcac, lastKnownGoodTimeContext, found), CHIP_NO_ERROR);
+
+    // Once the NOC has expired, the chain is dropped to be validated again.
+    uint32_t notAfter = NotAfterTime(kNocNoIcac);
+    ASSERT_NE(notAfter, kNullCertTime);
+    ValidationContext expiredContext = MakeContext(notAfter + 1);
+    EXPECT_EQ(cache.Find(1, kNocNoIcac, ByteSpan(), kRcac, expiredContext, found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Count(), 0u);
+}
+
+TEST_F(TestValidatedCertChainCache, EvictsLeastRecentlyUsed)
+{
+    ValidatedCertChainCache cache;
+    ASSERT_EQ(cache.Init(&mFabricTable, 2), CHIP_NO_ERROR);
+
+    ValidationContext context      = MakeContext(ValidTime({ kRcac, kIcac, kNoc, kNocNoIcac }));
+    ValidatedCertChain withIcac    = Validate(kNoc, kIcac, context);
+    ValidatedCertChain withoutIcac = Validate(kNocNoIcac, ByteSpan(), context);
+
+    EXPECT_EQ(cache.Insert(1, kNoc, kIcac, kRcac, context, withIcac), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Insert(1, kNocNoIcac, ByteSpan(), kRcac, context, withoutIcac), CHIP_NO_ERROR);
+
+    // Use the first chain, so that the second one is evicted by the next insertion.
+    ValidatedCertChain found;
+    EXPECT_EQ(cache.Find(1, kNoc, kIcac, kRcac, context, found), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Insert(2, kNoc, kIcac, kRcac, context, withIcac), CHIP_NO_ERROR);
+
+    EXPECT_EQ(cache.Count(), 2u);
+    EXPECT_EQ(cache.Find(1, kNoc, kIcac, kRcac, context, found), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Find(2, kNoc, kIcac, kRcac, context, found), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Find(1, kNocNoIcac, ByteSpan(), kRcac, context, found), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST_F(TestValidatedCertChainCache, InvalidatedByFabricChanges)
+{
+    ValidatedCertChainCache cache;
+    ASSERT_EQ(cache.Init(&mFabricTable, 4), CHIP_NO_ERROR);
+
+    // Add the Root01:ICA01:Node01_01 fabric, whose peers on Root01 can then be cached.
+    Crypto::P256SerializedKeypair opKeysSerialized;
+    Crypto::P256Keypair opKey;
+    memcpy(opKeysSerialized.Bytes(), TestCerts::sTestCert_Node01_01_PublicKey.data(),
+           TestCerts::sTestCert_Node01_01_PublicKey.size());
+    memcpy(opKeysSerialized.Bytes() + TestCerts::sTestCert_Node01_01_PublicKey.size(),
+           TestCerts::sTestCert_Node01_01_PrivateKey.data(), TestCerts::sTestCert_Node01_01_PrivateKey.size());
+    ASSERT_EQ(opKeysSerialized.SetLength(TestCerts::sTestCert_Node01_01_PublicKey.size() +
+                                         TestCerts::sTestCert_Node01_01_PrivateKey.size()),
+              CHIP_NO_ERROR);
+    ASSERT_EQ(opKey.Deserialize(opKeysSerialized), CHIP_NO_ERROR);
+
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    ASSERT_EQ(mFabricTable.AddNewPendingTrustedRootCert(kRcac), CHIP_NO_ERROR);
+    ASSERT_EQ(mFabricTable.AddNewPendingFabricWithProvidedOpKey(kNoc, kIcac, VendorId::TestVendor1, &opKey,
+                                                                /*isExistingOpKeyExternallyOwned =*/true, &fabricIndex),
+              CHIP_NO_ERROR);
+    ASSERT_EQ(mFabricTable.CommitPendingFabricData(), CHIP_NO_ERROR);
+
+    ValidationContext context    = MakeContext(ValidTime({ kRcac, kNocNoIcac }));
+    ValidatedCertChain validated = Validate(kNocNoIcac, ByteSpan(), context);
+    EXPECT_EQ(cache.Insert(fabricIndex, kNocNoIcac, ByteSpan(), kRcac, context, validated), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Insert(static_cast<FabricIndex>(fabricIndex + 1), kNocNoIcac, ByteSpan(), kRcac, context, validated),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 2u);
+
+    // Only the entries of the removed fabric are dropped.
+    EXPECT_EQ(mFabricTable.Delete(fabricIndex), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+
+    ValidatedCertChain found;
+    EXPECT_EQ(cache.Find(fabricIndex, kNocNoIcac, ByteSpan(), kRcac, context, found), CHIP_ERROR_NOT_FOUND);
+
+    // The cache stops following the fabric table once shut down.
+    cache.Shutdown();
+    EXPECT_EQ(cache.Count(), 0u);
+    EXPECT_EQ(cache.Insert(1, kNocNoIcac, ByteSpan(), kRcac, context, validated), CHIP_ERROR_INCORRECT_STATE);
+}
+
+} // namespace
@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the peer identity verification of repeated CASE establishments (as done by the responder
+ *      for Sigma3, or the initiator for Sigma2), with and without the ValidatedCertChainCache: validation of the peer
+ *      certificate chain, extraction of its CATs, and validation of the signature of the peer.
+ *
+ *      A few peers, with and without ICAC, establish sessions in turn.
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/FabricTable.h>
+#include <credentials/ValidatedCertChainCache.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kHandshakes       = 2000;
+constexpr FabricIndex kFabricIndex = 1;
+
+// Sigma2/Sigma3 sign a TBS data structure of about this size.
+constexpr uint8_t kTBSData[300] = {};
+
+struct Peer
+{
+    ByteSpan noc;
+    ByteSpan icac;
+    ByteSpan publicKey;
+    ByteSpan privateKey;
+    P256ECDSASignature signature;
+};
+
+Peer gPeers[] = {
+    { TestCerts::sTestCert_Node01_01_Chip, TestCerts::sTestCert_ICA01_Chip, TestCerts::sTestCert_Node01_01_PublicKey,
+      TestCerts::sTestCert_Node01_01_PrivateKey, {} },
+    { TestCerts::sTestCert_Node01_02_Chip, ByteSpan(), TestCerts::sTestCert_Node01_02_PublicKey,
+      TestCerts::sTestCert_Node01_02_PrivateKey, {} },
+};
+
+const ByteSpan kRcac = TestCerts::sTestCert_Root01_Chip;
+
+void SignTBSData(Peer & peer)
+{
+    P256SerializedKeypair serialized;
+    P256Keypair keypair;
+    memcpy(serialized.Bytes(), peer.publicKey.data(), peer.publicKey.size());
+    memcpy(serialized.Bytes() + peer.publicKey.size(), peer.privateKey.data(), peer.privateKey.size());
+    VerifyOrDie(serialized.SetLength(peer.publicKey.size() + peer.privateKey.size()) == CHIP_NO_ERROR);
+    VerifyOrDie(keypair.Deserialize(serialized) == CHIP_NO_ERROR);
+    VerifyOrDie(keypair.ECDSA_sign_msg(kTBSData, sizeof(kTBSData), peer.signature) == CHIP_NO_ERROR);
+}
+
+// Same steps as CASESession::HandleSigma3a/b/c.
+void VerifyPeer(const Peer & peer, ValidationContext & context, ValidatedCertChainCache * cache)
+{
+    ValidatedCertChain chain;
+    if (cache == nullptr || cache->Find(kFabricIndex, peer.noc, peer.icac, kRcac, context, chain) != CHIP_NO_ERROR)
+    {
+        CompressedFabricId unused;
+        VerifyOrDie(FabricTable::VerifyCredentials(peer.noc, peer.icac, kRcac, context, unused, chain.fabricId, chain.nodeId,
+                                                   chain.nocPublicKey) == CHIP_NO_ERROR);
+        VerifyOrDie(ExtractCATsFromOpCert(peer.noc, chain.cats) == CHIP_NO_ERROR);
+        if (cache != nullptr)
+        {
+            VerifyOrDie(cache->Insert(kFabricIndex, peer.noc, peer.icac, kRcac, context, chain) == CHIP_NO_ERROR);
+        }
+    }
+    VerifyOrDie(chain.nocPublicKey.ECDSA_validate_msg_signature(kTBSData, sizeof(kTBSData), peer.signature) == CHIP_NO_ERROR);
+}
+
+void Run(bool useCache)
+{
+    // The cache only registers with the fabric table, which is not needed otherwise.
+    FabricTable fabricTable;
+    ValidatedCertChainCache cache;
+    VerifyOrDie(cache.Init(&fabricTable, MATTER_ARRAY_SIZE(gPeers)) == CHIP_NO_ERROR);
+
+    // Same context as CASESession, at a time when all the test certificates are valid.
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    uint32_t time = 0;
+    for (const ByteSpan & cert : { kRcac, gPeers[0].icac, gPeers[0].noc, gPeers[1].noc })
+    {
+        ChipCertificateData certData;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        time = std::max(time, certData.mNotBeforeTime + 1);
+    }
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(time));
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kHandshakes; i++)
+    {
+        VerifyPeer(gPeers[i % MATTER_ARRAY_SIZE(gPeers)], context, useCache ? &cache : nullptr);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("%-10s %8zu %20.1f %14.1f\n", useCache ? "cached" : "uncached", MATTER_ARRAY_SIZE(gPeers), seconds * 1e6 / kHandshakes,
+           kHandshakes / seconds);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    for (Peer & peer : gPeers)
+    {
+        SignTBSData(peer);
+    }
+
+    printf("%-10s %8s %20s %14s\n", "chains", "peers", "verify peer (us)", "handshakes/s");
+    Run(false);
+    Run(true);
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmark of the conversion of certificates between the X.509 and the CHIP TLV
+ *      encodings, and of the prediction of the length of their conversion.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <memory>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+constexpr size_t kIterations = 100000;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile size_t gSink;
+
+std::vector<ByteSpan> gChipCerts;
+std::vector<ByteSpan> gX509Certs;
+
+template <typename Function>
+void Measure(const char * name, const std::vector<ByteSpan> & certs, Function function)
+{
+    size_t inputLen = 0;
+
+    // Warm up the caches.
+    for (const ByteSpan & cert : certs)
+    {
+        function(cert);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        const ByteSpan & cert = certs[i % certs.size()];
+        function(cert);
+        inputLen += cert.size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-40s %12.1f %12.1f\n", name, seconds * 1e9 / kIterations, static_cast<double>(inputLen) / seconds / 1e6);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < gNumTestCerts; i++)
+    {
+        ByteSpan cert;
+        VerifyOrDie(GetTestCert(gTestCerts[i], BitFlags<TestCertLoadFlags>(), cert) == CHIP_NO_ERROR);
+        gChipCerts.push_back(cert);
+        VerifyOrDie(GetTestCert(gTestCerts[i], BitFlags<TestCertLoadFlags>(TestCertLoadFlags::kDERForm), cert) == CHIP_NO_ERROR);
+        gX509Certs.push_back(cert);
+    }
+
+    printf("%-40s %12s %12s\n", "operation", "ns / cert", "input MB/s");
+
+    Measure("chip to x509: convert", gChipCerts, [](const ByteSpan & cert) {
+        uint8_t x509CertBuf[kMaxDERCertLength];
+        MutableByteSpan x509Cert(x509CertBuf);
+        VerifyOrDie(ConvertChipCertToX509Cert(cert, x509Cert) == CHIP_NO_ERROR);
+        gSink = x509Cert.size();
+    });
+    Measure("chip to x509: length", gChipCerts, [](const ByteSpan & cert) {
+        size_t x509CertLen;
+        VerifyOrDie(CalculateX509CertLength(cert, x509CertLen) == CHIP_NO_ERROR);
+        gSink = x509CertLen;
+    });
+    Measure("chip to x509: allocate max and convert", gChipCerts, [](const ByteSpan & cert) {
+        std::unique_ptr<uint8_t[]> x509CertBuf(new uint8_t[kMaxDERCertLength]);
+        MutableByteSpan x509Cert(x509CertBuf.get(), kMaxDERCertLength);
+        VerifyOrDie(ConvertChipCertToX509Cert(cert, x509Cert) == CHIP_NO_ERROR);
+        gSink = x509Cert.size();
+    });
+    Measure("chip to x509: allocate exact and convert", gChipCerts, [](const ByteSpan & cert) {
+        size_t x509CertLen;
+        VerifyOrDie(CalculateX509CertLength(cert, x509CertLen) == CHIP_NO_ERROR);
+        std::unique_ptr<uint8_t[]> x509CertBuf(new uint8_t[x509CertLen]);
+        MutableByteSpan x509Cert(x509CertBuf.get(), x509CertLen);
+        VerifyOrDie(ConvertChipCertToX509Cert(cert, x509Cert) == CHIP_NO_ERROR);
+        gSink = x509Cert.size();
+    });
+
+    Measure("x509 to chip: convert", gX509Certs, [](const ByteSpan & cert) {
+        uint8_t chipCertBuf[kMaxCHIPCertLength];
+        MutableByteSpan chipCert(chipCertBuf);
+        VerifyOrDie(ConvertX509CertToChipCert(cert, chipCert) == CHIP_NO_ERROR);
+        gSink = chipCert.size();
+    });
+    Measure("x509 to chip: length", gX509Certs, [](const ByteSpan & cert) {
+        size_t chipCertLen;
+        VerifyOrDie(CalculateChipCertLength(cert, chipCertLen) == CHIP_NO_ERROR);
+        gSink = chipCertLen;
+    });
+    Measure("x509 to chip: allocate max and convert", gX509Certs, [](const ByteSpan & cert) {
+        std::unique_ptr<uint8_t[]> chipCertBuf(new uint8_t[kMaxCHIPCertLength]);
+        MutableByteSpan chipCert(chipCertBuf.get(), kMaxCHIPCertLength);
+        VerifyOrDie(ConvertX509CertToChipCert(cert, chipCert) == CHIP_NO_ERROR);
+        gSink = chipCert.size();
+    });
+    Measure("x509 to chip: allocate exact and convert", gX509Certs, [](const ByteSpan & cert) {
+        size_t chipCertLen;
+        VerifyOrDie(CalculateChipCertLength(cert, chipCertLen) == CHIP_NO_ERROR);
+        std::unique_ptr<uint8_t[]> chipCertBuf(new uint8_t[chipCertLen]);
+        MutableByteSpan chipCert(chipCertBuf.get(), chipCertLen);
+        VerifyOrDie(ConvertX509CertToChipCert(cert, chipCert) == CHIP_NO_ERROR);
+        gSink = chipCert.size();
+    });
+
+    Platform::MemoryShutdown();
+    return 0;
+}
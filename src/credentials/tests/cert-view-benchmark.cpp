@@ -0,0 +1,163 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the extraction of single fields from CHIP certificates, as done by the FabricTable and
+ *      CASESession, with a full decoding by DecodeChipCert() against a ChipCertificateView.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertView.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+constexpr size_t kIterations = 20000;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile uint64_t gSink;
+
+const ByteSpan kCerts[] = {
+    TestCerts::sTestCert_Node01_01_Chip,
+    TestCerts::sTestCert_Node02_08_Chip,
+    TestCerts::sTestCert_ICA01_Chip,
+    TestCerts::sTestCert_Root01_Chip,
+};
+
+template <typename Function>
+void Measure(const char * name, Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        function(kCerts[i % MATTER_ARRAY_SIZE(kCerts)]);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-40s %12.1f\n", name, seconds * 1e9 / kIterations);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    printf("%-40s %12s\n", "operation", "ns / cert");
+
+    Measure("decoder: subject key id", [](const ByteSpan & cert) {
+        ChipCertificateData certData;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        gSink = certData.mSubjectKeyId[0];
+    });
+    Measure("view: subject key id", [](const ByteSpan & cert) {
+        ChipCertificateView certView;
+        CertificateKeyId skid;
+        VerifyOrDie(certView.Init(cert) == CHIP_NO_ERROR);
+        VerifyOrDie(certView.GetSubjectKeyId(skid) == CHIP_NO_ERROR);
+        gSink = skid[0];
+    });
+
+    Measure("decoder: public key", [](const ByteSpan & cert) {
+        ChipCertificateData certData;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        gSink = certData.mPublicKey[1];
+    });
+    Measure("view: public key", [](const ByteSpan & cert) {
+        ChipCertificateView certView;
+        VerifyOrDie(certView.Init(cert) == CHIP_NO_ERROR);
+        gSink = certView.GetPublicKey()[1];
+    });
+
+    Measure("decoder: not before time", [](const ByteSpan & cert) {
+        ChipCertificateData certData;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        gSink = certData.mNotBeforeTime;
+    });
+    Measure("view: not before time", [](const ByteSpan & cert) {
+        ChipCertificateView certView;
+        VerifyOrDie(certView.Init(cert) == CHIP_NO_ERROR);
+        gSink = certView.GetNotBeforeTime();
+    });
+
+    // Not all the certificates have a Fabric ID, and only the NOCs have a Node ID and CATs.
+    Measure("decoder: fabric id", [](const ByteSpan & cert) {
+        ChipCertificateData certData;
+        FabricId fabricId;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        gSink = (ExtractFabricIdFromCert(certData, &fabricId) == CHIP_NO_ERROR) ? fabricId : 0;
+    });
+    Measure("view: fabric id", [](const ByteSpan & cert) {
+        ChipCertificateView certView;
+        FabricId fabricId;
+        VerifyOrDie(certView.Init(cert) == CHIP_NO_ERROR);
+        gSink = (certView.GetFabricId(fabricId) == CHIP_NO_ERROR) ? fabricId : 0;
+    });
+
+    Measure("decoder: node id, fabric id and CATs", [](const ByteSpan & cert) {
+        ChipCertificateData certData;
+        NodeId nodeId;
+        FabricId fabricId;
+        CATValues cats;
+        VerifyOrDie(DecodeChipCert(cert, certData) == CHIP_NO_ERROR);
+        if (ExtractNodeIdFabricIdFromOpCert(certData, &nodeId, &fabricId) == CHIP_NO_ERROR)
+        {
+            VerifyOrDie(ExtractCATsFromOpCert(certData, cats) == CHIP_NO_ERROR);
+            gSink = nodeId ^ cats.values[0];
+        }
+    });
+    Measure("view: node id, fabric id and CATs", [](const ByteSpan & cert) {
+        ChipCertificateView certView;
+        NodeId nodeId;
+        FabricId fabricId;
+        CATValues cats;
+        VerifyOrDie(certView.Init(cert) == CHIP_NO_ERROR);
+        if (certView.GetNodeIdFabricId(nodeId, fabricId) == CHIP_NO_ERROR)
+        {
+            VerifyOrDie(certView.GetCATs(cats) == CHIP_NO_ERROR);
+            gSink = nodeId ^ cats.values[0];
+        }
+    });
+
+    // The TBS hash is needed for the signature either way: the view does not make signature checks slower.
+    Measure("decoder: signature check", [](const ByteSpan & cert) {
+        ChipCertificateData certData;
+        VerifyOrDie(DecodeChipCert(cert, certData, CertDecodeFlags::kGenerateTBSHash) == CHIP_NO_ERROR);
+        gSink = (VerifyCertSignature(certData, certData) == CHIP_NO_ERROR);
+    });
+    Measure("view: signature check", [](const ByteSpan & cert) {
+        ChipCertificateView certView;
+        VerifyOrDie(certView.Init(cert) == CHIP_NO_ERROR);
+        gSink = (certView.VerifySignature(certView.GetPublicKey()) == CHIP_NO_ERROR);
+    });
+
+    Platform::MemoryShutdown();
+    return 0;
+}
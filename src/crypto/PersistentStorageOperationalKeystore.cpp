@@ -137,31 +137,38 @@ CHIP_ERROR ExportStoredOpKey(FabricIndex fabricIndex, PersistentStorageDelegate
  *           only of the API and it is recommended to avoid directly accessing raw private key bits
  *           in storage.
  */
-CHIP_ERROR SignWithStoredOpKey(FabricIndex fabricIndex, PersistentStorageDelegate * storage, const ByteSpan & message,
-                               P256ECDSASignature & outSignature)
+CHIP_ERROR LoadStoredOpKey(FabricIndex fabricIndex, PersistentStorageDelegate * storage, P256Keypair & keypair)
 {
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex) && (storage != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // Use RAII scoping for the transient keypair, to make sure it doesn't get leaked on any error paths.
-    // Key is put in heap since signature is a costly stack operation and P256Keypair is
-    // a costly class depending on the backend.
-    auto transientOperationalKeypair = Platform::MakeUnique<P256Keypair>();
-    if (!transientOperationalKeypair)
-    {
-        return CHIP_ERROR_NO_MEMORY;
-    }
-
-    // Scope 1: Load up the keypair data from storage
+    // Load up the keypair data from storage
     P256SerializedKeypair serializedOpKey;
     CHIP_ERROR err = ExportStoredOpKey(fabricIndex, storage, serializedOpKey);
     if (CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND == err)
     {
         return CHIP_ERROR_INVALID_FABRIC_INDEX;
     }
+    ReturnErrorOnFailure(err);
 
     // Load-up key material
     // WARNING: This makes use of the raw key bits
-    ReturnErrorOnFailure(transientOperationalKeypair->Deserialize(serializedOpKey));
+    return keypair.Deserialize(serializedOpKey);
+}
+
+CHIP_ERROR SignWithStoredOpKey(FabricIndex fabricIndex, PersistentStorageDelegate * storage, const ByteSpan & message,
+                               P256ECDSASignature & outSignature)
+{
+    // Use RAII scoping for the transient keypair, to make sure it doesn't get leaked on any error paths.
+    // Key is put in heap since signature is a costly stack operation and P256Keypair is
+    // a costly class depending on the backend.
+    auto transientOperationalKeypair = Platform::MakeUnique<P256Keypair>();
+    if (!transientOperationalKeypair)
+    {
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    // Scope 1: Load up the keypair from storage
+    ReturnErrorOnFailure(LoadStoredOpKey(fabricIndex, storage, *transientOperationalKeypair));
 
     // Scope 2: Sign message with the keypair
     return transientOperationalKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
@@ -180,6 +187,12 @@ bool PersistentStorageOperationalKeystore::HasOpKeypairForFabric(FabricIndex fab
         return true;
     }
 
+    // A cached keypair was loaded from storage, and is evicted when removed from it.
+    if (FindCachedKeypair(fabricIndex) != nullptr)
+    {
+        return true;
+    }
+
     // TODO(#16958): need to actually read the key to know if it's there due to platforms not
     //               properly enforcing CHIP_ERROR_BUFFER_TOO_SMALL behavior needed by
     //               PersistentStorageDelegate. Very unfortunate, needs fixing ASAP.
@@ -255,6 +268,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::CommitOpKeypairForFabric(Fabric
 
     // If we got here, we succeeded and can reset the pending key: next `SignWithOpKeypair` will use the stored key.
     ResetPendingKey();
+    EvictCachedKeypair(fabricIndex);
     return CHIP_NO_ERROR;
 }
 
@@ -276,6 +290,8 @@ CHIP_ERROR PersistentStorageOperationalKeystore::RemoveOpKeypairForFabric(Fabric
         RevertPendingKeypair();
     }
 
+    EvictCachedKeypair(fabricIndex);
+
     CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricOpKey(fabricIndex).KeyName());
     if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
     {
@@ -306,9 +322,84 @@ CHIP_ERROR PersistentStorageOperationalKeystore::SignWithOpKeypair(FabricIndex f
         return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
     }
 
+    if (mKeypairCacheEnabled)
+    {
+        P256Keypair * keypair = FindCachedKeypair(fabricIndex);
+        if (keypair == nullptr)
+        {
+            CHIP_ERROR err = LoadCachedKeypair(fabricIndex, keypair);
+            // With more keys than cache entries, the extra keys are used without being cached.
+            VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_NO_MEMORY, err);
+        }
+        if (keypair != nullptr)
+        {
+            return keypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        }
+    }
+
     return SignWithStoredOpKey(fabricIndex, mStorage, message, outSignature);
 }
 
+Crypto::P256Keypair * PersistentStorageOperationalKeystore::FindCachedKeypair(FabricIndex fabricIndex) const
+{
+    for (const CachedKeypair & entry : mCachedKeypairs)
+    {
+        if (entry.keypair != nullptr && entry.fabricIndex == fabricIndex)
+        {
+            return entry.keypair;
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR PersistentStorageOperationalKeystore::LoadCachedKeypair(FabricIndex fabricIndex, P256Keypair *& outKeypair) const
+{
+    CachedKeypair * freeEntry = nullptr;
+    for (CachedKeypair & entry : mCachedKeypairs)
+    {
+        if (entry.keypair == nullptr)
+        {
+            freeEntry = &entry;
+            break;
+        }
+    }
+    VerifyOrReturnError(freeEntry != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    auto keypair = Platform::MakeUnique<P256Keypair>();
+    VerifyOrReturnError(keypair, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(LoadStoredOpKey(fabricIndex, mStorage, *keypair));
+
+    freeEntry->fabricIndex = fabricIndex;
+    freeEntry->keypair     = keypair.release();
+    outKeypair             = freeEntry->keypair;
+    return CHIP_NO_ERROR;
+}
+
+void PersistentStorageOperationalKeystore::EvictCachedKeypair(FabricIndex fabricIndex)
+{
+    for (CachedKeypair & entry : mCachedKeypairs)
+    {
+        if (entry.keypair != nullptr && entry.fabricIndex == fabricIndex)
+        {
+            // The destructor of P256Keypair clears the key material.
+            Platform::Delete(entry.keypair);
+            entry = CachedKeypair();
+        }
+    }
+}
+
+void PersistentStorageOperationalKeystore::ClearKeypairCache()
+{
+    for (CachedKeypair & entry : mCachedKeypairs)
+    {
+        if (entry.keypair != nullptr)
+        {
+            Platform::Delete(entry.keypair);
+            entry = CachedKeypair();
+        }
+    }
+}
+
 Crypto::P256Keypair * PersistentStorageOperationalKeystore::AllocateEphemeralKeypairForCASE()
 {
     // DO NOT CUT AND PASTE without considering the ReleaseEphemeralKeypair().
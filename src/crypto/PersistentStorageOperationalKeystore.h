@@ -72,9 +72,32 @@ public:
         VerifyOrReturn(mStorage != nullptr);
 
         ResetPendingKey();
+        ClearKeypairCache();
         mStorage = nullptr;
     }
 
+    /**
+     * @brief Keep the operational keypairs in memory once loaded, so that SignWithOpKeypair does not read and deserialize
+     *        the stored key for every signature (i.e. every CASE Sigma2/Sigma3).
+     *
+     * Disabled by default: with the cache, the private keys stay in RAM for the lifetime of the keystore instead of the
+     * duration of a signature. Cached keys are cleared (and their memory zeroized) when the key of their fabric is
+     * committed or removed through this keystore, when the cache is disabled, and on Finish(). The storage must not be
+     * modified behind the keystore while the cache is enabled.
+     *
+     * @param enabled Whether to cache the keypairs, up to one per fabric.
+     */
+    void SetKeypairCacheEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            ClearKeypairCache();
+        }
+        mKeypairCacheEnabled = enabled;
+    }
+
+    bool IsKeypairCacheEnabled() const { return mKeypairCacheEnabled; }
+
     bool HasPendingOpKeypair() const override { return (mPendingKeypair != nullptr); }
 
     bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override;
@@ -103,8 +126,23 @@ protected:
         mPendingFabricIndex       = kUndefinedFabricIndex;
     }
 
+    struct CachedKeypair
+    {
+        FabricIndex fabricIndex       = kUndefinedFabricIndex;
+        Crypto::P256Keypair * keypair = nullptr;
+    };
+
+    Crypto::P256Keypair * FindCachedKeypair(FabricIndex fabricIndex) const;
+    CHIP_ERROR LoadCachedKeypair(FabricIndex fabricIndex, Crypto::P256Keypair *& outKeypair) const;
+    void EvictCachedKeypair(FabricIndex fabricIndex);
+    void ClearKeypairCache();
+
     PersistentStorageDelegate * mStorage = nullptr;
 
+    // Loaded by SignWithOpKeypair, which is const, hence mutable.
+    mutable CachedKeypair mCachedKeypairs[CHIP_CONFIG_MAX_FABRICS];
+    bool mKeypairCacheEnabled = false;
+
     // This pending fabric index is `kUndefinedFabricIndex` if there isn't a pending keypair override for a given fabric.
     FabricIndex mPendingFabricIndex       = kUndefinedFabricIndex;
     Crypto::P256Keypair * mPendingKeypair = nullptr;
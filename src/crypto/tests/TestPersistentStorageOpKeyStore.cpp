@@ -380,4 +380,54 @@ TEST_F(TestPersistentStorageOpKeyStore, TestMigrationKeys)
     opKeyStore.Finish();
 }
 
+TEST_F(TestPersistentStorageOpKeyStore, TestKeypairCache)
+{
+    TestPersistentStorageDelegate storageDelegate;
+    PersistentStorageOperationalKeystore opKeystore;
+
+    FabricIndex kFabricIndex    = 111;
+    std::string opKeyStorageKey = DefaultStorageKeyAllocator::FabricOpKey(kFabricIndex).KeyName();
+    uint8_t message[]           = { 'm', 's', 'g' };
+    P256ECDSASignature sig;
+
+    EXPECT_EQ(opKeystore.Init(&storageDelegate), CHIP_NO_ERROR);
+    EXPECT_FALSE(opKeystore.IsKeypairCacheEnabled());
+    opKeystore.SetKeypairCacheEnabled(true);
+    EXPECT_TRUE(opKeystore.IsKeypairCacheEnabled());
+
+    uint8_t csrBuf[kMIN_CSR_Buffer_Size];
+    MutableByteSpan csrSpan{ csrBuf };
+    EXPECT_EQ(opKeystore.NewOpKeypairForFabric(kFabricIndex, csrSpan), CHIP_NO_ERROR);
+
+    P256PublicKey csrPublicKey;
+    EXPECT_EQ(VerifyCertificateSigningRequest(csrSpan.data(), csrSpan.size(), csrPublicKey), CHIP_NO_ERROR);
+    EXPECT_EQ(opKeystore.ActivateOpKeypairForFabric(kFabricIndex, csrPublicKey), CHIP_NO_ERROR);
+    EXPECT_EQ(opKeystore.CommitOpKeypairForFabric(kFabricIndex), CHIP_NO_ERROR);
+    EXPECT_TRUE(storageDelegate.HasKey(opKeyStorageKey));
+
+    // First signature loads the committed key in the cache.
+    EXPECT_EQ(opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, sig), CHIP_NO_ERROR);
+    EXPECT_EQ(csrPublicKey.ECDSA_validate_msg_signature(message, sizeof(message), sig), CHIP_NO_ERROR);
+
+    // Next signatures no longer read the storage.
+    storageDelegate.AddPoisonKey(opKeyStorageKey);
+    EXPECT_EQ(opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, sig), CHIP_NO_ERROR);
+    EXPECT_EQ(csrPublicKey.ECDSA_validate_msg_signature(message, sizeof(message), sig), CHIP_NO_ERROR);
+    EXPECT_TRUE(opKeystore.HasOpKeypairForFabric(kFabricIndex));
+
+    // Disabling the cache drops the key: signing reads the (poisoned) storage again.
+    opKeystore.SetKeypairCacheEnabled(false);
+    EXPECT_NE(opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, sig), CHIP_NO_ERROR);
+    storageDelegate.ClearPoisonKeys();
+
+    // Removing the key also removes it from the cache.
+    opKeystore.SetKeypairCacheEnabled(true);
+    EXPECT_EQ(opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, sig), CHIP_NO_ERROR);
+    EXPECT_EQ(opKeystore.RemoveOpKeypairForFabric(kFabricIndex), CHIP_NO_ERROR);
+    EXPECT_FALSE(opKeystore.HasOpKeypairForFabric(kFabricIndex));
+    EXPECT_EQ(opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, sig), CHIP_ERROR_INVALID_FABRIC_INDEX);
+
+    opKeystore.Finish();
+}
+
 } // namespace
@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the operational signatures of CASE (one per Sigma2 or Sigma3) made by the
+ *      PersistentStorageOperationalKeystore, with and without its keypair cache, for a few fabrics used in turn.
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kSignatures = 2000;
+
+void Run(size_t fabricCount, bool useCache)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentStorageOperationalKeystore keystore;
+    VerifyOrDie(keystore.Init(&storage) == CHIP_NO_ERROR);
+    keystore.SetKeypairCacheEnabled(useCache);
+
+    for (size_t i = 0; i < fabricCount; i++)
+    {
+        auto fabricIndex = static_cast<FabricIndex>(i + 1);
+        uint8_t csrBuf[kMIN_CSR_Buffer_Size];
+        MutableByteSpan csr{ csrBuf };
+        P256PublicKey publicKey;
+        VerifyOrDie(keystore.NewOpKeypairForFabric(fabricIndex, csr) == CHIP_NO_ERROR);
+        VerifyOrDie(VerifyCertificateSigningRequest(csr.data(), csr.size(), publicKey) == CHIP_NO_ERROR);
+        VerifyOrDie(keystore.ActivateOpKeypairForFabric(fabricIndex, publicKey) == CHIP_NO_ERROR);
+        VerifyOrDie(keystore.CommitOpKeypairForFabric(fabricIndex) == CHIP_NO_ERROR);
+    }
+
+    // Sigma2/Sigma3 sign a TBS data structure of about this size.
+    uint8_t message[300] = {};
+    P256ECDSASignature signature;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kSignatures; i++)
+    {
+        auto fabricIndex = static_cast<FabricIndex>(i % fabricCount + 1);
+        VerifyOrDie(keystore.SignWithOpKeypair(fabricIndex, ByteSpan{ message }, signature) == CHIP_NO_ERROR);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    keystore.Finish();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    printf("%-10s %8zu %14.1f %14.1f\n", useCache ? "cached" : "uncached", fabricCount, seconds * 1e6 / kSignatures,
+           kSignatures / seconds);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    printf("%-10s %8s %14s %14s\n", "keypairs", "fabrics", "sign (us)", "signs/s");
+    for (size_t fabricCount : { 1, 5 })
+    {
+        Run(fabricCount, false);
+        Run(fabricCount, true);
+    }
+
+    Platform::MemoryShutdown();
+    return 0;
+}
@@ -197,6 +197,19 @@ std::optional<DataModel::ActionReturnStatus> CodegenDataModelProvider::InvokeCom
     return std::nullopt;
 }
 
+DataModel::InvokeDispatchPolicy CodegenDataModelProvider::GetInvokeDispatchPolicy(const ConcreteCommandPath & path)
+{
+    if (auto * cluster = mRegistry.Get(path); cluster != nullptr)
+    {
+        return cluster->GetInvokeDispatchPolicy(path);
+    }
+
+    CommandHandlerInterface * handler_interface =
+        CommandHandlerInterfaceRegistry::Instance().GetCommandHandler(path.mEndpointId, path.mClusterId);
+    VerifyOrReturnValue(handler_interface != nullptr, DataModel::InvokeDispatchPolicy());
+    return handler_interface->GetDispatchPolicy(path);
+}
+
 CHIP_ERROR CodegenDataModelProvider::Endpoints(ReadOnlyBufferBuilder<DataModel::EndpointEntry> & builder)
 {
     const uint16_t endpointCount = emberAfEndpointCount();
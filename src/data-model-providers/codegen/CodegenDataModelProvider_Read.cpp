@@ -148,5 +148,18 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
     return encoder.Encode(emberData);
 }
 
+bool CodegenDataModelProvider::IsVersionedStorageAttribute(const ConcreteAttributePath & path)
+{
+    // Values read through cluster code can change without the data version changing.
+    VerifyOrReturnValue(mRegistry.Get(path) == nullptr, false);
+    VerifyOrReturnValue(AttributeAccessInterfaceRegistry::Instance().Get(path.mEndpointId, path.mClusterId) == nullptr, false);
+
+    // Ember RAM and NVM storage changes the data version on writes, and drops the cached reports when a write asks
+    // for it not to (see emAfWriteAttribute). External storage is read through emberAfExternalAttributeReadCallback.
+    auto metadata = Ember::FindAttributeMetadata(path);
+    const auto * attributeMetadata = std::get_if<const EmberAfAttributeMetadata *>(&metadata);
+    return attributeMetadata != nullptr && *attributeMetadata != nullptr && !(*attributeMetadata)->IsExternal();
+}
+
 } // namespace app
 } // namespace chip
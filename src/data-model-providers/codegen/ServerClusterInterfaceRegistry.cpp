@@ -69,8 +69,22 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
         ReturnErrorOnFailure(entry.serverClusterInterface->Startup(*mContext));
     }
 
-    entry.next     = mRegistrations;
-    mRegistrations = &entry;
+    if (!AddToIndex(*entry.serverClusterInterface))
+    {
+        entry.next     = mRegistrations;
+        mRegistrations = &entry;
+        mUnindexedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    // Indexed registrations go after the ones that did not fit in the index, so that lookups only walk the latter.
+    ServerClusterRegistration ** link = &mRegistrations;
+    for (size_t i = 0; i < mUnindexedCount; i++)
+    {
+        link = &(*link)->next;
+    }
+    entry.next = *link;
+    *link      = &entry;
 
     return CHIP_NO_ERROR;
 }
@@ -96,6 +110,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
                 prev->next = next;
             }
 
+            RemoveFromIndex(*current->serverClusterInterface);
             if (mCachedInterface == current->serverClusterInterface)
             {
                 mCachedInterface = nullptr;
@@ -135,6 +150,7 @@ void ServerClusterInterfaceRegistry::UnregisterAllFromEndpoint(EndpointId endpoi
         auto paths = current->serverClusterInterface->GetPaths();
         if (paths.empty() || paths.front().mEndpointId == endpointId)
         {
+            RemoveFromIndex(*current->serverClusterInterface);
             if (mCachedInterface == current->serverClusterInterface)
             {
                 mCachedInterface = nullptr;
@@ -167,24 +183,26 @@ void ServerClusterInterfaceRegistry::UnregisterAllFromEndpoint(EndpointId endpoi
 
 ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClusterPath & clusterPath)
 {
+    ServerClusterInterface * found = mIndex.Get(clusterPath.mEndpointId, clusterPath.mClusterId);
+    VerifyOrReturnValue(found == nullptr && mUnindexedCount > 0, found);
+
     // Check the cache to speed things up
     if ((mCachedInterface != nullptr) && mCachedInterface->PathsContains(clusterPath))
     {
         return mCachedInterface;
     }
 
-    // The cluster searched for is not cached, do a linear search for it
+    // The cluster searched for is not cached, do a linear search over the registrations that are not in the index; they
+    // come first in the list.
     ServerClusterRegistration * current = mRegistrations;
 
-    while (current != nullptr)
+    for (size_t count = mUnindexedCount; current != nullptr && count > 0; current = current->next, count--)
     {
         if (current->serverClusterInterface->PathsContains(clusterPath))
         {
             mCachedInterface = current->serverClusterInterface;
             return mCachedInterface;
         }
-
-        current = current->next;
     }
 
     // not found
@@ -230,6 +248,32 @@ CHIP_ERROR ServerClusterInterfaceRegistry::SetContext(ServerClusterContext && co
     return CHIP_NO_ERROR;
 }
 
+bool ServerClusterInterfaceRegistry::AddToIndex(ServerClusterInterface & interface)
+{
+    // A registration is either fully indexed or not at all, so that it is either in the index or walked by lookups.
+    Span<const ConcreteClusterPath> paths = interface.GetPaths();
+    VerifyOrReturnValue(paths.size() <= mIndex.Remaining(), false);
+
+    for (const ConcreteClusterPath & path : paths)
+    {
+        VerifyOrDie(mIndex.Insert(path.mEndpointId, path.mClusterId, &interface));
+    }
+    return true;
+}
+
+void ServerClusterInterfaceRegistry::RemoveFromIndex(ServerClusterInterface & interface)
+{
+    bool indexed = false;
+    for (const ConcreteClusterPath & path : interface.GetPaths())
+    {
+        indexed = mIndex.Remove(path.mEndpointId, path.mClusterId, &interface);
+    }
+    if (!indexed)
+    {
+        mUnindexedCount--;
+    }
+}
+
 void ServerClusterInterfaceRegistry::ClearContext()
 {
     if (!mContext.has_value())
@@ -16,11 +16,14 @@
  */
 #pragma once
 
+#include <app/ClusterPathIndex.h>
 #include <app/ConcreteClusterPath.h>
 #include <app/server-cluster/ServerClusterInterface.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <new>
 
@@ -233,10 +236,20 @@ public:
     void ClearContext();
 
 private:
+    bool AddToIndex(ServerClusterInterface & interface);
+    void RemoveFromIndex(ServerClusterInterface & interface);
+
     ServerClusterRegistration * mRegistrations = nullptr;
 
+    // Index of the paths of mRegistrations, so that lookups do not walk the list. Disabled unless
+    // CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE is set.
+    ClusterPathIndex<ServerClusterInterface, CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE> mIndex;
+
+    // Number of registrations whose paths did not fit in mIndex. They come first in mRegistrations, and only they need a
+    // list walk, behind mCachedInterface.
+    size_t mUnindexedCount = 0;
+
     // A one-element cache to speed up finding a cluster within an endpoint.
-    // The endpointId specifies which endpoint the cache belongs to.
     ServerClusterInterface * mCachedInterface = nullptr;
 
     // Managing context for this registry
@@ -87,6 +87,7 @@ namespace {
 
 constexpr AttributeId kAttributeIdReadOnly   = 0x3001;
 constexpr AttributeId kAttributeIdTimedWrite = 0x3002;
+constexpr AttributeId kAttributeIdExternal   = 0x3003;
 
 constexpr CommandId kMockCommandId1 = 0x1234;
 constexpr CommandId kMockCommandId2 = 0x1122;
@@ -565,6 +566,7 @@ const MockNodeConfig gTestNodeConfig({
             // Special case handling
             MockAttributeConfig(kAttributeIdReadOnly, ZCL_INT32S_ATTRIBUTE_TYPE, 0),
             MockAttributeConfig(kAttributeIdTimedWrite, ZCL_INT32S_ATTRIBUTE_TYPE, MATTER_ATTRIBUTE_FLAG_WRITABLE | MATTER_ATTRIBUTE_FLAG_MUST_USE_TIMED_WRITE),
+            MockAttributeConfig(kAttributeIdExternal, ZCL_INT32S_ATTRIBUTE_TYPE, MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE),
         }),
     }),
     MockEndpointConfig(kMockEndpoint4, {
@@ -2684,6 +2686,45 @@ TEST_F(TestCodegenModelViaMocks, ServerClusterInterfacesRegistration)
     model.Shutdown();
 }
 
+TEST_F(TestCodegenModelViaMocks, VersionedStorageAttributes)
+{
+    TestServerClusterContext testContext;
+
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    model.SetPersistentStorageDelegate(&testContext.StorageDelegate());
+    ASSERT_EQ(model.Startup(testContext.ImContext()), CHIP_NO_ERROR);
+
+    // Ember storage, unless external.
+    const ConcreteAttributePath kEmberPath(kMockEndpoint3, MockClusterId(4), kAttributeIdReadOnly);
+    EXPECT_TRUE(model.IsVersionedStorageAttribute(kEmberPath));
+    EXPECT_FALSE(model.IsVersionedStorageAttribute(ConcreteAttributePath(kMockEndpoint3, MockClusterId(4), kAttributeIdExternal)));
+    EXPECT_FALSE(model.IsVersionedStorageAttribute(ConcreteAttributePath(kMockEndpoint3, MockClusterId(4), 0xFFFE)));
+    EXPECT_FALSE(model.IsVersionedStorageAttribute(ConcreteAttributePath(kEndpointIdThatIsMissing, MockClusterId(4), 0)));
+
+    // Values read through an AttributeAccessInterface are not versioned by ember.
+    {
+        RegisteredAttributeAccessInterface<UnsupportedReadAccessInterface> aai(kEmberPath);
+        EXPECT_FALSE(model.IsVersionedStorageAttribute(kEmberPath));
+    }
+    EXPECT_TRUE(model.IsVersionedStorageAttribute(kEmberPath));
+
+    // Neither are the values of code driven clusters.
+    const ConcreteClusterPath kTestClusterPath(kMockEndpoint1, MockClusterId(2));
+    const ConcreteAttributePath kRevisionPath(kTestClusterPath.mEndpointId, kTestClusterPath.mClusterId,
+                                              Clusters::Globals::Attributes::ClusterRevision::Id);
+    EXPECT_TRUE(model.IsVersionedStorageAttribute(kRevisionPath));
+
+    FakeDefaultServerCluster fakeClusterServer(kTestClusterPath);
+    ServerClusterRegistration registration(fakeClusterServer);
+    ASSERT_EQ(model.Registry().Register(registration), CHIP_NO_ERROR);
+    EXPECT_FALSE(model.IsVersionedStorageAttribute(kRevisionPath));
+
+    model.Registry().Unregister(&fakeClusterServer);
+    model.Shutdown();
+}
+
 TEST_F(TestCodegenModelViaMocks, ServerClusterInterfacesListClusters)
 {
     TestServerClusterContext testContext;
@@ -208,9 +208,17 @@ public:
         Init(data, N);
     }
     void InitNullWriter(void);
+
+    /**
+     * Initialize a writer which discards everything written to it and only keeps track of the
+     * length of the encoding, as reported by GetLengthWritten(). This allows computing the exact
+     * size of a DER encoding before allocating a buffer for it.
+     */
+    void InitCountingWriter(void);
     size_t GetLengthWritten(void) const;
 
-    bool IsNullWriter() const { return mBuf == nullptr; }
+    bool IsNullWriter() const { return mBuf == nullptr && !mIsCountingWriter; }
+    bool IsCountingWriter() const { return mIsCountingWriter; }
 
     CHIP_ERROR PutInteger(int64_t val);
     CHIP_ERROR PutBoolean(bool val);
@@ -239,8 +247,10 @@ private:
     uint8_t * mBuf;
     uint8_t * mBufEnd;
     uint8_t * mWritePoint;
-    uint8_t * mDeferredLengthLocations[kMaxDeferredLengthDepth];
+    size_t mDeferredLengthOffsets[kMaxDeferredLengthDepth];
+    size_t mLengthCounted;
     uint8_t mDeferredLengthCount;
+    bool mIsCountingWriter;
 
     CHIP_ERROR EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed, int32_t len);
     CHIP_ERROR WriteDeferredLength(void);
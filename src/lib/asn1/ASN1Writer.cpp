@@ -55,6 +55,8 @@ void ASN1Writer::Init(uint8_t * buf, size_t maxLen)
     mWritePoint          = buf;
     mBufEnd              = buf + maxLen;
     mDeferredLengthCount = 0;
+    mLengthCounted       = 0;
+    mIsCountingWriter    = false;
 }
 
 void ASN1Writer::InitNullWriter()
@@ -63,10 +65,22 @@ void ASN1Writer::InitNullWriter()
     mWritePoint          = nullptr;
     mBufEnd              = nullptr;
     mDeferredLengthCount = 0;
+    mLengthCounted       = 0;
+    mIsCountingWriter    = false;
+}
+
+void ASN1Writer::InitCountingWriter()
+{
+    InitNullWriter();
+    mIsCountingWriter = true;
 }
 
 size_t ASN1Writer::GetLengthWritten() const
 {
+    if (mIsCountingWriter)
+    {
+        return mLengthCounted;
+    }
     return (mBuf != nullptr) ? static_cast<size_t>(mWritePoint - mBuf) : 0;
 }
 
@@ -98,7 +112,8 @@ CHIP_ERROR ASN1Writer::PutBoolean(bool val)
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_Boolean, false, 1));
 
-    *mWritePoint++ = (val) ? 0xFF : 0;
+    uint8_t encodedVal = (val) ? 0xFF : 0;
+    WriteData(&encodedVal, sizeof(encodedVal));
 
     return CHIP_NO_ERROR;
 }
@@ -186,32 +201,30 @@ CHIP_ERROR ASN1Writer::PutBitString(uint32_t val)
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, len));
 
-    if (val == 0)
-    {
-        mWritePoint[0] = 0;
-    }
-    else
+    uint8_t encodedVal[5] = { 0 };
+
+    if (val != 0)
     {
-        mWritePoint[1] = ReverseBits(static_cast<uint8_t>(val));
+        encodedVal[1] = ReverseBits(static_cast<uint8_t>(val));
         if (len >= 3)
         {
             val >>= 8;
-            mWritePoint[2] = ReverseBits(static_cast<uint8_t>(val));
+            encodedVal[2] = ReverseBits(static_cast<uint8_t>(val));
             if (len >= 4)
             {
                 val >>= 8;
-                mWritePoint[3] = ReverseBits(static_cast<uint8_t>(val));
+                encodedVal[3] = ReverseBits(static_cast<uint8_t>(val));
                 if (len == 5)
                 {
                     val >>= 8;
-                    mWritePoint[4] = ReverseBits(static_cast<uint8_t>(val));
+                    encodedVal[4] = ReverseBits(static_cast<uint8_t>(val));
                 }
             }
         }
-        mWritePoint[0] = static_cast<uint8_t>(7 - HighestBit(val));
+        encodedVal[0] = static_cast<uint8_t>(7 - HighestBit(val));
     }
 
-    mWritePoint += len;
+    WriteData(encodedVal, len);
 
     return CHIP_NO_ERROR;
 }
@@ -222,7 +235,7 @@ CHIP_ERROR ASN1Writer::PutBitString(uint8_t unusedBitCount, const uint8_t * enco
 
     ReturnErrorOnFailure(EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, encodedBitsLen + 1));
 
-    *mWritePoint++ = unusedBitCount;
+    WriteData(&unusedBitCount, sizeof(unusedBitCount));
 
     WriteData(encodedBits, encodedBitsLen);
 
@@ -241,7 +254,7 @@ CHIP_ERROR ASN1Writer::PutBitString(uint8_t unusedBitCount, chip::TLV::TLVReader
     ReturnErrorOnFailure(
         EncodeHead(kASN1TagClass_Universal, kASN1UniversalTag_BitString, false, static_cast<int32_t>(encodedBits.size() + 1)));
 
-    *mWritePoint++ = unusedBitCount;
+    WriteData(&unusedBitCount, sizeof(unusedBitCount));
 
     WriteData(encodedBits.data(), encodedBits.size());
 
@@ -279,7 +292,7 @@ CHIP_ERROR ASN1Writer::PutConstructedType(const uint8_t * val, uint16_t valLen)
     VerifyOrReturnError(!IsNullWriter(), CHIP_NO_ERROR);
 
     // Make sure we have enough space to write
-    VerifyOrReturnError((mWritePoint + valLen) <= mBufEnd, ASN1_ERROR_OVERFLOW);
+    VerifyOrReturnError(mIsCountingWriter || (mWritePoint + valLen) <= mBufEnd, ASN1_ERROR_OVERFLOW);
 
     WriteData(val, valLen);
 
@@ -307,8 +320,9 @@ CHIP_ERROR ASN1Writer::StartEncapsulatedType(uint8_t cls, uint8_t tag, bool bitS
     // the unused bit count is always 0.
     if (bitStringEncoding)
     {
-        VerifyOrReturnError(mWritePoint < mBufEnd, ASN1_ERROR_OVERFLOW);
-        *mWritePoint++ = 0;
+        const uint8_t unusedBitCount = 0;
+        VerifyOrReturnError(mIsCountingWriter || mWritePoint < mBufEnd, ASN1_ERROR_OVERFLOW);
+        WriteData(&unusedBitCount, sizeof(unusedBitCount));
     }
 
     return CHIP_NO_ERROR;
@@ -362,6 +376,19 @@ CHIP_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed,
     // Compute the number of bytes required to encode the length.
     bytesForLen = BytesForLength(len);
 
+    // A counting writer only keeps track of the length of the encoding, and of the offsets of the
+    // deferred lengths, so that their final size can be accounted for in WriteDeferredLength().
+    if (mIsCountingWriter)
+    {
+        if (len == kUnknownLength)
+        {
+            VerifyOrReturnError(mDeferredLengthCount < kMaxDeferredLengthDepth, ASN1_ERROR_INVALID_STATE);
+            mDeferredLengthOffsets[mDeferredLengthCount++] = mLengthCounted + 1;
+        }
+        mLengthCounted += 1 + bytesForLen;
+        return CHIP_NO_ERROR;
+    }
+
     // Make sure there's enough space to encode the entire value.
     // Note that the calculated total length doesn't overflow because `len` is a signed value (int32_t).
     // Note that if `len` is not kUnknownLength then it is non-negative (`len` >= 0).
@@ -377,9 +404,9 @@ CHIP_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed,
         EncodeLength(mWritePoint, bytesForLen, len);
     }
     // ... otherwise place a marker in the first byte of the length to indicate that the length is unknown
-    // and save a pointer to the length field in the deferred-length array.
+    // and save the offset of the length field in the deferred-length array.
     //
-    // The deferred-length is an array of "pointers" to length fields for which the length of the
+    // The deferred-length is an array of offsets of length fields for which the length of the
     // element was unknown at the time the element head was written. Examples include constructed
     // types such as SEQUENCE and SET, as well non-constructed types that encapsulate other ASN.1 types
     // (e.g. OCTET STRINGS that contain BER/DER encodings). The final lengths are filled in later,
@@ -388,8 +415,8 @@ CHIP_ERROR ASN1Writer::EncodeHead(uint8_t cls, uint8_t tag, bool isConstructed,
     {
         VerifyOrReturnError(mDeferredLengthCount < kMaxDeferredLengthDepth, ASN1_ERROR_INVALID_STATE);
 
-        *mWritePoint                                     = kUnknownLengthMarker;
-        mDeferredLengthLocations[mDeferredLengthCount++] = mWritePoint;
+        *mWritePoint                                   = kUnknownLengthMarker;
+        mDeferredLengthOffsets[mDeferredLengthCount++] = static_cast<size_t>(mWritePoint - mBuf);
     }
 
     mWritePoint += bytesForLen;
@@ -403,17 +430,27 @@ CHIP_ERROR ASN1Writer::WriteDeferredLength()
 
     VerifyOrReturnError(mDeferredLengthCount > 0, ASN1_ERROR_INVALID_STATE);
 
-    uint8_t * lenField = mDeferredLengthLocations[mDeferredLengthCount - 1];
-
-    VerifyOrReturnError(*lenField == kUnknownLengthMarker, ASN1_ERROR_INVALID_STATE);
+    size_t lenFieldOffset = mDeferredLengthOffsets[mDeferredLengthCount - 1];
 
     // Compute the length of the element's value.
-    size_t elemLen = static_cast<size_t>((mWritePoint - lenField) - kLengthFieldReserveSize);
+    size_t elemLen = GetLengthWritten() - lenFieldOffset - kLengthFieldReserveSize;
 
     VerifyOrReturnError(CanCastTo<int32_t>(elemLen), ASN1_ERROR_LENGTH_OVERFLOW);
 
     uint8_t bytesForLen = BytesForLength(static_cast<int32_t>(elemLen));
 
+    // A counting writer only accounts for the final size of the length field.
+    if (mIsCountingWriter)
+    {
+        mLengthCounted += (bytesForLen - kLengthFieldReserveSize);
+        mDeferredLengthCount--;
+        return CHIP_NO_ERROR;
+    }
+
+    uint8_t * lenField = mBuf + lenFieldOffset;
+
+    VerifyOrReturnError(*lenField == kUnknownLengthMarker, ASN1_ERROR_INVALID_STATE);
+
     // Move the element data if the number of bytes consumed by the final length field
     // is different than the space that was reserved for the field.
     if (bytesForLen != kLengthFieldReserveSize)
@@ -476,8 +513,17 @@ void ASN1Writer::EncodeLength(uint8_t * buf, uint8_t bytesForLen, int32_t lenToE
 
 void ASN1Writer::WriteData(const uint8_t * p, size_t len)
 {
-    memcpy(mWritePoint, p, len);
-    mWritePoint += len;
+    if (mIsCountingWriter)
+    {
+        mLengthCounted += len;
+        return;
+    }
+    // Empty values may come with a null pointer.
+    if (len > 0)
+    {
+        memcpy(mWritePoint, p, len);
+        mWritePoint += len;
+    }
 }
 
 } // namespace ASN1
@@ -318,6 +318,58 @@ TEST(TestASN1, NullWriter)
     EXPECT_EQ(err, CHIP_ERROR_WRONG_TLV_TYPE);
 }
 
+// Encoding with deferred lengths which need more than one byte, at several nesting levels.
+static CHIP_ERROR EncodeLongASN1TestData(ASN1Writer & writer)
+{
+    static const uint8_t sLongValue[300] = { 0 };
+    CHIP_ERROR err                       = CHIP_NO_ERROR;
+
+    ASN1_START_SEQUENCE
+    {
+        ASN1_START_OCTET_STRING_ENCAPSULATED
+        {
+            ASN1_START_SEQUENCE
+            {
+                ASN1_ENCODE_OCTET_STRING(sLongValue, 100);
+                ASN1_ENCODE_OCTET_STRING(sLongValue, sizeof(sLongValue));
+            }
+            ASN1_END_SEQUENCE;
+        }
+        ASN1_END_ENCAPSULATED;
+        ASN1_ENCODE_INTEGER(0x12345678);
+    }
+    ASN1_END_SEQUENCE;
+
+exit:
+    return err;
+}
+
+TEST(TestASN1, CountingWriter)
+{
+    CHIP_ERROR err;
+    ASN1Writer writer;
+
+    writer.InitCountingWriter();
+    EXPECT_FALSE(writer.IsNullWriter());
+
+    err = EncodeASN1TestData(writer);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(writer.GetLengthWritten(), sizeof(TestASN1_EncodedData));
+
+    // Deferred lengths are counted with their final size.
+    uint8_t buf[1024];
+    ASN1Writer bufWriter;
+    bufWriter.Init(buf);
+    writer.InitCountingWriter();
+
+    err = EncodeLongASN1TestData(bufWriter);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = EncodeLongASN1TestData(writer);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(writer.GetLengthWritten(), bufWriter.GetLengthWritten());
+    EXPECT_EQ(writer.GetLengthWritten(), 4u + 4u + 4u + (2u + 100u) + (4u + 300u) + 6u);
+}
+
 TEST(TestASN1, ASN1UniversalTime)
 {
     struct ASN1TimeTestCase
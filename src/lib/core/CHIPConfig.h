@@ -802,6 +802,24 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+ *
+ * @brief Keep the secure session table indexed by local session ID, by peer and
+ * by fabric, so that message reception, session ID allocation and per-node session
+ * lookups do not walk the whole table.
+ *
+ * The indexes are statically sized to CHIP_CONFIG_SECURE_SESSION_POOL_SIZE and
+ * take about 5 kB of RAM on 32-bit platforms at the default pool size, so they are
+ * enabled by default only where object pools are heap backed (see
+ * CHIP_SYSTEM_CONFIG_POOL_USE_HEAP). Platforms with small statically allocated
+ * pools walk the table instead.
+ *
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -884,12 +902,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_NUM_SUBSCRIPTIONS
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS
+ *      * #CHIP_IM_PATH_ARENA_CHUNK_SIZE
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
+ *      * #CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES
+ *      * #CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE
+ *      * #CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE
  *
  *  @{
  */
@@ -955,6 +977,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS (CHIP_IM_MAX_NUM_READS * 9)
 #endif
 
+/**
+ * @def CHIP_IM_PATH_ARENA_CHUNK_SIZE
+ *
+ * @brief Defines the maximum size in bytes of the chunks from which each read or subscription allocates its attribute paths,
+ *        event paths and data version filters when object pools use the heap (CHIP_SYSTEM_CONFIG_POOL_USE_HEAP). Each chunk is
+ *        one heap allocation. The first chunk of a list is sized for its first node and each following chunk doubles, up to
+ *        this size, so a list of a few paths costs about as much heap as allocating its nodes one by one. The default caps
+ *        chunks at 16 paths on 64-bit hosts. Builds with static pools use the fixed path pools of the engine instead.
+ */
+#ifndef CHIP_IM_PATH_ARENA_CHUNK_SIZE
+#define CHIP_IM_PATH_ARENA_CHUNK_SIZE 384
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *
@@ -992,6 +1027,75 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_TIMED_HANDLER 8
 #endif
 
+/**
+ * @def CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES
+ *
+ * @brief Defines the number of encoded attribute reports kept by the reporting engine, so that subscriptions reporting
+ *        the same attribute at the same data version share a single read and encode. Each entry takes
+ *        CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE bytes of RAM. Defaults to 0, which disables the cache.
+ */
+#ifndef CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES
+#define CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE
+ *
+ * @brief Defines the size, in bytes, of each CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRIES entry. Attribute reports that do not
+ *        fit are always read from the data model.
+ */
+#ifndef CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE
+#define CHIP_IM_REPORT_FRAGMENT_CACHE_ENTRY_SIZE 128
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS
+ *
+ * @brief Defines the duration of the time slots SpreadReportSchedulerImpl groups max interval reports into. Reports of
+ *        subscriptions whose max interval elapses within the same slot are emitted together at the start of the slot.
+ */
+#ifndef CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS
+#define CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS 1000
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS
+ *
+ * @brief Defines how many slots before its max interval SpreadReportSchedulerImpl may move a report to when the slot of
+ *        the max interval already holds CHIP_IM_MAX_REPORTS_IN_FLIGHT reports.
+ */
+#ifndef CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS
+#define CHIP_IM_REPORT_SCHEDULER_SPREAD_SLOTS 8
+#endif
+
+/**
+ * @def CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE
+ *
+ * @brief Defines how many (endpoint, cluster) paths the hash index of each cluster interface registry (attribute access
+ *        interfaces, command handler interfaces and server cluster interfaces) holds. 0 disables the indexes: the
+ *        registries then walk their registration lists, as they did before the indexes were added.
+ *
+ *        Devices with many interfaces, such as bridges with hundreds of per-endpoint interfaces, should set this to at
+ *        least the number of interfaces they register, so that lookups during wildcard reads do not walk the lists.
+ *        Interfaces registered beyond that are still found, by walking only the interfaces that did not fit. Each
+ *        registry then uses a power-of-2 number of buckets, at least 4/3 of this value, of 8 bytes plus a pointer each:
+ *        for example 512 buckets, 6 KB on 32-bit platforms, for 384 paths.
+ */
+#ifndef CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE
+#define CHIP_IM_CLUSTER_INTERFACE_INDEX_SIZE 0
+#endif
+
+/**
+ * @def CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE
+ *
+ * @brief Defines the maximum number of commands of a single invoke request that may be awaiting their (asynchronous)
+ *        response at the same time. Only commands whose handlers are concurrency-safe run concurrently; further
+ *        commands of a batch are dispatched as earlier ones complete.
+ */
+#ifndef CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE
+#define CHIP_IM_MAX_CONCURRENT_COMMANDS_PER_INVOKE 4
+#endif
+
 /**
  * @}
  */
@@ -1281,6 +1385,58 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE
+ *
+ * @brief
+ *   Number of CASE ephemeral keypairs that the server generates ahead of time, in the background, to take them out of
+ *   the critical path of Sigma1 and Sigma2. Each one holds a P256Keypair in memory. 0 disables the pool.
+ *
+ *   The pool requires the default ephemeral keypairs of the operational keystore (see CASEEphemeralKeypairPool), and
+ *   only takes key generation off the Matter thread on platforms that implement background event processing.
+ */
+#ifndef CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE
+#define CHIP_CONFIG_CASE_EPHEMERAL_KEYPAIR_POOL_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE
+ *
+ * @brief
+ *   Number of validated peer certificate chains that the server keeps, so that a peer re-establishing CASE with the same
+ *   chain skips its decoding and signature validation. Each entry takes about 150 bytes. 0 disables the cache.
+ *
+ *   Cached chains are still checked against the current time and validity policy, and are dropped on any change of
+ *   their fabric.
+ */
+#ifndef CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_CASE_CERT_CHAIN_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PASE_WS_CACHE_SIZE
+ *
+ * @brief
+ *   Number of SPAKE2+ w0s/w1s values, derived with PBKDF2 from the setup passcode of a commissionee, that a commissioner
+ *   keeps so that retrying PASE with the same commissionee does not run PBKDF2 again. Each entry takes about 120 bytes.
+ *   0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_PASE_WS_CACHE_SIZE
+#define CHIP_CONFIG_PASE_WS_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PASE_COMPUTE_WS_IN_BACKGROUND
+ *
+ * @brief
+ *   Enable the commissioner to derive the SPAKE2+ w0s/w1s of a commissionee with PBKDF2 through
+ *   PlatformManager::ScheduleBackgroundWork, so that the Matter thread serves other sessions meanwhile. Requires a
+ *   platform that implements background event processing and a running event loop.
+ */
+#ifndef CHIP_CONFIG_PASE_COMPUTE_WS_IN_BACKGROUND
+#define CHIP_CONFIG_PASE_COMPUTE_WS_IN_BACKGROUND 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1514,6 +1670,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_SUBSCRIPTION_RESUMPTION_STORAGE_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS
+ *
+ * @brief Defines the number of subscribers to which sessions are established at the same time when resuming persisted
+ *        subscriptions. All the subscriptions of a subscriber are resumed on a single session; the other subscribers wait
+ *        for one of these sessions to be established or to fail.
+ */
+#ifndef CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS
+#define CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS 4
+#endif
+
 /**
  * @brief Maximum length of Scene names
  */
@@ -1804,6 +1971,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED 0
 #endif
 
+/**
+ * @def CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+ *
+ * @brief Controls whether the spread report scheduler (SpreadReportSchedulerImpl) is the default report scheduler of
+ *        CommonCaseDeviceServerInitParams. Platforms that select their scheduler give the synchronized report scheduler
+ *        precedence.
+ *
+ * The spread report scheduler groups the max interval reports of many subscriptions into time slots and limits how many
+ * are sent at once, see CHIP_IM_REPORT_SCHEDULER_SLOT_DURATION_MS.
+ */
+#ifndef CHIP_CONFIG_SPREAD_REPORTS_ENABLED
+#define CHIP_CONFIG_SPREAD_REPORTS_ENABLED 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS
  *
@@ -0,0 +1,49 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/TLVCountingWriter.h>
+
+#include <cstdint>
+
+#include <lib/core/CHIPError.h>
+
+namespace chip {
+namespace TLV {
+
+CountingTLVWriter::CountingTLVWriter()
+{
+    // DiscardingBuffer::OnInit cannot fail.
+    Init(mDiscardingBuffer);
+}
+
+CHIP_ERROR CountingTLVWriter::DiscardingBuffer::OnInit(TLVWriter & /*writer*/, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    bufStart = mScratch;
+    bufLen   = sizeof(mScratch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CountingTLVWriter::DiscardingBuffer::GetNewBuffer(TLVWriter & /*writer*/, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    // Whatever was written to the scratch space has been counted already, so just reuse it.
+    bufStart = mScratch;
+    bufLen   = sizeof(mScratch);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,72 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVBackingStore.h>
+#include <lib/core/TLVWriter.h>
+
+namespace chip {
+namespace TLV {
+
+// Implementation of TLVWriter that discards everything written to it and only
+// keeps track of how many bytes the encoding takes, as reported by
+// GetLengthWritten().  This allows computing the exact encoded size of a value
+// (e.g. to decide whether it can fit in the remaining space of a message)
+// without needing a buffer large enough to hold it.
+//
+// Users of CountingTLVWriter may call any public API of TLVWriter, except for
+// the Init functions and ReserveBuffer.
+class CountingTLVWriter : public TLVWriter
+{
+public:
+    CountingTLVWriter();
+    CountingTLVWriter(const CountingTLVWriter &)             = delete;
+    CountingTLVWriter & operator=(const CountingTLVWriter &) = delete;
+
+private:
+    class DiscardingBuffer : public TLVBackingStore
+    {
+    public:
+        // TLVBackingStore implementation:
+        CHIP_ERROR OnInit(TLVReader & /*reader*/, const uint8_t *& /*bufStart*/, uint32_t & /*bufLen*/) override
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+        CHIP_ERROR GetNextBuffer(TLVReader & /*reader*/, const uint8_t *& /*bufStart*/, uint32_t & /*bufLen*/) override
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+        CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+        CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+        CHIP_ERROR FinalizeBuffer(TLVWriter & /*writer*/, uint8_t * /*bufStart*/, uint32_t /*bufLen*/) override
+        {
+            return CHIP_NO_ERROR;
+        }
+
+    private:
+        // Scratch space that is handed out (and overwritten) over and over again.
+        uint8_t mScratch[128];
+    };
+
+    DiscardingBuffer mDiscardingBuffer;
+};
+
+} // namespace TLV
+} // namespace chip
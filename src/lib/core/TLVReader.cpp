@@ -47,7 +47,35 @@ namespace TLV {
 
 using namespace chip::Encoding;
 
-static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+static constexpr uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+
+namespace {
+
+/**
+ * Number of bytes in the head of an element (the control byte, the tag and the length or value field) for each control
+ * byte, or 0 for control bytes with an invalid element type.
+ */
+struct ElementHeadSizes
+{
+    constexpr ElementHeadSizes() : sizes()
+    {
+        for (unsigned controlByte = 0; controlByte < 256; controlByte++)
+        {
+            const TLVElementType elemType = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+            if (IsValidTLVType(elemType))
+            {
+                sizes[controlByte] = static_cast<uint8_t>(1 + sTagSizes[controlByte >> kTLVTagControlShift] +
+                                                          TLVFieldSizeToBytes(GetTLVFieldSize(elemType)));
+            }
+        }
+    }
+
+    uint8_t sizes[256];
+};
+
+} // namespace
+
+static constexpr ElementHeadSizes sElementHeadSizes;
 
 TLVReader::TLVReader() :
     ImplicitProfileId(kProfileIdNotSpecified), AppData(nullptr), mElemLenOrVal(0), mBackingStore(nullptr), mReadPoint(nullptr),
@@ -709,6 +737,12 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
     // from calling CloseContainer() with the now orphaned container reader.
     SetContainerOpen(false);
 
+    // Without a backing store, the rest of the container is all in the input buffer.
+    if (mBackingStore == nullptr)
+    {
+        return SkipToEndOfContainerInBuffer();
+    }
+
     while (true)
     {
         TLVElementType elemType = ElementType();
@@ -738,6 +772,77 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
     }
 }
 
+/**
+ * SkipToEndOfContainer for readers without a backing store.
+ *
+ * The elements of the container are skipped over by their precomputed head sizes and their lengths, straight from the
+ * input buffer: their tags are not decoded, and they are not checked against the type of their container the way
+ * ReadElement checks the elements that are returned to the application. Only the encoding itself is verified (valid
+ * element types, anonymous end of container tags and lengths within the input buffer).
+ */
+CHIP_ERROR TLVReader::SkipToEndOfContainerInBuffer()
+{
+    TLVElementType elemType = ElementType();
+    uint32_t nestLevel      = 0;
+
+    VerifyOrReturnError(elemType != TLVElementType::EndOfContainer, CHIP_NO_ERROR);
+    if (TLVTypeIsContainer(elemType))
+    {
+        nestLevel++;
+    }
+    ReturnErrorOnFailure(SkipData());
+
+    const uint8_t * p = mReadPoint;
+    while (true)
+    {
+        VerifyOrReturnError(p != mBufEnd, CHIP_END_OF_TLV);
+
+        const uint8_t controlByte = *p;
+        const uint8_t headBytes   = sElementHeadSizes.sizes[controlByte];
+        VerifyOrReturnError(headBytes != 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        VerifyOrReturnError(headBytes <= mBufEnd - p, CHIP_ERROR_TLV_UNDERRUN);
+
+        elemType = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            VerifyOrReturnError((controlByte & kTLVTagControlMask) == 0, CHIP_ERROR_INVALID_TLV_TAG);
+            if (nestLevel == 0)
+            {
+                break;
+            }
+            nestLevel--;
+        }
+        else if (TLVTypeIsContainer(elemType))
+        {
+            nestLevel++;
+        }
+
+        p += headBytes;
+
+        if (TLVTypeHasLength(elemType))
+        {
+            const uint8_t lenBytes = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+            uint64_t len           = 0;
+            memcpy(&len, p - lenBytes, lenBytes);
+            LittleEndian::HostSwap(len);
+            VerifyOrReturnError(len <= static_cast<uint64_t>(mBufEnd - p), CHIP_ERROR_TLV_UNDERRUN);
+            p += len;
+        }
+    }
+
+    VerifyOrReturnError(mContainerType != kTLVType_NotSpecified, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+    // Leave the reader on the end of the container, as ReadElement would have.
+    mControlByte  = *p;
+    mElemTag      = AnonymousTag();
+    mElemLenOrVal = 0;
+    p++;
+    mLenRead += static_cast<uint32_t>(p - mReadPoint);
+    mReadPoint = p;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     // Make sure we have input data. Return CHIP_END_OF_TLV if no more data is available.
@@ -747,25 +852,18 @@ CHIP_ERROR TLVReader::ReadElement()
     // Get the element's control byte.
     mControlByte = *mReadPoint;
 
-    // Extract the element type from the control byte. Fail if it's invalid.
-    TLVElementType elemType = ElementType();
-    VerifyOrReturnError(IsValidTLVType(elemType), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    // Determine the number of bytes in the element's 'head'. This includes: the control byte, the tag bytes (if present), the
+    // length bytes (if present), and for elements that don't have a length (e.g. integers), the value bytes. Fail if the
+    // element type is invalid.
+    const uint8_t elemHeadBytes = sElementHeadSizes.sizes[mControlByte];
+    VerifyOrReturnError(elemHeadBytes != 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-    // Extract the tag control from the control byte.
+    // Extract the element type and the tag control from the control byte.
+    TLVElementType elemType  = ElementType();
     TLVTagControl tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
 
-    // Determine the number of bytes in the element's tag, if any.
-    uint8_t tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
-
-    // Extract the size of length/value field from the control byte.
-    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
-
     // Determine the number of bytes in the length/value field.
-    const uint8_t valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
-
-    // Determine the number of bytes in the element's 'head'. This includes: the control byte, the tag bytes (if present), the
-    // length bytes (if present), and for elements that don't have a length (e.g. integers), the value bytes.
-    const uint8_t elemHeadBytes = static_cast<uint8_t>(1 + tagBytes + valOrLenBytes);
+    const uint8_t valOrLenBytes = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
 
     // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
     uint8_t stagingBuf[17];
@@ -774,13 +872,24 @@ CHIP_ERROR TLVReader::ReadElement()
     // understand that ReadData initializes stagingBuf
     stagingBuf[1] = 0;
 
-    // If the head of the element goes past the end of the current input buffer,
-    // we need to read it into the staging buffer to parse it.  Just do that unconditionally,
-    // even if the head does not go past end of current buffer, to save codesize.
-    ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+    // Points just past the control byte, at the start of the tag field.
+    const uint8_t * p;
 
-    // +1 to skip over the control byte
-    const uint8_t * p = stagingBuf + 1;
+    if (static_cast<size_t>(mBufEnd - mReadPoint) >= elemHeadBytes)
+    {
+        // The whole head is in the current input buffer (always the case for well-formed
+        // contiguous buffers), so parse it in place instead of copying it out first.
+        p = mReadPoint + 1;
+        mReadPoint += elemHeadBytes;
+        mLenRead += elemHeadBytes;
+    }
+    else
+    {
+        // The head of the element goes past the end of the current input buffer, so
+        // read it into the staging buffer to parse it.
+        ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+        p = stagingBuf + 1;
+    }
 
     // Read the tag field, if present.
     mElemTag      = ReadTag(tagControl, p);
@@ -889,6 +998,19 @@ Tag TLVReader::ReadTag(TLVTagControl tagControl, const uint8_t *& p) const
 
 CHIP_ERROR TLVReader::ReadData(uint8_t * buf, uint32_t len)
 {
+    // Fast path: all of the requested data is available in the current input buffer, which
+    // avoids consulting the backing store entirely for contiguous buffers.
+    if (len > 0 && len <= static_cast<uint32_t>(mBufEnd - mReadPoint))
+    {
+        if (buf != nullptr)
+        {
+            memcpy(buf, mReadPoint, len);
+        }
+        mReadPoint += len;
+        mLenRead += len;
+        return CHIP_NO_ERROR;
+    }
+
     while (len > 0)
     {
         ReturnErrorOnFailure(EnsureData(CHIP_ERROR_TLV_UNDERRUN));
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdio>
 #include <stdint.h>
 #include <type_traits>
@@ -1212,6 +1213,29 @@ public:
      */
     uint32_t GetRemainingFreeLength() const { return mRemainingLen; }
 
+    /**
+     * Gets the point in the current output buffer where the writer will write its next byte.
+     *
+     * @return A pointer into the current output buffer that corresponds to the writer's current position.
+     */
+    const uint8_t * GetWritePoint() const { return mWritePoint; }
+
+    /**
+     * Returns the number of bytes that can still be written before the end of the current buffer,
+     * once the end of the containers that are open has been accounted for.
+     *
+     * @return the number of bytes that can still be written.
+     */
+    uint32_t GetRemainingWritableLength() const
+    {
+        return (mMaxLen > mLenWritten) ? std::min(mRemainingLen, mMaxLen - mLenWritten) : 0;
+    }
+
+    /**
+     * Get the TLVBackingStore used by this writer, or nullptr if it writes to a fixed buffer.
+     */
+    TLVBackingStore * GetBackingStore() const { return mBackingStore; }
+
     /**
      * @brief Returns true if this TLVWriter was properly initialized.
      */
@@ -1589,6 +1589,148 @@ TEST_F(TestTLV, CheckSimpleWriteRead)
     ReadEncoding1(reader);
 }
 
+/**
+ * A reader backing store that hands out its data one byte at a time, so that every
+ * element head straddles a buffer boundary.
+ */
+class ByteAtATimeBackingStore : public TLVBackingStore
+{
+public:
+    ByteAtATimeBackingStore(const uint8_t * data, uint32_t len) : mData(data), mLen(len) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mData;
+        bufLen   = (mLen > 0) ? 1 : 0;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufLen = (bufStart < mData + mLen) ? 1 : 0;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mData;
+    uint32_t mLen;
+};
+
+/**
+ *  Test reading when element heads are split across backing store buffers
+ */
+TEST_F(TestTLV, CheckSplitElementHeadRead)
+{
+    TLVReader reader;
+    ByteAtATimeBackingStore backingStore(Encoding1, sizeof(Encoding1));
+
+    EXPECT_EQ(reader.Init(backingStore, sizeof(Encoding1)), CHIP_NO_ERROR);
+    reader.ImplicitProfileId = TestProfile_2;
+
+    ReadEncoding1(reader);
+}
+
+/**
+ *  Test that skipping containers in a contiguous buffer leaves the reader where skipping them
+ *  element by element does
+ */
+TEST_F(TestTLV, CheckContiguousContainerSkip)
+{
+    TLVReader contiguousReader;
+    TLVReader reader;
+    ByteAtATimeBackingStore backingStore(Encoding1, sizeof(Encoding1));
+    TLVType outerContainerType;
+    CHIP_ERROR err;
+
+    contiguousReader.Init(Encoding1);
+    contiguousReader.ImplicitProfileId = TestProfile_2;
+    EXPECT_EQ(reader.Init(backingStore, sizeof(Encoding1)), CHIP_NO_ERROR);
+    reader.ImplicitProfileId = TestProfile_2;
+
+    EXPECT_EQ(contiguousReader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(contiguousReader.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+
+    // Read the elements of the outermost structure without entering the containers nested in it.
+    while ((err = contiguousReader.Next()) == CHIP_NO_ERROR)
+    {
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(contiguousReader.GetTag(), reader.GetTag());
+        EXPECT_EQ(contiguousReader.GetType(), reader.GetType());
+        EXPECT_EQ(contiguousReader.GetLengthRead(), reader.GetLengthRead());
+    }
+    EXPECT_EQ(err, CHIP_END_OF_TLV);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+
+    EXPECT_EQ(contiguousReader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(contiguousReader.GetLengthRead(), sizeof(Encoding1));
+    EXPECT_EQ(reader.GetLengthRead(), sizeof(Encoding1));
+
+    // Skipping the outermost structure as a whole reaches the end of the encoding too.
+    contiguousReader.Init(Encoding1);
+    EXPECT_EQ(contiguousReader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(contiguousReader.Next(), CHIP_END_OF_TLV);
+    EXPECT_EQ(contiguousReader.GetLengthRead(), sizeof(Encoding1));
+}
+
+/**
+ *  Test that skipping malformed containers in a contiguous buffer fails the way skipping them
+ *  element by element does
+ */
+TEST_F(TestTLV, CheckContiguousContainerSkipErrors)
+{
+    // clang-format off
+    // Outermost structure without an end of container
+    static const uint8_t kUnterminated[]         = { 0x15, 0x35, 0x01, 0x18 };
+    // Invalid element type in a nested structure
+    static const uint8_t kInvalidElementType[]   = { 0x15, 0x35, 0x01, 0x1F, 0x18, 0x18 };
+    // String longer than the encoding
+    static const uint8_t kStringTooLong[]        = { 0x15, 0x2C, 0x01, 0x10, 0x61, 0x18 };
+    // End of container with a context tag
+    static const uint8_t kTaggedEndOfContainer[] = { 0x15, 0x35, 0x01, 0x38, 0x01, 0x18 };
+    // Element head cut short by the end of the encoding
+    static const uint8_t kTruncatedHead[]        = { 0x15, 0x25, 0x01 };
+    // clang-format on
+
+    const struct
+    {
+        ByteSpan encoding;
+        CHIP_ERROR expectedError;
+    } testCases[] = {
+        { ByteSpan(kUnterminated), CHIP_END_OF_TLV },
+        { ByteSpan(kInvalidElementType), CHIP_ERROR_INVALID_TLV_ELEMENT },
+        { ByteSpan(kStringTooLong), CHIP_ERROR_TLV_UNDERRUN },
+        { ByteSpan(kTaggedEndOfContainer), CHIP_ERROR_INVALID_TLV_TAG },
+        { ByteSpan(kTruncatedHead), CHIP_ERROR_TLV_UNDERRUN },
+    };
+
+    for (const auto & testCase : testCases)
+    {
+        TLVReader contiguousReader;
+        contiguousReader.Init(testCase.encoding);
+        EXPECT_EQ(contiguousReader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(contiguousReader.Next(), testCase.expectedError);
+
+        TLVReader reader;
+        ByteAtATimeBackingStore backingStore(testCase.encoding.data(), static_cast<uint32_t>(testCase.encoding.size()));
+        EXPECT_EQ(reader.Init(backingStore, static_cast<uint32_t>(testCase.encoding.size())), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(), testCase.expectedError);
+    }
+}
+
 TEST_F(TestTLV, TestIntMinMax)
 {
     CHIP_ERROR err;
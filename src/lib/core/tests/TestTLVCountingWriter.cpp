@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVCommon.h>
+#include <lib/core/TLVCountingWriter.h>
+#include <lib/core/TLVTags.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+// Writes the same content to the given writer; used to compare the counted length with a real encoding.
+CHIP_ERROR WriteTestEncoding(TLVWriter & writer, size_t blobSize)
+{
+    static uint8_t sBlob[1000] = {};
+    VerifyOrReturnError(blobSize <= sizeof(sBlob), CHIP_ERROR_INVALID_ARGUMENT);
+
+    TLVType outerType;
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint8_t>(7)));
+    ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<uint64_t>(0x123456789ABCDEF0)));
+    ReturnErrorOnFailure(writer.PutString(ContextTag(3), "Hello, counting writer"));
+    ReturnErrorOnFailure(writer.Put(ContextTag(4), ByteSpan(sBlob, blobSize)));
+
+    TLVType innerType;
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(5), kTLVType_Array, innerType));
+    for (uint16_t i = 0; i < 50; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(AnonymousTag(), i));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(innerType));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    return writer.Finalize();
+}
+
+} // namespace
+
+TEST(TestTLVCountingWriter, EmptyWriterHasZeroLength)
+{
+    CountingTLVWriter writer;
+
+    EXPECT_EQ(writer.GetLengthWritten(), 0u);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.GetLengthWritten(), 0u);
+}
+
+TEST(TestTLVCountingWriter, CountMatchesRealEncoding)
+{
+    // Include blobs both smaller and larger than the scratch space of the counting writer.
+    for (size_t blobSize : { 0u, 10u, 127u, 128u, 129u, 1000u })
+    {
+        uint8_t buffer[2048];
+        TLVWriter realWriter;
+        realWriter.Init(buffer);
+        EXPECT_EQ(WriteTestEncoding(realWriter, blobSize), CHIP_NO_ERROR);
+
+        CountingTLVWriter countingWriter;
+        EXPECT_EQ(WriteTestEncoding(countingWriter, blobSize), CHIP_NO_ERROR);
+
+        EXPECT_EQ(countingWriter.GetLengthWritten(), realWriter.GetLengthWritten());
+    }
+}
+
+TEST(TestTLVCountingWriter, CheckpointAndRollback)
+{
+    CountingTLVWriter writer;
+
+    EXPECT_EQ(writer.Put(AnonymousTag(), true), CHIP_NO_ERROR);
+    uint32_t checkpointLength = writer.GetLengthWritten();
+
+    TLVWriter checkpoint = writer;
+    EXPECT_EQ(writer.PutString(AnonymousTag(), "some data that will be rolled back"), CHIP_NO_ERROR);
+    EXPECT_GT(writer.GetLengthWritten(), checkpointLength);
+
+    static_cast<TLVWriter &>(writer) = checkpoint;
+    EXPECT_EQ(writer.GetLengthWritten(), checkpointLength);
+}
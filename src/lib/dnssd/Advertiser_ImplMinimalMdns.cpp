@@ -27,6 +27,7 @@
 #include <crypto/RandUtils.h>
 #include <lib/dnssd/Advertiser_ImplMinimalMdnsAllocator.h>
 #include <lib/dnssd/minimal_mdns/AddressPolicy.h>
+#include <lib/dnssd/minimal_mdns/KnownAnswers.h>
 #include <lib/dnssd/minimal_mdns/ResponseSender.h>
 #include <lib/dnssd/minimal_mdns/Server.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
@@ -319,6 +320,7 @@ private:
     // current request handling
     const chip::Inet::IPPacketInfo * mCurrentSource = nullptr;
     uint16_t mMessageId                             = 0;
+    KnownAnswers mCurrentKnownAnswers;
 
     const char * mEmptyTextEntries[1] = {
         "=",
@@ -334,10 +336,13 @@ void AdvertiserMinMdns::OnMdnsPacketData(const BytesRange & data, const chip::In
 #endif
 
     mCurrentSource = info;
+    // Queries with invalid known answers are still answered, just without known answer suppression.
+    mCurrentKnownAnswers.Parse(data);
     if (!ParsePacket(data, this))
     {
         ChipLogError(Discovery, "Failed to parse mDNS query");
     }
+    mCurrentKnownAnswers.Clear();
     mCurrentSource = nullptr;
 }
 
@@ -352,7 +357,8 @@ void AdvertiserMinMdns::OnQuery(const QueryData & data)
     LogQuery(data);
 
     const ResponseConfiguration defaultResponseConfiguration;
-    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource, defaultResponseConfiguration);
+    CHIP_ERROR err =
+        mResponseSender.Respond(mMessageId, data, mCurrentSource, defaultResponseConfiguration, &mCurrentKnownAnswers);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Discovery, "Failed to reply to query: %" CHIP_ERROR_FORMAT, err.Format());
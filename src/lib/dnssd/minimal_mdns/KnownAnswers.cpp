@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "KnownAnswers.h"
+
+#include "Parser.h"
+
+#include <lib/support/CodeUtils.h>
+
+namespace mdns {
+namespace Minimal {
+
+bool KnownAnswers::Parse(const BytesRange & packet)
+{
+    Clear();
+
+    VerifyOrReturnValue(packet.Size() >= static_cast<ptrdiff_t>(HeaderRef::kSizeBytes), false);
+
+    // header is used as const, so cast is safe
+    ConstHeaderRef header(packet.Start());
+    const uint8_t * data = packet.Start() + HeaderRef::kSizeBytes;
+
+    QueryData queryData;
+    for (uint16_t i = 0; i < header.GetQueryCount(); i++)
+    {
+        VerifyOrReturnValue(queryData.Parse(packet, &data), false);
+    }
+
+    mPacket      = packet;
+    mAnswers     = data;
+    mAnswerCount = header.GetAnswerCount();
+
+    return true;
+}
+
+bool KnownAnswers::Contains(const ResourceRecord & record) const
+{
+    const uint8_t * data = mAnswers;
+    ResourceData answer;
+
+    for (uint16_t i = 0; i < mAnswerCount; i++)
+    {
+        VerifyOrReturnValue(answer.Parse(mPacket, &data), false);
+
+        if (answer.GetType() != record.GetType())
+        {
+            continue;
+        }
+
+        if ((static_cast<uint16_t>(answer.GetClass()) & ~kQClassResponseFlushBit) !=
+            (static_cast<uint16_t>(record.GetClass()) & ~kQClassResponseFlushBit))
+        {
+            continue;
+        }
+
+        // A known answer with less than half of the TTL left is about to expire from the
+        // querier cache and still has to be sent (RFC 6762 section 7.1)
+        if (answer.GetTtlSeconds() * 2 < record.GetTtl())
+        {
+            continue;
+        }
+
+        if ((answer.GetName() == record.GetName()) && record.MatchesData(mPacket, answer.GetData()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace Minimal
+} // namespace mdns
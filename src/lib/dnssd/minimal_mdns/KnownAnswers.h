@@ -0,0 +1,57 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/dnssd/minimal_mdns/core/BytesRange.h>
+#include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Answers that a querier listed in its query as already known
+/// (https://datatracker.ietf.org/doc/html/rfc6762#section-7.1).
+///
+/// Only references the packet data, so it is only valid while the
+/// query packet is being processed.
+class KnownAnswers
+{
+public:
+    /// Locates the known answers in the given query packet.
+    ///
+    /// returns true on parse success, false on failure (in which case no answers are known).
+    bool Parse(const BytesRange & packet);
+
+    void Clear()
+    {
+        mPacket      = BytesRange();
+        mAnswers     = nullptr;
+        mAnswerCount = 0;
+    }
+
+    /// Checks if the querier already has the given record, with at least half of
+    /// its TTL remaining. Such records must not be sent again.
+    bool Contains(const ResourceRecord & record) const;
+
+private:
+    BytesRange mPacket;
+    const uint8_t * mAnswers = nullptr; // start of the answer section
+    uint16_t mAnswerCount    = 0;
+};
+
+} // namespace Minimal
+} // namespace mdns
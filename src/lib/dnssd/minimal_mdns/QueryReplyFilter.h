@@ -29,7 +29,7 @@ namespace Minimal {
 class QueryReplyFilter : public ReplyFilter
 {
 public:
-    QueryReplyFilter(const QueryData & queryData) : mQueryData(queryData) {}
+    QueryReplyFilter(const QueryData & queryData) : mQueryData(queryData), mQueryNameHash(HashQName(queryData.GetName())) {}
 
     bool Accept(QType qType, QClass qClass, FullQName qname) override
     {
@@ -46,6 +46,16 @@ public:
         return AcceptablePath(qname);
     }
 
+    bool AcceptNameHash(uint32_t qnameHash) override
+    {
+        if (mIgnoreNameMatch || mQueryData.IsAnnounceBroadcast())
+        {
+            return true;
+        }
+
+        return qnameHash == mQueryNameHash;
+    }
+
     /// Ignore qname matches during Accept calls (if set to true, only qtype and qclass are matched).
     ///
     /// Ignoring qname is useful when sending related data replies: cliens often query for PTR
@@ -90,6 +100,7 @@ private:
     }
 
     const QueryData & mQueryData;
+    const uint32_t mQueryNameHash;
     bool mIgnoreNameMatch        = false;
     bool mSendingAdditionalItems = false;
 };
@@ -103,9 +103,9 @@ bool ResponseSender::HasQueryResponders() const
 }
 
 CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
-                                   const ResponseConfiguration & configuration)
+                                   const ResponseConfiguration & configuration, const KnownAnswers * knownAnswers)
 {
-    mSendState.Reset(messageId, query, querySource);
+    mSendState.Reset(messageId, query, querySource, knownAnswers);
 
     if (query.IsAnnounceBroadcast())
     {
@@ -151,9 +151,18 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             }
             for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
             {
+                const size_t recordsAdded        = mSendState.GetRecordsAdded();
+                const size_t knownAnswersSkipped = mSendState.GetKnownAnswersSkipped();
+
                 it->responder->AddAllResponses(querySource, this, configuration);
                 ReturnErrorOnFailure(mSendState.GetError());
 
+                if ((mSendState.GetRecordsAdded() == recordsAdded) && (mSendState.GetKnownAnswersSkipped() != knownAnswersSkipped))
+                {
+                    // The querier already has all the answers, so it has no use for additional data about them either.
+                    continue;
+                }
+
                 responder->MarkAdditionalRepliesFor(it);
 
                 if (!mSendState.SendUnicast())
@@ -288,6 +297,12 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
 {
     ReturnOnFailure(mSendState.GetError());
 
+    if (mSendState.IsKnownAnswer(record))
+    {
+        mSendState.MarkKnownAnswerSkipped();
+        return;
+    }
+
     if (!mResponseBuilder.HasPacketBuffer())
     {
         mSendState.SetError(PrepareNewReplyPacket());
@@ -318,8 +333,11 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
             // Very much unexpected: single record addition should fit (our records should not be that big).
             ChipLogError(Discovery, "Failed to add single record to mDNS response.");
             mSendState.SetError(CHIP_ERROR_INTERNAL);
+            return;
         }
     }
+
+    mSendState.MarkRecordAdded();
 }
 
 } // namespace Minimal
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "KnownAnswers.h"
 #include "Parser.h"
 #include "ResponseBuilder.h"
 #include "Server.h"
@@ -71,13 +72,17 @@ class ResponseSendingState
 public:
     ResponseSendingState() {}
 
-    void Reset(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * packet)
+    void Reset(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * packet,
+               const KnownAnswers * knownAnswers)
     {
-        mMessageId    = messageId;
-        mQuery        = &query;
-        mSource       = packet;
-        mSendError    = CHIP_NO_ERROR;
-        mResourceType = ResourceType::kAnswer;
+        mMessageId           = messageId;
+        mQuery               = &query;
+        mSource              = packet;
+        mKnownAnswers        = knownAnswers;
+        mSendError           = CHIP_NO_ERROR;
+        mResourceType        = ResourceType::kAnswer;
+        mRecordsAdded        = 0;
+        mKnownAnswersSkipped = 0;
         mSentItems.ClearAll();
     }
 
@@ -110,9 +115,24 @@ public:
     bool GetWasSent(ResponseItemsSent item) const { return mSentItems.Has(item); }
     void MarkWasSent(ResponseItemsSent item) { mSentItems.Set(item); }
 
+    /// Check if the querier listed the given record as a known answer, in which case it should not be sent.
+    bool IsKnownAnswer(const ResourceRecord & record) const
+    {
+        return (mKnownAnswers != nullptr) && mKnownAnswers->Contains(record);
+    }
+
+    void MarkRecordAdded() { mRecordsAdded++; }
+    size_t GetRecordsAdded() const { return mRecordsAdded; }
+
+    void MarkKnownAnswerSkipped() { mKnownAnswersSkipped++; }
+    size_t GetKnownAnswersSkipped() const { return mKnownAnswersSkipped; }
+
 private:
     const QueryData * mQuery                 = nullptr;               // query being replied to
     const chip::Inet::IPPacketInfo * mSource = nullptr;               // Where to send the reply (if unicast)
+    const KnownAnswers * mKnownAnswers       = nullptr;               // answers the querier already has (optional)
+    size_t mRecordsAdded                     = 0;                     // records added to the reply so far
+    size_t mKnownAnswersSkipped              = 0;                     // known answers left out of the reply so far
     uint16_t mMessageId                      = 0;                     // message id for the reply
     ResourceType mResourceType               = ResourceType::kAnswer; // what is being sent right now
     CHIP_ERROR mSendError                    = CHIP_NO_ERROR;
@@ -135,8 +155,10 @@ public:
     bool HasQueryResponders() const;
 
     /// Send back the response to a particular query
+    ///
+    /// Records listed in [knownAnswers], if provided, are not sent back.
     CHIP_ERROR Respond(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
-                       const ResponseConfiguration & configuration);
+                       const ResponseConfiguration & configuration, const KnownAnswers * knownAnswers = nullptr);
 
     // Implementation of ResponderDelegate
     void AddResponse(const ResourceRecord & record) override;
@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 #include <assert.h>
+#include <ctype.h>
 #include <strings.h>
 
 #include "QName.h"
@@ -22,6 +23,25 @@
 namespace mdns {
 namespace Minimal {
 
+namespace {
+
+// 32-bit FNV-1a
+constexpr uint32_t kQNameHashOffsetBasis = 2166136261u;
+constexpr uint32_t kQNameHashPrime       = 16777619u;
+
+uint32_t HashQNamePart(uint32_t hash, QNamePart part)
+{
+    for (const char * c = part; *c != '\0'; c++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(tolower(static_cast<unsigned char>(*c)))) * kQNameHashPrime;
+    }
+
+    // Separate labels, so that moving characters from one label to the next changes the hash
+    return (hash ^ '.') * kQNameHashPrime;
+}
+
+} // namespace
+
 bool SerializedQNameIterator::Next()
 {
     return mIsValid && Next(true);
@@ -194,6 +214,26 @@ bool SerializedQNameIterator::operator==(const SerializedQNameIterator & other)
     return a.IsValid() && b.IsValid();
 }
 
+uint32_t HashQName(const FullQName & name)
+{
+    uint32_t hash = kQNameHashOffsetBasis;
+    for (size_t i = 0; i < name.nameCount; i++)
+    {
+        hash = HashQNamePart(hash, name.names[i]);
+    }
+    return hash;
+}
+
+uint32_t HashQName(SerializedQNameIterator name)
+{
+    uint32_t hash = kQNameHashOffsetBasis;
+    while (name.Next())
+    {
+        hash = HashQNamePart(hash, name.Value());
+    }
+    return hash;
+}
+
 bool FullQName::operator==(const FullQName & other) const
 {
     if (nameCount != other.nameCount)
@@ -117,5 +117,12 @@ private:
     bool Next(bool followIndirectPointers);
 };
 
+/// Computes a case insensitive hash of a QName.
+///
+/// QNames that compare equal have the same hash, so comparing hashes is a cheap way
+/// to rule out most names before doing a full label by label comparison.
+uint32_t HashQName(const FullQName & name);
+uint32_t HashQName(SerializedQNameIterator name);
+
 } // namespace Minimal
 } // namespace mdns
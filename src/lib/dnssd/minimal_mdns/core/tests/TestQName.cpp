@@ -271,6 +271,21 @@ TEST(TestQName, CaseInsensitiveFullQNameCompare)
     }
 }
 
+TEST(TestQName, Hash)
+{
+    const QNamePart kName[]            = { "some", "test", "local" };
+    const QNamePart kNameUpper[]       = { "SOME", "Test", "LOCAL" };
+    const QNamePart kOtherName[]       = { "some", "other", "local" };
+    const QNamePart kMovedLabel[]      = { "somet", "est", "local" };
+    static const uint8_t kSerialized[] = "\04SoMe\04TEST\05local\00";
+
+    EXPECT_EQ(HashQName(FullQName(kName)), HashQName(FullQName(kNameUpper)));
+    EXPECT_EQ(HashQName(FullQName(kName)), HashQName(AsSerializedQName(kSerialized)));
+
+    EXPECT_NE(HashQName(FullQName(kName)), HashQName(FullQName(kOtherName)));
+    EXPECT_NE(HashQName(FullQName(kName)), HashQName(FullQName(kMovedLabel)));
+}
+
 TEST(TestQName, SerializedCompare)
 {
     static const uint8_t kThisIsATest1[]    = "\04this\02is\01a\04test\00";
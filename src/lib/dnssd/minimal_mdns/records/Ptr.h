@@ -29,6 +29,11 @@ public:
 
     const FullQName & GetPtr() const { return mPtrName; }
 
+    bool MatchesData(const BytesRange & validData, const BytesRange & data) const override
+    {
+        return (data.Size() > 0) && (SerializedQNameIterator(validData, data.Start()) == mPtrName);
+    }
+
 protected:
     bool WriteData(RecordWriter & out) const override { return out.WriteQName(mPtrName).Fit(); }
 
@@ -60,6 +60,13 @@ public:
     /// Updates header item count on success, does NOT update header on failure.
     bool Append(HeaderRef & hdr, ResourceType asType, RecordWriter & out) const;
 
+    /// Checks if [data] is the serialized data portion of this record.
+    ///
+    /// [data] is part of [validData], which names within the data may point into.
+    /// Used to find records in the known answers of a query. Records that do not
+    /// override this are never considered known.
+    virtual bool MatchesData(const BytesRange & validData, const BytesRange & data) const { return false; }
+
 protected:
     /// Output the data portion of the resource record.
     virtual bool WriteData(RecordWriter & out) const = 0;
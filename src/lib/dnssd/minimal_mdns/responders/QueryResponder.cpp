@@ -42,6 +42,7 @@ void QueryResponderBase::Init()
     {
         // reply to queries about services available
         mResponderInfos[0].responder = this;
+        mResponderInfos[0].qnameHash = HashQName(GetQName());
     }
 
     if (mResponderInfoSize < 2)
@@ -65,6 +66,7 @@ QueryResponderSettings QueryResponderBase::AddResponder(RecordResponder * respon
         {
             mResponderInfos[i].Clear();
             mResponderInfos[i].responder = responder;
+            mResponderInfos[i].qnameHash = HashQName(responder->GetQName());
 
             return QueryResponderSettings(&mResponderInfos[i]);
         }
@@ -82,6 +84,11 @@ void QueryResponderBase::ResetAdditionals()
 }
 
 size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
+{
+    return MarkAdditional(qname, HashQName(qname));
+}
+
+size_t QueryResponderBase::MarkAdditional(const FullQName & qname, uint32_t qnameHash)
 {
     size_t count = 0;
     for (size_t i = 0; i < mResponderInfoSize; i++)
@@ -96,7 +103,7 @@ size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
             continue; // already marked
         }
 
-        if (mResponderInfos[i].responder->GetQName() == qname)
+        if ((mResponderInfos[i].qnameHash == qnameHash) && (mResponderInfos[i].responder->GetQName() == qname))
         {
             mResponderInfos[i].reportNowAsAdditional = true;
             count++;
@@ -115,7 +122,7 @@ void QueryResponderBase::MarkAdditionalRepliesFor(QueryResponderIterator it)
         return; // nothing additional to report
     }
 
-    if (MarkAdditional(info->additionalQName) == 0)
+    if (MarkAdditional(info->additionalQName, info->additionalQNameHash) == 0)
     {
         return; // nothing additional added
     }
@@ -133,7 +140,8 @@ void QueryResponderBase::MarkAdditionalRepliesFor(QueryResponderIterator it)
         {
             if (ait.GetInternal()->alsoReportAdditionalQName)
             {
-                keepAdding = keepAdding || (MarkAdditional(ait.GetInternal()->additionalQName) != 0);
+                keepAdding = keepAdding ||
+                    (MarkAdditional(ait.GetInternal()->additionalQName, ait.GetInternal()->additionalQNameHash) != 0);
             }
         }
     }
@@ -40,9 +40,11 @@ namespace Internal {
 struct QueryResponderInfo : public QueryResponderRecord
 {
     bool reportNowAsAdditional; // report as additional data required
+    uint32_t qnameHash = 0;     // HashQName of the responder name
 
     bool alsoReportAdditionalQName = false; // report more data when this record is listed
     FullQName additionalQName;              // if alsoReportAdditionalQName is set, send this extra data
+    uint32_t additionalQNameHash = 0;       // HashQName of additionalQName
 
     void Clear()
     {
@@ -84,6 +86,7 @@ public:
         {
             mInfo->alsoReportAdditionalQName = true;
             mInfo->additionalQName           = qname;
+            mInfo->additionalQNameHash       = HashQName(qname);
         }
         return *this;
     }
@@ -147,7 +150,8 @@ public:
         }
 
         if ((mReplyFilter != nullptr) &&
-            !mReplyFilter->Accept(record->responder->GetQType(), record->responder->GetQClass(), record->responder->GetQName()))
+            (!mReplyFilter->AcceptNameHash(record->qnameHash) ||
+             !mReplyFilter->Accept(record->responder->GetQType(), record->responder->GetQClass(), record->responder->GetQName())))
         {
             return false;
         }
@@ -276,6 +280,8 @@ public:
     void ClearBroadcastThrottle();
 
 private:
+    size_t MarkAdditional(const FullQName & qname, uint32_t qnameHash);
+
     Internal::QueryResponderInfo * mResponderInfos;
     size_t mResponderInfoSize;
 };
@@ -31,6 +31,12 @@ public:
 
     /// Returns true if specified answer should be sent back as a reply
     virtual bool Accept(QType qType, QClass qClass, FullQName qname) = 0;
+
+    /// Quick check done before Accept when the HashQName of the answer name is known.
+    ///
+    /// Returns false if no answer with a name of the given hash can be accepted. Filters
+    /// that do not match names, or cannot tell from the hash, should return true.
+    virtual bool AcceptNameHash(uint32_t qnameHash) { return true; }
 };
 
 } // namespace Minimal
@@ -23,6 +23,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/KnownAnswers.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
 #include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
@@ -84,6 +85,34 @@ struct CommonTestElements
     }
 };
 
+// A PTR query for `service` listing a PTR record to `instance` as a known answer.
+struct KnownAnswerQuery
+{
+    uint8_t storage[128];
+    HeaderRef header                               = HeaderRef(storage);
+    Encoding::BigEndian::BufferWriter bufferWriter = Encoding::BigEndian::BufferWriter(storage, sizeof(storage));
+    RecordWriter recordWriter                      = RecordWriter(&bufferWriter);
+    BytesRange packet;
+
+    KnownAnswerQuery(const FullQName & service, const FullQName & instance, uint32_t knownAnswerTtl)
+    {
+        header.Clear();
+        header.SetQueryCount(1);
+        bufferWriter.Skip(HeaderRef::kSizeBytes);
+
+        recordWriter.WriteQName(service).Put16(static_cast<uint16_t>(QType::PTR)).Put16(static_cast<uint16_t>(QClass::IN));
+
+        PtrResourceRecord knownAnswer(service, instance);
+        knownAnswer.SetTtl(knownAnswerTtl);
+        EXPECT_TRUE(knownAnswer.Append(header, ResourceType::kAnswer, recordWriter));
+        EXPECT_TRUE(recordWriter.Fit());
+
+        packet = BytesRange(storage, storage + bufferWriter.Needed());
+    }
+
+    QueryData Query() const { return QueryData(QType::PTR, QClass::IN, false, storage + HeaderRef::kSizeBytes, packet); }
+};
+
 class TestResponseSender : public ::testing::Test
 {
 public:
@@ -350,4 +379,53 @@ TEST_F(TestResponseSender, PtrSrvTxtMultipleRespondersToServiceListing)
     EXPECT_TRUE(common1->server.GetHeaderFound());
 }
 
+TEST_F(TestResponseSender, KnownAnswerSuppression)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    KnownAnswerQuery query(common.service, common.instance, ResourceRecord::kDefaultTtl);
+    QueryData queryData = query.Query();
+
+    KnownAnswers knownAnswers;
+    ASSERT_TRUE(knownAnswers.Parse(query.packet));
+    EXPECT_TRUE(knownAnswers.Contains(common.ptrRecord));
+    EXPECT_FALSE(knownAnswers.Contains(common.srvRecord));
+
+    // The querier already has the only answer: nothing is sent, not even the additional SRV and TXT records.
+    responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration(), &knownAnswers);
+    EXPECT_FALSE(common.server.GetSendCalled());
+}
+
+TEST_F(TestResponseSender, KnownAnswerCloseToExpiry)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    // Less than half of the TTL left in the querier cache: the record must be refreshed.
+    KnownAnswerQuery query(common.service, common.instance, ResourceRecord::kDefaultTtl / 2 - 1);
+    QueryData queryData = query.Query();
+
+    KnownAnswers knownAnswers;
+    ASSERT_TRUE(knownAnswers.Parse(query.packet));
+    EXPECT_FALSE(knownAnswers.Contains(common.ptrRecord));
+
+    common.server.AddExpectedRecord(&common.ptrRecord);
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+
+    responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration(), &knownAnswers);
+
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+}
+
 } // namespace
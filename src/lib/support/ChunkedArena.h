@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+/**
+ * Bump allocator for objects that share one lifetime, over chunks allocated from the CHIP heap.
+ *
+ * Objects are placed one after the other in the current chunk, and a new chunk is allocated once it is full. The first
+ * chunk only holds the first object, and each following chunk doubles the size of the previous one, up to kChunkSize
+ * bytes: a list of one object costs a single allocation of about its size, and building a list of N small objects takes
+ * about log2(kChunkSize / size) + N * size / kChunkSize heap allocations instead of N. Objects cannot be freed
+ * individually. Release() frees all the chunks at once, without running destructors, so only trivially destructible
+ * types can be allocated.
+ */
+template <size_t kChunkSize>
+class ChunkedArena
+{
+public:
+    static_assert(kChunkSize <= UINT16_MAX, "Chunk sizes are stored in 16 bits");
+
+    ChunkedArena() = default;
+    ~ChunkedArena() { Release(); }
+
+    ChunkedArena(const ChunkedArena &)             = delete;
+    ChunkedArena & operator=(const ChunkedArena &) = delete;
+
+    /// Construct a T in the arena. Returns nullptr if a new chunk was needed and could not be allocated.
+    template <typename T, typename... Args>
+    T * New(Args &&... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena objects are released without running their destructor");
+        static_assert(sizeof(T) <= kChunkSize, "Object does not fit in an arena chunk");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned objects are not supported");
+
+        void * memory = Allocate(sizeof(T), alignof(T));
+        VerifyOrReturnValue(memory != nullptr, nullptr);
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /// Free all the objects of the arena.
+    void Release()
+    {
+        while (mpChunks != nullptr)
+        {
+            Chunk * next = mpChunks->mpNext;
+            Platform::MemoryFree(mpChunks);
+            mpChunks = next;
+        }
+    }
+
+    /// Number of chunks, i.e. of heap allocations, currently held by the arena.
+    size_t ChunkCount() const
+    {
+        size_t count = 0;
+        for (const Chunk * chunk = mpChunks; chunk != nullptr; chunk = chunk->mpNext)
+        {
+            count++;
+        }
+        return count;
+    }
+
+    /// Number of bytes, chunk headers included, currently allocated from the heap by the arena.
+    size_t AllocatedSize() const
+    {
+        size_t size = 0;
+        for (const Chunk * chunk = mpChunks; chunk != nullptr; chunk = chunk->mpNext)
+        {
+            size += sizeof(Chunk) + chunk->mSize;
+        }
+        return size;
+    }
+
+private:
+    // Followed by the mSize bytes of the chunk; its alignment keeps them aligned for any object.
+    struct alignas(std::max_align_t) Chunk
+    {
+        Chunk * mpNext;
+        uint16_t mUsed;
+        uint16_t mSize;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+    };
+
+    void * Allocate(size_t size, size_t alignment)
+    {
+        size_t chunkSize = size;
+        if (mpChunks != nullptr)
+        {
+            size_t offset = (mpChunks->mUsed + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= mpChunks->mSize)
+            {
+                mpChunks->mUsed = static_cast<uint16_t>(offset + size);
+                return mpChunks->Data() + offset;
+            }
+            chunkSize = std::max(size, std::min(2 * static_cast<size_t>(mpChunks->mSize), kChunkSize));
+        }
+
+        void * memory = Platform::MemoryAlloc(sizeof(Chunk) + chunkSize);
+        VerifyOrReturnValue(memory != nullptr, nullptr);
+        Chunk * chunk = new (memory) Chunk;
+        chunk->mpNext = mpChunks;
+        chunk->mUsed  = static_cast<uint16_t>(size);
+        chunk->mSize  = static_cast<uint16_t>(chunkSize);
+        mpChunks      = chunk;
+        return chunk->Data();
+    }
+
+    // Only the head of the chunk list is kept, so that an unused arena costs a single pointer.
+    Chunk * mpChunks = nullptr;
+};
+
+} // namespace chip
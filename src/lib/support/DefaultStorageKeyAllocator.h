@@ -265,6 +265,9 @@ public:
     // Terms and Conditions Acceptance Key
     // Stores the terms and conditions acceptance including terms and conditions revision, TLV encoded
     static StorageKeyName TermsAndConditionsAcceptance() { return StorageKeyName::FromConst("g/tc"); }
+
+    // Unit Testing cluster: prefix of the PersistentList keys of the ListFabricScoped attribute.
+    static StorageKeyName UnitTestingListFabricScoped() { return StorageKeyName::FromConst("g/ut/lfs"); }
 };
 
 } // namespace chip
@@ -0,0 +1,572 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Fixed-capacity hash maps and sets, that never allocate.
+ *
+ *      These use open addressing with linear probing over a power-of-2 table sized at compile time so that it is at most
+ *      3/4 full. Removal shifts the following entries back instead of leaving tombstones, so lookup cost does not degrade
+ *      as entries are added and removed.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+
+#include <iterator>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+/// Default hash for the keys of fixed-capacity hash containers: integers and enums. Other key types (e.g. structs of
+/// ids) need a hash functor of their own, returning a size_t that is well mixed in its low bits.
+template <typename Key>
+struct FixedContainerHash
+{
+    static_assert(std::is_integral<Key>::value || std::is_enum<Key>::value, "Provide a hash functor for this key type");
+
+    size_t operator()(Key key) const
+    {
+        // Ids are often small consecutive numbers, or share their low bits: mix them before the table takes its low bits.
+        uint64_t hash = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+};
+
+namespace internal {
+
+/// Number of buckets of a hash table holding up to `capacity` entries: the smallest power of 2 that is at most 3/4 full.
+constexpr size_t FixedHashBucketCount(size_t capacity)
+{
+    size_t buckets = 2;
+    while (buckets - buckets / 4 < capacity)
+    {
+        buckets *= 2;
+    }
+    return buckets;
+}
+
+/// Open-addressing table of `Entry` objects, each holding its key (as returned by `KeyOf`), constructed in place.
+template <typename Entry, typename Key, typename KeyOf, typename Hash, size_t kCapacity>
+class FixedHashTable
+{
+public:
+    static_assert(kCapacity > 0, "Hash table capacity must not be 0");
+
+    static constexpr size_t kBucketCount = FixedHashBucketCount(kCapacity);
+
+    template <typename TableType, typename EntryType>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::remove_const_t<EntryType>;
+        using difference_type   = ptrdiff_t;
+        using pointer           = EntryType *;
+        using reference         = EntryType &;
+
+        Iterator(TableType * table, size_t bucket) : mTable(table), mBucket(bucket) { SkipEmpty(); }
+
+        EntryType & operator*() const { return *mTable->At(mBucket); }
+        EntryType * operator->() const { return mTable->At(mBucket); }
+        Iterator & operator++()
+        {
+            mBucket++;
+            SkipEmpty();
+            return *this;
+        }
+        bool operator==(const Iterator & other) const { return mBucket == other.mBucket; }
+        bool operator!=(const Iterator & other) const { return mBucket != other.mBucket; }
+
+    private:
+        void SkipEmpty()
+        {
+            while (mBucket < kBucketCount && !mTable->mOccupied[mBucket])
+            {
+                mBucket++;
+            }
+        }
+
+        TableType * mTable;
+        size_t mBucket;
+    };
+
+    using iterator       = Iterator<FixedHashTable, Entry>;
+    using const_iterator = Iterator<const FixedHashTable, const Entry>;
+
+    FixedHashTable() = default;
+    FixedHashTable(const FixedHashTable & other) { CopyFrom(other); }
+    FixedHashTable & operator=(const FixedHashTable & other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+    ~FixedHashTable() { Clear(); }
+
+    static constexpr size_t Capacity() { return kCapacity; }
+    size_t Size() const { return mSize; }
+    bool Empty() const { return mSize == 0; }
+    bool Full() const { return mSize == kCapacity; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, kBucketCount); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, kBucketCount); }
+
+    Entry * Find(const Key & key)
+    {
+        size_t bucket = FindBucket(key);
+        return bucket < kBucketCount ? At(bucket) : nullptr;
+    }
+    const Entry * Find(const Key & key) const { return const_cast<FixedHashTable *>(this)->Find(key); }
+
+    /// Returns the entry for `key`, constructing it from `key` and `args` if there is none. `inserted` tells whether it
+    /// was constructed. Returns nullptr if the table is full.
+    template <typename... Args>
+    Entry * Emplace(bool & inserted, const Key & key, Args &&... args)
+    {
+        inserted      = false;
+        size_t bucket = HomeBucket(key);
+        for (; mOccupied[bucket]; bucket = Next(bucket))
+        {
+            if (KeyOf()(*At(bucket)) == key)
+            {
+                return At(bucket);
+            }
+        }
+        VerifyOrReturnValue(!Full(), nullptr);
+
+        Entry * entry     = new (mStorage[bucket]) Entry(key, std::forward<Args>(args)...);
+        mOccupied[bucket] = true;
+        mSize++;
+        inserted = true;
+        return entry;
+    }
+
+    bool Erase(const Key & key)
+    {
+        size_t hole = FindBucket(key);
+        VerifyOrReturnValue(hole < kBucketCount, false);
+
+        // Shift back the entries that follow in the same run, unless that would move them before their own bucket, so
+        // that every entry stays reachable by probing forward from its bucket.
+        for (size_t next = Next(hole); mOccupied[next]; next = Next(next))
+        {
+            size_t home = HomeBucket(KeyOf()(*At(next)));
+            if (((next - home) & (kBucketCount - 1)) >= ((next - hole) & (kBucketCount - 1)))
+            {
+                *At(hole) = std::move(*At(next));
+                hole      = next;
+            }
+        }
+
+        At(hole)->~Entry();
+        mOccupied[hole] = false;
+        mSize--;
+        return true;
+    }
+
+    void Clear()
+    {
+        for (size_t bucket = 0; bucket < kBucketCount && mSize > 0; bucket++)
+        {
+            if (mOccupied[bucket])
+            {
+                At(bucket)->~Entry();
+                mOccupied[bucket] = false;
+                mSize--;
+            }
+        }
+    }
+
+private:
+    static size_t HomeBucket(const Key & key) { return Hash()(key) & (kBucketCount - 1); }
+    static size_t Next(size_t bucket) { return (bucket + 1) & (kBucketCount - 1); }
+
+    Entry * At(size_t bucket) { return std::launder(reinterpret_cast<Entry *>(mStorage[bucket])); }
+    const Entry * At(size_t bucket) const { return std::launder(reinterpret_cast<const Entry *>(mStorage[bucket])); }
+
+    size_t FindBucket(const Key & key) const
+    {
+        for (size_t bucket = HomeBucket(key); mOccupied[bucket]; bucket = Next(bucket))
+        {
+            if (KeyOf()(*At(bucket)) == key)
+            {
+                return bucket;
+            }
+        }
+        return kBucketCount;
+    }
+
+    void CopyFrom(const FixedHashTable & other)
+    {
+        for (size_t bucket = 0; bucket < kBucketCount; bucket++)
+        {
+            if (other.mOccupied[bucket])
+            {
+                new (mStorage[bucket]) Entry(*other.At(bucket));
+                mOccupied[bucket] = true;
+            }
+        }
+        mSize = other.mSize;
+    }
+
+    alignas(Entry) unsigned char mStorage[kBucketCount][sizeof(Entry)];
+    bool mOccupied[kBucketCount] = {};
+    size_t mSize                 = 0;
+};
+
+template <typename Key, typename Value>
+struct FixedHashMapEntry
+{
+    template <typename... Args>
+    FixedHashMapEntry(const Key & aKey, Args &&... args) : key(aKey), value(std::forward<Args>(args)...)
+    {}
+
+    Key key;
+    Value value;
+};
+
+template <typename Key, typename Value>
+struct FixedHashMapKeyOf
+{
+    const Key & operator()(const FixedHashMapEntry<Key, Value> & entry) const { return entry.key; }
+};
+
+template <typename Key>
+struct FixedHashSetKeyOf
+{
+    const Key & operator()(const Key & key) const { return key; }
+};
+
+} // namespace internal
+
+/**
+ * @brief
+ *   Hash map holding up to kCapacity entries in place.
+ *
+ * Iterating yields entries with `key` and `value` members, in no particular order. Inserting an entry does not move the
+ * others, but erasing one may move entries of the same probe run: use StableFixedHashMap when pointers to entries must
+ * survive the removal of other entries.
+ */
+template <typename Key, typename Value, size_t kCapacity, typename Hash = FixedContainerHash<Key>>
+class FixedHashMap
+{
+public:
+    using Entry          = internal::FixedHashMapEntry<Key, Value>;
+    using Table          = internal::FixedHashTable<Entry, Key, internal::FixedHashMapKeyOf<Key, Value>, Hash, kCapacity>;
+    using iterator       = typename Table::iterator;
+    using const_iterator = typename Table::const_iterator;
+
+    static constexpr size_t kBucketCount = Table::kBucketCount;
+
+    static constexpr size_t Capacity() { return kCapacity; }
+    size_t Size() const { return mTable.Size(); }
+    bool Empty() const { return mTable.Empty(); }
+    bool Full() const { return mTable.Full(); }
+
+    iterator begin() { return mTable.begin(); }
+    iterator end() { return mTable.end(); }
+    const_iterator begin() const { return mTable.begin(); }
+    const_iterator end() const { return mTable.end(); }
+
+    /// Get the value for `key`, or nullptr.
+    Value * Find(const Key & key)
+    {
+        Entry * entry = mTable.Find(key);
+        return entry != nullptr ? &entry->value : nullptr;
+    }
+    const Value * Find(const Key & key) const
+    {
+        const Entry * entry = mTable.Find(key);
+        return entry != nullptr ? &entry->value : nullptr;
+    }
+    bool Contains(const Key & key) const { return mTable.Find(key) != nullptr; }
+
+    /// Get the value for `key`, constructing it from `args` if there is none. Returns nullptr if the map is full.
+    template <typename... Args>
+    Value * Emplace(const Key & key, Args &&... args)
+    {
+        bool inserted;
+        Entry * entry = mTable.Emplace(inserted, key, std::forward<Args>(args)...);
+        return entry != nullptr ? &entry->value : nullptr;
+    }
+
+    /// Set the value for `key`. Returns nullptr if the map is full.
+    Value * Insert(const Key & key, const Value & value)
+    {
+        bool inserted;
+        Entry * entry = mTable.Emplace(inserted, key, value);
+        VerifyOrReturnValue(entry != nullptr, nullptr);
+        if (!inserted)
+        {
+            entry->value = value;
+        }
+        return &entry->value;
+    }
+
+    /// Remove the entry for `key`. Returns false if there is none.
+    bool Erase(const Key & key) { return mTable.Erase(key); }
+    void Clear() { mTable.Clear(); }
+
+private:
+    Table mTable;
+};
+
+/**
+ * @brief
+ *   Hash set holding up to kCapacity keys in place. See FixedHashMap.
+ */
+template <typename Key, size_t kCapacity, typename Hash = FixedContainerHash<Key>>
+class FixedHashSet
+{
+public:
+    using Table          = internal::FixedHashTable<Key, Key, internal::FixedHashSetKeyOf<Key>, Hash, kCapacity>;
+    using const_iterator = typename Table::const_iterator;
+
+    static constexpr size_t kBucketCount = Table::kBucketCount;
+
+    static constexpr size_t Capacity() { return kCapacity; }
+    size_t Size() const { return mTable.Size(); }
+    bool Empty() const { return mTable.Empty(); }
+    bool Full() const { return mTable.Full(); }
+
+    const_iterator begin() const { return mTable.begin(); }
+    const_iterator end() const { return mTable.end(); }
+
+    bool Contains(const Key & key) const { return mTable.Find(key) != nullptr; }
+
+    /// Add `key`. Returns false if the set is full; adding a key that is already in the set succeeds.
+    bool Insert(const Key & key)
+    {
+        bool inserted;
+        return mTable.Emplace(inserted, key) != nullptr;
+    }
+
+    /// Remove `key`. Returns false if it is not in the set.
+    bool Erase(const Key & key) { return mTable.Erase(key); }
+    void Clear() { mTable.Clear(); }
+
+private:
+    Table mTable;
+};
+
+/**
+ * @brief
+ *   Hash map holding up to kCapacity entries in place, whose entries never move.
+ *
+ * Entries live in a fixed array of slots, and the hash table only holds slot indices: inserting or erasing an entry
+ * leaves pointers and references to the other entries valid. This costs an extra indirection per probe and a 16-bit
+ * index per bucket over FixedHashMap.
+ */
+template <typename Key, typename Value, size_t kCapacity, typename Hash = FixedContainerHash<Key>>
+class StableFixedHashMap
+{
+public:
+    static_assert(kCapacity > 0 && kCapacity < UINT16_MAX, "StableFixedHashMap capacity must fit slot indices");
+
+    using Entry = internal::FixedHashMapEntry<Key, Value>;
+
+    static constexpr size_t kBucketCount = internal::FixedHashBucketCount(kCapacity);
+
+    template <typename MapType, typename EntryType>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::remove_const_t<EntryType>;
+        using difference_type   = ptrdiff_t;
+        using pointer           = EntryType *;
+        using reference         = EntryType &;
+
+        Iterator(MapType * map, size_t slot) : mMap(map), mSlot(slot) { SkipEmpty(); }
+
+        EntryType & operator*() const { return *mMap->At(mSlot); }
+        EntryType * operator->() const { return mMap->At(mSlot); }
+        Iterator & operator++()
+        {
+            mSlot++;
+            SkipEmpty();
+            return *this;
+        }
+        bool operator==(const Iterator & other) const { return mSlot == other.mSlot; }
+        bool operator!=(const Iterator & other) const { return mSlot != other.mSlot; }
+
+    private:
+        void SkipEmpty()
+        {
+            while (mSlot < kCapacity && !mMap->mSlotUsed[mSlot])
+            {
+                mSlot++;
+            }
+        }
+
+        MapType * mMap;
+        size_t mSlot;
+    };
+
+    using iterator       = Iterator<StableFixedHashMap, Entry>;
+    using const_iterator = Iterator<const StableFixedHashMap, const Entry>;
+
+    StableFixedHashMap() { ResetFreeSlots(); }
+    StableFixedHashMap(const StableFixedHashMap & other) = delete;
+    StableFixedHashMap & operator=(const StableFixedHashMap & other) = delete;
+    ~StableFixedHashMap() { Clear(); }
+
+    static constexpr size_t Capacity() { return kCapacity; }
+    size_t Size() const { return kCapacity - mFreeCount; }
+    bool Empty() const { return mFreeCount == kCapacity; }
+    bool Full() const { return mFreeCount == 0; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, kCapacity); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, kCapacity); }
+
+    /// Get the value for `key`, or nullptr.
+    Value * Find(const Key & key)
+    {
+        size_t bucket = FindBucket(key);
+        return bucket < kBucketCount ? &At(mBuckets[bucket] - 1u)->value : nullptr;
+    }
+    const Value * Find(const Key & key) const { return const_cast<StableFixedHashMap *>(this)->Find(key); }
+    bool Contains(const Key & key) const { return FindBucket(key) < kBucketCount; }
+
+    /// Get the value for `key`, constructing it from `args` if there is none. Returns nullptr if the map is full.
+    template <typename... Args>
+    Value * Emplace(const Key & key, Args &&... args)
+    {
+        size_t bucket = HomeBucket(key);
+        for (; mBuckets[bucket] != 0; bucket = Next(bucket))
+        {
+            Entry * entry = At(mBuckets[bucket] - 1u);
+            if (entry->key == key)
+            {
+                return &entry->value;
+            }
+        }
+        VerifyOrReturnValue(!Full(), nullptr);
+
+        uint16_t slot    = mFreeSlots[--mFreeCount];
+        Entry * entry    = new (mStorage[slot]) Entry(key, std::forward<Args>(args)...);
+        mSlotUsed[slot]  = true;
+        mBuckets[bucket] = static_cast<uint16_t>(slot + 1);
+        return &entry->value;
+    }
+
+    /// Set the value for `key`. Returns nullptr if the map is full.
+    Value * Insert(const Key & key, const Value & value)
+    {
+        size_t sizeBefore = Size();
+        Value * stored    = Emplace(key, value);
+        if (stored != nullptr && Size() == sizeBefore)
+        {
+            *stored = value;
+        }
+        return stored;
+    }
+
+    /// Remove the entry for `key`. Returns false if there is none.
+    bool Erase(const Key & key)
+    {
+        size_t hole = FindBucket(key);
+        VerifyOrReturnValue(hole < kBucketCount, false);
+
+        uint16_t slot = static_cast<uint16_t>(mBuckets[hole] - 1u);
+        At(slot)->~Entry();
+        mSlotUsed[slot]          = false;
+        mFreeSlots[mFreeCount++] = slot;
+
+        // Same backward shift as FixedHashTable::Erase, moving only slot indices.
+        for (size_t next = Next(hole); mBuckets[next] != 0; next = Next(next))
+        {
+            size_t home = HomeBucket(At(mBuckets[next] - 1u)->key);
+            if (((next - home) & (kBucketCount - 1)) >= ((next - hole) & (kBucketCount - 1)))
+            {
+                mBuckets[hole] = mBuckets[next];
+                hole           = next;
+            }
+        }
+        mBuckets[hole] = 0;
+        return true;
+    }
+
+    void Clear()
+    {
+        for (size_t slot = 0; slot < kCapacity; slot++)
+        {
+            if (mSlotUsed[slot])
+            {
+                At(slot)->~Entry();
+                mSlotUsed[slot] = false;
+            }
+        }
+        for (auto & bucket : mBuckets)
+        {
+            bucket = 0;
+        }
+        ResetFreeSlots();
+    }
+
+private:
+    static size_t HomeBucket(const Key & key) { return Hash()(key) & (kBucketCount - 1); }
+    static size_t Next(size_t bucket) { return (bucket + 1) & (kBucketCount - 1); }
+
+    Entry * At(size_t slot) { return std::launder(reinterpret_cast<Entry *>(mStorage[slot])); }
+    const Entry * At(size_t slot) const { return std::launder(reinterpret_cast<const Entry *>(mStorage[slot])); }
+
+    size_t FindBucket(const Key & key) const
+    {
+        for (size_t bucket = HomeBucket(key); mBuckets[bucket] != 0; bucket = Next(bucket))
+        {
+            if (At(mBuckets[bucket] - 1u)->key == key)
+            {
+                return bucket;
+            }
+        }
+        return kBucketCount;
+    }
+
+    void ResetFreeSlots()
+    {
+        // Hand out slots in increasing order.
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mFreeSlots[i] = static_cast<uint16_t>(kCapacity - 1 - i);
+        }
+        mFreeCount = kCapacity;
+    }
+
+    alignas(Entry) unsigned char mStorage[kCapacity][sizeof(Entry)];
+    bool mSlotUsed[kCapacity] = {};
+    uint16_t mFreeSlots[kCapacity];
+    size_t mFreeCount = 0;
+    // Slot index + 1 of the entry in each bucket, 0 for an empty bucket.
+    uint16_t mBuckets[kBucketCount] = {};
+};
+
+} // namespace chip
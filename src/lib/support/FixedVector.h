@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#include <new>
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+/**
+ * @brief
+ *   A vector with inline storage for up to kCapacity elements, that never allocates.
+ *
+ * Elements are constructed in place as they are added, so T does not need a default constructor. Adding an element
+ * to a full vector fails (EmplaceBack returns nullptr, PushBack and Insert return false) rather than growing it.
+ * Like std::vector, inserting or erasing an element moves the elements after it and invalidates iterators to them.
+ */
+template <typename T, size_t kCapacity>
+class FixedVector
+{
+public:
+    static_assert(kCapacity > 0, "FixedVector capacity must not be 0");
+
+    using value_type     = T;
+    using iterator       = T *;
+    using const_iterator = const T *;
+
+    FixedVector() = default;
+    FixedVector(const FixedVector & other) { CopyFrom(other); }
+    FixedVector & operator=(const FixedVector & other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+    ~FixedVector() { Clear(); }
+
+    static constexpr size_t Capacity() { return kCapacity; }
+    size_t Size() const { return mSize; }
+    bool Empty() const { return mSize == 0; }
+    bool Full() const { return mSize == kCapacity; }
+
+    T * Data() { return Slot(0); }
+    const T * Data() const { return Slot(0); }
+    Span<T> AsSpan() { return Span<T>(Data(), mSize); }
+    Span<const T> AsSpan() const { return Span<const T>(Data(), mSize); }
+
+    T & operator[](size_t index)
+    {
+        VerifyOrDie(index < mSize);
+        return *Slot(index);
+    }
+    const T & operator[](size_t index) const
+    {
+        VerifyOrDie(index < mSize);
+        return *Slot(index);
+    }
+    T & Front() { return (*this)[0]; }
+    T & Back() { return (*this)[mSize - 1]; }
+
+    iterator begin() { return Data(); }
+    iterator end() { return Data() + mSize; }
+    const_iterator begin() const { return Data(); }
+    const_iterator end() const { return Data() + mSize; }
+
+    /// Construct an element at the end. Returns nullptr if the vector is full.
+    template <typename... Args>
+    T * EmplaceBack(Args &&... args)
+    {
+        VerifyOrReturnValue(!Full(), nullptr);
+        T * element = new (Slot(mSize)) T(std::forward<Args>(args)...);
+        mSize++;
+        return element;
+    }
+
+    bool PushBack(const T & value) { return EmplaceBack(value) != nullptr; }
+    bool PushBack(T && value) { return EmplaceBack(std::move(value)) != nullptr; }
+
+    void PopBack()
+    {
+        VerifyOrDie(mSize > 0);
+        mSize--;
+        Slot(mSize)->~T();
+    }
+
+    /// Insert an element before `position`, moving the following elements. Returns false if the vector is full.
+    bool Insert(const_iterator position, T value)
+    {
+        size_t index = static_cast<size_t>(position - begin());
+        VerifyOrDie(index <= mSize);
+        VerifyOrReturnValue(!Full(), false);
+
+        if (index == mSize)
+        {
+            EmplaceBack(std::move(value));
+            return true;
+        }
+        EmplaceBack(std::move(Back()));
+        for (size_t i = mSize - 2; i > index; i--)
+        {
+            *Slot(i) = std::move(*Slot(i - 1));
+        }
+        *Slot(index) = std::move(value);
+        return true;
+    }
+
+    /// Erase the element at `position`, moving the following elements. Returns an iterator to the element that
+    /// followed it.
+    iterator Erase(const_iterator position)
+    {
+        size_t index = static_cast<size_t>(position - begin());
+        VerifyOrDie(index < mSize);
+        for (size_t i = index + 1; i < mSize; i++)
+        {
+            *Slot(i - 1) = std::move(*Slot(i));
+        }
+        PopBack();
+        return begin() + index;
+    }
+
+    void Clear()
+    {
+        while (mSize > 0)
+        {
+            PopBack();
+        }
+    }
+
+private:
+    T * Slot(size_t index) { return std::launder(reinterpret_cast<T *>(mStorage)) + index; }
+    const T * Slot(size_t index) const { return std::launder(reinterpret_cast<const T *>(mStorage)) + index; }
+
+    void CopyFrom(const FixedVector & other)
+    {
+        for (const T & element : other)
+        {
+            EmplaceBack(element);
+        }
+    }
+
+    alignas(T) unsigned char mStorage[sizeof(T) * kCapacity];
+    size_t mSize = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/PersistentList.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR PersistentList::Init(PersistentStorageDelegate * aStorage, const char * aKeyPrefix, uint16_t aMaxElements)
+{
+    VerifyOrReturnError(aStorage != nullptr && aKeyPrefix != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aKeyPrefix[0] != '\0' && strlen(aKeyPrefix) <= kMaxKeyPrefixLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mStorage     = aStorage;
+    mKeyPrefix   = aKeyPrefix;
+    mMaxElements = aMaxElements;
+    mWriteMode   = WriteMode::kNone;
+    mGeneration  = 0;
+    mCount       = 0;
+
+    uint8_t metadata[kMetadataSize];
+    uint16_t size  = sizeof(metadata);
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(MetadataKey().KeyName(), metadata, size);
+    if (err == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(size == kMetadataSize && metadata[0] <= 1, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        mGeneration = metadata[0];
+        mCount      = Encoding::LittleEndian::Get16(&metadata[1]);
+    }
+    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        return err;
+    }
+
+    // A write interrupted before its commit leaves elements in the inactive generation (replace), or after the end of the
+    // active one (append). So does a reboot between the commit of a replace and the removal of the previous list.
+    uint8_t inactiveGeneration = static_cast<uint8_t>(mGeneration ^ 1);
+    DeleteElements(inactiveGeneration, 0, FindElementsEnd(inactiveGeneration, 0));
+    DeleteElements(mGeneration, mCount, FindElementsEnd(mGeneration, mCount));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentList::Get(uint16_t aIndex, MutableByteSpan & aElement) const
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aIndex < mCount, CHIP_ERROR_NOT_FOUND);
+    VerifyOrReturnError(CanCastTo<uint16_t>(aElement.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint16_t size = static_cast<uint16_t>(aElement.size());
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(ElementKey(mGeneration, aIndex).KeyName(), aElement.data(), size));
+    aElement.reduce_size(size);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentList::BeginReplace()
+{
+    VerifyOrReturnError(mStorage != nullptr && !IsWriting(), CHIP_ERROR_INCORRECT_STATE);
+    mWriteMode   = WriteMode::kReplace;
+    mStagedCount = 0;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentList::BeginAppend()
+{
+    VerifyOrReturnError(mStorage != nullptr && !IsWriting(), CHIP_ERROR_INCORRECT_STATE);
+    mWriteMode   = WriteMode::kAppend;
+    mStagedCount = mCount;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentList::Append(ByteSpan aElement)
+{
+    VerifyOrReturnError(IsWriting(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanCastTo<uint16_t>(aElement.size()), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mStagedCount < mMaxElements, CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(ElementKey(StagingGeneration(), mStagedCount).KeyName(), aElement.data(),
+                                                   static_cast<uint16_t>(aElement.size())));
+    mStagedCount++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentList::Commit()
+{
+    VerifyOrReturnError(IsWriting(), CHIP_ERROR_INCORRECT_STATE);
+
+    uint8_t previousGeneration = mGeneration;
+    uint16_t previousCount     = mCount;
+    uint8_t stagingGeneration  = StagingGeneration();
+    ReturnErrorOnFailure(StoreMetadata(stagingGeneration, mStagedCount));
+
+    bool replaced = (mWriteMode == WriteMode::kReplace);
+    mGeneration   = stagingGeneration;
+    mCount        = mStagedCount;
+    mWriteMode    = WriteMode::kNone;
+
+    if (replaced)
+    {
+        // Anything left behind by a failure here is removed by the next Init.
+        DeleteElements(previousGeneration, 0, previousCount);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void PersistentList::Rollback()
+{
+    VerifyOrReturn(IsWriting());
+    DeleteElements(StagingGeneration(), mWriteMode == WriteMode::kReplace ? 0 : mCount, mStagedCount);
+    mWriteMode = WriteMode::kNone;
+}
+
+uint8_t PersistentList::StagingGeneration() const
+{
+    return mWriteMode == WriteMode::kReplace ? static_cast<uint8_t>(mGeneration ^ 1) : mGeneration;
+}
+
+StorageKeyName PersistentList::ElementKey(uint8_t aGeneration, uint16_t aIndex) const
+{
+    return StorageKeyName::Formatted("%s/%c%x", mKeyPrefix, aGeneration == 0 ? 'a' : 'b', static_cast<unsigned>(aIndex));
+}
+
+StorageKeyName PersistentList::MetadataKey() const
+{
+    return StorageKeyName::Formatted("%s/m", mKeyPrefix);
+}
+
+CHIP_ERROR PersistentList::StoreMetadata(uint8_t aGeneration, uint16_t aCount)
+{
+    uint8_t metadata[kMetadataSize];
+    metadata[0] = aGeneration;
+    Encoding::LittleEndian::Put16(&metadata[1], aCount);
+    return mStorage->SyncSetKeyValue(MetadataKey().KeyName(), metadata, sizeof(metadata));
+}
+
+uint32_t PersistentList::FindElementsEnd(uint8_t aGeneration, uint16_t aFirstIndex) const
+{
+    uint32_t index = aFirstIndex;
+    while (index <= UINT16_MAX && mStorage->SyncDoesKeyExist(ElementKey(aGeneration, static_cast<uint16_t>(index)).KeyName()))
+    {
+        index++;
+    }
+    return index;
+}
+
+void PersistentList::DeleteElements(uint8_t aGeneration, uint16_t aFirstIndex, uint32_t aEndIndex)
+{
+    // Elements are appended in ascending order, so the stored elements of a generation are a contiguous range. Deleting
+    // them from the last one down keeps it contiguous when the deletion is interrupted, so that FindElementsEnd still
+    // finds what is left of it.
+    for (uint32_t index = aEndIndex; index > aFirstIndex; index--)
+    {
+        CHIP_ERROR err = mStorage->SyncDeleteKeyValue(ElementKey(aGeneration, static_cast<uint16_t>(index - 1)).KeyName());
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(Support, "Failed to delete persistent list element: %" CHIP_ERROR_FORMAT, err.Format());
+            break;
+        }
+    }
+}
+
+} // namespace chip
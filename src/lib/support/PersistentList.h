@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/Span.h>
+
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * @brief
+ *   A list of opaque elements kept in persistent storage, one storage key per element, that is rewritten one element at
+ *   a time and committed or rolled back as a whole.
+ *
+ * This lets list attributes be written as their elements arrive (e.g. from the AppendItem data of a chunked list write)
+ * without holding the list in RAM: memory use does not depend on the length of the list.
+ *
+ * Storage layout, for a key prefix P:
+ *   - P/m holds the active generation and the element count.
+ *   - P/a<index> and P/b<index> (index in hex) hold the elements of generations 0 and 1.
+ *
+ * A write either replaces the list, staging its elements in the inactive generation, or appends to it, staging them
+ * after the last element of the active generation. Writing P/m is the commit point: until then, readers (and the list
+ * loaded after a reboot) see the previous list. Staged elements left behind by a reboot are removed by Init.
+ */
+class PersistentList
+{
+public:
+    /// Storage keys are the prefix followed by at most 6 characters.
+    static constexpr size_t kMaxKeyPrefixLength = PersistentStorageDelegate::kKeyLengthMax - 6;
+
+    /**
+     * Load the list stored under aKeyPrefix, cleaning up after any write interrupted by a reboot.
+     *
+     * @param[in] aStorage     the storage holding the list.
+     * @param[in] aKeyPrefix   prefix of the storage keys of the list, at most kMaxKeyPrefixLength characters. Must
+     *                         outlive this object.
+     * @param[in] aMaxElements the capacity of the list.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * aStorage, const char * aKeyPrefix, uint16_t aMaxElements);
+
+    /// Number of elements of the committed list.
+    uint16_t Count() const { return mCount; }
+    uint16_t MaxElements() const { return mMaxElements; }
+
+    /**
+     * Read an element of the committed list. On success, aElement is resized to the size of the element.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if aIndex is out of range, CHIP_ERROR_BUFFER_TOO_SMALL if aElement cannot hold the
+     *         element.
+     */
+    CHIP_ERROR Get(uint16_t aIndex, MutableByteSpan & aElement) const;
+
+    /// Start a write that replaces the list with the elements appended until Commit.
+    CHIP_ERROR BeginReplace();
+    /// Start a write that adds the elements appended until Commit at the end of the list.
+    CHIP_ERROR BeginAppend();
+
+    bool IsWriting() const { return mWriteMode != WriteMode::kNone; }
+    /// Number of elements the list will have once the current write is committed.
+    uint16_t StagedCount() const { return IsWriting() ? mStagedCount : mCount; }
+
+    /**
+     * Persist the next element of the current write.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the list would exceed its capacity. The write is left in progress: the caller
+     *         decides whether to commit what was appended so far or to roll back.
+     */
+    CHIP_ERROR Append(ByteSpan aElement);
+
+    /// Make the current write the committed list.
+    CHIP_ERROR Commit();
+    /// Abandon the current write, leaving the committed list untouched. Does nothing if no write is in progress.
+    void Rollback();
+
+private:
+    enum class WriteMode : uint8_t
+    {
+        kNone,
+        kReplace,
+        kAppend,
+    };
+
+    static constexpr size_t kMetadataSize = 3;
+
+    StorageKeyName ElementKey(uint8_t aGeneration, uint16_t aIndex) const;
+    StorageKeyName MetadataKey() const;
+    CHIP_ERROR StoreMetadata(uint8_t aGeneration, uint16_t aCount);
+    // Index one past the last element of aGeneration stored from aFirstIndex on.
+    uint32_t FindElementsEnd(uint8_t aGeneration, uint16_t aFirstIndex) const;
+    // Delete the elements of aGeneration in [aFirstIndex, aEndIndex), from the last one down.
+    void DeleteElements(uint8_t aGeneration, uint16_t aFirstIndex, uint32_t aEndIndex);
+    uint8_t StagingGeneration() const;
+
+    PersistentStorageDelegate * mStorage = nullptr;
+    const char * mKeyPrefix              = nullptr;
+    uint16_t mMaxElements                = 0;
+    uint16_t mCount                      = 0;
+    uint16_t mStagedCount                = 0;
+    uint8_t mGeneration                  = 0;
+    WriteMode mWriteMode                 = WriteMode::kNone;
+};
+
+} // namespace chip
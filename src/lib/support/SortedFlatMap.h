@@ -0,0 +1,112 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/FixedVector.h>
+
+#include <algorithm>
+#include <functional>
+#include <stddef.h>
+#include <utility>
+
+namespace chip {
+
+/**
+ * @brief
+ *   Map holding up to kCapacity entries in place, sorted by key.
+ *
+ * Lookups are binary searches over a contiguous array, and iteration is in key order. Inserting or erasing moves the
+ * entries that follow, so this suits maps that are read far more often than they are modified, such as tables built at
+ * startup or on fabric changes; prefer FixedHashMap for maps that churn.
+ */
+template <typename Key, typename Value, size_t kCapacity, typename Compare = std::less<Key>>
+class SortedFlatMap
+{
+public:
+    struct Entry
+    {
+        Entry(const Key & aKey, Value aValue) : key(aKey), value(std::move(aValue)) {}
+
+        Key key;
+        Value value;
+    };
+
+    using iterator       = Entry *;
+    using const_iterator = const Entry *;
+
+    static constexpr size_t Capacity() { return kCapacity; }
+    size_t Size() const { return mEntries.Size(); }
+    bool Empty() const { return mEntries.Empty(); }
+    bool Full() const { return mEntries.Full(); }
+
+    iterator begin() { return mEntries.begin(); }
+    iterator end() { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    /// First entry whose key is not less than `key`.
+    iterator LowerBound(const Key & key)
+    {
+        return std::lower_bound(begin(), end(), key, [](const Entry & entry, const Key & k) { return Compare()(entry.key, k); });
+    }
+    const_iterator LowerBound(const Key & key) const { return const_cast<SortedFlatMap *>(this)->LowerBound(key); }
+
+    /// Get the value for `key`, or nullptr.
+    Value * Find(const Key & key)
+    {
+        iterator entry = LowerBound(key);
+        return IsMatch(entry, key) ? &entry->value : nullptr;
+    }
+    const Value * Find(const Key & key) const { return const_cast<SortedFlatMap *>(this)->Find(key); }
+    bool Contains(const Key & key) const { return Find(key) != nullptr; }
+
+    /// Set the value for `key`. Returns nullptr if the map is full.
+    Value * Insert(const Key & key, const Value & value)
+    {
+        iterator position = LowerBound(key);
+        if (IsMatch(position, key))
+        {
+            position->value = value;
+            return &position->value;
+        }
+
+        size_t index = static_cast<size_t>(position - begin());
+        VerifyOrReturnValue(mEntries.Insert(position, Entry(key, value)), nullptr);
+        return &mEntries[index].value;
+    }
+
+    /// Remove the entry for `key`. Returns false if there is none.
+    bool Erase(const Key & key)
+    {
+        iterator position = LowerBound(key);
+        VerifyOrReturnValue(IsMatch(position, key), false);
+        mEntries.Erase(position);
+        return true;
+    }
+
+    void Clear() { mEntries.Clear(); }
+
+private:
+    bool IsMatch(const_iterator position, const Key & key) const { return position != end() && !Compare()(key, position->key); }
+
+    FixedVector<Entry, kCapacity> mEntries;
+};
+
+} // namespace chip
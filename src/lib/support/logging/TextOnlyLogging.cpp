@@ -46,6 +46,15 @@ namespace Logging {
 
 #if CHIP_PW_TOKENIZER_LOGGING
 
+namespace {
+std::atomic<TokenizedLogRedirectCallback_t> sTokenizedLogRedirectCallback{ nullptr };
+} // namespace
+
+void SetTokenizedLogRedirectCallback(TokenizedLogRedirectCallback_t callback)
+{
+    sTokenizedLogRedirectCallback.store(callback);
+}
+
 void HandleTokenizedLog(uint32_t levels, pw_tokenizer_Token token, pw_tokenizer_ArgTypes types, ...)
 {
     uint8_t encoded_message[PW_TOKENIZER_CFG_ENCODING_BUFFER_SIZE_BYTES];
@@ -63,6 +72,14 @@ void HandleTokenizedLog(uint32_t levels, pw_tokenizer_Token token, pw_tokenizer_
     uint8_t log_module    = levels & 0xFF;
     char * logging_buffer = nullptr;
 
+    // The redirected messages are kept in binary form, and are only rendered as text by the offline decoder.
+    TokenizedLogRedirectCallback_t redirect = sTokenizedLogRedirectCallback.load();
+    if (redirect != nullptr)
+    {
+        redirect(log_module, log_category, encoded_message, encoded_size);
+        return;
+    }
+
     // To reduce the number of alloc/free that is happening we will use a stack
     // buffer when buffer required to log is small.
     char stack_buffer[32];
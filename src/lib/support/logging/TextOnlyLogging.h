@@ -448,6 +448,15 @@ void LogV(uint8_t module, uint8_t category, const char * msg, va_list args) ENFO
 
 #if CHIP_PW_TOKENIZER_LOGGING
 
+// Tokenized log redirection: the encoded message is the token of the format string, followed by the encoded arguments.
+using TokenizedLogRedirectCallback_t = void (*)(uint8_t module, uint8_t category, const uint8_t * encoded, size_t length);
+
+/**
+ * Redirect the tokenized log messages, which are otherwise logged as hexadecimal text through LogV.
+ * A null callback restores the default behavior.
+ */
+DLL_EXPORT void SetTokenizedLogRedirectCallback(TokenizedLogRedirectCallback_t callback);
+
 void HandleTokenizedLog(uint32_t levels, pw_tokenizer_Token token, pw_tokenizer_ArgTypes, ...);
 
 #define ChipInternalLogImpl(MOD, CAT, MSG, ...)                                                                                    \
@@ -0,0 +1,177 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "TokenizedLogWriter.h"
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+
+namespace chip {
+namespace Logging {
+
+namespace {
+
+// Longest varint, for a 64-bit value.
+constexpr size_t kMaxVarintLength = 10;
+
+size_t PutVarint(uint8_t * buffer, uint64_t value)
+{
+    size_t length = 0;
+    while (value >= 0x80)
+    {
+        buffer[length++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    buffer[length++] = static_cast<uint8_t>(value);
+    return length;
+}
+
+uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+} // namespace
+
+CHIP_ERROR TokenizedLogWriter::WriteHeader(uint64_t timestampUs)
+{
+    uint8_t header[sizeof(kMagic) + 1 + sizeof(uint64_t) + 1];
+    uint8_t * p = header;
+
+    memcpy(p, kMagic, sizeof(kMagic));
+    p += sizeof(kMagic);
+    *p++ = kVersion;
+    Encoding::LittleEndian::Put64(p, timestampUs);
+    p += sizeof(uint64_t);
+    *p++ = static_cast<uint8_t>(kLogModule_Max);
+    VerifyOrReturnError(fwrite(header, 1, sizeof(header), mOutput) == sizeof(header), CHIP_ERROR_WRITE_FAILED);
+
+    static_assert(kMaxModuleNameLen < kModuleNameSize, "Module names must fit in the header");
+    for (int module = 0; module < kLogModule_Max; module++)
+    {
+        char name[kModuleNameSize] = {};
+        strncpy(name, GetModuleName(static_cast<LogModule>(module)), sizeof(name) - 1);
+        VerifyOrReturnError(fwrite(name, 1, sizeof(name), mOutput) == sizeof(name), CHIP_ERROR_WRITE_FAILED);
+    }
+
+    mLastTimestampUs = timestampUs;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TokenizedLogWriter::WriteRecord(uint8_t module, uint8_t category, uint64_t timestampUs, ByteSpan encodedMessage)
+{
+    uint8_t header[2 * kMaxVarintLength + 2];
+    size_t length = PutVarint(header, encodedMessage.size());
+
+    header[length++] = category;
+    header[length++] = module;
+    // The clock may go backwards, or the messages of other threads be written out of order.
+    length += PutVarint(&header[length], ZigZagEncode(static_cast<int64_t>(timestampUs - mLastTimestampUs)));
+    mLastTimestampUs = timestampUs;
+
+    VerifyOrReturnError(fwrite(header, 1, length, mOutput) == length, CHIP_ERROR_WRITE_FAILED);
+    VerifyOrReturnError(fwrite(encodedMessage.data(), 1, encodedMessage.size(), mOutput) == encodedMessage.size(),
+                        CHIP_ERROR_WRITE_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_PW_TOKENIZER_LOGGING
+
+namespace {
+
+// Large enough to write the log file in few system calls.
+constexpr size_t kFileBufferSize = 64 * 1024;
+
+// Guards the log file against its closing while other threads are still writing to it.
+std::mutex sTokenizedLogFileLock;
+FILE * sTokenizedLogFile = nullptr;
+TokenizedLogWriter sTokenizedLogWriter(nullptr);
+bool sStopRegisteredAtExit = false;
+
+uint64_t GetTimestampUs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+void WriteTokenizedLog(uint8_t module, uint8_t category, const uint8_t * encoded, size_t length)
+{
+    uint64_t timestampUs = GetTimestampUs();
+
+    std::lock_guard<std::mutex> lock(sTokenizedLogFileLock);
+    // The file may have been closed since this callback was looked up.
+    VerifyOrReturn(sTokenizedLogFile != nullptr);
+
+    // Nothing sensible can be done, such as logging an error, when the log can not be written.
+    (void) sTokenizedLogWriter.WriteRecord(module, category, timestampUs, ByteSpan(encoded, length));
+
+    // Errors often precede an abort, which loses whatever is still buffered.
+    if (category == kLogCategory_Error)
+    {
+        fflush(sTokenizedLogFile);
+    }
+}
+
+} // namespace
+
+CHIP_ERROR StartTokenizedLogFile(const char * path)
+{
+    std::lock_guard<std::mutex> lock(sTokenizedLogFileLock);
+    VerifyOrReturnError(sTokenizedLogFile == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    FILE * file = fopen(path, "wb");
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_OPEN_FAILED);
+    setvbuf(file, nullptr, _IOFBF, kFileBufferSize);
+
+    sTokenizedLogWriter = TokenizedLogWriter(file);
+    CHIP_ERROR err      = sTokenizedLogWriter.WriteHeader(GetTimestampUs());
+    if (err != CHIP_NO_ERROR)
+    {
+        fclose(file);
+        return err;
+    }
+
+    if (!sStopRegisteredAtExit)
+    {
+        // Write the pending messages of applications that exit without stopping the log file.
+        sStopRegisteredAtExit = (atexit(StopTokenizedLogFile) == 0);
+    }
+
+    sTokenizedLogFile = file;
+    SetTokenizedLogRedirectCallback(WriteTokenizedLog);
+    return CHIP_NO_ERROR;
+}
+
+void StopTokenizedLogFile()
+{
+    SetTokenizedLogRedirectCallback(nullptr);
+
+    // Wait for the writes in progress, which may have looked up the callback before it was cleared.
+    std::lock_guard<std::mutex> lock(sTokenizedLogFileLock);
+    VerifyOrReturn(sTokenizedLogFile != nullptr);
+    fclose(sTokenizedLogFile);
+    sTokenizedLogFile = nullptr;
+}
+
+#endif // CHIP_PW_TOKENIZER_LOGGING
+
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,97 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a writer of tokenized log messages to a compact
+ *      binary log file, which is decoded offline.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/TextOnlyLogging.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace chip {
+namespace Logging {
+
+/**
+ * Writer of tokenized log messages (the pw_tokenizer token of the format string, followed by the encoded arguments) to a
+ * binary log file, which scripts/tools/decode_tokenized_logs.py renders as text using the token database of the
+ * application.
+ *
+ * File format, with integers in little-endian order and signed varints zigzag-encoded:
+ *   - Header: the kMagic bytes, the kVersion byte, the time of the header in microseconds since the Unix epoch (8 bytes),
+ *     the number of log modules (1 byte), and the name of each module (kModuleNameSize bytes, padded with zeros).
+ *   - Records: the length of the encoded message (varint), the category and the module of the message (1 byte each), the
+ *     time elapsed since the previous record or the header in microseconds (signed varint), and the encoded message.
+ *
+ * The writer is not thread-safe: the caller serializes the writes.
+ */
+class TokenizedLogWriter
+{
+public:
+    static constexpr uint8_t kMagic[8]      = { 'C', 'H', 'I', 'P', 'T', 'L', 'O', 'G' };
+    static constexpr uint8_t kVersion       = 1;
+    static constexpr size_t kModuleNameSize = 4;
+
+    explicit TokenizedLogWriter(FILE * output) : mOutput(output) {}
+
+    /**
+     * Write the file header, which must precede the records.
+     *
+     * @param timestampUs  Current time, in microseconds since the Unix epoch.
+     */
+    CHIP_ERROR WriteHeader(uint64_t timestampUs);
+
+    /**
+     * Write a log message.
+     *
+     * @param timestampUs     Time of the message, in microseconds since the Unix epoch.
+     * @param encodedMessage  Token of the format string of the message, followed by the encoded arguments.
+     */
+    CHIP_ERROR WriteRecord(uint8_t module, uint8_t category, uint64_t timestampUs, ByteSpan encodedMessage);
+
+private:
+    FILE * mOutput;
+    uint64_t mLastTimestampUs = 0;
+};
+
+#if CHIP_PW_TOKENIZER_LOGGING
+
+/**
+ * Write the tokenized log messages to the given file, which is created or truncated, instead of logging them as
+ * hexadecimal text.
+ *
+ * The file is buffered: error messages are written out immediately, the others when the buffer is full, when
+ * StopTokenizedLogFile() is called, or when the application exits.
+ */
+CHIP_ERROR StartTokenizedLogFile(const char * path);
+
+/**
+ * Write the pending messages and close the tokenized log file, restoring the default output of the tokenized log
+ * messages. Waits for the messages that other threads are writing to the file.
+ */
+void StopTokenizedLogFile();
+
+#endif // CHIP_PW_TOKENIZER_LOGGING
+
+} // namespace Logging
+} // namespace chip
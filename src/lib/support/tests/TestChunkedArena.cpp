@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ChunkedArena.h>
+
+#include <cstdint>
+
+using namespace chip;
+
+namespace {
+
+class TestChunkedArena : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+struct Small
+{
+    Small(uint8_t aValue) : value(aValue) {}
+
+    uint8_t value;
+};
+
+struct Wide
+{
+    Wide(uint64_t aValue) : value(aValue) {}
+
+    uint64_t value;
+};
+
+TEST_F(TestChunkedArena, FillsChunksBeforeAllocating)
+{
+    ChunkedArena<64> arena;
+    EXPECT_EQ(arena.ChunkCount(), 0u);
+    EXPECT_EQ(arena.AllocatedSize(), 0u);
+
+    Wide * objects[24];
+    for (uint64_t i = 0; i < 24; i++)
+    {
+        objects[i] = arena.New<Wide>(i);
+        ASSERT_NE(objects[i], nullptr);
+    }
+    // Chunks of 1, 2, 4 and 8 objects of 8 bytes, then of 64 bytes.
+    EXPECT_EQ(arena.ChunkCount(), 6u);
+
+    for (uint64_t i = 0; i < 24; i++)
+    {
+        EXPECT_EQ(objects[i]->value, i);
+    }
+
+    arena.Release();
+    EXPECT_EQ(arena.ChunkCount(), 0u);
+    EXPECT_EQ(arena.AllocatedSize(), 0u);
+
+    // The arena can be used again after a release.
+    EXPECT_NE(arena.New<Wide>(1u), nullptr);
+    EXPECT_EQ(arena.ChunkCount(), 1u);
+}
+
+TEST_F(TestChunkedArena, SizesFirstChunkByNeed)
+{
+    ChunkedArena<1024> arena;
+
+    // A single object does not cost a whole chunk.
+    ASSERT_NE(arena.New<Wide>(1u), nullptr);
+    const size_t oneObjectSize = arena.AllocatedSize();
+    EXPECT_LT(oneObjectSize, 128u);
+
+    // The next chunk holds two objects.
+    ASSERT_NE(arena.New<Wide>(2u), nullptr);
+    EXPECT_EQ(arena.ChunkCount(), 2u);
+    EXPECT_EQ(arena.AllocatedSize(), 2 * oneObjectSize + sizeof(Wide));
+    ASSERT_NE(arena.New<Wide>(3u), nullptr);
+    EXPECT_EQ(arena.ChunkCount(), 2u);
+}
+
+TEST_F(TestChunkedArena, AlignsObjects)
+{
+    ChunkedArena<64> arena;
+
+    Wide * first  = arena.New<Wide>(5u);
+    Small * small = arena.New<Small>(static_cast<uint8_t>(7));
+    Wide * wide   = arena.New<Wide>(9u);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(wide, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % alignof(Wide), 0u);
+    EXPECT_EQ(first->value, 5u);
+    EXPECT_EQ(small->value, 7);
+    EXPECT_EQ(wide->value, 9u);
+
+    // With its padding, `small` takes the space of a wide object: it and `wide` fill the 16-byte second chunk.
+    EXPECT_EQ(arena.ChunkCount(), 2u);
+    ASSERT_NE(arena.New<Wide>(1u), nullptr);
+    EXPECT_EQ(arena.ChunkCount(), 3u);
+}
+
+} // namespace
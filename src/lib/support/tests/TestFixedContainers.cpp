@@ -0,0 +1,247 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/FixedHashMap.h>
+#include <lib/support/FixedVector.h>
+#include <lib/support/SortedFlatMap.h>
+
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <utility>
+
+using namespace chip;
+
+namespace {
+
+// Counts live instances, to check that containers construct and destroy their elements exactly once.
+struct Tracked
+{
+    static int sLive;
+
+    explicit Tracked(int aValue) : value(aValue) { sLive++; }
+    Tracked(const Tracked & other) : value(other.value) { sLive++; }
+    Tracked & operator=(const Tracked & other) = default;
+    ~Tracked() { sLive--; }
+
+    int value;
+};
+
+int Tracked::sLive = 0;
+
+struct PathKey
+{
+    EndpointId endpoint;
+    ClusterId cluster;
+
+    bool operator==(const PathKey & other) const { return endpoint == other.endpoint && cluster == other.cluster; }
+};
+
+struct PathKeyHash
+{
+    size_t operator()(const PathKey & key) const
+    {
+        return FixedContainerHash<uint64_t>()((static_cast<uint64_t>(key.endpoint) << 32) | key.cluster);
+    }
+};
+
+static_assert(FixedHashMap<uint16_t, int, 12>::kBucketCount == 16, "12 entries fit 3/4 of 16 buckets");
+static_assert(FixedHashMap<uint16_t, int, 13>::kBucketCount == 32, "13 entries do not fit 3/4 of 16 buckets");
+static_assert(FixedVector<uint8_t, 7>::Capacity() == 7, "Capacity is a compile-time constant");
+
+TEST(TestFixedContainers, FixedVector)
+{
+    {
+        FixedVector<Tracked, 4> vector;
+        EXPECT_TRUE(vector.Empty());
+        EXPECT_NE(vector.EmplaceBack(1), nullptr);
+        EXPECT_TRUE(vector.PushBack(Tracked(3)));
+        EXPECT_TRUE(vector.Insert(vector.begin() + 1, Tracked(2)));
+        EXPECT_TRUE(vector.Insert(vector.begin(), Tracked(0)));
+        EXPECT_TRUE(vector.Full());
+        EXPECT_EQ(vector.EmplaceBack(5), nullptr);
+        EXPECT_FALSE(vector.Insert(vector.begin(), Tracked(5)));
+        EXPECT_EQ(Tracked::sLive, 4);
+
+        int expected = 0;
+        for (const Tracked & element : vector)
+        {
+            EXPECT_EQ(element.value, expected++);
+        }
+
+        auto next = vector.Erase(vector.begin() + 1);
+        EXPECT_EQ(next->value, 2);
+        EXPECT_EQ(vector.Size(), 3u);
+        EXPECT_EQ(vector.Front().value, 0);
+        EXPECT_EQ(vector.Back().value, 3);
+        EXPECT_EQ(Tracked::sLive, 3);
+
+        FixedVector<Tracked, 4> copy(vector);
+        vector.PopBack();
+        EXPECT_EQ(copy.Size(), 3u);
+        EXPECT_EQ(copy[2].value, 3);
+        EXPECT_EQ(vector.AsSpan().size(), 2u);
+        EXPECT_EQ(Tracked::sLive, 5);
+    }
+    EXPECT_EQ(Tracked::sLive, 0);
+}
+
+// Applies random inserts and erases to `map` and to a std::map, checking that they always agree.
+template <typename Map>
+void CheckChurnMatchesReference(Map & map, unsigned seed)
+{
+    std::map<uint16_t, int> reference;
+
+    srand(seed);
+    for (int i = 0; i < 5000; i++)
+    {
+        // Few enough keys that the map is often full, and its probe runs are long.
+        uint16_t key = static_cast<uint16_t>(rand() % 24);
+        if (reference.count(key) != 0 && rand() % 2 == 0)
+        {
+            EXPECT_TRUE(map.Erase(key));
+            reference.erase(key);
+        }
+        else
+        {
+            int * value = map.Insert(key, i);
+            EXPECT_EQ(value != nullptr, reference.count(key) != 0 || reference.size() < Map::Capacity());
+            if (value != nullptr)
+            {
+                EXPECT_EQ(*value, i);
+                reference[key] = i;
+            }
+        }
+
+        ASSERT_EQ(map.Size(), reference.size());
+        for (uint16_t k = 0; k < 24; k++)
+        {
+            auto found        = reference.find(k);
+            const int * value = map.Find(k);
+            ASSERT_EQ(value != nullptr, found != reference.end());
+            if (value != nullptr)
+            {
+                ASSERT_EQ(*value, found->second);
+            }
+        }
+    }
+
+    size_t iterated = 0;
+    for (const auto & entry : map)
+    {
+        EXPECT_EQ(reference[entry.key], entry.value);
+        iterated++;
+    }
+    EXPECT_EQ(iterated, reference.size());
+}
+
+TEST(TestFixedContainers, FixedHashMap)
+{
+    FixedHashMap<uint16_t, int, 12> map;
+    CheckChurnMatchesReference(map, 1234);
+
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Find(1), nullptr);
+    EXPECT_FALSE(map.Erase(1));
+
+    // Emplace does not overwrite, Insert does.
+    EXPECT_EQ(*map.Emplace(1, 10), 10);
+    EXPECT_EQ(*map.Emplace(1, 11), 10);
+    EXPECT_EQ(*map.Insert(1, 12), 12);
+    EXPECT_TRUE(map.Contains(1));
+
+    FixedHashMap<PathKey, Tracked, 8, PathKeyHash> paths;
+    EXPECT_NE(paths.Emplace(PathKey{ 1, 6 }, 16), nullptr);
+    EXPECT_NE(paths.Emplace(PathKey{ 2, 6 }, 26), nullptr);
+    EXPECT_EQ(paths.Find(PathKey{ 2, 6 })->value, 26);
+    EXPECT_EQ(paths.Find(PathKey{ 6, 2 }), nullptr);
+    EXPECT_TRUE(paths.Erase(PathKey{ 1, 6 }));
+    EXPECT_EQ(Tracked::sLive, 1);
+    paths.Clear();
+    EXPECT_EQ(Tracked::sLive, 0);
+}
+
+TEST(TestFixedContainers, FixedHashSet)
+{
+    FixedHashSet<uint32_t, 4> set;
+    EXPECT_TRUE(set.Insert(7));
+    EXPECT_TRUE(set.Insert(7));
+    EXPECT_TRUE(set.Insert(9));
+    EXPECT_TRUE(set.Insert(0xFFFFFFFF));
+    EXPECT_TRUE(set.Insert(0));
+    EXPECT_FALSE(set.Insert(1));
+    EXPECT_EQ(set.Size(), 4u);
+
+    std::set<uint32_t> iterated(set.begin(), set.end());
+    EXPECT_EQ(iterated, (std::set<uint32_t>{ 0, 7, 9, 0xFFFFFFFF }));
+
+    EXPECT_TRUE(set.Erase(9));
+    EXPECT_FALSE(set.Erase(9));
+    EXPECT_FALSE(set.Contains(9));
+    EXPECT_TRUE(set.Contains(0xFFFFFFFF));
+}
+
+TEST(TestFixedContainers, StableFixedHashMap)
+{
+    StableFixedHashMap<uint16_t, int, 12> map;
+    CheckChurnMatchesReference(map, 5678);
+
+    // Entries stay in place whatever else is inserted and erased.
+    map.Clear();
+    int * anchor = map.Insert(3, 300);
+    for (uint16_t key = 100; key < 111; key++)
+    {
+        EXPECT_NE(map.Insert(key, key), nullptr);
+    }
+    for (uint16_t key = 100; key < 111; key += 2)
+    {
+        EXPECT_TRUE(map.Erase(key));
+    }
+    EXPECT_EQ(map.Find(3), anchor);
+    EXPECT_EQ(*anchor, 300);
+}
+
+TEST(TestFixedContainers, SortedFlatMap)
+{
+    SortedFlatMap<uint16_t, int, 12> map;
+    CheckChurnMatchesReference(map, 9012);
+
+    map.Clear();
+    const uint16_t keys[] = { 50, 10, 40, 20, 30 };
+    for (uint16_t key : keys)
+    {
+        EXPECT_NE(map.Insert(key, key * 10), nullptr);
+    }
+
+    // Iteration is in key order.
+    uint16_t previous = 0;
+    for (const auto & entry : map)
+    {
+        EXPECT_GT(entry.key, previous);
+        EXPECT_EQ(entry.value, entry.key * 10);
+        previous = entry.key;
+    }
+    EXPECT_EQ(map.LowerBound(25)->key, 30);
+    EXPECT_EQ(map.LowerBound(60), map.end());
+}
+
+} // namespace
@@ -0,0 +1,243 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/PersistentList.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <set>
+#include <string>
+
+using namespace chip;
+
+namespace {
+
+constexpr char kPrefix[] = "g/tl";
+
+ByteSpan Element(uint16_t value, uint8_t (&buffer)[2])
+{
+    buffer[0] = static_cast<uint8_t>(value);
+    buffer[1] = static_cast<uint8_t>(value >> 8);
+    return ByteSpan(buffer);
+}
+
+void ExpectList(const PersistentList & list, uint16_t count, uint16_t firstValue)
+{
+    ASSERT_EQ(list.Count(), count);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint8_t buffer[8];
+        MutableByteSpan element(buffer);
+        ASSERT_EQ(list.Get(i, element), CHIP_NO_ERROR);
+        ASSERT_EQ(element.size(), 2u);
+        ASSERT_EQ(element[0] | (element[1] << 8), firstValue + i);
+    }
+}
+
+CHIP_ERROR AppendRange(PersistentList & list, uint16_t firstValue, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint8_t buffer[2];
+        ReturnErrorOnFailure(list.Append(Element(static_cast<uint16_t>(firstValue + i), buffer)));
+    }
+    return CHIP_NO_ERROR;
+}
+
+TEST(TestPersistentList, ReplaceAndAppend)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentList list;
+    ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+    EXPECT_EQ(list.Count(), 0u);
+
+    EXPECT_EQ(list.Append(ByteSpan()), CHIP_ERROR_INCORRECT_STATE);
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    EXPECT_EQ(list.BeginAppend(), CHIP_ERROR_INCORRECT_STATE);
+    ASSERT_EQ(AppendRange(list, 100, 5), CHIP_NO_ERROR);
+
+    // Nothing is visible before the commit.
+    EXPECT_EQ(list.Count(), 0u);
+    EXPECT_EQ(list.StagedCount(), 5u);
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+    ExpectList(list, 5, 100);
+
+    ASSERT_EQ(list.BeginAppend(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 105, 3), CHIP_NO_ERROR);
+    ExpectList(list, 5, 100);
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+    ExpectList(list, 8, 100);
+
+    // Replacing removes the elements of the previous list from storage.
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 7, 2), CHIP_NO_ERROR);
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+    ExpectList(list, 2, 7);
+    EXPECT_EQ(storage.GetNumKeys(), 3u);
+
+    uint8_t small[1];
+    MutableByteSpan tooSmall(small);
+    EXPECT_EQ(list.Get(0, tooSmall), CHIP_ERROR_BUFFER_TOO_SMALL);
+    MutableByteSpan element(small);
+    EXPECT_EQ(list.Get(2, element), CHIP_ERROR_NOT_FOUND);
+
+    // The list survives a reboot.
+    PersistentList reloaded;
+    ASSERT_EQ(reloaded.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+    ExpectList(reloaded, 2, 7);
+}
+
+TEST(TestPersistentList, Rollback)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentList list;
+    ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 0, 4), CHIP_NO_ERROR);
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+    std::set<std::string> committedKeys = storage.GetKeys();
+
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 50, 6), CHIP_NO_ERROR);
+    list.Rollback();
+    ExpectList(list, 4, 0);
+    EXPECT_EQ(storage.GetKeys(), committedKeys);
+
+    ASSERT_EQ(list.BeginAppend(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 4, 6), CHIP_NO_ERROR);
+    list.Rollback();
+    ExpectList(list, 4, 0);
+    EXPECT_EQ(storage.GetKeys(), committedKeys);
+
+    // A failed commit leaves the write in progress, to be rolled back.
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 50, 2), CHIP_NO_ERROR);
+    storage.AddPoisonKey("g/tl/m");
+    EXPECT_NE(list.Commit(), CHIP_NO_ERROR);
+    storage.ClearPoisonKeys();
+    EXPECT_TRUE(list.IsWriting());
+    list.Rollback();
+    ExpectList(list, 4, 0);
+    EXPECT_EQ(storage.GetKeys(), committedKeys);
+}
+
+TEST(TestPersistentList, Capacity)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentList list;
+    ASSERT_EQ(list.Init(&storage, kPrefix, 3), CHIP_NO_ERROR);
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 0, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(AppendRange(list, 3, 1), CHIP_ERROR_NO_MEMORY);
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+
+    ASSERT_EQ(list.BeginAppend(), CHIP_NO_ERROR);
+    EXPECT_EQ(AppendRange(list, 3, 1), CHIP_ERROR_NO_MEMORY);
+    list.Rollback();
+    ExpectList(list, 3, 0);
+
+    PersistentList badPrefix;
+    EXPECT_EQ(badPrefix.Init(&storage, "a-prefix-that-is-far-too-long-for-keys", 3), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(badPrefix.Init(&storage, "", 3), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(TestPersistentList, InterruptedWritesAreCleanedUp)
+{
+    TestPersistentStorageDelegate storage;
+    {
+        PersistentList list;
+        ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+        ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+        ASSERT_EQ(AppendRange(list, 0, 3), CHIP_NO_ERROR);
+        ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+    }
+    std::set<std::string> committedKeys = storage.GetKeys();
+
+    // "Reboot" in the middle of a replace, then of an append.
+    {
+        PersistentList list;
+        ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+        ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+        ASSERT_EQ(AppendRange(list, 10, 5), CHIP_NO_ERROR);
+    }
+    {
+        PersistentList list;
+        ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+        ExpectList(list, 3, 0);
+        EXPECT_EQ(storage.GetKeys(), committedKeys);
+        ASSERT_EQ(list.BeginAppend(), CHIP_NO_ERROR);
+        ASSERT_EQ(AppendRange(list, 3, 5), CHIP_NO_ERROR);
+    }
+
+    PersistentList list;
+    ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+    ExpectList(list, 3, 0);
+    EXPECT_EQ(storage.GetKeys(), committedKeys);
+}
+
+TEST(TestPersistentList, InterruptedDeletesAreCleanedUp)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentList list;
+    ASSERT_EQ(list.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 0, 4), CHIP_NO_ERROR);
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+
+    // Fail the removal of the previous list partway through the commit of a replace, then "reboot".
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 10, 2), CHIP_NO_ERROR);
+    storage.AddPoisonKey("g/tl/b1");
+    ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+    storage.ClearPoisonKeys();
+    EXPECT_GT(storage.GetNumKeys(), 3u);
+
+    PersistentList reloaded;
+    ASSERT_EQ(reloaded.Init(&storage, kPrefix, 16), CHIP_NO_ERROR);
+    ExpectList(reloaded, 2, 10);
+    EXPECT_EQ(storage.GetNumKeys(), 3u);
+}
+
+// A 1000-element list is written with the memory of a single element, and storage operations proportional to its length.
+TEST(TestPersistentList, LargeList)
+{
+    constexpr uint16_t kElements = 1000;
+
+    TestPersistentStorageDelegate storage;
+    PersistentList list;
+    ASSERT_EQ(list.Init(&storage, kPrefix, kElements), CHIP_NO_ERROR);
+
+    for (uint16_t round = 0; round < 2; round++)
+    {
+        ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+        ASSERT_EQ(AppendRange(list, static_cast<uint16_t>(round * kElements), kElements), CHIP_NO_ERROR);
+        ASSERT_EQ(list.Commit(), CHIP_NO_ERROR);
+        ExpectList(list, kElements, static_cast<uint16_t>(round * kElements));
+        EXPECT_EQ(storage.GetNumKeys(), kElements + 1u);
+    }
+
+    ASSERT_EQ(list.BeginReplace(), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendRange(list, 0, kElements), CHIP_NO_ERROR);
+    list.Rollback();
+    ExpectList(list, kElements, kElements);
+    EXPECT_EQ(storage.GetNumKeys(), kElements + 1u);
+}
+
+} // namespace
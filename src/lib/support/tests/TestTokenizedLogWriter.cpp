@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/TokenizedLogWriter.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::Logging;
+
+namespace {
+
+constexpr uint64_t kHeaderTimestampUs = 1700000000123456;
+constexpr size_t kHeaderLength =
+    sizeof(TokenizedLogWriter::kMagic) + 1 + sizeof(uint64_t) + 1 + kLogModule_Max * TokenizedLogWriter::kModuleNameSize;
+
+std::vector<uint8_t> ReadFile(FILE * file)
+{
+    std::vector<uint8_t> content;
+    uint8_t buffer[256];
+    size_t length;
+
+    rewind(file);
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) != 0)
+    {
+        content.insert(content.end(), buffer, buffer + length);
+    }
+    return content;
+}
+
+TEST(TestTokenizedLogWriter, TestHeader)
+{
+    FILE * file = tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    TokenizedLogWriter writer(file);
+    EXPECT_EQ(writer.WriteHeader(kHeaderTimestampUs), CHIP_NO_ERROR);
+
+    std::vector<uint8_t> content = ReadFile(file);
+    ASSERT_EQ(content.size(), kHeaderLength);
+
+    const uint8_t * p = content.data();
+    EXPECT_EQ(memcmp(p, TokenizedLogWriter::kMagic, sizeof(TokenizedLogWriter::kMagic)), 0);
+    p += sizeof(TokenizedLogWriter::kMagic);
+    EXPECT_EQ(*p++, TokenizedLogWriter::kVersion);
+    EXPECT_EQ(Encoding::LittleEndian::Get64(p), kHeaderTimestampUs);
+    p += sizeof(uint64_t);
+    EXPECT_EQ(*p++, kLogModule_Max);
+
+    const char * name = reinterpret_cast<const char *>(p + kLogModule_SecureChannel * TokenizedLogWriter::kModuleNameSize);
+    EXPECT_STREQ(name, "SC");
+
+    fclose(file);
+}
+
+TEST(TestTokenizedLogWriter, TestRecords)
+{
+    // Token of the format string, followed by a zigzag-encoded integer argument.
+    const uint8_t kMessage1[] = { 0x78, 0x56, 0x34, 0x12, 0x54 };
+    // Token of a format string without arguments.
+    const uint8_t kMessage2[] = { 0xef, 0xcd, 0xab, 0x90 };
+
+    FILE * file = tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    TokenizedLogWriter writer(file);
+    EXPECT_EQ(writer.WriteHeader(kHeaderTimestampUs), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.WriteRecord(kLogModule_InteractionModel, kLogCategory_Progress, kHeaderTimestampUs + 300, ByteSpan(kMessage1)),
+              CHIP_NO_ERROR);
+    // Records may go back in time.
+    EXPECT_EQ(writer.WriteRecord(kLogModule_Echo, kLogCategory_Detail, kHeaderTimestampUs + 299, ByteSpan(kMessage2)),
+              CHIP_NO_ERROR);
+
+    const uint8_t kExpectedRecords[] = {
+        // Message length, category, module, timestamp delta of 300 (zigzag 600 as varint), message.
+        sizeof(kMessage1), kLogCategory_Progress, kLogModule_InteractionModel, 0xd8, 0x04, 0x78, 0x56, 0x34, 0x12, 0x54,
+        // Timestamp delta of -1 (zigzag 1).
+        sizeof(kMessage2), kLogCategory_Detail, kLogModule_Echo, 0x01, 0xef, 0xcd, 0xab, 0x90
+    };
+
+    std::vector<uint8_t> content = ReadFile(file);
+    ASSERT_EQ(content.size(), kHeaderLength + sizeof(kExpectedRecords));
+    EXPECT_EQ(memcmp(&content[kHeaderLength], kExpectedRecords, sizeof(kExpectedRecords)), 0);
+
+    fclose(file);
+}
+
+} // namespace
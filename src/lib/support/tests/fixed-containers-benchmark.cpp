@@ -0,0 +1,190 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the fixed-capacity containers against std::map, std::unordered_map and the linear scans of an
+ *      ObjectPool that the stack commonly uses for lookups by id.
+ *
+ *      For each container size, measures the time per lookup (half hits, half misses) and per churn operation (erase
+ *      one key, insert another) on a full container. Build in release mode for meaningful numbers.
+ */
+
+#include <lib/support/FixedHashMap.h>
+#include <lib/support/Pool.h>
+#include <lib/support/SortedFlatMap.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <stdio.h>
+#include <unordered_map>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kLookups = 1000000;
+constexpr size_t kChurns  = 200000;
+
+// Sink for looked up values, so that lookups cannot be optimized away.
+volatile uint32_t gSink;
+
+template <typename Map>
+struct Adapter
+{
+    Map map;
+
+    bool Insert(uint32_t key, uint32_t value) { return map.Insert(key, value) != nullptr; }
+    const uint32_t * Find(uint32_t key) const { return map.Find(key); }
+    void Erase(uint32_t key) { map.Erase(key); }
+};
+
+template <typename Key, typename Value>
+struct Adapter<std::map<Key, Value>>
+{
+    std::map<Key, Value> map;
+
+    bool Insert(uint32_t key, uint32_t value) { return map.emplace(key, value).second; }
+    const uint32_t * Find(uint32_t key) const
+    {
+        auto found = map.find(key);
+        return found != map.end() ? &found->second : nullptr;
+    }
+    void Erase(uint32_t key) { map.erase(key); }
+};
+
+template <typename Key, typename Value>
+struct Adapter<std::unordered_map<Key, Value>>
+{
+    std::unordered_map<Key, Value> map;
+
+    bool Insert(uint32_t key, uint32_t value) { return map.emplace(key, value).second; }
+    const uint32_t * Find(uint32_t key) const
+    {
+        auto found = map.find(key);
+        return found != map.end() ? &found->second : nullptr;
+    }
+    void Erase(uint32_t key) { map.erase(key); }
+};
+
+struct PoolEntry
+{
+    PoolEntry(uint32_t aKey, uint32_t aValue) : key(aKey), value(aValue) {}
+
+    uint32_t key;
+    uint32_t value;
+};
+
+// Lookup by walking the active objects of a pool, as done by e.g. session and exchange lookups.
+template <size_t kCapacity>
+struct PoolScan
+{
+    ~PoolScan() { pool.ReleaseAll(); }
+
+    bool Insert(uint32_t key, uint32_t value) { return pool.CreateObject(key, value) != nullptr; }
+    const uint32_t * Find(uint32_t key)
+    {
+        const uint32_t * value = nullptr;
+        pool.ForEachActiveObject([&](PoolEntry * entry) {
+            if (entry->key == key)
+            {
+                value = &entry->value;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        return value;
+    }
+    void Erase(uint32_t key)
+    {
+        pool.ForEachActiveObject([&](PoolEntry * entry) {
+            if (entry->key == key)
+            {
+                pool.ReleaseObject(entry);
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+    }
+
+    ObjectPool<PoolEntry, kCapacity, ObjectPoolMem::kInline> pool;
+};
+
+// Keys look like node ids or cluster ids: scattered, with some shared low bits. Even indices are present, odd ones are
+// misses.
+uint32_t KeyAt(size_t index)
+{
+    return static_cast<uint32_t>(index * 0x10001u + 0xFFF10000u);
+}
+
+template <typename Container>
+void Run(const char * name, size_t count)
+{
+    auto container = std::make_unique<Container>();
+    for (size_t i = 0; i < count; i++)
+    {
+        VerifyOrDie(container->Insert(KeyAt(2 * i), static_cast<uint32_t>(i)));
+    }
+
+    auto start   = std::chrono::steady_clock::now();
+    uint32_t sum = 0;
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        const uint32_t * value = container->Find(KeyAt(i % (2 * count)));
+        sum += value != nullptr ? *value : 1;
+    }
+    auto lookupEnd = std::chrono::steady_clock::now();
+
+    // Move the window of present keys forward: erase the oldest, insert a new one.
+    for (size_t i = 0; i < kChurns; i++)
+    {
+        container->Erase(KeyAt(2 * i));
+        VerifyOrDie(container->Insert(KeyAt(2 * (i + count)), static_cast<uint32_t>(i)));
+    }
+    auto churnEnd = std::chrono::steady_clock::now();
+    gSink         = sum;
+
+    double lookupNs = std::chrono::duration<double, std::nano>(lookupEnd - start).count() / kLookups;
+    double churnNs  = std::chrono::duration<double, std::nano>(churnEnd - lookupEnd).count() / kChurns;
+    printf("%-22s %6zu %12.1f %12.1f %10zu\n", name, count, lookupNs, churnNs, sizeof(Container));
+}
+
+template <size_t kCount>
+void RunAll()
+{
+    Run<Adapter<std::map<uint32_t, uint32_t>>>("std::map", kCount);
+    Run<Adapter<std::unordered_map<uint32_t, uint32_t>>>("std::unordered_map", kCount);
+    Run<PoolScan<kCount>>("ObjectPool scan", kCount);
+    Run<Adapter<FixedHashMap<uint32_t, uint32_t, kCount>>>("FixedHashMap", kCount);
+    Run<Adapter<StableFixedHashMap<uint32_t, uint32_t, kCount>>>("StableFixedHashMap", kCount);
+    Run<Adapter<SortedFlatMap<uint32_t, uint32_t, kCount>>>("SortedFlatMap", kCount);
+}
+
+} // namespace
+
+int main()
+{
+    // Sizes of the std containers exclude their heap allocations.
+    printf("%-22s %6s %12s %12s %10s\n", "container", "size", "lookup (ns)", "churn (ns)", "sizeof");
+    RunAll<8>();
+    RunAll<32>();
+    RunAll<128>();
+    return 0;
+}
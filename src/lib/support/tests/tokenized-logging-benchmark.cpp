@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the text logging against the tokenized logging to a binary log file: time per message and
+ *      size of the log per message, for a few typical messages of the stack.
+ *
+ *      The text messages are formatted and written to a file as done by the Linux LogV, and the tokenized messages
+ *      are written by the TokenizedLogWriter. Build in release mode for meaningful numbers.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/TokenizedLogWriter.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Logging;
+
+namespace {
+
+constexpr size_t kIterations           = 100000;
+constexpr size_t kMessagesPerIteration = 3;
+constexpr size_t kMessages             = kIterations * kMessagesPerIteration;
+
+// Same arguments for both loggings, for each iteration of kMessagesPerIteration messages.
+constexpr uint64_t kNodeId     = 0x123456789ABCDEF0;
+constexpr uint32_t kCounter    = 0x4d2c71a1;
+constexpr uint16_t kExchangeId = 31337;
+
+// Message logged for each received message; a literal for the tokenizer.
+#define MSG_RX_FORMAT                                                                                                              \
+    "<<< [E:" ChipLogFormatExchangeId " S:%u M:" ChipLogFormatMessageCounter "] (S) Msg RX from %u:" ChipLogFormatX64             \
+    " [%04X] --- Type %04x:%02x (%s:%s)"
+
+FILE * gTextLogFile;
+
+// Same output as the Linux LogV.
+void WriteTextLog(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+
+    flockfile(gTextLogFile);
+    fprintf(gTextLogFile, "[%" PRIu64 ".%06" PRIu64 "][%lld:%lld] CHIP:%s: ", static_cast<uint64_t>(tv.tv_sec),
+            static_cast<uint64_t>(tv.tv_usec), static_cast<long long>(syscall(SYS_getpid)),
+            static_cast<long long>(syscall(SYS_gettid)), module);
+    vfprintf(gTextLogFile, msg, args);
+    fputc('\n', gTextLogFile);
+    funlockfile(gTextLogFile);
+}
+
+// The text logging goes through Log, which the logging macros use when the tokenized logging is disabled.
+void LogMessagesAsText(size_t i)
+{
+    Log(kLogModule_ExchangeManager, kLogCategory_Progress, MSG_RX_FORMAT, ChipLogValueExchangeId(kExchangeId, true), 4660u,
+        static_cast<uint32_t>(kCounter + i), 1u, ChipLogValueX64(kNodeId), 0xABCDu, 0u, 0x10u, "SecureChannel", "StandaloneAck");
+    Log(kLogModule_DataManagement, kLogCategory_Detail, "Building Report, %u attributes in chunk", static_cast<unsigned>(i % 16));
+    Log(kLogModule_InteractionModel, kLogCategory_Detail, "Refresh Subscribe Sync Timer with min %d seconds and max %d seconds", 1,
+        60);
+}
+
+void LogMessagesTokenized(size_t i)
+{
+    ChipLogProgress(ExchangeManager, MSG_RX_FORMAT, ChipLogValueExchangeId(kExchangeId, true), 4660u,
+                    static_cast<uint32_t>(kCounter + i), 1u, ChipLogValueX64(kNodeId), 0xABCDu, 0u, 0x10u, "SecureChannel",
+                    "StandaloneAck");
+    ChipLogDetail(DataManagement, "Building Report, %u attributes in chunk", static_cast<unsigned>(i % 16));
+    ChipLogDetail(InteractionModel, "Refresh Subscribe Sync Timer with min %d seconds and max %d seconds", 1, 60);
+}
+
+off_t GetFileSize(const char * path)
+{
+    struct stat st;
+    VerifyOrDie(stat(path, &st) == 0);
+    return st.st_size;
+}
+
+void Report(const char * name, std::chrono::steady_clock::duration duration, off_t fileSize)
+{
+    double seconds = std::chrono::duration<double>(duration).count();
+    printf("%-10s %14.1f %14.0f %16.1f\n", name, seconds * 1e9 / kMessages, kMessages / seconds,
+           static_cast<double>(fileSize) / static_cast<double>(kMessages));
+}
+
+} // namespace
+
+int main()
+{
+    char textPath[]      = "/tmp/text-log-XXXXXX";
+    char tokenizedPath[] = "/tmp/tokenized-log-XXXXXX";
+    int fd;
+
+    VerifyOrDie((fd = mkstemp(textPath)) >= 0);
+    close(fd);
+    VerifyOrDie((fd = mkstemp(tokenizedPath)) >= 0);
+    close(fd);
+
+    printf("%-10s %14s %14s %16s\n", "logging", "ns / message", "messages / s", "bytes / message");
+
+    VerifyOrDie((gTextLogFile = fopen(textPath, "w")) != nullptr);
+    SetLogRedirectCallback(WriteTextLog);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        LogMessagesAsText(i);
+    }
+    fclose(gTextLogFile);
+    Report("text", std::chrono::steady_clock::now() - start, GetFileSize(textPath));
+    SetLogRedirectCallback(nullptr);
+
+    VerifyOrDie(StartTokenizedLogFile(tokenizedPath) == CHIP_NO_ERROR);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        LogMessagesTokenized(i);
+    }
+    StopTokenizedLogFile();
+    Report("tokenized", std::chrono::steady_clock::now() - start, GetFileSize(tokenizedPath));
+
+    unlink(textPath);
+    unlink(tokenizedPath);
+    return 0;
+}
@@ -36,6 +36,18 @@ const uint8_t Verhoeff10::sMultiplyTable[] = {
 
 const uint8_t Verhoeff10::sPermTable[] = { 1, 5, 7, 6, 2, 8, 3, 0, 9, 4 };
 
+namespace {
+
+// sPermTable applied i times, for i from 0 to 7: the permutation has an order of 8, so the permutation of the digit at
+// position i is sPermTablePowers[i % 8][val], without the i recursions of Verhoeff::Permute.
+const uint8_t sPermTablePowers[8][Verhoeff10::Base] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, { 1, 5, 7, 6, 2, 8, 3, 0, 9, 4 }, { 5, 8, 0, 3, 7, 9, 6, 1, 4, 2 },
+    { 8, 9, 1, 6, 0, 4, 3, 5, 2, 7 }, { 9, 4, 5, 3, 1, 2, 6, 8, 7, 0 }, { 4, 2, 8, 6, 5, 7, 3, 9, 0, 1 },
+    { 2, 7, 9, 3, 8, 0, 6, 4, 1, 5 }, { 7, 0, 4, 6, 9, 1, 3, 2, 5, 8 },
+};
+
+} // namespace
+
 char Verhoeff10::ComputeCheckChar(const char * str)
 {
     return ComputeCheckChar(str, strlen(str));
@@ -53,7 +65,7 @@ char Verhoeff10::ComputeCheckChar(const char * str, size_t strLen)
         if (val < 0)
             return 0; // invalid character
 
-        int p = Verhoeff::Permute(val, sPermTable, Base, i);
+        int p = sPermTablePowers[i % 8][val];
 
         c = sMultiplyTable[c * Base + p];
     }
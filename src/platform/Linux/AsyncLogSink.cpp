@@ -0,0 +1,394 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "AsyncLogSink.h"
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/Constants.h>
+#include <platform/CHIPDeviceConfig.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace chip {
+namespace Logging {
+namespace Platform {
+
+namespace {
+
+constexpr size_t kRecordAlignment = 8;
+constexpr size_t kBatchSize       = 64 * 1024;
+
+constexpr uint32_t kPaddingMarker = UINT32_MAX;
+
+std::atomic<uint64_t> sNextGeneration{ 1 };
+
+size_t AlignRecordLength(size_t length)
+{
+    return (length + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+}
+
+} // namespace
+
+struct AsyncLogSink::RecordHeader
+{
+    // Total length of the record, including the header and the alignment padding.
+    uint32_t length;
+    // Length of the message following the header, or kPaddingMarker for the padding up to the end of the buffer.
+    uint32_t messageLength;
+    uint64_t timestampSec;
+    uint32_t timestampUsec;
+    uint8_t category;
+    const char * module;
+};
+
+/**
+ * Ring buffer written by a single logging thread, and read by the writer thread. The head and tail are the total number of
+ * bytes written and read: records are written at head modulo the size, and are never split, a padding record filling the
+ * space left at the end of the buffer when needed.
+ */
+class AsyncLogSink::ThreadBuffer
+{
+public:
+    // Only the first two fields of a padding record are written.
+    static constexpr size_t kPaddingRecordLength = offsetof(RecordHeader, timestampSec);
+    static_assert(kPaddingRecordLength <= kRecordAlignment, "Padding records must fit in any space left at the end of a buffer");
+
+    ThreadBuffer(size_t size, long long tid) : mData(new uint8_t[size]), mSize(size), mTid(tid) {}
+
+    // Called by the logging thread.
+    bool Push(const RecordHeader & header, const char * message)
+    {
+        size_t head      = mHead.load(std::memory_order_relaxed);
+        size_t tail      = mTail.load(std::memory_order_acquire);
+        size_t offset    = head % mSize;
+        size_t padding   = (mSize - offset < header.length) ? (mSize - offset) : 0;
+        size_t available = mSize - (head - tail);
+
+        if (available < padding + header.length)
+        {
+            mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (padding != 0)
+        {
+            RecordHeader paddingHeader;
+            paddingHeader.length        = static_cast<uint32_t>(padding);
+            paddingHeader.messageLength = kPaddingMarker;
+            memcpy(&mData[offset], &paddingHeader, kPaddingRecordLength);
+            offset = 0;
+        }
+
+        memcpy(&mData[offset], &header, sizeof(header));
+        memcpy(&mData[offset + sizeof(header)], message, header.messageLength);
+        mHead.store(head + padding + header.length, std::memory_order_release);
+        return true;
+    }
+
+    // Called by the writer thread: get the next record, if any, without consuming it.
+    bool Peek(RecordHeader & header, const char *& message)
+    {
+        size_t head = mHead.load(std::memory_order_acquire);
+        size_t tail = mTail.load(std::memory_order_relaxed);
+
+        while (tail != head)
+        {
+            size_t offset = tail % mSize;
+            memcpy(&header, &mData[offset], kPaddingRecordLength);
+            if (header.messageLength != kPaddingMarker)
+            {
+                memcpy(&header, &mData[offset], sizeof(header));
+                message = reinterpret_cast<const char *>(&mData[offset + sizeof(header)]);
+                return true;
+            }
+
+            tail += header.length;
+            mTail.store(tail, std::memory_order_release);
+        }
+        return false;
+    }
+
+    // Called by the writer thread, once done with the record returned by Peek.
+    void Pop(const RecordHeader & header)
+    {
+        mTail.store(mTail.load(std::memory_order_relaxed) + header.length, std::memory_order_release);
+    }
+
+    bool IsEmpty() const { return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_relaxed); }
+
+    uint64_t TakeDroppedCount() { return mDroppedCount.exchange(0, std::memory_order_relaxed); }
+
+    long long GetTid() const { return mTid; }
+
+private:
+    const std::unique_ptr<uint8_t[]> mData;
+    const size_t mSize;
+    const long long mTid;
+
+    // The head and tail are on different cache lines, so that the logging thread and the writer thread do not contend.
+    alignas(64) std::atomic<size_t> mHead{ 0 };
+    alignas(64) std::atomic<size_t> mTail{ 0 };
+    std::atomic<uint64_t> mDroppedCount{ 0 };
+};
+
+AsyncLogSink::AsyncLogSink(FILE * output, size_t threadBufferSize, std::chrono::milliseconds drainInterval) :
+    mOutput(output),
+    // A buffer holds at least two messages of the maximum length.
+    mThreadBufferSize(AlignRecordLength(
+        std::max(threadBufferSize, 2 * AlignRecordLength(sizeof(RecordHeader) + CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE)))),
+    mDrainInterval(drainInterval)
+{}
+
+AsyncLogSink & AsyncLogSink::Instance()
+{
+    static AsyncLogSink sInstance(stdout, CHIP_DEVICE_CONFIG_LOG_ASYNC_BUFFER_SIZE);
+    return sInstance;
+}
+
+CHIP_ERROR AsyncLogSink::Start()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(!mThread.joinable(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!mBatch)
+    {
+        mBatch.reset(new char[kBatchSize]);
+    }
+    mPid = static_cast<long long>(syscall(SYS_getpid));
+
+    // The buffers of the threads that logged to a previous run of the sink are not reused.
+    mGeneration.store(sNextGeneration.fetch_add(1, std::memory_order_relaxed), std::memory_order_release);
+    mStopping = false;
+    mThread   = std::thread(&AsyncLogSink::Run, this);
+    mRunning.store(true, std::memory_order_release);
+    return CHIP_NO_ERROR;
+}
+
+void AsyncLogSink::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturn(mThread.joinable());
+        mRunning.store(false, std::memory_order_release);
+        mStopping = true;
+    }
+    mWakeCondition.notify_one();
+    mThread.join();
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mBuffers.clear();
+    mDrainedBuffers.clear();
+}
+
+bool AsyncLogSink::Log(const char * module, uint8_t category, const char * msg, va_list v)
+{
+    VerifyOrReturnValue(IsRunning(), false);
+
+    ThreadBuffer * buffer = GetThreadBuffer();
+    VerifyOrReturnValue(buffer != nullptr, false);
+
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+
+    char message[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    int messageLength = vsnprintf(message, sizeof(message), msg, v);
+
+    RecordHeader header;
+    header.messageLength = static_cast<uint32_t>(std::clamp(messageLength, 0, static_cast<int>(sizeof(message) - 1)));
+    header.length        = static_cast<uint32_t>(AlignRecordLength(sizeof(header) + header.messageLength));
+    header.timestampSec  = static_cast<uint64_t>(tv.tv_sec);
+    header.timestampUsec = static_cast<uint32_t>(tv.tv_usec);
+    header.category      = category;
+    header.module        = module;
+
+    if (category == kLogCategory_Error)
+    {
+        // An error is often followed by an abort (e.g. VerifyOrDie), which would lose the queued messages: write it before
+        // returning, once the messages queued before it are written.
+        char line[kMaxLineLength];
+        size_t length = FormatLine(line, header, message, static_cast<long long>(syscall(SYS_gettid)));
+        Flush();
+        fwrite(line, 1, length, mOutput);
+        fflush(mOutput);
+        return true;
+    }
+
+    // A dropped message is counted, and reported by the writer thread.
+    buffer->Push(header, message);
+    return true;
+}
+
+void AsyncLogSink::Flush()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    VerifyOrReturn(mThread.joinable() && !mStopping);
+
+    uint64_t request = ++mFlushRequested;
+    mWakeCondition.notify_one();
+    mFlushedCondition.wait(lock, [this, request] { return mFlushCompleted >= request || mStopping; });
+}
+
+AsyncLogSink::ThreadBuffer * AsyncLogSink::GetThreadBuffer()
+{
+    struct ThreadBufferRef
+    {
+        uint64_t generation = 0;
+        std::shared_ptr<ThreadBuffer> buffer;
+    };
+    thread_local ThreadBufferRef tBufferRef;
+
+    // Once registered, the buffer of the thread is used without taking the lock.
+    if (tBufferRef.generation == mGeneration.load(std::memory_order_acquire))
+    {
+        return tBufferRef.buffer.get();
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnValue(!mStopping, nullptr);
+
+    tBufferRef.buffer     = std::make_shared<ThreadBuffer>(mThreadBufferSize, static_cast<long long>(syscall(SYS_gettid)));
+    tBufferRef.generation = mGeneration.load(std::memory_order_relaxed);
+    mBuffers.push_back(tBufferRef.buffer);
+    return tBufferRef.buffer.get();
+}
+
+void AsyncLogSink::Run()
+{
+    mWriterTid = static_cast<long long>(syscall(SYS_gettid));
+
+    std::unique_lock<std::mutex> lock(mLock);
+    while (true)
+    {
+        mWakeCondition.wait_for(lock, mDrainInterval, [this] { return mStopping || mFlushRequested != mFlushCompleted; });
+
+        uint64_t flushRequest = mFlushRequested;
+        bool stopping         = mStopping;
+
+        // Buffers only referenced by the sink belong to threads that exited: drop them once drained.
+        mBuffers.erase(std::remove_if(mBuffers.begin(), mBuffers.end(),
+                                      [](const std::shared_ptr<ThreadBuffer> & buffer) {
+                                          return buffer.use_count() == 1 && buffer->IsEmpty();
+                                      }),
+                       mBuffers.end());
+        mDrainedBuffers = mBuffers;
+
+        lock.unlock();
+        Drain();
+        lock.lock();
+
+        mFlushCompleted = flushRequest;
+        mFlushedCondition.notify_all();
+        if (stopping)
+        {
+            break;
+        }
+    }
+}
+
+void AsyncLogSink::Drain()
+{
+    char line[kMaxLineLength];
+    uint64_t droppedCount = 0;
+
+    for (const auto & buffer : mDrainedBuffers)
+    {
+        droppedCount += buffer->TakeDroppedCount();
+    }
+
+    // Write the records of all the threads in timestamp order, by taking the oldest of the next records of the threads.
+    while (true)
+    {
+        ThreadBuffer * oldest = nullptr;
+        RecordHeader oldestHeader;
+        const char * oldestMessage = nullptr;
+
+        for (const auto & buffer : mDrainedBuffers)
+        {
+            RecordHeader header;
+            const char * message;
+            if (buffer->Peek(header, message) &&
+                (oldest == nullptr || header.timestampSec < oldestHeader.timestampSec ||
+                 (header.timestampSec == oldestHeader.timestampSec && header.timestampUsec < oldestHeader.timestampUsec)))
+            {
+                oldest        = buffer.get();
+                oldestHeader  = header;
+                oldestMessage = message;
+            }
+        }
+        if (oldest == nullptr)
+        {
+            break;
+        }
+
+        size_t length = FormatLine(line, oldestHeader, oldestMessage, oldest->GetTid());
+        oldest->Pop(oldestHeader);
+        Append(line, length);
+    }
+
+    if (droppedCount != 0)
+    {
+        mDroppedCount.fetch_add(droppedCount, std::memory_order_relaxed);
+
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+
+        int length = snprintf(line, sizeof(line), "[%" PRIu64 ".%06" PRIu64 "][%lld:%lld] CHIP:LOG: %" PRIu64
+                              " log messages dropped\n",
+                              static_cast<uint64_t>(tv.tv_sec), static_cast<uint64_t>(tv.tv_usec), mPid, mWriterTid, droppedCount);
+        Append(line, static_cast<size_t>(std::clamp(length, 0, static_cast<int>(sizeof(line) - 1))));
+    }
+
+    WriteBatch();
+}
+
+size_t AsyncLogSink::FormatLine(char (&line)[kMaxLineLength], const RecordHeader & header, const char * message,
+                                long long tid) const
+{
+    // Same format as the synchronous LogV.
+    int length = snprintf(line, sizeof(line), "[%" PRIu64 ".%06" PRIu32 "][%lld:%lld] CHIP:%s: %.*s\n", header.timestampSec,
+                          header.timestampUsec, mPid, tid, header.module, static_cast<int>(header.messageLength), message);
+    return static_cast<size_t>(std::clamp(length, 0, static_cast<int>(sizeof(line) - 1)));
+}
+
+void AsyncLogSink::Append(const char * data, size_t length)
+{
+    if (mBatchLength + length > kBatchSize)
+    {
+        WriteBatch();
+    }
+    memcpy(&mBatch[mBatchLength], data, length);
+    mBatchLength += length;
+}
+
+void AsyncLogSink::WriteBatch()
+{
+    VerifyOrReturn(mBatchLength != 0);
+
+    fwrite(mBatch.get(), 1, mBatchLength, mOutput);
+    fflush(mOutput);
+    mBatchLength = 0;
+}
+
+} // namespace Platform
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Asynchronous sink for the log messages of the chip Device Layer
+ *          on Linux platforms.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace Logging {
+namespace Platform {
+
+/**
+ * Log sink that takes the formatting of the message header and the writing of the log messages off the logging threads.
+ *
+ * Each thread formats its messages into its own ring buffer, which only it writes to and only the writer thread of the sink
+ * reads from, without any lock. The writer thread periodically drains all the buffers, in timestamp order, and writes the
+ * lines in large batches. When the buffer of a thread is full, its messages are dropped rather than blocking the thread:
+ * the number of dropped messages is written in the log, and counted by GetDroppedCount().
+ *
+ * Error messages are written by the logging thread before Log returns, after the messages queued before them, so that
+ * they are not lost if the process aborts right after. Messages logged while the sink is stopping may be lost.
+ */
+class AsyncLogSink
+{
+public:
+    static constexpr std::chrono::milliseconds kDefaultDrainInterval = std::chrono::milliseconds(10);
+
+    /**
+     * @param output           Where the log lines are written.
+     * @param threadBufferSize Size of the buffer of each logging thread, in bytes.
+     * @param drainInterval    Maximum time between two drains of the buffers.
+     */
+    AsyncLogSink(FILE * output, size_t threadBufferSize, std::chrono::milliseconds drainInterval = kDefaultDrainInterval);
+    ~AsyncLogSink() { Stop(); }
+
+    AsyncLogSink(const AsyncLogSink &)             = delete;
+    AsyncLogSink & operator=(const AsyncLogSink &) = delete;
+
+    /// Sink writing to stdout, used by LogV when CHIP_DEVICE_CONFIG_LOG_ASYNC is enabled.
+    static AsyncLogSink & Instance();
+
+    /// Start the writer thread.
+    CHIP_ERROR Start();
+
+    /// Write the pending messages, and stop the writer thread.
+    void Stop();
+
+    bool IsRunning() const { return mRunning.load(std::memory_order_acquire); }
+
+    /**
+     * Queue a log message, or write it if it is an error.
+     *
+     * @return false if the sink is not running, in which case the message must be written by the caller.
+     */
+    bool Log(const char * module, uint8_t category, const char * msg, va_list v);
+
+    /// Wait until the messages queued before the call are written.
+    void Flush();
+
+    /// Total number of messages dropped because the buffer of their thread was full.
+    uint64_t GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+private:
+    class ThreadBuffer;
+    struct RecordHeader;
+
+    // Longest line: header, module, message and new line.
+    static constexpr size_t kMaxLineLength = 64 + CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE;
+
+    ThreadBuffer * GetThreadBuffer();
+    size_t FormatLine(char (&line)[kMaxLineLength], const RecordHeader & header, const char * message, long long tid) const;
+    void Run();
+    void Drain();
+    void Append(const char * data, size_t length);
+    void WriteBatch();
+
+    FILE * const mOutput;
+    const size_t mThreadBufferSize;
+    const std::chrono::milliseconds mDrainInterval;
+
+    // Protects the members below, up to the writer thread.
+    std::mutex mLock;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mFlushedCondition;
+    std::vector<std::shared_ptr<ThreadBuffer>> mBuffers;
+    uint64_t mFlushRequested = 0;
+    uint64_t mFlushCompleted = 0;
+    bool mStopping           = false;
+    std::thread mThread;
+
+    // Identifies the current run of the sink, to which the buffers of the threads belong.
+    std::atomic<uint64_t> mGeneration{ 0 };
+    std::atomic<bool> mRunning{ false };
+    std::atomic<uint64_t> mDroppedCount{ 0 };
+
+    // Only used by the writer thread.
+    std::vector<std::shared_ptr<ThreadBuffer>> mDrainedBuffers;
+    std::unique_ptr<char[]> mBatch;
+    size_t mBatchLength  = 0;
+    long long mPid       = 0;
+    long long mWriterTid = 0;
+};
+
+} // namespace Platform
+} // namespace Logging
+} // namespace chip
@@ -68,6 +68,25 @@
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 
+/**
+ * CHIP_DEVICE_CONFIG_LOG_ASYNC
+ *
+ * Write the log messages from a dedicated thread (see AsyncLogSink), instead of from the threads that log them.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LOG_ASYNC
+#define CHIP_DEVICE_CONFIG_LOG_ASYNC 0
+#endif // CHIP_DEVICE_CONFIG_LOG_ASYNC
+
+/**
+ * CHIP_DEVICE_CONFIG_LOG_ASYNC_BUFFER_SIZE
+ *
+ * Size, in bytes, of the buffer of each thread logging through the AsyncLogSink. Messages are dropped when the buffer of
+ * their thread is full.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LOG_ASYNC_BUFFER_SIZE
+#define CHIP_DEVICE_CONFIG_LOG_ASYNC_BUFFER_SIZE (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LOG_ASYNC_BUFFER_SIZE
+
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY_FULL 0
@@ -4,6 +4,14 @@
 
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/logging/Constants.h>
+#include <platform/CHIPDeviceConfig.h>
+
+#if CHIP_DEVICE_CONFIG_LOG_ASYNC
+#include "AsyncLogSink.h"
+
+#include <cstdlib>
+#include <mutex>
+#endif // CHIP_DEVICE_CONFIG_LOG_ASYNC
 
 #include <cinttypes>
 #include <cstdio>
@@ -28,11 +36,40 @@ void __attribute__((weak)) OnLogOutput() {}
 namespace Logging {
 namespace Platform {
 
+#if CHIP_DEVICE_CONFIG_LOG_ASYNC
+namespace {
+
+std::once_flag sAsyncLogSinkStarted;
+
+void StopAsyncLogSink()
+{
+    AsyncLogSink::Instance().Stop();
+}
+
+} // namespace
+#endif // CHIP_DEVICE_CONFIG_LOG_ASYNC
+
 /**
  * CHIP log output functions.
  */
 void LogV(const char * module, uint8_t category, const char * msg, va_list v)
 {
+#if CHIP_DEVICE_CONFIG_LOG_ASYNC
+    // The sink is stopped at exit, once its pending messages are written. Messages are written synchronously when it is not
+    // running.
+    std::call_once(sAsyncLogSinkStarted, [] {
+        if (AsyncLogSink::Instance().Start() == CHIP_NO_ERROR)
+        {
+            atexit(StopAsyncLogSink);
+        }
+    });
+    if (AsyncLogSink::Instance().Log(module, category, msg, v))
+    {
+        DeviceLayer::OnLogOutput();
+        return;
+    }
+#endif // CHIP_DEVICE_CONFIG_LOG_ASYNC
+
     struct timeval tv;
 
     // Should not fail per man page of gettimeofday(), but failed to get time is not a fatal error in log. The bad time value will
@@ -0,0 +1,223 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the asynchronous log
+ *      sink of Linux platforms.
+ *
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/Constants.h>
+#include <platform/Linux/AsyncLogSink.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Logging;
+using namespace chip::Logging::Platform;
+
+namespace {
+
+bool Log(AsyncLogSink & sink, const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    bool queued = sink.Log("TST", kLogCategory_Progress, msg, v);
+    va_end(v);
+    return queued;
+}
+
+bool LogError(AsyncLogSink & sink, const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    bool handled = sink.Log("TST", kLogCategory_Error, msg, v);
+    va_end(v);
+    return handled;
+}
+
+std::vector<std::string> ReadLines(FILE * file)
+{
+    std::vector<std::string> lines;
+    char line[512];
+
+    rewind(file);
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        lines.emplace_back(line);
+    }
+    return lines;
+}
+
+// Message of a log line, after the "CHIP:<module>: " prefix.
+std::string GetMessage(const std::string & line)
+{
+    size_t position = line.find(" CHIP:");
+    position        = (position == std::string::npos) ? std::string::npos : line.find(": ", position);
+    return (position == std::string::npos) ? std::string() : line.substr(position + 2);
+}
+
+} // namespace
+
+TEST(TestAsyncLogSink, LogWhenStopped)
+{
+    FILE * output = tmpfile();
+    ASSERT_NE(output, nullptr);
+
+    AsyncLogSink sink(output, 4096);
+    EXPECT_FALSE(sink.IsRunning());
+    EXPECT_FALSE(Log(sink, "not queued"));
+
+    EXPECT_EQ(sink.Start(), CHIP_NO_ERROR);
+    EXPECT_EQ(sink.Start(), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_TRUE(Log(sink, "queued"));
+    sink.Stop();
+    EXPECT_FALSE(Log(sink, "not queued"));
+
+    std::vector<std::string> lines = ReadLines(output);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(GetMessage(lines[0]), "queued\n");
+    EXPECT_NE(lines[0].find("CHIP:TST: "), std::string::npos);
+
+    fclose(output);
+}
+
+TEST(TestAsyncLogSink, MessagesOfEachThreadInOrder)
+{
+    constexpr int kThreads  = 4;
+    constexpr int kMessages = 500;
+
+    FILE * output = tmpfile();
+    ASSERT_NE(output, nullptr);
+
+    AsyncLogSink sink(output, 64 * 1024);
+    ASSERT_EQ(sink.Start(), CHIP_NO_ERROR);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < kThreads; thread++)
+    {
+        threads.emplace_back([&sink, thread] {
+            for (int message = 0; message < kMessages; message++)
+            {
+                EXPECT_TRUE(Log(sink, "%d %d", thread, message));
+                // Leave time to the writer thread, so that no message is dropped.
+                if (message % 50 == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    sink.Flush();
+    EXPECT_EQ(sink.GetDroppedCount(), 0u);
+
+    std::vector<std::string> lines = ReadLines(output);
+    EXPECT_EQ(lines.size(), static_cast<size_t>(kThreads * kMessages));
+
+    int nextMessage[kThreads] = {};
+    for (const auto & line : lines)
+    {
+        int thread;
+        int message;
+        ASSERT_EQ(sscanf(GetMessage(line).c_str(), "%d %d", &thread, &message), 2);
+        ASSERT_GE(thread, 0);
+        ASSERT_LT(thread, kThreads);
+        EXPECT_EQ(message, nextMessage[thread]);
+        nextMessage[thread] = message + 1;
+    }
+
+    sink.Stop();
+    fclose(output);
+}
+
+TEST(TestAsyncLogSink, DroppedMessagesAreCounted)
+{
+    constexpr int kMessages = 1000;
+
+    FILE * output = tmpfile();
+    ASSERT_NE(output, nullptr);
+
+    // The smallest buffer, which is not drained while logging.
+    AsyncLogSink sink(output, 0, std::chrono::milliseconds(60 * 1000));
+    ASSERT_EQ(sink.Start(), CHIP_NO_ERROR);
+
+    for (int message = 0; message < kMessages; message++)
+    {
+        EXPECT_TRUE(Log(sink, "%0200d", message));
+    }
+    sink.Flush();
+
+    std::vector<std::string> lines = ReadLines(output);
+    uint64_t dropped               = sink.GetDroppedCount();
+    EXPECT_GT(dropped, 0u);
+    ASSERT_FALSE(lines.empty());
+
+    // The queued messages come first, followed by the number of dropped messages.
+    EXPECT_EQ(lines.size() - 1 + dropped, static_cast<uint64_t>(kMessages));
+    for (size_t i = 0; i + 1 < lines.size(); i++)
+    {
+        EXPECT_EQ(atoi(GetMessage(lines[i]).c_str()), static_cast<int>(i));
+    }
+    EXPECT_EQ(GetMessage(lines.back()), std::to_string(dropped) + " log messages dropped\n");
+
+    // Once drained, the buffer can be used again.
+    EXPECT_TRUE(Log(sink, "after drain"));
+    sink.Flush();
+    EXPECT_EQ(sink.GetDroppedCount(), dropped);
+    EXPECT_EQ(GetMessage(ReadLines(output).back()), "after drain\n");
+
+    sink.Stop();
+    fclose(output);
+}
+
+TEST(TestAsyncLogSink, ErrorsAreWrittenBeforeReturning)
+{
+    FILE * output = tmpfile();
+    ASSERT_NE(output, nullptr);
+
+    // Not drained while logging, so that only the error can cause the messages to be written.
+    AsyncLogSink sink(output, 4096, std::chrono::milliseconds(60 * 1000));
+    ASSERT_EQ(sink.Start(), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(Log(sink, "before"));
+    EXPECT_TRUE(LogError(sink, "error %d", 42));
+
+    // Both are written without a flush of the sink, the error after the message queued before it.
+    std::vector<std::string> lines = ReadLines(output);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(GetMessage(lines[0]), "before\n");
+    EXPECT_EQ(GetMessage(lines[1]), "error 42\n");
+    EXPECT_NE(lines[1].find("CHIP:TST: "), std::string::npos);
+
+    sink.Stop();
+    fclose(output);
+}
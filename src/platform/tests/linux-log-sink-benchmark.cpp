@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Microbenchmark of the Linux log output, writing synchronously (LogV) or through the AsyncLogSink: throughput
+ *      and latency of the logging calls, for a few logging threads.
+ *
+ *      The log lines are written to a temporary file, in place of stdout.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/Constants.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/AsyncLogSink.h>
+#include <platform/logging/LogV.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Logging;
+using namespace chip::Logging::Platform;
+
+namespace {
+
+constexpr size_t kMessagesPerThread = 20000;
+constexpr size_t kThreadCounts[]    = { 1, 4 };
+
+// Buffer of each thread: the default one, and one large enough for all the messages of the thread.
+constexpr size_t kThreadBufferSizes[] = { CHIP_DEVICE_CONFIG_LOG_ASYNC_BUFFER_SIZE, 4 * 1024 * 1024 };
+
+// A typical message of the SDK.
+constexpr char kMessageFormat[] = "Received message of type 0x%02x with protocolId (0, %u) and MessageCounter:%u on exchange %u%c";
+
+void Log(AsyncLogSink * sink, ...)
+{
+    va_list v;
+    va_start(v, sink);
+    if (sink == nullptr || !sink->Log("EM", kLogCategory_Progress, kMessageFormat, v))
+    {
+        LogV("EM", kLogCategory_Progress, kMessageFormat, v);
+    }
+    va_end(v);
+}
+
+double Percentile(const std::vector<uint32_t> & sortedLatencies, double percentile)
+{
+    size_t index = static_cast<size_t>(percentile / 100 * static_cast<double>(sortedLatencies.size() - 1));
+    return sortedLatencies[index] / 1000.0;
+}
+
+void Run(size_t threadCount, AsyncLogSink * sink, size_t threadBufferSize)
+{
+    // Latency of each call, in ns.
+    std::vector<uint32_t> latencies(threadCount * kMessagesPerThread);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t thread = 0; thread < threadCount; thread++)
+    {
+        threads.emplace_back([&latencies, sink, thread] {
+            uint32_t * threadLatencies = &latencies[thread * kMessagesPerThread];
+            for (size_t i = 0; i < kMessagesPerThread; i++)
+            {
+                auto callStart = std::chrono::steady_clock::now();
+                Log(sink, 0x16u, 1u, static_cast<unsigned>(i), static_cast<unsigned>(thread), 'i');
+                auto callEnd = std::chrono::steady_clock::now();
+
+                threadLatencies[i] =
+                    static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(callEnd - callStart).count());
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    // Throughput up to the write of all the messages.
+    if (sink != nullptr)
+    {
+        sink->Flush();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::sort(latencies.begin(), latencies.end());
+    double seconds   = std::chrono::duration<double>(end - start).count();
+    uint64_t dropped = (sink == nullptr) ? 0 : sink->GetDroppedCount();
+    fprintf(stderr, "%-6s %8zu %8zu %14.0f %9.2f %9.2f %10.2f %9.2f %9llu\n", sink == nullptr ? "sync" : "async", threadCount,
+            threadBufferSize / 1024, static_cast<double>(latencies.size() - dropped) / seconds, Percentile(latencies, 50),
+            Percentile(latencies, 99), Percentile(latencies, 99.9), latencies.back() / 1000.0,
+            static_cast<unsigned long long>(dropped));
+}
+
+} // namespace
+
+int main()
+{
+    char path[] = "/tmp/linux-log-sink-benchmark-XXXXXX";
+    int fd      = mkstemp(path);
+    VerifyOrDie(fd >= 0);
+    close(fd);
+    VerifyOrDie(freopen(path, "w", stdout) != nullptr);
+
+    // Throughput of the messages written, and latency of the logging calls.
+    fprintf(stderr, "%-6s %8s %8s %14s %9s %9s %10s %9s %9s\n", "sink", "threads", "KB", "written msgs/s", "p50 (us)",
+            "p99 (us)", "p99.9 (us)", "max (us)", "dropped");
+    for (size_t threadCount : kThreadCounts)
+    {
+        Run(threadCount, nullptr, 0);
+
+        for (size_t threadBufferSize : kThreadBufferSizes)
+        {
+            AsyncLogSink sink(stdout, threadBufferSize);
+            VerifyOrDie(sink.Start() == CHIP_NO_ERROR);
+            Run(threadCount, &sink, threadBufferSize);
+            sink.Stop();
+        }
+    }
+
+    fclose(stdout);
+    unlink(path);
+    return 0;
+}
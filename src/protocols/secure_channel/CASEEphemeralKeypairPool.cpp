@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/LockTracker.h>
+#include <platform/PlatformManager.h>
+
+namespace chip {
+
+using namespace Crypto;
+
+CHIP_ERROR CASEEphemeralKeypairPool::Init(size_t capacity)
+{
+    VerifyOrReturnError(mKeypairs.Get() == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(capacity > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mKeypairs.Calloc(capacity);
+    VerifyOrReturnError(mKeypairs.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    mCount = 0;
+
+    ScheduleRefill();
+    return CHIP_NO_ERROR;
+}
+
+void CASEEphemeralKeypairPool::Shutdown()
+{
+    if (mRefill)
+    {
+        // A generation in progress completes without the pool, and deletes its keypair.
+        mRefill->pool = nullptr;
+        mRefill.reset();
+    }
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        ReleaseKeypair(mKeypairs[i]);
+        mKeypairs[i] = nullptr;
+    }
+    mCount = 0;
+    mKeypairs.Free();
+}
+
+P256Keypair * CASEEphemeralKeypairPool::TakeKeypair()
+{
+    assertChipStackLockedByCurrentThread();
+
+    P256Keypair * keypair = nullptr;
+    if (mCount > 0)
+    {
+        mCount--;
+        keypair           = mKeypairs[mCount];
+        mKeypairs[mCount] = nullptr;
+    }
+
+    ScheduleRefill();
+    return keypair;
+}
+
+void CASEEphemeralKeypairPool::ScheduleRefill()
+{
+    VerifyOrReturn(mCount < Capacity());
+
+    if (mRefill)
+    {
+        // A generation whose completion could not be scheduled back will never complete: start over.
+        VerifyOrReturn(mRefill->scheduleFailed.load());
+        mRefill.reset();
+    }
+
+    auto refill = Platform::MakeShared<Refill>();
+    VerifyOrReturn(refill);
+    refill->keypair = Platform::New<P256Keypair>();
+    VerifyOrReturn(refill->keypair != nullptr);
+    refill->pool = this;
+
+    // The scheduled work holds its own reference to the refill until it completes.
+    auto * workRefill = Platform::New<Platform::SharedPtr<Refill>>(refill);
+    VerifyOrReturn(workRefill != nullptr);
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(GenerateKeypair, reinterpret_cast<intptr_t>(workRefill));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to schedule CASE ephemeral keypair generation: %" CHIP_ERROR_FORMAT, err.Format());
+        Platform::Delete(workRefill);
+        return;
+    }
+    mRefill = std::move(refill);
+}
+
+void CASEEphemeralKeypairPool::GenerateKeypair(intptr_t arg)
+{
+    auto * workRefill = reinterpret_cast<Platform::SharedPtr<Refill> *>(arg);
+    Refill & refill   = **workRefill;
+
+    // Executed in the background thread: only the keypair of the refill is used here.
+    refill.status = refill.keypair->Initialize(ECPKeyTarget::ECDH);
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(AddGeneratedKeypair, arg);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to schedule adding a CASE ephemeral keypair: %" CHIP_ERROR_FORMAT, err.Format());
+        refill.scheduleFailed.store(true);
+        Platform::Delete(workRefill);
+    }
+}
+
+void CASEEphemeralKeypairPool::AddGeneratedKeypair(intptr_t arg)
+{
+    assertChipStackLockedByCurrentThread();
+
+    auto * workRefill = reinterpret_cast<Platform::SharedPtr<Refill> *>(arg);
+    Platform::SharedPtr<Refill> refill(std::move(*workRefill));
+    Platform::Delete(workRefill);
+
+    VerifyOrReturn(refill->pool != nullptr);
+    refill->pool->OnKeypairGenerated(*refill);
+}
+
+void CASEEphemeralKeypairPool::OnKeypairGenerated(Refill & refill)
+{
+    mRefill.reset();
+
+    if (refill.status != CHIP_NO_ERROR)
+    {
+        // Not retried right away: the next TakeKeypair schedules another attempt.
+        ChipLogError(SecureChannel, "Failed to generate a CASE ephemeral keypair: %" CHIP_ERROR_FORMAT, refill.status.Format());
+        return;
+    }
+
+    VerifyOrReturn(mCount < Capacity());
+    mKeypairs[mCount++] = refill.keypair;
+    refill.keypair      = nullptr;
+
+    ScheduleRefill();
+}
+
+} // namespace chip
@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <atomic>
+
+namespace chip {
+
+/**
+ * Bounded pool of ECDH keypairs generated ahead of time for CASE, so that Sigma1 (initiator) and Sigma2 (responder) do
+ * not have to generate their ephemeral keypair on the critical path of the handshake.
+ *
+ * Keypairs are generated one at a time via `PlatformManager::ScheduleBackgroundWork`, and added to the pool on the Matter
+ * thread. Every keypair taken from the pool schedules the generation of a new one. A keypair is handed out only once, and
+ * is deleted (which clears its key material) by ReleaseKeypair once the session is done with it.
+ *
+ * Pooled keypairs are plain Crypto::P256Keypair objects: the pool must not be used with an OperationalKeystore whose
+ * AllocateEphemeralKeypairForCASE returns a different implementation (e.g. keys held by a secure element).
+ *
+ * All methods must be called from the Matter thread.
+ */
+class CASEEphemeralKeypairPool
+{
+public:
+    CASEEphemeralKeypairPool() = default;
+    ~CASEEphemeralKeypairPool() { Shutdown(); }
+
+    CASEEphemeralKeypairPool(const CASEEphemeralKeypairPool &)             = delete;
+    CASEEphemeralKeypairPool & operator=(const CASEEphemeralKeypairPool &) = delete;
+
+    /**
+     * Allocate the pool and start filling it in the background.
+     *
+     * @param capacity Number of keypairs to keep ready.
+     */
+    CHIP_ERROR Init(size_t capacity);
+
+    /// Delete the keypairs of the pool. Keypairs taken before stay valid.
+    void Shutdown();
+
+    /**
+     * Take a keypair initialized for ECDH out of the pool, and schedule its replacement.
+     *
+     * @return the keypair, to release with ReleaseKeypair, or nullptr if the pool is empty.
+     */
+    Crypto::P256Keypair * TakeKeypair();
+
+    /// Release a keypair returned by TakeKeypair.
+    static void ReleaseKeypair(Crypto::P256Keypair * keypair) { Platform::Delete(keypair); }
+
+    /// Number of keypairs ready to be taken.
+    size_t Count() const { return mCount; }
+
+    size_t Capacity() const { return mKeypairs.AllocatedSize(); }
+
+private:
+    // Generation of one keypair, shared by the pool and the scheduled work until it completes.
+    struct Refill
+    {
+        ~Refill() { ReleaseKeypair(keypair); }
+
+        // Only accessed from the Matter thread, cleared on Shutdown.
+        CASEEphemeralKeypairPool * pool = nullptr;
+        Crypto::P256Keypair * keypair   = nullptr;
+        CHIP_ERROR status               = CHIP_NO_ERROR;
+        // Set by the background thread if the completion could not be scheduled back on the Matter thread.
+        std::atomic<bool> scheduleFailed{ false };
+    };
+
+    void ScheduleRefill();
+    void OnKeypairGenerated(Refill & refill);
+
+    static void GenerateKeypair(intptr_t arg);
+    static void AddGeneratedKeypair(intptr_t arg);
+
+    Platform::ScopedMemoryBufferWithSize<Crypto::P256Keypair *> mKeypairs;
+    size_t mCount = 0;
+    Platform::SharedPtr<Refill> mRefill;
+};
+
+} // namespace chip
@@ -57,6 +57,20 @@ public:
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
+    /**
+     * Take the ephemeral keypairs of the handshakes from a pool of pre-generated keypairs.
+     *
+     * @param pool The pool, or nullptr to generate the keypairs during the handshakes.
+     */
+    void SetEphemeralKeypairPool(CASEEphemeralKeypairPool * pool) { GetSession().SetEphemeralKeypairPool(pool); }
+
+    /**
+     * Skip the validation of initiator certificate chains that are in a cache of validated chains.
+     *
+     * @param cache The cache, or nullptr to validate the chain on every handshake.
+     */
+    void SetCertChainCache(Credentials::ValidatedCertChainCache * cache) { GetSession().SetCertChainCache(cache); }
+
     //////////// SessionEstablishmentDelegate Implementation ///////////////
     void OnSessionEstablishmentError(CHIP_ERROR error) override;
     void OnSessionEstablished(const SessionHandle & session) override;
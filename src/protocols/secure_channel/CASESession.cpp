@@ -43,6 +43,7 @@
 #include <protocols/secure_channel/CASEDestinationId.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <protocols/secure_channel/SessionWorkHelper.h>
 #include <protocols/secure_channel/StatusReport.h>
 #include <system/SystemClock.h>
 #include <tracing/macros.h>
@@ -152,205 +153,6 @@ static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime    = System
 static constexpr ExchangeContext::Timeout kExpectedSigma1ProcessingTime = kExpectedLowProcessingTime;
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime   = System::Clock::Seconds16(30);
 
-// Helper for managing a session's outstanding work.
-// Holds work data which is provided to a scheduled work callback (standalone),
-// then (if not canceled) to a scheduled after work callback (on the session).
-template <class DATA>
-class CASESession::WorkHelper
-{
-public:
-    // Work callback, processed in the background via `PlatformManager::ScheduleBackgroundWork`.
-    // This is a non-member function which does not use the associated session.
-    // The return value is passed to the after work callback (called afterward).
-    // Set `cancel` to true if calling the after work callback is not necessary.
-    typedef CHIP_ERROR (*WorkCallback)(DATA & data, bool & cancel);
-
-    // After work callback, processed in the main Matter task via `PlatformManager::ScheduleWork`.
-    // This is a member function to be called on the associated session after the work callback.
-    // The `status` value is the result of the work callback (called beforehand), or the status of
-    // queueing the after work callback back to the Matter thread, if the work callback succeeds
-    // but queueing fails.
-    //
-    // When this callback is called asynchronously (i.e. via ScheduleWork), the helper guarantees
-    // that it will keep itself (and hence `data`) alive until the callback completes.
-    typedef CHIP_ERROR (CASESession::*AfterWorkCallback)(DATA & data, CHIP_ERROR status);
-
-public:
-    // Create a work helper using the specified session, work callback, after work callback, and data (template arg).
-    // Lifetime is managed by sharing between the caller (typically the session) and the helper itself (while work is scheduled).
-    static Platform::SharedPtr<WorkHelper> Create(CASESession & session, WorkCallback workCallback,
-                                                  AfterWorkCallback afterWorkCallback)
-    {
-        struct EnableShared : public WorkHelper
-        {
-            EnableShared(CASESession & session, WorkCallback workCallback, AfterWorkCallback afterWorkCallback) :
-                WorkHelper(session, workCallback, afterWorkCallback)
-            {}
-        };
-        auto ptr = Platform::MakeShared<EnableShared>(session, workCallback, afterWorkCallback);
-        if (ptr)
-        {
-            ptr->mWeakPtr = ptr; // used by `ScheduleWork`
-        }
-        return ptr;
-    }
-
-    // Do the work immediately.
-    // No scheduling, no outstanding work, no shared lifetime management.
-    //
-    // The caller must guarantee that it keeps the helper alive across this call, most likely by
-    // holding a reference to it on the stack.
-    CHIP_ERROR DoWork()
-    {
-        // Ensure that this function is being called from main Matter thread
-        assertChipStackLockedByCurrentThread();
-
-        VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
-        auto * helper   = this;
-        bool cancel     = false;
-        helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
-        if (!cancel)
-        {
-            helper->mStatus = (helper->mSession->*(helper->mAfterWorkCallback))(helper->mData, helper->mStatus);
-        }
-        return helper->mStatus;
-    }
-
-    // Schedule the work for later execution.
-    // If lifetime is managed, the helper shares management while work is outstanding.
-    CHIP_ERROR ScheduleWork()
-    {
-        VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
-        // Hold strong ptr while work is outstanding
-        mStrongPtr  = mWeakPtr.lock(); // set in `Create`
-        auto status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(this));
-        if (status != CHIP_NO_ERROR)
-        {
-            // Release strong ptr since scheduling failed.
-            mStrongPtr.reset();
-        }
-        return status;
-    }
-
-    // Cancel the work, by clearing the associated session.
-    void CancelWork() { mSession.store(nullptr); }
-
-    bool IsCancelled() const { return mSession.load() == nullptr; }
-
-    // This API returns true when background thread fails to schedule the AfterWorkCallback
-    bool UnableToScheduleAfterWorkCallback() { return mScheduleAfterWorkFailed.load(); }
-
-    // Do after work immediately.
-    // No scheduling, no outstanding work, no shared lifetime management.
-    void DoAfterWork()
-    {
-        VerifyOrDie(UnableToScheduleAfterWorkCallback());
-        AfterWorkHandler(reinterpret_cast<intptr_t>(this));
-    }
-
-private:
-    // Create a work helper using the specified session, work callback, after work callback, and data (template arg).
-    // Lifetime is not managed, see `Create` for that option.
-    WorkHelper(CASESession & session, WorkCallback workCallback, AfterWorkCallback afterWorkCallback) :
-        mSession(&session), mWorkCallback(workCallback), mAfterWorkCallback(afterWorkCallback)
-    {}
-
-    // Handler for the work callback.
-    static void WorkHandler(intptr_t arg)
-    {
-        auto * helper = reinterpret_cast<WorkHelper *>(arg);
-        // Hold strong ptr while work is handled
-        auto strongPtr(std::move(helper->mStrongPtr));
-        VerifyOrReturn(!helper->IsCancelled());
-        bool cancel = false;
-        // Execute callback in background thread; data must be OK with this
-        helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
-        VerifyOrReturn(!cancel && !helper->IsCancelled());
-        // Hold strong ptr to ourselves while work is outstanding
-        helper->mStrongPtr.swap(strongPtr);
-        auto status = DeviceLayer::PlatformMgr().ScheduleWork(AfterWorkHandler, reinterpret_cast<intptr_t>(helper));
-        if (status != CHIP_NO_ERROR)
-        {
-            ChipLogError(SecureChannel, "Failed to Schedule the AfterWorkCallback on foreground thread: %" CHIP_ERROR_FORMAT,
-                         status.Format());
-
-            // We failed to schedule after work callback, so setting mScheduleAfterWorkFailed flag to true
-            // This can be checked from foreground thread and after work callback can be retried
-            helper->mStatus = status;
-
-            // Release strong ptr to self since scheduling failed, because nothing guarantees
-            // that AfterWorkHandler will get called at this point to release the reference,
-            // and we don't want to leak.  That said, we want to ensure that "helper" stays
-            // alive through the end of this function (so we can set mScheduleAfterWorkFailed
-            // on it), but also want to avoid racing on the single SharedPtr instance in
-            // helper->mStrongPtr.  That means we need to not touch helper->mStrongPtr after
-            // writing to mScheduleAfterWorkFailed.
-            //
-            // The simplest way to do this is to move the reference in helper->mStrongPtr to
-            // our stack, where it outlives all our accesses to "helper".
-            strongPtr.swap(helper->mStrongPtr);
-
-            // helper and any of its state should not be touched after storing mScheduleAfterWorkFailed.
-            helper->mScheduleAfterWorkFailed.store(true);
-        }
-    }
-
-    // Handler for the after work callback.
-    static void AfterWorkHandler(intptr_t arg)
-    {
-        // Ensure that this function is being called from main Matter thread
-        assertChipStackLockedByCurrentThread();
-
-        auto * helper = reinterpret_cast<WorkHelper *>(arg);
-        // Hold strong ptr while work is handled, and ensure that helper->mStrongPtr does not keep
-        // holding a reference.
-        auto strongPtr(std::move(helper->mStrongPtr));
-        if (!strongPtr)
-        {
-            // This can happen if scheduling AfterWorkHandler failed.  Just grab a strong ref
-            // to handler directly, to fulfill our API contract of holding a strong reference
-            // across the after-work callback.  At this point, we are guaranteed that the
-            // background thread is not touching the helper anymore.
-            strongPtr = helper->mWeakPtr.lock();
-        }
-        if (auto * session = helper->mSession.load())
-        {
-            // Execute callback in Matter thread; session should be OK with this
-            (session->*(helper->mAfterWorkCallback))(helper->mData, helper->mStatus);
-        }
-    }
-
-private:
-    // Lifetime management: `ScheduleWork` sets `mStrongPtr` from `mWeakPtr`.
-    Platform::WeakPtr<WorkHelper> mWeakPtr;
-
-    // Lifetime management: `ScheduleWork` sets `mStrongPtr` from `mWeakPtr`.
-    Platform::SharedPtr<WorkHelper> mStrongPtr;
-
-    // Associated session, cleared by `CancelWork`.
-    std::atomic<CASESession *> mSession;
-
-    // Work callback, called by `WorkHandler`.
-    WorkCallback mWorkCallback;
-
-    // After work callback, called by `AfterWorkHandler`.
-    AfterWorkCallback mAfterWorkCallback;
-
-    // Return value of `mWorkCallback`, passed to `mAfterWorkCallback`.
-    CHIP_ERROR mStatus;
-
-    // If background thread fails to schedule AfterWorkCallback then this flag is set to true
-    // and CASEServer then can check this one and run the AfterWorkCallback for us.
-    //
-    // When this happens, the write to this boolean _must_ be the last code that touches this
-    // object on the background thread.  After that, the Matter thread owns the object.
-    std::atomic<bool> mScheduleAfterWorkFailed{ false };
-
-public:
-    // Data passed to `mWorkCallback` and `mAfterWorkCallback`.
-    DATA mData;
-};
-
 CASESession::~CASESession()
 {
     // Let's clear out any security state stored in the object, before destroying it.
@@ -387,6 +189,13 @@ void CASESession::Clear()
     mState = State::kInitialized;
     Crypto::ClearSecretData(mIPK);
 
+    if (mEphemeralKeyFromPool)
+    {
+        CASEEphemeralKeypairPool::ReleaseKeypair(mEphemeralKey);
+        mEphemeralKey         = nullptr;
+        mEphemeralKeyFromPool = false;
+    }
+
     if (mFabricsTable != nullptr)
     {
         mFabricsTable->RemoveFabricDelegate(this);
@@ -753,6 +562,25 @@ void CASESession::HandleConnectionClosed(Transport::ActiveTCPConnectionState * c
 }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
+CHIP_ERROR CASESession::AllocateEphemeralKey()
+{
+    if (mEphemeralKeypairPool != nullptr)
+    {
+        mEphemeralKey = mEphemeralKeypairPool->TakeKeypair();
+    }
+    mEphemeralKeyFromPool = (mEphemeralKeypairPool != nullptr) && (mEphemeralKey != nullptr);
+    MATTER_LOG_METRIC(kMetricDeviceCASESessionEphemeralKeyPooled, static_cast<uint32_t>(mEphemeralKeyFromPool));
+    if (mEphemeralKeyFromPool)
+    {
+        // Already initialized for ECDH in the background.
+        return CHIP_NO_ERROR;
+    }
+
+    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
+    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
+    return mEphemeralKey->Initialize(ECPKeyTarget::ECDH);
+}
+
 CHIP_ERROR CASESession::SendSigma1()
 {
     MATTER_TRACE_SCOPE("SendSigma1", "CASESession");
@@ -771,9 +599,7 @@ CHIP_ERROR CASESession::SendSigma1()
     encodeSigma1Inputs.initiatorSessionId = GetLocalSessionId().Value();
 
     // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
+    ReturnErrorOnFailure(AllocateEphemeralKey());
     encodeSigma1Inputs.initiatorEphPubKey = &mEphemeralKey->Pubkey();
 
     // Fill in the random value
@@ -916,7 +742,10 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
         System::PacketBufferHandle msgR2;
         EncodeSigma2Inputs encodeSigma2;
 
-        SuccessOrExit(err = PrepareSigma2(encodeSigma2));
+        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2Prepare);
+        err = PrepareSigma2(encodeSigma2);
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2Prepare, err);
+        SuccessOrExit(err);
         SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
 
         MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
@@ -1204,9 +1033,7 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
     ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
 
     // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
+    ReturnErrorOnFailure(AllocateEphemeralKey());
     outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
 
     // Generate a Shared Secret
@@ -1528,20 +1355,16 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
 
     // Validate responder identity located in msgR2Decrypted
     // Constructing responder identity
-    P256PublicKey responderPublicKey;
+    Credentials::ValidatedCertChain responderChain;
+    P256PublicKey & responderPublicKey = responderChain.nocPublicKey;
     {
-        NodeId responderNodeId;
-
-        CompressedFabricId unused;
-        FabricId responderFabricId;
         ReturnErrorOnFailure(SetEffectiveTime());
-        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, parsedSigma2TBEData.responderNOC,
-                                                              parsedSigma2TBEData.responderICAC, mValidContext, unused,
-                                                              responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrReturnError(fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+        ReturnErrorOnFailure(
+            VerifyResponderCredentials(parsedSigma2TBEData.responderNOC, parsedSigma2TBEData.responderICAC, responderChain));
+        VerifyOrReturnError(fabricId == responderChain.fabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
         // Verify that responderNodeId (from responderNOC) matches one that was included
         // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+        VerifyOrReturnError(mPeerNodeId == responderChain.nodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
     }
 
     // Construct msgR2Signed and validate the signature in msgR2Decrypted.
@@ -1569,8 +1392,8 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
 
     std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), mNewResumptionId.begin());
 
-    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(parsedSigma2TBEData.responderNOC, mPeerCATs));
+    // Peer CASE Authenticated Tags (CATs) were retrieved from peer's NOC with the validation of its chain.
+    mPeerCATs = responderChain.cats;
 
     if (parsedSigma2.responderSessionParamStructPresent)
     {
@@ -1582,6 +1405,40 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::VerifyResponderCredentials(const ByteSpan & noc, const ByteSpan & icac,
+                                                    Credentials::ValidatedCertChain & outResponderChain)
+{
+    CompressedFabricId unused;
+
+    if (mCertChainCache == nullptr)
+    {
+        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, noc, icac, mValidContext, unused,
+                                                              outResponderChain.fabricId, outResponderChain.nodeId,
+                                                              outResponderChain.nocPublicKey));
+        return ExtractCATsFromOpCert(noc, outResponderChain.cats);
+    }
+
+    uint8_t rootCertBuf[kMaxCHIPCertLength];
+    MutableByteSpan rootCert{ rootCertBuf };
+    ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, rootCert));
+
+    if (mCertChainCache->Find(mFabricIndex, noc, icac, rootCert, mValidContext, outResponderChain) == CHIP_NO_ERROR)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(noc, icac, rootCert, mValidContext, unused, outResponderChain.fabricId,
+                                                        outResponderChain.nodeId, outResponderChain.nocPublicKey));
+    ReturnErrorOnFailure(ExtractCATsFromOpCert(noc, outResponderChain.cats));
+
+    CHIP_ERROR err = mCertChainCache->Insert(mFabricIndex, noc, icac, rootCert, mValidContext, outResponderChain);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Unable to cache responder certificate chain: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CASESession::ParseSigma2(ContiguousBufferTLVReader & tlvReader, ParsedSigma2 & outParsedSigma2)
 {
     TLVType containerType = kTLVType_Structure;
@@ -2004,6 +1861,21 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             SuccessOrExit(err = signedDataTlvReader.ExitContainer(containerType));
         }
 
+        // Look up the validation of the initiator chain here, as the cache is only used from the Matter thread.
+        if (mCertChainCache != nullptr)
+        {
+            Credentials::ValidatedCertChain initiatorChain;
+            if (mCertChainCache->Find(mFabricIndex, data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
+                                      initiatorChain) == CHIP_NO_ERROR)
+            {
+                data.initiatorFabricId  = initiatorChain.fabricId;
+                data.initiatorNodeId    = initiatorChain.nodeId;
+                data.initiatorPublicKey = initiatorChain.nocPublicKey;
+                data.initiatorCATs      = initiatorChain.cats;
+                data.certChainCached    = true;
+            }
+        }
+
         SuccessOrExit(err = helper->ScheduleWork());
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
@@ -2091,16 +1963,18 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     // Step 5/6
     // Validate initiator identity located in msg->Start()
     // Constructing responder identity
-    CompressedFabricId unused;
-    FabricId initiatorFabricId;
-    P256PublicKey initiatorPublicKey;
-    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
-                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
-    VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    if (!data.certChainCached)
+    {
+        CompressedFabricId unused;
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                            data.validContext, unused, data.initiatorFabricId,
+                                                            data.initiatorNodeId, data.initiatorPublicKey));
+    }
+    VerifyOrReturnError(data.fabricId == data.initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Step 7 - Validate Signature
-    ReturnErrorOnFailure(initiatorPublicKey.ECDSA_validate_msg_signature(data.msgR3SignedSpan.data(), data.msgR3SignedSpan.size(),
-                                                                         data.tbsData3Signature));
+    ReturnErrorOnFailure(data.initiatorPublicKey.ECDSA_validate_msg_signature(data.msgR3SignedSpan.data(),
+                                                                              data.msgR3SignedSpan.size(), data.tbsData3Signature));
 
     return CHIP_NO_ERROR;
 }
@@ -2120,9 +1994,30 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
         SuccessOrExit(err = mCommissioningHash.Finish(messageDigestSpan));
     }
 
-    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
+    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC, unless they were cached along with its chain.
+    if (data.certChainCached)
+    {
+        mPeerCATs = data.initiatorCATs;
+    }
+    else
     {
         SuccessOrExit(err = ExtractCATsFromOpCert(data.initiatorNOC, mPeerCATs));
+
+        if (mCertChainCache != nullptr)
+        {
+            Credentials::ValidatedCertChain initiatorChain;
+            initiatorChain.fabricId     = data.initiatorFabricId;
+            initiatorChain.nodeId       = data.initiatorNodeId;
+            initiatorChain.nocPublicKey = data.initiatorPublicKey;
+            initiatorChain.cats         = mPeerCATs;
+
+            CHIP_ERROR err2 = mCertChainCache->Insert(mFabricIndex, data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                      data.validContext, initiatorChain);
+            if (err2 != CHIP_NO_ERROR)
+            {
+                ChipLogError(SecureChannel, "Unable to cache initiator certificate chain: %" CHIP_ERROR_FORMAT, err2.Format());
+            }
+        }
     }
 
     if (mSessionResumptionStorage != nullptr)
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/FabricTable.h>
 #include <credentials/GroupDataProvider.h>
+#include <credentials/ValidatedCertChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/ScopedNodeId.h>
 #include <lib/core/TLV.h>
@@ -38,6 +39,7 @@
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <protocols/secure_channel/CASEDestinationId.h>
+#include <protocols/secure_channel/CASEEphemeralKeypairPool.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
@@ -51,6 +53,9 @@
 
 namespace chip {
 
+template <class SESSION, class DATA>
+class SessionWorkHelper;
+
 // TODO: temporary derive from Messaging::UnsolicitedMessageHandler, actually the CASEServer should be the umh, it will be fixed
 // when implementing concurrent CASE session.
 class DLL_EXPORT CASESession : public Messaging::UnsolicitedMessageHandler,
@@ -118,6 +123,25 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+    /**
+     * @brief
+     *   Set the pool of pre-generated ephemeral keypairs to take the ephemeral key of the handshake from, instead of
+     *   generating it in Sigma1 or Sigma2. Persists across handshakes.
+     *
+     * @param ephemeralKeypairPool - Pointer to the pool (if nullptr, the ephemeral key is allocated from the fabric table
+     *                               and generated in place).
+     */
+    void SetEphemeralKeypairPool(CASEEphemeralKeypairPool * ephemeralKeypairPool) { mEphemeralKeypairPool = ephemeralKeypairPool; }
+
+    /**
+     * @brief
+     *   Set the cache of validated peer certificate chains, to skip the validation of a chain the peer already presented
+     *   in a previous handshake. Persists across handshakes.
+     *
+     * @param certChainCache - Pointer to the cache (if nullptr, the peer certificate chain is always validated).
+     */
+    void SetCertChainCache(Credentials::ValidatedCertChainCache * certChainCache) { mCertChainCache = certChainCache; }
+
     /**
      * @brief
      *   Derive a secure session from the established session. The API will return error if called before session is established.
@@ -329,7 +353,13 @@ protected:
         Crypto::P256ECDSASignature tbsData3Signature;
 
         FabricId fabricId;
+        FabricId initiatorFabricId;
         NodeId initiatorNodeId;
+        Crypto::P256PublicKey initiatorPublicKey;
+        CATValues initiatorCATs;
+
+        // Whether the results of the validation of the initiator chain above were found in mCertChainCache.
+        bool certChainCached = false;
 
         Credentials::ValidationContext validContext;
     };
@@ -485,6 +515,9 @@ private:
     // destinationId/initiatorRandom from processing of Sigma1, and sets mIpk to the right IPK.
     CHIP_ERROR FindLocalNodeFromDestinationId(const ByteSpan & destinationId, const ByteSpan & initiatorRandom);
 
+    // Take the ephemeral keypair from the pool, or allocate and generate it.
+    CHIP_ERROR AllocateEphemeralKey();
+
     CHIP_ERROR SendSigma1();
     CHIP_ERROR HandleSigma1_and_SendSigma2(System::PacketBufferHandle && msg);
     NextStep HandleSigma1(System::PacketBufferHandle && msg);
@@ -498,6 +531,9 @@ private:
 
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    // Validate the responder certificate chain against the fabric of the session, unless mCertChainCache already has it.
+    CHIP_ERROR VerifyResponderCredentials(const ByteSpan & noc, const ByteSpan & icac,
+                                          Credentials::ValidatedCertChain & outResponderChain);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3a();
@@ -563,6 +599,10 @@ private:
     Crypto::Hash_SHA256_stream mCommissioningHash;
     Crypto::P256PublicKey mRemotePubKey;
     Crypto::P256Keypair * mEphemeralKey = nullptr;
+    // Whether mEphemeralKey comes from mEphemeralKeypairPool, rather than from the fabric table.
+    bool mEphemeralKeyFromPool                             = false;
+    CASEEphemeralKeypairPool * mEphemeralKeypairPool       = nullptr;
+    Credentials::ValidatedCertChainCache * mCertChainCache = nullptr;
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
@@ -585,7 +625,7 @@ private:
     uint8_t mInitiatorRandom[kSigmaParamRandomNumberSize];
 
     template <class DATA>
-    class WorkHelper;
+    using WorkHelper = SessionWorkHelper<CASESession, DATA>;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
@@ -42,6 +42,7 @@
 #include <messaging/SessionParameters.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/SessionWorkHelper.h>
 #include <protocols/secure_channel/StatusReport.h>
 #include <setup_payload/SetupPayload.h>
 #include <system/TLVPacketBufferBackingStore.h>
@@ -115,6 +116,9 @@ const char kSpake2pContext[] = "CHIP PAKE V1 Commissioning";
 static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime  = System::Clock::Seconds16(2);
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime = System::Clock::Seconds16(30);
 
+// Interval at which a background derivation of w0s/w1s is checked for a failure to schedule its completion.
+static constexpr System::Clock::Timeout kComputeWSWatchdogInterval = System::Clock::Seconds16(1);
+
 PASESession::~PASESession()
 {
     // Let's clear out any security state stored in the object, before destroying it.
@@ -142,6 +146,17 @@ void PASESession::Clear()
     memset(&mPASEVerifier, 0, sizeof(mPASEVerifier));
     mNextExpectedMsg.ClearValue();
 
+    if (mComputeWSHelper)
+    {
+        // Abort any outstanding work
+        mComputeWSHelper->CancelWork();
+        mComputeWSHelper.reset();
+        if (mSessionManager != nullptr)
+        {
+            mSessionManager->SystemLayer()->CancelTimer(ComputeWSWatchdogTimerHandler, this);
+        }
+    }
+
     mSpake2p.Clear();
     mCommissioningHash.Clear();
 
@@ -533,7 +548,6 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     uint8_t random[kPBKDFParamRandomNumberSize];
 
     ByteSpan salt;
-    uint8_t serializedWS[kSpake2p_WS_Length * 2] = { 0 };
 
     ChipLogDetail(SecureChannel, "Received PBKDF param response");
 
@@ -602,24 +616,132 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     err = SetupSpake2p();
     SuccessOrExit(err);
 
-    err = Spake2pVerifier::ComputeWS(mIterationCount, salt, mSetupPINCode, serializedWS, sizeof(serializedWS));
+    err = ComputeWS(salt);
     SuccessOrExit(err);
 
-    err = mSpake2p.BeginProver(nullptr, 0, nullptr, 0, &serializedWS[0], kSpake2p_WS_Length, &serializedWS[kSpake2p_WS_Length],
-                               kSpake2p_WS_Length);
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
+
+CHIP_ERROR PASESession::ComputeWS(const ByteSpan & salt)
+{
+    MATTER_TRACE_SCOPE("ComputeWS", "PASESession");
+
+    uint8_t serializedWS[Spake2pWSCache::kWSLength];
+    if (mSpake2pWSCache != nullptr && mSpake2pWSCache->Find(mSetupPINCode, mIterationCount, salt, serializedWS) == CHIP_NO_ERROR)
+    {
+        CHIP_ERROR err = BeginProverAndSendMsg1(serializedWS);
+        ClearSecretData(serializedWS);
+        return err;
+    }
+
+    auto helper = WorkHelper<ComputeWSData>::Create(*this, &ComputeWSInBackground, &PASESession::OnWSComputed);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+
+    auto & data = helper->mData;
+    VerifyOrReturnError(salt.size() <= sizeof(data.saltBuf), CHIP_ERROR_INVALID_ARGUMENT);
+    memcpy(data.saltBuf, salt.data(), salt.size());
+    data.salt           = ByteSpan(data.saltBuf, salt.size());
+    data.inBackground   = mComputeWSInBackground;
+    data.iterationCount = mIterationCount;
+    data.setupPINCode   = mSetupPINCode;
+
+    if (data.inBackground)
+    {
+        // PBKDF2 is slow by design: the other sessions and exchanges are served meanwhile.
+        ReturnErrorOnFailure(helper->ScheduleWork());
+        mComputeWSHelper = helper;
+        // Nothing else completes the pairing if the worker fails to schedule OnWSComputed.
+        ReturnErrorOnFailure(
+            mSessionManager->SystemLayer()->StartTimer(kComputeWSWatchdogInterval, ComputeWSWatchdogTimerHandler, this));
+        mExchangeCtxt.Value()->WillSendMessage();
+        // Only a status report is expected until Pake1 is sent.
+        mNextExpectedMsg.ClearValue();
+    }
+    else
+    {
+        ReturnErrorOnFailure(helper->DoWork());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PASESession::ComputeWSInBackground(ComputeWSData & data, bool & cancel)
+{
+    return Spake2pVerifier::ComputeWS(data.iterationCount, data.salt, data.setupPINCode, data.serializedWS,
+                                      sizeof(data.serializedWS));
+}
+
+CHIP_ERROR PASESession::OnWSComputed(ComputeWSData & data, CHIP_ERROR status)
+{
+    MATTER_TRACE_SCOPE("OnWSComputed", "PASESession");
+    CHIP_ERROR err = status;
     SuccessOrExit(err);
 
-    err = SendMsg1();
+    if (mSpake2pWSCache != nullptr)
+    {
+        // Not caching the values only costs their derivation on a retry.
+        CHIP_ERROR cacheErr = mSpake2pWSCache->Insert(data.setupPINCode, data.iterationCount, data.salt, data.serializedWS);
+        if (cacheErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(SecureChannel, "Failed to cache the PASE w0s/w1s: %" CHIP_ERROR_FORMAT, cacheErr.Format());
+        }
+    }
+
+    err = BeginProverAndSendMsg1(data.serializedWS);
     SuccessOrExit(err);
 
 exit:
-    if (err != CHIP_NO_ERROR)
+    mComputeWSHelper.reset();
+    mSessionManager->SystemLayer()->CancelTimer(ComputeWSWatchdogTimerHandler, this);
+
+    // If data.inBackground is set, processing occurred in the background, so if an error occurred, need to send status report
+    // (normally occurs in HandlePBKDFParamResponse), and discard exchange and abort pending establish (normally occurs in
+    // OnMessageReceived).
+    if (data.inBackground && err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        DiscardExchange();
+        Clear();
+        ChipLogError(SecureChannel, "Failed during PASE session setup: %" CHIP_ERROR_FORMAT, err.Format());
+        MATTER_TRACE_COUNTER("PASEFail");
+        // Do this last in case the delegate frees us.
+        NotifySessionEstablishmentError(err);
     }
     return err;
 }
 
+bool PASESession::InvokeBackgroundWorkWatchdog()
+{
+    VerifyOrReturnValue(mComputeWSHelper && mComputeWSHelper->UnableToScheduleAfterWorkCallback(), false);
+
+    ChipLogError(SecureChannel, "ComputeWSHelper was unable to schedule the AfterWorkCallback");
+    mComputeWSHelper->DoAfterWork();
+    return true;
+}
+
+void PASESession::ComputeWSWatchdogTimerHandler(System::Layer * systemLayer, void * context)
+{
+    auto * session = static_cast<PASESession *>(context);
+    VerifyOrReturn(session->mComputeWSHelper);
+
+    if (!session->InvokeBackgroundWorkWatchdog())
+    {
+        // Still deriving.
+        LogErrorOnFailure(systemLayer->StartTimer(kComputeWSWatchdogInterval, ComputeWSWatchdogTimerHandler, session));
+    }
+}
+
+CHIP_ERROR PASESession::BeginProverAndSendMsg1(const uint8_t (&serializedWS)[Spake2pWSCache::kWSLength])
+{
+    ReturnErrorOnFailure(mSpake2p.BeginProver(nullptr, 0, nullptr, 0, &serializedWS[0], kSpake2p_WS_Length,
+                                              &serializedWS[kSpake2p_WS_Length], kSpake2p_WS_Length));
+    return SendMsg1();
+}
+
 CHIP_ERROR PASESession::SendMsg1()
 {
     MATTER_TRACE_SCOPE("SendMsg1", "PASESession");
@@ -31,12 +31,14 @@
 #include <crypto/PSASpake2p.h>
 #endif
 #include <lib/support/Base64.h>
+#include <lib/support/CHIPMem.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMessageDispatch.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
+#include <protocols/secure_channel/Spake2pWSCache.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <transport/CryptoContext.h>
@@ -44,6 +46,10 @@
 #include <transport/raw/PeerAddress.h>
 
 namespace chip {
+
+template <class SESSION, class DATA>
+class SessionWorkHelper;
+
 namespace Testing {
 class TestPASESession;
 }
@@ -126,6 +132,32 @@ public:
     static CHIP_ERROR GeneratePASEVerifier(Crypto::Spake2pVerifier & verifier, uint32_t pbkdf2IterCount, const ByteSpan & salt,
                                            bool useRandomPIN, uint32_t & setupPIN);
 
+    /**
+     * @brief
+     *   Set the cache of the values derived from the setup PIN code of the peer, so that pairing again with the same peer
+     *   (e.g. on a retry) does not compute them again. Must be set before Pair() and outlive the pairing.
+     *
+     * @param cache  Cache to use, or nullptr to always derive the values.
+     */
+    void SetSpake2pWSCache(Spake2pWSCache * cache) { mSpake2pWSCache = cache; }
+
+    /**
+     * @brief
+     *   Derive the values from the setup PIN code of the peer (PBKDF2, the most expensive step of the pairing) through
+     *   PlatformManager::ScheduleBackgroundWork, instead of while handling the PBKDF param response. This lets the Matter
+     *   thread serve other sessions meanwhile, but requires its event loop to be running. Must be set before Pair().
+     */
+    void SetComputeWSInBackground(bool inBackground) { mComputeWSInBackground = inBackground; }
+
+    /**
+     * @brief
+     *   Complete a background derivation that the worker failed to hand back to the Matter thread, as
+     *   CASESession::InvokeBackgroundWorkWatchdog does. Runs periodically while a derivation is outstanding.
+     *
+     * @return true if the derivation was stuck; the pairing has then failed and the session has been reset.
+     */
+    bool InvokeBackgroundWorkWatchdog();
+
     /**
      * @brief
      *   Derive a secure session from the paired session. The API will return error if called before pairing is established.
@@ -192,6 +224,9 @@ private:
     CHIP_ERROR SendPBKDFParamResponse(ByteSpan initiatorRandom, bool initiatorHasPBKDFParams);
     CHIP_ERROR HandlePBKDFParamResponse(System::PacketBufferHandle && msg);
 
+    // Derive w0s and w1s from the setup PIN code of the peer, in the background unless cached, then send Pake1.
+    CHIP_ERROR ComputeWS(const ByteSpan & salt);
+    CHIP_ERROR BeginProverAndSendMsg1(const uint8_t (&serializedWS)[Spake2pWSCache::kWSLength]);
     CHIP_ERROR SendMsg1();
 
     CHIP_ERROR HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg);
@@ -239,6 +274,35 @@ private:
         Spake2pErrorType error;
     };
 
+    struct ComputeWSData
+    {
+        ~ComputeWSData()
+        {
+            Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(&setupPINCode), sizeof(setupPINCode));
+            Crypto::ClearSecretData(serializedWS);
+        }
+
+        bool inBackground;
+        uint32_t iterationCount;
+        uint32_t setupPINCode;
+
+        uint8_t saltBuf[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
+        ByteSpan salt;
+
+        uint8_t serializedWS[Spake2pWSCache::kWSLength];
+    };
+
+    static CHIP_ERROR ComputeWSInBackground(ComputeWSData & data, bool & cancel);
+    CHIP_ERROR OnWSComputed(ComputeWSData & data, CHIP_ERROR status);
+    static void ComputeWSWatchdogTimerHandler(System::Layer * systemLayer, void * context);
+
+    template <class DATA>
+    using WorkHelper = SessionWorkHelper<PASESession, DATA>;
+    Platform::SharedPtr<WorkHelper<ComputeWSData>> mComputeWSHelper;
+
+    Spake2pWSCache * mSpake2pWSCache = nullptr;
+    bool mComputeWSInBackground      = false;
+
 protected:
     uint8_t mKe[Crypto::kMAX_Hash_Length];
 
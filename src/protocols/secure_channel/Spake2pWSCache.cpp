@@ -0,0 +1,149 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Spake2pWSCache.h"
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR Spake2pWSCache::Init(size_t capacity)
+{
+    VerifyOrReturnError(capacity > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!mEntries, CHIP_ERROR_INCORRECT_STATE);
+
+    mEntries.Calloc(capacity);
+    VerifyOrReturnError(mEntries, CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
+
+void Spake2pWSCache::Shutdown()
+{
+    Clear();
+    mEntries.Free();
+}
+
+CHIP_ERROR Spake2pWSCache::Find(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt,
+                                uint8_t (&outWS)[kWSLength])
+{
+    assertChipStackLockedByCurrentThread();
+
+    Key key;
+    ReturnErrorOnFailure(ComputeKey(setupPINCode, iterationCount, salt, key));
+
+    Entry * entry = FindEntry(key);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NOT_FOUND);
+
+    memcpy(outWS, entry->ws, sizeof(outWS));
+    entry->lastUsed = ++mUseCounter;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Spake2pWSCache::Insert(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt,
+                                  const uint8_t (&ws)[kWSLength])
+{
+    assertChipStackLockedByCurrentThread();
+    VerifyOrReturnError(mEntries, CHIP_ERROR_INCORRECT_STATE);
+
+    Key key;
+    ReturnErrorOnFailure(ComputeKey(setupPINCode, iterationCount, salt, key));
+
+    // Replace the same values if they are already cached, else use a free entry or the least recently used one.
+    Entry * entry = FindEntry(key);
+    for (size_t i = 0; entry == nullptr && i < mEntries.AllocatedSize(); i++)
+    {
+        if (!mEntries[i].inUse)
+        {
+            entry = &mEntries[i];
+        }
+    }
+    if (entry == nullptr)
+    {
+        entry = &mEntries[0];
+        for (size_t i = 1; i < mEntries.AllocatedSize(); i++)
+        {
+            if (mEntries[i].lastUsed < entry->lastUsed)
+            {
+                entry = &mEntries[i];
+            }
+        }
+        ClearEntry(*entry);
+    }
+
+    entry->inUse = true;
+    memcpy(entry->key, key, sizeof(key));
+    memcpy(entry->ws, ws, sizeof(ws));
+    entry->lastUsed = ++mUseCounter;
+    return CHIP_NO_ERROR;
+}
+
+void Spake2pWSCache::Clear()
+{
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        ClearEntry(mEntries[i]);
+    }
+    mUseCounter = 0;
+}
+
+size_t Spake2pWSCache::Count() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        if (mEntries[i].inUse)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+CHIP_ERROR Spake2pWSCache::ComputeKey(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt, Key & outKey)
+{
+    // The salt is last, and the only field of variable length.
+    uint8_t params[2 * sizeof(uint32_t)];
+    Encoding::LittleEndian::Put32(&params[0], setupPINCode);
+    Encoding::LittleEndian::Put32(&params[sizeof(uint32_t)], iterationCount);
+
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(params)));
+    ReturnErrorOnFailure(hash.AddData(salt));
+    Crypto::ClearSecretData(params);
+
+    MutableByteSpan keySpan(outKey);
+    return hash.Finish(keySpan);
+}
+
+Spake2pWSCache::Entry * Spake2pWSCache::FindEntry(const Key & key)
+{
+    for (size_t i = 0; i < mEntries.AllocatedSize(); i++)
+    {
+        if (mEntries[i].inUse && memcmp(mEntries[i].key, key, sizeof(key)) == 0)
+        {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace chip
@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+/**
+ * Bounded cache of the SPAKE2+ w0s and w1s values that a PASE initiator derives from the setup passcode of the peer
+ * with PBKDF2 (see Crypto::Spake2pVerifier::ComputeWS), so that retrying PASE with the same device does not cost the
+ * PBKDF2 iterations again.
+ *
+ * Entries are keyed by a SHA-256 hash of the passcode, iteration count and salt, so the passcode itself is not kept.
+ * The cached values are as sensitive as the passcode though: they are cleared on eviction and on Clear. Least recently
+ * used entries are evicted once the cache is full.
+ *
+ * All methods must be called from the Matter thread.
+ */
+class Spake2pWSCache
+{
+public:
+    /// Length of the serialized w0s and w1s values.
+    static constexpr size_t kWSLength = Crypto::kSpake2p_WS_Length * 2;
+
+    Spake2pWSCache() = default;
+    ~Spake2pWSCache() { Shutdown(); }
+
+    Spake2pWSCache(const Spake2pWSCache &)             = delete;
+    Spake2pWSCache & operator=(const Spake2pWSCache &) = delete;
+
+    /**
+     * Allocate the cache.
+     *
+     * @param capacity Maximum number of cached values.
+     */
+    CHIP_ERROR Init(size_t capacity);
+
+    /// Clear all the entries, and free the cache.
+    void Shutdown();
+
+    /**
+     * Look up the values derived from a passcode with the given PBKDF2 parameters.
+     *
+     * @return CHIP_ERROR_NOT_FOUND if they are not in the cache.
+     */
+    CHIP_ERROR Find(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt, uint8_t (&outWS)[kWSLength]);
+
+    /// Add the values derived from a passcode with the given PBKDF2 parameters.
+    CHIP_ERROR Insert(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt, const uint8_t (&ws)[kWSLength]);
+
+    /// Clear all the entries.
+    void Clear();
+
+    /// Number of cached values.
+    size_t Count() const;
+
+    size_t Capacity() const { return mEntries.AllocatedSize(); }
+
+private:
+    using Key = uint8_t[Crypto::kSHA256_Hash_Length];
+
+    struct Entry
+    {
+        bool inUse;
+        Key key;
+        uint8_t ws[kWSLength];
+        uint32_t lastUsed;
+    };
+
+    static CHIP_ERROR ComputeKey(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt, Key & outKey);
+    static void ClearEntry(Entry & entry) { Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(&entry), sizeof(entry)); }
+
+    Entry * FindEntry(const Key & key);
+
+    Platform::ScopedMemoryBufferWithSize<Entry> mEntries;
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace chip
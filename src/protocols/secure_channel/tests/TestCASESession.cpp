@@ -29,6 +29,7 @@
 #include <credentials/CHIPCert.h>
 #include <credentials/GroupDataProviderImpl.h>
 #include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/ValidatedCertChainCache.h>
 #include <crypto/DefaultSessionKeystore.h>
 #include <errno.h>
 #include <lib/core/CHIPCore.h>
@@ -537,6 +538,32 @@ TEST_F(TestCASESession, SecurePairingHandshakeTest)
     SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
 }
 
+TEST_F(TestCASESession, SecurePairingHandshakeWithEphemeralKeypairPoolTest)
+{
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    CASEEphemeralKeypairPool pool;
+    EXPECT_EQ(pool.Init(2), CHIP_NO_ERROR);
+    // Keypairs are generated one at a time.
+    for (int i = 0; i < 4 && pool.Count() < pool.Capacity(); i++)
+    {
+        ServiceEvents();
+    }
+    EXPECT_EQ(pool.Count(), 2u);
+
+    pairingCommissioner.SetEphemeralKeypairPool(&pool);
+    SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+
+    // Sigma1 took a keypair, which has been replaced since.
+    EXPECT_EQ(pool.Count(), 2u);
+    pool.Shutdown();
+    EXPECT_EQ(pool.Count(), 0u);
+    EXPECT_EQ(pool.TakeKeypair(), nullptr);
+}
+
 TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
 {
     // TODO: Add cases for mismatching IPK config between initiator/responder
@@ -590,6 +617,49 @@ TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
     gPairingServer.Shutdown();
 }
 
+TEST_F(TestCASESession, SecurePairingHandshakeServerWithCertChainCacheTest)
+{
+    TestCASESecurePairingDelegate delegateCommissioner;
+
+    auto & loopback            = GetLoopback();
+    loopback.mSentMessageCount = 0;
+
+    ValidatedCertChainCache cache;
+    EXPECT_EQ(cache.Init(&gDeviceFabrics, 2), CHIP_NO_ERROR);
+
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
+              CHIP_NO_ERROR);
+    gPairingServer.SetCertChainCache(&cache);
+
+    // The second establishment finds the initiator chain validated by the first one.
+    for (uint32_t i = 1; i <= 2; i++)
+    {
+        auto * pairingCommissioner = chip::Platform::New<CASESession>();
+        pairingCommissioner->SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(pairingCommissioner);
+
+        EXPECT_EQ(pairingCommissioner->EstablishSession(GetSecureSessionManager(), &gCommissionerFabrics,
+                                                        ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                        nullptr, nullptr, &delegateCommissioner,
+                                                        Optional<ReliableMessageProtocolConfig>::Missing()),
+                  CHIP_NO_ERROR);
+        ServiceEvents();
+
+        EXPECT_EQ(delegateCommissioner.mNumPairingComplete, i);
+        EXPECT_EQ(cache.Count(), 1u);
+
+        chip::Platform::Delete(pairingCommissioner);
+    }
+
+    // Updating the fabric of the responder drops the chains received on it.
+    gDeviceFabrics.SendUpdateFabricNotificationForTest(gDeviceFabricIndex);
+    EXPECT_EQ(cache.Count(), 0u);
+
+    gPairingServer.SetCertChainCache(nullptr);
+    gPairingServer.Shutdown();
+}
+
 TEST_F(TestCASESession, ClientReceivesBusyTest)
 {
     TemporarySessionManager sessionManager(*this);
@@ -431,6 +431,36 @@ TEST_F(TestPASESession, SecurePairingHandshakeWithPacketLossTest)
     EXPECT_EQ(loopback.mNumMessagesToDrop, 0u);
 }
 
+TEST_F(TestPASESession, SecurePairingHandshakeWithWSCacheTest)
+{
+    TemporarySessionManager sessionManager(*this);
+
+    Spake2pWSCache cache;
+    ASSERT_EQ(cache.Init(1), CHIP_NO_ERROR);
+
+    // The second pairing uses the values derived by the first one.
+    for (int i = 0; i < 2; i++)
+    {
+        TestSecurePairingDelegate delegateCommissioner;
+        PASESession pairingCommissioner;
+        pairingCommissioner.SetSpake2pWSCache(&cache);
+        auto & loopback = GetLoopback();
+        loopback.Reset();
+        SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, Optional<ReliableMessageProtocolConfig>::Missing(),
+                                         Optional<ReliableMessageProtocolConfig>::Missing(), delegateCommissioner);
+        EXPECT_EQ(cache.Count(), 1u);
+    }
+
+    uint8_t cachedWS[Spake2pWSCache::kWSLength];
+    uint8_t expectedWS[Spake2pWSCache::kWSLength];
+    EXPECT_EQ(cache.Find(sTestSpake2p01_PinCode, sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), cachedWS),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(Spake2pVerifier::ComputeWS(sTestSpake2p01_IterationCount, ByteSpan(sTestSpake2p01_Salt), sTestSpake2p01_PinCode,
+                                         expectedWS, sizeof(expectedWS)),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(cachedWS, expectedWS, sizeof(expectedWS)), 0);
+}
+
 TEST_F(TestPASESession, SecurePairingFailedHandshake)
 {
     TemporarySessionManager sessionManager(*this);
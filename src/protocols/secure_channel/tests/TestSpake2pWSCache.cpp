@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <protocols/secure_channel/Spake2pWSCache.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kPinCode        = 20202021;
+constexpr uint32_t kIterationCount = 1000;
+constexpr uint8_t kSalt[]          = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                       0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+
+class TestSpake2pWSCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+void FillWS(uint8_t (&ws)[Spake2pWSCache::kWSLength], uint8_t value)
+{
+    memset(ws, value, sizeof(ws));
+}
+
+TEST_F(TestSpake2pWSCache, FindsInsertedValues)
+{
+    Spake2pWSCache cache;
+    uint8_t ws[Spake2pWSCache::kWSLength];
+    uint8_t found[Spake2pWSCache::kWSLength];
+
+    // Not initialized.
+    FillWS(ws, 1);
+    EXPECT_EQ(cache.Insert(kPinCode, kIterationCount, ByteSpan(kSalt), ws), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt), found), CHIP_ERROR_NOT_FOUND);
+
+    ASSERT_EQ(cache.Init(2), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Capacity(), 2u);
+    EXPECT_EQ(cache.Init(2), CHIP_ERROR_INCORRECT_STATE);
+
+    // Really derive the values, as PASESession does.
+    ASSERT_EQ(Crypto::Spake2pVerifier::ComputeWS(kIterationCount, ByteSpan(kSalt), kPinCode, ws, sizeof(ws)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Insert(kPinCode, kIterationCount, ByteSpan(kSalt), ws), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt), found), CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(found, ws, sizeof(ws)), 0);
+
+    // Each of the PBKDF2 inputs is part of the key.
+    EXPECT_EQ(cache.Find(kPinCode + 1, kIterationCount, ByteSpan(kSalt), found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount + 1, ByteSpan(kSalt), found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt, sizeof(kSalt) - 1), found), CHIP_ERROR_NOT_FOUND);
+
+    // Inserting the same inputs again replaces the values.
+    FillWS(ws, 2);
+    EXPECT_EQ(cache.Insert(kPinCode, kIterationCount, ByteSpan(kSalt), ws), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 1u);
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt), found), CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(found, ws, sizeof(ws)), 0);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Count(), 0u);
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt), found), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST_F(TestSpake2pWSCache, EvictsLeastRecentlyUsed)
+{
+    Spake2pWSCache cache;
+    ASSERT_EQ(cache.Init(2), CHIP_NO_ERROR);
+
+    uint8_t ws[Spake2pWSCache::kWSLength];
+    uint8_t found[Spake2pWSCache::kWSLength];
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        FillWS(ws, i);
+        EXPECT_EQ(cache.Insert(kPinCode + i, kIterationCount, ByteSpan(kSalt), ws), CHIP_NO_ERROR);
+    }
+
+    // Use the first values, so that the second ones are evicted.
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt), found), CHIP_NO_ERROR);
+    FillWS(ws, 2);
+    EXPECT_EQ(cache.Insert(kPinCode + 2, kIterationCount, ByteSpan(kSalt), ws), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Count(), 2u);
+
+    EXPECT_EQ(cache.Find(kPinCode + 1, kIterationCount, ByteSpan(kSalt), found), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kPinCode, kIterationCount, ByteSpan(kSalt), found), CHIP_NO_ERROR);
+    EXPECT_EQ(found[0], 0);
+    EXPECT_EQ(cache.Find(kPinCode + 2, kIterationCount, ByteSpan(kSalt), found), CHIP_NO_ERROR);
+    EXPECT_EQ(found[0], 2);
+
+    cache.Shutdown();
+    EXPECT_EQ(cache.Count(), 0u);
+    EXPECT_EQ(cache.Capacity(), 0u);
+}
+
+} // namespace
@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of the stall of the Matter event loop while a commissioner runs concurrent PASE sessions, depending
+ *      on where the PBKDF2 derivation of w0s/w1s (PASESession::ComputeWS) runs: inline while handling the PBKDF param
+ *      response, in the background with a completion on the event loop, or not at all when the values are cached.
+ *
+ *      The event loop and the background worker are modeled by two task queues served by one thread each, as done by
+ *      PlatformManager::ScheduleWork and ScheduleBackgroundWork with CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING. A
+ *      ticker posts a heartbeat task every millisecond, whose queueing latency measures the stall of the event loop.
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/secure_channel/Spake2pWSCache.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kSessions                           = 8;
+constexpr uint32_t kIterationCount                   = kSpake2p_Max_PBKDF_Iterations;
+constexpr uint32_t kPinCode                          = 20202021;
+constexpr uint8_t kSalt[]                            = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                                         0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+constexpr std::chrono::microseconds kHeartbeatPeriod = std::chrono::milliseconds(1);
+
+enum class Mode
+{
+    kInline,
+    kBackground,
+    kCached,
+};
+
+class TaskQueue
+{
+public:
+    void Post(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(std::move(task));
+        }
+        mCondition.notify_one();
+    }
+
+    void Stop() { Post(nullptr); }
+
+    // Run the tasks until Stop.
+    void Run()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return !mTasks.empty(); });
+                task = std::move(mTasks.front());
+                mTasks.pop_front();
+            }
+            if (!task)
+            {
+                return;
+            }
+            task();
+        }
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<std::function<void()>> mTasks;
+};
+
+struct Derivation
+{
+    uint32_t pinCode;
+    uint8_t ws[Spake2pWSCache::kWSLength];
+};
+
+void Run(Mode mode, const char * name)
+{
+    TaskQueue eventLoop;
+    TaskQueue backgroundWorker;
+    Spake2pWSCache cache;
+    VerifyOrDie(cache.Init(kSessions) == CHIP_NO_ERROR);
+
+    // The sessions pair with different devices, which have different passcodes.
+    std::vector<Derivation> derivations(kSessions);
+    for (size_t i = 0; i < kSessions; i++)
+    {
+        derivations[i].pinCode = kPinCode + static_cast<uint32_t>(i);
+        if (mode == Mode::kCached)
+        {
+            VerifyOrDie(Spake2pVerifier::ComputeWS(kIterationCount, ByteSpan(kSalt), derivations[i].pinCode, derivations[i].ws,
+                                                   sizeof(derivations[i].ws)) == CHIP_NO_ERROR);
+            VerifyOrDie(cache.Insert(derivations[i].pinCode, kIterationCount, ByteSpan(kSalt), derivations[i].ws) ==
+                        CHIP_NO_ERROR);
+        }
+    }
+
+    // Only accessed from the event loop.
+    std::vector<double> latenciesMs;
+    size_t completed = 0;
+    Clock::time_point end;
+
+    std::atomic<bool> done{ false };
+    std::thread eventLoopThread([&] { eventLoop.Run(); });
+    std::thread backgroundThread([&] { backgroundWorker.Run(); });
+    std::thread ticker([&] {
+        while (!done)
+        {
+            Clock::time_point posted = Clock::now();
+            eventLoop.Post([&, posted] {
+                latenciesMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - posted).count());
+            });
+            std::this_thread::sleep_for(kHeartbeatPeriod);
+        }
+    });
+
+    auto onDerived = [&](Derivation & derivation) {
+        if (mode != Mode::kCached)
+        {
+            VerifyOrDie(cache.Insert(derivation.pinCode, kIterationCount, ByteSpan(kSalt), derivation.ws) == CHIP_NO_ERROR);
+        }
+        if (++completed == kSessions)
+        {
+            end  = Clock::now();
+            done = true;
+        }
+    };
+
+    // All the PBKDF param responses arrive together.
+    Clock::time_point start = Clock::now();
+    for (Derivation & derivation : derivations)
+    {
+        eventLoop.Post([&] {
+            if (cache.Find(derivation.pinCode, kIterationCount, ByteSpan(kSalt), derivation.ws) == CHIP_NO_ERROR)
+            {
+                onDerived(derivation);
+                return;
+            }
+            if (mode == Mode::kInline)
+            {
+                VerifyOrDie(Spake2pVerifier::ComputeWS(kIterationCount, ByteSpan(kSalt), derivation.pinCode, derivation.ws,
+                                                       sizeof(derivation.ws)) == CHIP_NO_ERROR);
+                onDerived(derivation);
+                return;
+            }
+            backgroundWorker.Post([&] {
+                VerifyOrDie(Spake2pVerifier::ComputeWS(kIterationCount, ByteSpan(kSalt), derivation.pinCode, derivation.ws,
+                                                       sizeof(derivation.ws)) == CHIP_NO_ERROR);
+                eventLoop.Post([&] { onDerived(derivation); });
+            });
+        });
+    }
+
+    ticker.join();
+    backgroundWorker.Stop();
+    backgroundThread.join();
+    eventLoop.Stop();
+    eventLoopThread.join();
+
+    std::sort(latenciesMs.begin(), latenciesMs.end());
+    double p99 = latenciesMs.empty() ? 0 : latenciesMs[latenciesMs.size() * 99 / 100];
+    double max = latenciesMs.empty() ? 0 : latenciesMs.back();
+    printf("%-12s %10.1f %16.2f %16.2f\n", name, std::chrono::duration<double, std::milli>(end - start).count(), p99, max);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    printf("%zu concurrent PASE sessions, %u PBKDF2 iterations\n", kSessions, kIterationCount);
+    printf("%-12s %10s %16s %16s\n", "pbkdf2", "all (ms)", "stall p99 (ms)", "stall max (ms)");
+    Run(Mode::kInline, "inline");
+    Run(Mode::kBackground, "background");
+    Run(Mode::kCached, "cached");
+
+    Platform::MemoryShutdown();
+    return 0;
+}
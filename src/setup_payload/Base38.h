@@ -29,9 +29,18 @@
 
 namespace chip {
 
-static const char kCodes[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I',
-                               'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '-', '.' };
-static const uint8_t kBase38CharactersNeededInNBytesChunk[] = { 2, 4, 5 };
-static const uint8_t kRadix                                 = MATTER_ARRAY_SIZE(kCodes);
+static constexpr char kCodes[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I',
+                                   'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '-', '.' };
+static constexpr uint8_t kBase38CharactersNeededInNBytesChunk[] = { 2, 4, 5 };
+static constexpr uint8_t kRadix                                 = MATTER_ARRAY_SIZE(kCodes);
+
+/**
+ * Return kCodes[digit], computed rather than looked up so that the loops converting many digits can be vectorized:
+ * 0..9 map to '0'..'9', 10..35 to 'A'..'Z', 36 to '-' and 37 to '.'.
+ */
+constexpr char base38Char(uint32_t digit)
+{
+    return static_cast<char>(digit + '0' + (digit >= 10 ? 'A' - '9' - 1 : 0) - (digit >= 36 ? 'Z' + 1 - '-' : 0));
+}
 
 } // namespace chip
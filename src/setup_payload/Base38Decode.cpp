@@ -25,82 +25,39 @@
 
 namespace {
 
-static inline CHIP_ERROR decodeChar(char c, uint8_t & value)
+constexpr uint8_t kBogus = 255;
+
+// Map of every character to its Base38 value, or to kBogus: a full table needs no range check of the characters, and the
+// validity of a whole chunk is checked at once since a chunk containing kBogus has the high bit of its values set.
+struct DecodeTable
 {
-    static const int kBogus = 255;
-    // map of base38 charater to numeric value
-    // subtract 45 from the charater, then index into this array, if possible
-    const uint8_t decodes[] = {
-        36,     // '-', =45
-        37,     // '.', =46
-        kBogus, // '/', =47
-        0,      // '0', =48
-        1,      // '1', =49
-        2,      // '2', =50
-        3,      // '3', =51
-        4,      // '4', =52
-        5,      // '5', =53
-        6,      // '6', =54
-        7,      // '7', =55
-        8,      // '8', =56
-        9,      // '9', =57
-        kBogus, // ':', =58
-        kBogus, // ';', =59
-        kBogus, // '<', =50
-        kBogus, // '=', =61
-        kBogus, // '>', =62
-        kBogus, // '?', =63
-        kBogus, // '@', =64
-        10,     // 'A', =65
-        11,     // 'B', =66
-        12,     // 'C', =67
-        13,     // 'D', =68
-        14,     // 'E', =69
-        15,     // 'F', =70
-        16,     // 'G', =71
-        17,     // 'H', =72
-        18,     // 'I', =73
-        19,     // 'J', =74
-        20,     // 'K', =75
-        21,     // 'L', =76
-        22,     // 'M', =77
-        23,     // 'N', =78
-        24,     // 'O', =79
-        25,     // 'P', =80
-        26,     // 'Q', =81
-        27,     // 'R', =82
-        28,     // 'S', =83
-        29,     // 'T', =84
-        30,     // 'U', =85
-        31,     // 'V', =86
-        32,     // 'W', =87
-        33,     // 'X', =88
-        34,     // 'Y', =89
-        35,     // 'Z', =90
-    };
-    if (c < '-' || c > 'Z')
-    {
-        return CHIP_ERROR_INVALID_INTEGER_VALUE;
-    }
-    uint8_t v = decodes[c - '-'];
-    if (v == kBogus)
+    uint8_t values[256];
+
+    constexpr DecodeTable() : values{}
     {
-        return CHIP_ERROR_INVALID_INTEGER_VALUE;
+        for (uint8_t & value : values)
+        {
+            value = kBogus;
+        }
+        for (uint8_t digit = 0; digit < chip::kRadix; digit++)
+        {
+            values[static_cast<uint8_t>(chip::base38Char(digit))] = digit;
+        }
     }
-    value = v;
-    return CHIP_NO_ERROR;
-}
+};
+
+constexpr DecodeTable kDecodeTable;
 
 } // unnamed namespace
 
 namespace chip {
 
-CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+CHIP_ERROR base38Decode(CharSpan base38, MutableByteSpan & out)
 {
-    result.clear();
+    const char * base38Ptr        = base38.data();
+    size_t base38CharactersNumber = base38.size();
+    size_t outIdx                 = 0;
 
-    size_t base38CharactersNumber  = base38.length();
-    size_t decodedBase38Characters = 0;
     while (base38CharactersNumber > 0)
     {
         uint8_t base38CharactersInChunk;
@@ -126,36 +83,44 @@ CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
             return CHIP_ERROR_INVALID_STRING_LENGTH;
         }
 
-        uint32_t value = 0;
+        uint32_t value    = 0;
+        uint8_t allValues = 0;
 
         for (size_t i = base38CharactersInChunk; i > 0; i--)
         {
-            uint8_t v      = 0;
-            CHIP_ERROR err = decodeChar(base38[decodedBase38Characters + i - 1], v);
-
-            if (err != CHIP_NO_ERROR)
-            {
-                return err;
-            }
-
+            uint8_t v = kDecodeTable.values[static_cast<uint8_t>(base38Ptr[i - 1])];
+            allValues |= v;
             value = value * kRadix + v;
         }
-        decodedBase38Characters += base38CharactersInChunk;
+        VerifyOrReturnError((allValues & 0x80) == 0, CHIP_ERROR_INVALID_INTEGER_VALUE);
+        // encoded value is too big to represent a correct chunk of size 1, 2 or 3 bytes
+        VerifyOrReturnError((value >> (8 * bytesInDecodedChunk)) == 0, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(outIdx + bytesInDecodedChunk <= out.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        base38Ptr += base38CharactersInChunk;
         base38CharactersNumber -= base38CharactersInChunk;
 
         for (size_t i = 0; i < bytesInDecodedChunk; i++)
         {
-            result.push_back(static_cast<uint8_t>(value));
+            out.data()[outIdx++] = static_cast<uint8_t>(value);
             value >>= 8;
         }
-
-        if (value > 0)
-        {
-            // encoded value is too big to represent a correct chunk of size 1, 2 or 3 bytes
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
     }
+
+    out.reduce_size(outIdx);
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+{
+    // Each character decodes to less than a byte.
+    result.resize(base38.length());
+
+    MutableByteSpan resultSpan(result.data(), result.size());
+    CHIP_ERROR err = base38Decode(CharSpan(base38.data(), base38.length()), resultSpan);
+
+    result.resize(err == CHIP_NO_ERROR ? resultSpan.size() : 0);
+    return err;
+}
+
 } // namespace chip
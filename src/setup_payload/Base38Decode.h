@@ -19,11 +19,20 @@
 
 #include "Base38.h"
 
+#include <lib/support/Span.h>
+
 #include <string>
 #include <vector>
 
 namespace chip {
 
+/*
+ * Decodes the Base38 string into out, without allocating memory.
+ *
+ * The resulting size of the out span will be the size of the decoded data, which is at most the length of the string.
+ */
+CHIP_ERROR base38Decode(CharSpan base38, MutableByteSpan & out);
+
 CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & out);
 
 } // namespace chip
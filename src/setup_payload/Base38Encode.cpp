@@ -35,7 +35,18 @@
 
 namespace {
 
-static const uint8_t kMaxBytesSingleChunkLen = 3;
+constexpr uint8_t kMaxBytesSingleChunkLen = 3;
+
+// Convert a chunk, with its first byte in the least significant byte of value, to charCount characters. The divisions by the
+// constant radix compile to multiplications, and the loop is unrolled for the constant size of a full chunk.
+inline void encodeChunk(uint32_t value, char * out, uint8_t charCount)
+{
+    for (uint8_t character = 0; character < charCount; character++)
+    {
+        out[character] = chip::base38Char(value % chip::kRadix);
+        value /= chip::kRadix;
+    }
+}
 
 } // unnamed namespace
 
@@ -48,33 +59,44 @@ CHIP_ERROR base38Encode(ByteSpan in_buf, MutableCharSpan & out_buf)
     size_t in_buf_len          = in_buf.size();
     size_t out_idx             = 0;
 
-    while (in_buf_len > 0)
-    {
-        uint32_t value = 0;
-        static_assert((sizeof(value) * CHAR_BIT) >= (kMaxBytesSingleChunkLen * 8), "Type for value is too small for conversions");
+    static_assert((sizeof(uint32_t) * CHAR_BIT) >= (kMaxBytesSingleChunkLen * 8), "Type for value is too small for conversions");
 
-        size_t bytesInChunk = (in_buf_len >= kMaxBytesSingleChunkLen) ? kMaxBytesSingleChunkLen : in_buf_len;
+    // Without code length optimization there is constant characters number needed for specific chunk size.
+    constexpr uint8_t kCharactersInFullChunk = kBase38CharactersNeededInNBytesChunk[kMaxBytesSingleChunkLen - 1];
 
-        for (size_t byte_idx = 0; byte_idx < bytesInChunk; byte_idx++)
+    while (in_buf_len >= kMaxBytesSingleChunkLen)
+    {
+        if ((out_idx + kCharactersInFullChunk) >= out_buf.size())
         {
-            value += static_cast<uint32_t>(in_buf_ptr[byte_idx] << (8 * byte_idx));
+            err = CHIP_ERROR_BUFFER_TOO_SMALL;
+            break;
         }
-        in_buf_len -= bytesInChunk;
-        in_buf_ptr += bytesInChunk;
 
-        // Without code length optimization there is constant characters number needed for specific chunk size.
-        const uint8_t base38CharactersNeeded = kBase38CharactersNeededInNBytesChunk[bytesInChunk - 1];
+        uint32_t value = static_cast<uint32_t>(in_buf_ptr[0] | (in_buf_ptr[1] << 8) | (in_buf_ptr[2] << 16));
+        encodeChunk(value, &out_buf.data()[out_idx], kCharactersInFullChunk);
+
+        in_buf_len -= kMaxBytesSingleChunkLen;
+        in_buf_ptr += kMaxBytesSingleChunkLen;
+        out_idx += kCharactersInFullChunk;
+    }
+
+    if (err == CHIP_NO_ERROR && in_buf_len > 0)
+    {
+        const uint8_t base38CharactersNeeded = kBase38CharactersNeededInNBytesChunk[in_buf_len - 1];
 
         if ((out_idx + base38CharactersNeeded) >= out_buf.size())
         {
             err = CHIP_ERROR_BUFFER_TOO_SMALL;
-            break;
         }
-
-        for (uint8_t character = 0; character < base38CharactersNeeded; character++)
+        else
         {
-            out_buf.data()[out_idx++] = kCodes[value % kRadix];
-            value /= kRadix;
+            uint32_t value = 0;
+            for (size_t byte_idx = 0; byte_idx < in_buf_len; byte_idx++)
+            {
+                value += static_cast<uint32_t>(in_buf_ptr[byte_idx] << (8 * byte_idx));
+            }
+            encodeChunk(value, &out_buf.data()[out_idx], base38CharactersNeeded);
+            out_idx += base38CharactersNeeded;
         }
     }
 
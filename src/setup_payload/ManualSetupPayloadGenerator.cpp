@@ -23,8 +23,6 @@
 
 #include "ManualSetupPayloadGenerator.h"
 
-#include <inttypes.h>
-
 #include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/verhoeff/Verhoeff.h>
 
@@ -85,12 +83,22 @@ static uint32_t chunk3PayloadRepresentation(const PayloadContents & payload)
     return result;
 }
 
+// Same output as snprintf with "%0*u" and a width of buffer.size() - 1, without the cost of parsing the format.
 static CHIP_ERROR decimalStringWithPadding(MutableCharSpan buffer, uint32_t number)
 {
-    int len    = static_cast<int>(buffer.size() - 1);
-    int retval = snprintf(buffer.data(), buffer.size(), "%0*" PRIu32, len, number);
+    VerifyOrReturnError(!buffer.empty(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    char * digits = buffer.data();
+    size_t len    = buffer.size() - 1;
+
+    digits[len] = '\0';
+    for (size_t i = len; i > 0; i--)
+    {
+        digits[i - 1] = static_cast<char>('0' + number % 10);
+        number /= 10;
+    }
 
-    return (retval >= static_cast<int>(buffer.size())) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+    return (number != 0) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ManualSetupPayloadGenerator::payloadDecimalStringRepresentation(MutableCharSpan & outBuffer)
@@ -129,7 +137,7 @@ CHIP_ERROR ManualSetupPayloadGenerator::payloadDecimalStringRepresentation(Mutab
 
     size_t offset = 0;
 
-    // Add one to the length of each chunk, since snprintf writes a null terminator.
+    // Add one to the length of each chunk, since decimalStringWithPadding writes a null terminator.
     ReturnErrorOnFailure(decimalStringWithPadding(outBuffer.SubSpan(offset, kManualSetupCodeChunk1CharLength + 1), chunk1));
     offset += kManualSetupCodeChunk1CharLength;
     ReturnErrorOnFailure(decimalStringWithPadding(outBuffer.SubSpan(offset, kManualSetupCodeChunk2CharLength + 1), chunk2));
@@ -0,0 +1,245 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the generation and the parsing of the onboarding codes of many payloads at once.
+ */
+
+#include "SetupPayloadBatch.h"
+
+#include "Base38Decode.h"
+#include "Base38Encode.h"
+#include "ManualSetupPayloadGenerator.h"
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/verhoeff/Verhoeff.h>
+
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+// The packed payload of a QR code, padded so that any of its fields can be read with a single 64-bit load.
+constexpr size_t kPaddedPayloadDataSize = kTotalPayloadDataSizeInBytes + sizeof(uint64_t);
+
+// Write the field of fieldLength bits at offset in the packed payload, least significant bit first.
+void writeField(uint8_t (&bits)[kPaddedPayloadDataSize], size_t & offset, uint32_t value, int fieldLength)
+{
+    uint8_t * word = &bits[offset / 8];
+    Encoding::LittleEndian::Put64(word, Encoding::LittleEndian::Get64(word) | (static_cast<uint64_t>(value) << (offset % 8)));
+    offset += static_cast<size_t>(fieldLength);
+}
+
+CHIP_ERROR generateQRCode(const PayloadContents & payload, MutableCharSpan code)
+{
+    VerifyOrReturnError(payload.isValidQRCodePayload(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The fields of a valid payload fit in their lengths.
+    uint8_t bits[kPaddedPayloadDataSize] = {};
+    size_t offset                        = 0;
+    writeField(bits, offset, payload.version, kVersionFieldLengthInBits);
+    writeField(bits, offset, payload.vendorID, kVendorIDFieldLengthInBits);
+    writeField(bits, offset, payload.productID, kProductIDFieldLengthInBits);
+    writeField(bits, offset, static_cast<uint32_t>(payload.commissioningFlow), kCommissioningFlowFieldLengthInBits);
+    writeField(bits, offset, payload.rendezvousInformation.Value().Raw(), kRendezvousInfoFieldLengthInBits);
+    writeField(bits, offset, payload.discriminator.GetLongValue(), kPayloadDiscriminatorFieldLengthInBits);
+    writeField(bits, offset, payload.setUpPINCode, kSetupPINCodeFieldLengthInBits);
+
+    const size_t prefixLength = strlen(kQRCodePrefix);
+    memcpy(code.data(), kQRCodePrefix, prefixLength);
+    MutableCharSpan base38 = code.SubSpan(prefixLength);
+    return base38Encode(ByteSpan(bits, kTotalPayloadDataSizeInBytes), base38);
+}
+
+// Read the field of fieldLength bits at offset in the packed payload, least significant bit first.
+uint32_t readField(const uint8_t (&bits)[kPaddedPayloadDataSize], size_t & offset, int fieldLength)
+{
+    uint64_t word = Encoding::LittleEndian::Get64(&bits[offset / 8]) >> (offset % 8);
+    offset += static_cast<size_t>(fieldLength);
+    return static_cast<uint32_t>(word & ((1u << fieldLength) - 1));
+}
+
+CHIP_ERROR parseQRCode(CharSpan code, PayloadContents & payload)
+{
+    static_assert(kSetupPINCodeFieldLengthInBits + 7 < 64, "Fields must be read with a single load");
+
+    const size_t prefixLength = strlen(kQRCodePrefix);
+
+    VerifyOrReturnError(code.size() >= prefixLength && memcmp(code.data(), kQRCodePrefix, prefixLength) == 0,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(code.size() <= kBasicQRCodeLength, CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(code.size() == kBasicQRCodeLength, CHIP_ERROR_INVALID_STRING_LENGTH);
+
+    uint8_t bits[kPaddedPayloadDataSize] = {};
+    MutableByteSpan bitsSpan(bits, kTotalPayloadDataSizeInBytes);
+    ReturnErrorOnFailure(base38Decode(code.SubSpan(prefixLength), bitsSpan));
+
+    size_t offset             = 0;
+    payload.version           = static_cast<uint8_t>(readField(bits, offset, kVersionFieldLengthInBits));
+    payload.vendorID          = static_cast<uint16_t>(readField(bits, offset, kVendorIDFieldLengthInBits));
+    payload.productID         = static_cast<uint16_t>(readField(bits, offset, kProductIDFieldLengthInBits));
+    payload.commissioningFlow = static_cast<CommissioningFlow>(readField(bits, offset, kCommissioningFlowFieldLengthInBits));
+    payload.rendezvousInformation.SetValue(RendezvousInformationFlags().SetRaw(
+        static_cast<std::underlying_type_t<RendezvousInformationFlag>>(readField(bits, offset, kRendezvousInfoFieldLengthInBits))));
+    payload.discriminator.SetLongValue(static_cast<uint16_t>(readField(bits, offset, kPayloadDiscriminatorFieldLengthInBits)));
+    payload.setUpPINCode = readField(bits, offset, kSetupPINCodeFieldLengthInBits);
+    VerifyOrReturnError(readField(bits, offset, kPaddingFieldLengthInBits) == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    VerifyOrReturnError(payload.isValidQRCodePayload(), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+// Read a number from decimal digits which are known to be valid.
+uint32_t readDigits(const char * digits, size_t & offset, size_t count)
+{
+    uint32_t number = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        number = number * 10 + static_cast<uint32_t>(digits[offset + i] - '0');
+    }
+    offset += count;
+    return number;
+}
+
+CHIP_ERROR parseManualCode(CharSpan code, PayloadContents & payload)
+{
+    // The digits of the code, without the digit group separators, then the check digit.
+    char digits[kManualSetupLongCodeCharLength + 1];
+    size_t length = 0;
+
+    for (char c : code)
+    {
+        if (c == '-')
+        {
+            continue;
+        }
+        VerifyOrReturnError(length < sizeof(digits), CHIP_ERROR_INVALID_STRING_LENGTH);
+        digits[length++] = c;
+    }
+
+    VerifyOrReturnError(length >= 2, CHIP_ERROR_INVALID_STRING_LENGTH);
+    length--;
+    VerifyOrReturnError(Verhoeff10::ValidateCheckChar(digits[length], digits, length), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    for (size_t i = 0; i < length; i++)
+    {
+        VerifyOrReturnError(digits[i] >= '0' && digits[i] <= '9', CHIP_ERROR_INVALID_INTEGER_VALUE);
+    }
+    VerifyOrReturnError(length >= kManualSetupShortCodeCharLength, CHIP_ERROR_INVALID_STRING_LENGTH);
+
+    size_t offset   = 0;
+    uint32_t chunk1 = readDigits(digits, offset, kManualSetupCodeChunk1CharLength);
+    uint32_t chunk2 = readDigits(digits, offset, kManualSetupCodeChunk2CharLength);
+    uint32_t chunk3 = readDigits(digits, offset, kManualSetupCodeChunk3CharLength);
+
+    // First digit of '8' or '9' would be invalid for v1 and would indicate new format (e.g. version 2)
+    VerifyOrReturnError(chunk1 != 8 && chunk1 != 9, CHIP_ERROR_INVALID_ARGUMENT);
+
+    bool isLongCode           = ((chunk1 >> kManualSetupChunk1VidPidPresentBitPos) & 1) == 1;
+    size_t expectedCharLength = isLongCode ? kManualSetupLongCodeCharLength : kManualSetupShortCodeCharLength;
+    VerifyOrReturnError(length == expectedCharLength, CHIP_ERROR_INVALID_STRING_LENGTH);
+
+    constexpr uint32_t kDiscriminatorMsbitsMask = (1 << kManualSetupChunk1DiscriminatorMsbitsLength) - 1;
+    constexpr uint32_t kDiscriminatorLsbitsMask = (1 << kManualSetupChunk2DiscriminatorLsbitsLength) - 1;
+    constexpr uint32_t kPincodeMsbitsMask       = (1 << kManualSetupChunk3PINCodeMsbitsLength) - 1;
+    constexpr uint32_t kPincodeLsbitsMask       = (1 << kManualSetupChunk2PINCodeLsbitsLength) - 1;
+
+    uint32_t discriminator = ((chunk2 >> kManualSetupChunk2DiscriminatorLsbitsPos) & kDiscriminatorLsbitsMask);
+    discriminator |= ((chunk1 >> kManualSetupChunk1DiscriminatorMsbitsPos) & kDiscriminatorMsbitsMask)
+        << kManualSetupChunk2DiscriminatorLsbitsLength;
+
+    uint32_t setUpPINCode = ((chunk2 >> kManualSetupChunk2PINCodeLsbitsPos) & kPincodeLsbitsMask);
+    setUpPINCode |= ((chunk3 >> kManualSetupChunk3PINCodeMsbitsPos) & kPincodeMsbitsMask) << kManualSetupChunk2PINCodeLsbitsLength;
+
+    // The payloads may be reused: reset the fields which are not in all the codes.
+    payload = PayloadContents();
+
+    if (isLongCode)
+    {
+        uint32_t vendorID  = readDigits(digits, offset, kManualSetupVendorIdCharLength);
+        uint32_t productID = readDigits(digits, offset, kManualSetupProductIdCharLength);
+        // Need to do dynamic checks, because we are reading 5 chars, so could have 99,999 here or something.
+        VerifyOrReturnError(CanCastTo<uint16_t>(vendorID) && CanCastTo<uint16_t>(productID), CHIP_ERROR_INVALID_INTEGER_VALUE);
+        payload.vendorID  = static_cast<uint16_t>(vendorID);
+        payload.productID = static_cast<uint16_t>(productID);
+    }
+    payload.commissioningFlow = isLongCode ? CommissioningFlow::kCustom : CommissioningFlow::kStandard;
+    payload.setUpPINCode      = setUpPINCode;
+    static_assert(kManualSetupDiscriminatorFieldLengthInBits <= 8, "Won't fit in uint8_t");
+    payload.discriminator.SetShortValue(static_cast<uint8_t>(discriminator));
+
+    VerifyOrReturnError(payload.isValidManualCode(), CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR GenerateQRCodes(Span<const PayloadContents> payloads, MutableCharSpan codes, size_t & count)
+{
+    count = 0;
+    VerifyOrReturnError(codes.size() / kBatchQRCodeStride >= payloads.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (; count < payloads.size(); count++)
+    {
+        ReturnErrorOnFailure(generateQRCode(payloads[count], codes.SubSpan(count * kBatchQRCodeStride, kBatchQRCodeStride)));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR GenerateManualCodes(Span<const PayloadContents> payloads, MutableCharSpan codes, size_t & count, bool forceShortCode)
+{
+    count = 0;
+    VerifyOrReturnError(codes.size() / kBatchManualCodeStride >= payloads.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (; count < payloads.size(); count++)
+    {
+        MutableCharSpan code = codes.SubSpan(count * kBatchManualCodeStride, kBatchManualCodeStride);
+        ManualSetupPayloadGenerator generator(payloads[count]);
+        generator.SetForceShortCode(forceShortCode);
+        ReturnErrorOnFailure(generator.payloadDecimalStringRepresentation(code));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ParseQRCodes(Span<const CharSpan> codes, Span<PayloadContents> payloads, size_t & count)
+{
+    count = 0;
+    VerifyOrReturnError(payloads.size() >= codes.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (; count < codes.size(); count++)
+    {
+        ReturnErrorOnFailure(parseQRCode(codes[count], payloads[count]));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ParseManualCodes(Span<const CharSpan> codes, Span<PayloadContents> payloads, size_t & count)
+{
+    count = 0;
+    VerifyOrReturnError(payloads.size() >= codes.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (; count < codes.size(); count++)
+    {
+        ReturnErrorOnFailure(parseManualCode(codes[count], payloads[count]));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
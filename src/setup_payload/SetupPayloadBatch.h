@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file describes the generation and the parsing of the onboarding codes of many
+ *      payloads at once, for manufacturing and cloud services. The codes and the payloads are
+ *      written to buffers provided by the caller, without any allocation for each payload.
+ *
+ *      Only the payloads without optional data are handled: the others are generated and
+ *      parsed with QRCodeSetupPayloadGenerator and SetupPayload::FromStringRepresentation.
+ */
+
+#pragma once
+
+#include "Base38.h"
+#include "SetupPayload.h"
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+
+namespace chip {
+
+/// Length of the QR code of a payload without optional data: the "MT:" prefix, then the Base38 encoding of the payload.
+constexpr size_t kBasicQRCodeLength = 3 + (kTotalPayloadDataSizeInBytes / 3) * kBase38CharactersNeededInNBytesChunk[2] +
+    kBase38CharactersNeededInNBytesChunk[kTotalPayloadDataSizeInBytes % 3 - 1];
+
+/// Distance between the QR codes written by GenerateQRCodes: a code and its null terminator.
+constexpr size_t kBatchQRCodeStride = kBasicQRCodeLength + 1;
+
+/// Distance between the manual codes written by GenerateManualCodes: a long code, its check digit and its null terminator.
+constexpr size_t kBatchManualCodeStride = kManualSetupLongCodeCharLength + 2;
+
+/**
+ * Generate the QR codes of payloads without optional data.
+ *
+ * The code of payloads[i] is written, null-terminated, at codes.data() + i * kBatchQRCodeStride.
+ *
+ * @param[in]  payloads  The payloads, which must be valid for QR codes.
+ * @param[out] codes     The buffer of the codes, of at least payloads.size() * kBatchQRCodeStride characters.
+ * @param[out] count     The number of codes generated: payloads.size() on success, otherwise the index of the
+ *                       payload which failed.
+ *
+ * @retval #CHIP_NO_ERROR if the method succeeded.
+ * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if codes is too small for all the codes, in which case none is generated.
+ * @retval #CHIP_ERROR_INVALID_ARGUMENT if a payload is invalid.
+ */
+CHIP_ERROR GenerateQRCodes(Span<const PayloadContents> payloads, MutableCharSpan codes, size_t & count);
+
+/**
+ * Generate the manual codes of payloads.
+ *
+ * The code of payloads[i] is written, null-terminated, at codes.data() + i * kBatchManualCodeStride. The codes are
+ * long codes for the payloads with a commissioning flow other than standard, unless forceShortCode is set.
+ *
+ * @param[in]  payloads        The payloads, which must be valid for manual codes.
+ * @param[out] codes           The buffer of the codes, of at least payloads.size() * kBatchManualCodeStride characters.
+ * @param[out] count           The number of codes generated: payloads.size() on success, otherwise the index of
+ *                             the payload which failed.
+ * @param[in]  forceShortCode  Whether to generate short codes for all the payloads.
+ *
+ * @retval #CHIP_NO_ERROR if the method succeeded.
+ * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if codes is too small for all the codes, in which case none is generated.
+ * @retval #CHIP_ERROR_INVALID_ARGUMENT if a payload is invalid.
+ */
+CHIP_ERROR GenerateManualCodes(Span<const PayloadContents> payloads, MutableCharSpan codes, size_t & count,
+                               bool forceShortCode = false);
+
+/**
+ * Parse QR codes, such as those written by GenerateQRCodes, into payloads which are validated as by
+ * SetupPayload::FromStringRepresentation.
+ *
+ * @param[in]  codes     The QR codes, of payloads without optional data.
+ * @param[out] payloads  The payloads, of at least codes.size() entries. payloads[i] is parsed from codes[i].
+ * @param[out] count     The number of codes parsed: codes.size() on success, otherwise the index of the code which
+ *                       failed.
+ *
+ * @retval #CHIP_NO_ERROR if the method succeeded.
+ * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if payloads is too small for all the codes, in which case none is parsed.
+ * @retval #CHIP_ERROR_NOT_IMPLEMENTED if a code has optional data or several payloads.
+ * @retval other Other CHIP error codes if a code is invalid.
+ */
+CHIP_ERROR ParseQRCodes(Span<const CharSpan> codes, Span<PayloadContents> payloads, size_t & count);
+
+/**
+ * Parse manual codes, such as those written by GenerateManualCodes, into payloads which are validated as by
+ * SetupPayload::FromStringRepresentation. The codes may have '-' digit group separators.
+ *
+ * @param[in]  codes     The manual codes.
+ * @param[out] payloads  The payloads, of at least codes.size() entries. payloads[i] is parsed from codes[i].
+ * @param[out] count     The number of codes parsed: codes.size() on success, otherwise the index of the code which
+ *                       failed.
+ *
+ * @retval #CHIP_NO_ERROR if the method succeeded.
+ * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if payloads is too small for all the codes, in which case none is parsed.
+ * @retval other Other CHIP error codes if a code is invalid.
+ */
+CHIP_ERROR ParseManualCodes(Span<const CharSpan> codes, Span<PayloadContents> payloads, size_t & count);
+
+} // namespace chip
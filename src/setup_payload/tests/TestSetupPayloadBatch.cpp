@@ -0,0 +1,251 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the batch generation
+ *      and parsing of onboarding codes.
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <setup_payload/ManualSetupPayloadGenerator.h>
+#include <setup_payload/ManualSetupPayloadParser.h>
+#include <setup_payload/SetupPayloadBatch.h>
+
+#include "TestHelpers.h"
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kPayloadCount = 16;
+
+std::vector<PayloadContents> GetPayloads()
+{
+    std::vector<PayloadContents> payloads;
+
+    for (size_t i = 0; i < kPayloadCount; i++)
+    {
+        PayloadContents payload = GetDefaultPayload();
+        payload.discriminator.SetLongValue(static_cast<uint16_t>(0xF00 + i * 7));
+        payload.setUpPINCode = static_cast<uint32_t>(20202021 + i * 1000003);
+        if (i % 2)
+        {
+            payload.vendorID          = 0xFFF1;
+            payload.productID         = static_cast<uint16_t>(0x8000 + i);
+            payload.commissioningFlow = CommissioningFlow::kCustom;
+            payload.rendezvousInformation.SetValue(
+                RendezvousInformationFlags(RendezvousInformationFlag::kBLE, RendezvousInformationFlag::kOnNetwork));
+        }
+        payloads.push_back(payload);
+    }
+    return payloads;
+}
+
+std::vector<CharSpan> GetCodes(const std::vector<char> & buffer, size_t stride)
+{
+    std::vector<CharSpan> codes;
+
+    for (size_t offset = 0; offset < buffer.size(); offset += stride)
+    {
+        codes.push_back(CharSpan::fromCharString(&buffer[offset]));
+    }
+    return codes;
+}
+
+TEST(TestSetupPayloadBatch, TestBase38DecodeSpan)
+{
+    const char kEncoded[] = "KKHF3W2S013OPM3EJX11";
+    uint8_t decoded[12];
+
+    MutableByteSpan decodedSpan(decoded);
+    EXPECT_EQ(base38Decode(CharSpan::fromCharString(kEncoded), decodedSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(decodedSpan.data_equal(ByteSpan(reinterpret_cast<const uint8_t *>("Hello World!"), 12)));
+
+    MutableByteSpan smallSpan(decoded, 11);
+    EXPECT_EQ(base38Decode(CharSpan::fromCharString(kEncoded), smallSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Every byte value, in chunks of all sizes, encodes and decodes back.
+    uint8_t input[256 + 1];
+    for (size_t i = 0; i < sizeof(input); i++)
+    {
+        input[i] = static_cast<uint8_t>(i);
+    }
+    for (size_t length = sizeof(input) - 3; length <= sizeof(input); length++)
+    {
+        char encoded[kDefaultBufferSizeInBytes];
+        MutableCharSpan encodedSpan(encoded);
+        ASSERT_EQ(base38Encode(ByteSpan(input, length), encodedSpan), CHIP_NO_ERROR);
+
+        uint8_t output[sizeof(input)];
+        MutableByteSpan outputSpan(output);
+        ASSERT_EQ(base38Decode(encodedSpan, outputSpan), CHIP_NO_ERROR);
+        EXPECT_TRUE(outputSpan.data_equal(ByteSpan(input, length)));
+    }
+}
+
+TEST(TestSetupPayloadBatch, TestQRCodes)
+{
+    std::vector<PayloadContents> payloads = GetPayloads();
+    std::vector<char> buffer(kPayloadCount * kBatchQRCodeStride);
+    size_t count;
+
+    EXPECT_EQ(GenerateQRCodes(Span<const PayloadContents>(payloads.data(), payloads.size()),
+                              MutableCharSpan(buffer.data(), buffer.size()), count),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(count, kPayloadCount);
+
+    std::vector<CharSpan> codes = GetCodes(buffer, kBatchQRCodeStride);
+    for (size_t i = 0; i < kPayloadCount; i++)
+    {
+        SetupPayload payload;
+        static_cast<PayloadContents &>(payload) = payloads[i];
+
+        std::string expected;
+        EXPECT_EQ(QRCodeSetupPayloadGenerator(payload).payloadBase38Representation(expected), CHIP_NO_ERROR);
+        EXPECT_TRUE(codes[i].data_equal(CharSpan(expected.data(), expected.size())));
+        EXPECT_EQ(codes[i].size(), kBasicQRCodeLength);
+    }
+
+    std::vector<PayloadContents> parsed(kPayloadCount);
+    EXPECT_EQ(ParseQRCodes(Span<const CharSpan>(codes.data(), codes.size()), Span<PayloadContents>(parsed.data(), parsed.size()),
+                           count),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(count, kPayloadCount);
+    for (size_t i = 0; i < kPayloadCount; i++)
+    {
+        EXPECT_TRUE(parsed[i] == payloads[i]);
+    }
+}
+
+TEST(TestSetupPayloadBatch, TestManualCodes)
+{
+    std::vector<PayloadContents> payloads = GetPayloads();
+    std::vector<char> buffer(kPayloadCount * kBatchManualCodeStride);
+    size_t count;
+
+    EXPECT_EQ(GenerateManualCodes(Span<const PayloadContents>(payloads.data(), payloads.size()),
+                                  MutableCharSpan(buffer.data(), buffer.size()), count),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(count, kPayloadCount);
+
+    std::vector<CharSpan> codes = GetCodes(buffer, kBatchManualCodeStride);
+    std::vector<PayloadContents> parsed(kPayloadCount);
+    Span<PayloadContents> parsedSpan(parsed.data(), parsed.size());
+    EXPECT_EQ(ParseManualCodes(Span<const CharSpan>(codes.data(), codes.size()), parsedSpan, count), CHIP_NO_ERROR);
+    EXPECT_EQ(count, kPayloadCount);
+
+    for (size_t i = 0; i < kPayloadCount; i++)
+    {
+        std::string expected;
+        EXPECT_EQ(ManualSetupPayloadGenerator(payloads[i]).payloadDecimalStringRepresentation(expected), CHIP_NO_ERROR);
+        EXPECT_TRUE(codes[i].data_equal(CharSpan(expected.data(), expected.size())));
+
+        SetupPayload expectedPayload;
+        EXPECT_EQ(ManualSetupPayloadParser(expected).populatePayload(expectedPayload), CHIP_NO_ERROR);
+        EXPECT_TRUE(parsed[i] == expectedPayload);
+    }
+}
+
+TEST(TestSetupPayloadBatch, TestErrors)
+{
+    std::vector<PayloadContents> payloads = GetPayloads();
+    char buffer[kPayloadCount * kBatchManualCodeStride];
+    size_t count;
+
+    EXPECT_EQ(GenerateQRCodes(Span<const PayloadContents>(payloads.data(), payloads.size()),
+                              MutableCharSpan(buffer, kPayloadCount * kBatchQRCodeStride - 1), count),
+              CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(count, 0u);
+
+    payloads[3].setUpPINCode = 11111111;
+    EXPECT_EQ(GenerateManualCodes(Span<const PayloadContents>(payloads.data(), payloads.size()), MutableCharSpan(buffer), count),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(count, 3u);
+
+    // Codes with optional data are left to the QRCodeSetupPayloadParser.
+    SetupPayload payloadWithSerialNumber = GetDefaultPayloadWithSerialNumber();
+    std::string qrCodeWithSerialNumber;
+    uint8_t optionalInfo[kDefaultBufferSizeInBytes];
+    EXPECT_EQ(QRCodeSetupPayloadGenerator(payloadWithSerialNumber)
+                  .payloadBase38Representation(qrCodeWithSerialNumber, optionalInfo, sizeof(optionalInfo)),
+              CHIP_NO_ERROR);
+
+    const CharSpan kQRCodes[] = {
+        CharSpan::fromCharString(kDefaultPayloadQRCode),
+        CharSpan::fromCharString(kConcatenatedQRCode),
+        CharSpan(qrCodeWithSerialNumber.data(), qrCodeWithSerialNumber.size()),
+        CharSpan::fromCharString("MT:M5L90MP500K64J0000"),
+        CharSpan::fromCharString("MT:M5L90MP500K64J0000["),
+        CharSpan::fromCharString("M5L90MP500K64J00000"),
+    };
+    const CHIP_ERROR kQRCodeErrors[] = {
+        CHIP_NO_ERROR,
+        CHIP_ERROR_NOT_IMPLEMENTED,
+        CHIP_ERROR_NOT_IMPLEMENTED,
+        CHIP_ERROR_INVALID_STRING_LENGTH,
+        CHIP_ERROR_INVALID_INTEGER_VALUE,
+        CHIP_ERROR_INVALID_ARGUMENT,
+    };
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(kQRCodes); i++)
+    {
+        PayloadContents parsed;
+        EXPECT_EQ(ParseQRCodes(Span<const CharSpan>(&kQRCodes[i], 1), Span<PayloadContents>(&parsed, 1), count), kQRCodeErrors[i]);
+    }
+
+    const CharSpan kManualCodes[] = {
+        CharSpan::fromCharString("3497-011-2332"),
+        CharSpan::fromCharString("749701123365521327694"),
+        CharSpan::fromCharString("3497-011-2331"),
+        CharSpan::fromCharString("3497011233"),
+        CharSpan::fromCharString("84970112331"),
+    };
+    const CHIP_ERROR kManualCodeErrors[] = {
+        CHIP_NO_ERROR,
+        CHIP_NO_ERROR,
+        CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+        CHIP_ERROR_INVALID_STRING_LENGTH,
+        CHIP_ERROR_INVALID_ARGUMENT,
+    };
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(kManualCodes); i++)
+    {
+        PayloadContents parsed;
+        SetupPayload expected;
+        std::string code(kManualCodes[i].data(), kManualCodes[i].size());
+        CHIP_ERROR expectedError = ManualSetupPayloadParser(code).populatePayload(expected);
+        if (expectedError == CHIP_NO_ERROR && !expected.isValidManualCode())
+        {
+            expectedError = CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        EXPECT_EQ(expectedError, kManualCodeErrors[i]);
+        EXPECT_EQ(ParseManualCodes(Span<const CharSpan>(&kManualCodes[i], 1), Span<PayloadContents>(&parsed, 1), count),
+                  kManualCodeErrors[i]);
+    }
+
+    PayloadContents parsed;
+    EXPECT_EQ(ParseManualCodes(Span<const CharSpan>(kManualCodes), Span<PayloadContents>(&parsed, 1), count),
+              CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+} // namespace
@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmark of the batch generation and parsing of onboarding codes (SetupPayloadBatch.h) against the
+ *      generators and parsers of a single payload, which use std::string, and of the Base38 decoding into a span
+ *      against the decoding into a std::vector.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <setup_payload/Base38Decode.h>
+#include <setup_payload/ManualSetupPayloadGenerator.h>
+#include <setup_payload/QRCodeSetupPayloadGenerator.h>
+#include <setup_payload/SetupPayload.h>
+#include <setup_payload/SetupPayloadBatch.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kPayloadCount = 10000;
+constexpr size_t kRounds       = 20;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile size_t gSink;
+
+std::vector<SetupPayload> GetPayloads()
+{
+    std::vector<SetupPayload> payloads(kPayloadCount);
+
+    for (size_t i = 0; i < kPayloadCount; i++)
+    {
+        SetupPayload & payload = payloads[i];
+
+        payload.vendorID          = 0xFFF1;
+        payload.productID         = static_cast<uint16_t>(0x8000 + i % 64);
+        payload.commissioningFlow = (i % 4 == 0) ? CommissioningFlow::kCustom : CommissioningFlow::kStandard;
+        payload.rendezvousInformation.SetValue(RendezvousInformationFlag::kBLE);
+        payload.discriminator.SetLongValue(static_cast<uint16_t>(i % 4096));
+        payload.setUpPINCode = static_cast<uint32_t>(20000000 + i * 7);
+    }
+    return payloads;
+}
+
+template <typename Function>
+void Measure(const char * name, Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        function();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double codes   = static_cast<double>(kPayloadCount * kRounds);
+
+    printf("%-32s %12.1f %14.0f\n", name, seconds * 1e9 / codes, codes / seconds);
+}
+
+std::vector<CharSpan> GetCodes(const std::vector<char> & buffer, size_t stride)
+{
+    std::vector<CharSpan> codes;
+
+    for (size_t offset = 0; offset < buffer.size(); offset += stride)
+    {
+        codes.push_back(CharSpan::fromCharString(&buffer[offset]));
+    }
+    return codes;
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<SetupPayload> payloads = GetPayloads();
+    std::vector<PayloadContents> contents(payloads.begin(), payloads.end());
+    Span<const PayloadContents> contentsSpan(contents.data(), contents.size());
+    std::vector<PayloadContents> parsed(kPayloadCount);
+    Span<PayloadContents> parsedSpan(parsed.data(), parsed.size());
+    std::vector<std::string> qrCodeStrings(kPayloadCount);
+    std::vector<std::string> manualCodeStrings(kPayloadCount);
+    std::vector<char> qrCodes(kPayloadCount * kBatchQRCodeStride);
+    std::vector<char> manualCodes(kPayloadCount * kBatchManualCodeStride);
+    size_t count;
+
+    printf("%-32s %12s %14s\n", "operation", "ns / code", "codes / s");
+
+    Measure("QR code generation", [&] {
+        for (size_t i = 0; i < kPayloadCount; i++)
+        {
+            VerifyOrDie(QRCodeSetupPayloadGenerator(payloads[i]).payloadBase38Representation(qrCodeStrings[i]) == CHIP_NO_ERROR);
+        }
+    });
+    Measure("QR code batch generation", [&] {
+        VerifyOrDie(GenerateQRCodes(contentsSpan, MutableCharSpan(qrCodes.data(), qrCodes.size()), count) == CHIP_NO_ERROR);
+    });
+
+    Measure("QR code parsing", [&] {
+        std::vector<SetupPayload> outPayloads;
+        for (size_t i = 0; i < kPayloadCount; i++)
+        {
+            VerifyOrDie(SetupPayload::FromStringRepresentation(qrCodeStrings[i], outPayloads) == CHIP_NO_ERROR);
+            gSink = outPayloads[0].setUpPINCode;
+        }
+    });
+    std::vector<CharSpan> qrCodeSpans = GetCodes(qrCodes, kBatchQRCodeStride);
+    Measure("QR code batch parsing", [&] {
+        VerifyOrDie(ParseQRCodes(Span<const CharSpan>(qrCodeSpans.data(), qrCodeSpans.size()), parsedSpan, count) ==
+                    CHIP_NO_ERROR);
+        gSink = parsed[kPayloadCount - 1].setUpPINCode;
+    });
+
+    Measure("Manual code generation", [&] {
+        for (size_t i = 0; i < kPayloadCount; i++)
+        {
+            VerifyOrDie(ManualSetupPayloadGenerator(payloads[i]).payloadDecimalStringRepresentation(manualCodeStrings[i]) ==
+                        CHIP_NO_ERROR);
+        }
+    });
+    Measure("Manual code batch generation", [&] {
+        VerifyOrDie(GenerateManualCodes(contentsSpan, MutableCharSpan(manualCodes.data(), manualCodes.size()), count) ==
+                    CHIP_NO_ERROR);
+    });
+
+    Measure("Manual code parsing", [&] {
+        std::vector<SetupPayload> outPayloads;
+        for (size_t i = 0; i < kPayloadCount; i++)
+        {
+            VerifyOrDie(SetupPayload::FromStringRepresentation(manualCodeStrings[i], outPayloads) == CHIP_NO_ERROR);
+            gSink = outPayloads[0].setUpPINCode;
+        }
+    });
+    std::vector<CharSpan> manualCodeSpans = GetCodes(manualCodes, kBatchManualCodeStride);
+    Measure("Manual code batch parsing", [&] {
+        VerifyOrDie(ParseManualCodes(Span<const CharSpan>(manualCodeSpans.data(), manualCodeSpans.size()), parsedSpan, count) ==
+                    CHIP_NO_ERROR);
+        gSink = parsed[kPayloadCount - 1].setUpPINCode;
+    });
+
+    // The Base38 encoding of the payloads, without the QR code prefix.
+    const size_t prefixLength = strlen(kQRCodePrefix);
+    Measure("Base38 decoding to std::vector", [&] {
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < kPayloadCount; i++)
+        {
+            VerifyOrDie(base38Decode(qrCodeStrings[i].substr(prefixLength), bytes) == CHIP_NO_ERROR);
+            gSink = bytes[0];
+        }
+    });
+    Measure("Base38 decoding to span", [&] {
+        for (size_t i = 0; i < kPayloadCount; i++)
+        {
+            uint8_t bytes[kTotalPayloadDataSizeInBytes];
+            MutableByteSpan bytesSpan(bytes);
+            VerifyOrDie(base38Decode(qrCodeSpans[i].SubSpan(prefixLength), bytesSpan) == CHIP_NO_ERROR);
+            gSink = bytes[0];
+        }
+    });
+
+    return 0;
+}
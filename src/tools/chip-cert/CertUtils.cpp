@@ -581,6 +581,51 @@ exit:
     return res;
 }
 
+bool SignAttCert(X509 * cert, EVP_PKEY * caKey, const EVP_MD * md, bool deterministicSignature)
+{
+    bool res = true;
+
+#ifdef OSSL_SIGNATURE_PARAM_NONCE_TYPE
+    if (deterministicSignature)
+    {
+        // Derive the ECDSA nonce from the key and the message (RFC 6979), so that the same certificate always gets the
+        // same signature.
+        std::unique_ptr<EVP_MD_CTX, void (*)(EVP_MD_CTX *)> mdCtx(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+        EVP_PKEY_CTX * pkeyCtx = nullptr;
+        unsigned int nonceType = 1;
+        OSSL_PARAM params[]    = { OSSL_PARAM_construct_uint(OSSL_SIGNATURE_PARAM_NONCE_TYPE, &nonceType),
+                                OSSL_PARAM_construct_end() };
+
+        VerifyOrExit(mdCtx != nullptr, res = false);
+
+        if (!EVP_DigestSignInit(mdCtx.get(), &pkeyCtx, md, nullptr, caKey))
+        {
+            ReportOpenSSLErrorAndExit("EVP_DigestSignInit", res = false);
+        }
+
+        if (!EVP_PKEY_CTX_set_params(pkeyCtx, params))
+        {
+            ReportOpenSSLErrorAndExit("EVP_PKEY_CTX_set_params", res = false);
+        }
+
+        if (!X509_sign_ctx(cert, mdCtx.get()))
+        {
+            ReportOpenSSLErrorAndExit("X509_sign_ctx", res = false);
+        }
+
+        ExitNow();
+    }
+#endif
+
+    if (!X509_sign(cert, caKey, md))
+    {
+        ReportOpenSSLErrorAndExit("X509_sign", res = false);
+    }
+
+exit:
+    return res;
+}
+
 } // namespace
 
 bool ReadCert(const char * fileNameOrStr, std::unique_ptr<X509, void (*)(X509 *)> & cert)
@@ -671,10 +716,17 @@ bool ReadCert(const char * fileNameOrStr, std::unique_ptr<X509, void (*)(X509 *)
             VerifyTrueOrExit(res);
         }
 
-        std::unique_ptr<uint8_t[]> x509CertBuf(new uint8_t[kMaxDERCertLength]);
-        MutableByteSpan x509Cert(x509CertBuf.get(), kMaxDERCertLength);
+        // Allocate exactly the size of the X.509 certificate.
+        size_t x509CertLen = 0;
+        CHIP_ERROR err     = CalculateX509CertLength(ByteSpan(certBuf.get(), certLen), x509CertLen);
+
+        std::unique_ptr<uint8_t[]> x509CertBuf(new uint8_t[x509CertLen]);
+        MutableByteSpan x509Cert(x509CertBuf.get(), x509CertLen);
 
-        CHIP_ERROR err = ConvertChipCertToX509Cert(ByteSpan(certBuf.get(), certLen), x509Cert);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = ConvertChipCertToX509Cert(ByteSpan(certBuf.get(), certLen), x509Cert);
+        }
         if (err != CHIP_NO_ERROR)
         {
             fprintf(stderr, "Error converting certificate: %s\n", chip::ErrorStr(err));
@@ -1319,7 +1371,8 @@ exit:
 
 bool MakeAttCert(AttCertType attCertType, const char * subjectCN, uint16_t subjectVID, uint16_t subjectPID,
                  bool encodeVIDandPIDasCN, X509 * caCert, EVP_PKEY * caKey, const struct tm & validFrom, uint32_t validDays,
-                 X509 * newCert, EVP_PKEY * newKey, CertStructConfig & certConfig, X509_EXTENSION * cdpExt)
+                 X509 * newCert, EVP_PKEY * newKey, CertStructConfig & certConfig, X509_EXTENSION * cdpExt, uint64_t serialNumber,
+                 bool deterministicSignature)
 {
     bool res     = true;
     uint16_t vid = certConfig.IsSubjectVIDMismatch() ? static_cast<uint16_t>(subjectVID + 1) : subjectVID;
@@ -1337,8 +1390,8 @@ bool MakeAttCert(AttCertType attCertType, const char * subjectCN, uint16_t subje
         ReportOpenSSLErrorAndExit("X509_set_version", res = false);
     }
 
-    // Generate a serial number for the cert.
-    res = SetCertSerialNumber(newCert);
+    // Set the serial number of the cert, or generate one.
+    res = SetCertSerialNumber(newCert, serialNumber);
     VerifyTrueOrExit(res);
 
     // Set the certificate validity time.
@@ -1517,10 +1570,8 @@ bool MakeAttCert(AttCertType attCertType, const char * subjectCN, uint16_t subje
     }
 
     // Sign the new certificate.
-    if (!X509_sign(newCert, caKey, certConfig.GetSignatureAlgorithmDER()))
-    {
-        ReportOpenSSLErrorAndExit("X509_sign", res = false);
-    }
+    res = SignAttCert(newCert, caKey, certConfig.GetSignatureAlgorithmDER(), deterministicSignature);
+    VerifyTrueOrExit(res);
 
 exit:
     return res;
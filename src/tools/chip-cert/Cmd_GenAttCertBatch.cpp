@@ -0,0 +1,700 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the command handler for the 'chip-cert' tool
+ *      that generates batches of device attestation certificates and keys.
+ *
+ */
+
+#include "chip-cert.h"
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BytesToHex.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::ArgParser;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+#define CMD_NAME "chip-cert gen-att-cert-batch"
+
+bool HandleOption(const char * progName, OptionSet * optSet, int id, const char * name, const char * arg);
+
+// clang-format off
+OptionDef gCmdOptionDefs[] =
+{
+    { "subject-cn",         kArgumentRequired, 'c' },
+    { "subject-vid",        kArgumentRequired, 'V' },
+    { "subject-pid",        kArgumentRequired, 'P' },
+    { "vid-pid-as-cn",      kNoArgument,       'a' },
+    { "ca-cert",            kArgumentRequired, 'C' },
+    { "ca-key",             kArgumentRequired, 'K' },
+    { "count",              kArgumentRequired, 'n' },
+    { "in",                 kArgumentRequired, 'i' },
+    { "out",                kArgumentRequired, 'o' },
+    { "format",             kArgumentRequired, 'F' },
+    { "valid-from",         kArgumentRequired, 'f' },
+    { "lifetime",           kArgumentRequired, 'l' },
+    { "threads",            kArgumentRequired, 't' },
+    { "seed",               kArgumentRequired, 'S' },
+    { }
+};
+
+const char * const gCmdOptionHelp =
+    "   -c, --subject-cn <string>\n"
+    "\n"
+    "       Subject DN Common Name attribute encoded as UTF8String, for the devices that are not\n"
+    "       given one in the input file.\n"
+    "\n"
+    "   -V, --subject-vid <hex-digits>\n"
+    "\n"
+    "       Subject DN CHIP VID attribute (in hex).\n"
+    "\n"
+    "   -P, --subject-pid <hex-digits>\n"
+    "\n"
+    "       Subject DN CHIP PID attribute (in hex), for the devices that are not given one in the input file.\n"
+    "\n"
+    "   -a, --vid-pid-as-cn\n"
+    "\n"
+    "       Encode Matter VID and PID parameters as Common Name attributes in the Subject DN.\n"
+    "       If not specified then by default the VID and PID fields are encoded using\n"
+    "       Matter specific OIDs.\n"
+    "\n"
+    "   -C, --ca-cert <file/str>\n"
+    "\n"
+    "       File or string containing the PAI certificate to be used to sign the new certificates.\n"
+    "\n"
+    "   -K, --ca-key <file/str>\n"
+    "\n"
+    "       File or string containing the PAI private key to be used to sign the new certificates.\n"
+    "\n"
+    "   -n, --count <int>\n"
+    "\n"
+    "       The number of device attestation certificates to be generated, when no input file is specified.\n"
+    "\n"
+    "   -i, --in <file/stdin>\n"
+    "\n"
+    "       File with one line per device attestation certificate to be generated, in the format:\n"
+    "           [ <subject-cn> ] [ ,<subject-pid> ]\n"
+    "       An empty Common Name or PID is replaced with the --subject-cn or --subject-pid value.\n"
+    "       If specified '-' then input is read from stdin. The file is read as the certificates are generated.\n"
+    "\n"
+    "   -o, --out <file/stdout>\n"
+    "\n"
+    "       File to contain the new certificates and keys, which are written as they are generated.\n"
+    "       If specified '-' then output is written to stdout. With the CSV format, the file is:\n"
+    "           Index,Subject CN,PID,Serial Number,DAC,DAC Key\n"
+    "           index of the device,'subject-cn','subject-pid','serial-number'(in hex),'dac'(X.509 DER, Base-64 encoded),\n"
+    "           'dac-key'(SEC1 DER, Base-64 encoded)\n"
+    "           ....\n"
+    "\n"
+    "   -F, --format <csv|json>\n"
+    "\n"
+    "       Format of the output file. With 'json', each device is written as one JSON object per line:\n"
+    "           {\"index\":0,\"subjectCN\":\"...\",\"pid\":\"8000\",\"serialNumber\":\"...\",\"dac\":\"...\",\"dacKey\":\"...\"}\n"
+    "       If not specified, the CSV format is used.\n"
+    "\n"
+    "   -f, --valid-from <YYYY>-<MM>-<DD> [ <HH>:<MM>:<SS> ]\n"
+    "\n"
+    "       The start date for the certificates' validity period. If not specified,\n"
+    "       the validity period starts on the current day.\n"
+    "\n"
+    "   -l, --lifetime <days>\n"
+    "\n"
+    "       The lifetime for the new certificates, in whole days. Use special value\n"
+    "       4294967295 to indicate that certificates don't have well defined\n"
+    "       expiration date\n"
+    "\n"
+    "   -t, --threads <int>\n"
+    "\n"
+    "       The number of threads generating the certificates. If not specified, one thread per CPU core\n"
+    "       is used. The certificates are written in the order of their index, whatever the number of threads.\n"
+    "\n"
+    "   -S, --seed <hex-digits>\n"
+    "\n"
+    "       Seed (up to 64 bytes, in hex) for the private keys and serial numbers, instead of random values.\n"
+    "       They are derived from the seed and the index of the device with HMAC-SHA256, and the certificates\n"
+    "       are signed with deterministic ECDSA (RFC 6979) when supported by OpenSSL (3.2 or later), so the same\n"
+    "       seed and inputs always generate the same output.\n"
+    "       This is intended for reproducible test runs: the seed must be kept as secret as the private keys.\n"
+    "\n"
+    ;
+
+OptionSet gCmdOptions =
+{
+    HandleOption,
+    gCmdOptionDefs,
+    "COMMAND OPTIONS",
+    gCmdOptionHelp
+};
+
+HelpOptions gHelpOptions(
+    CMD_NAME,
+    "Usage: " CMD_NAME " [ <options...> ]\n",
+    CHIP_VERSION_STRING "\n" COPYRIGHT_STRING,
+    "Generate a batch of CHIP Device Attestation certificates and keys"
+);
+
+OptionSet *gCmdOptionSets[] =
+{
+    &gCmdOptions,
+    &gHelpOptions,
+    nullptr
+};
+// clang-format on
+
+enum class OutputFormat
+{
+    kCSV,
+    kJSON,
+};
+
+// Number of certificates generated in parallel, then written, at a time.
+constexpr size_t kChunkSize                  = 1024;
+constexpr size_t kMaxSeedLength              = 64;
+constexpr size_t kMaxLabelLength             = 8;
+constexpr uint32_t kMaxKeyDerivationAttempts = 8;
+constexpr const char * kKeyLabel             = "DACKey";
+constexpr const char * kSerialNumberLabel    = "Serial";
+
+const char * gSubjectCN           = "";
+uint16_t gSubjectVID              = VendorId::NotSpecified;
+uint16_t gSubjectPID              = 0;
+bool gEncodeVIDandPIDasCN         = false;
+const char * gCACertFileNameOrStr = nullptr;
+const char * gCAKeyFileNameOrStr  = nullptr;
+uint32_t gCount                   = 0;
+const char * gInFileName          = nullptr;
+const char * gOutFileName         = nullptr;
+OutputFormat gOutputFormat        = OutputFormat::kCSV;
+uint32_t gValidDays               = kCertValidDays_Undefined;
+uint32_t gThreadCount             = 0;
+uint8_t gSeed[kMaxSeedLength];
+size_t gSeedLen = 0;
+struct tm gValidFrom;
+
+struct AttCertUnit
+{
+    uint32_t index;
+    std::string subjectCN;
+    uint16_t subjectPID;
+    uint64_t serialNumber;
+    std::string dac;
+    std::string dacKey;
+};
+
+bool HandleOption(const char * progName, OptionSet * optSet, int id, const char * name, const char * arg)
+{
+    switch (id)
+    {
+    case 'c':
+        gSubjectCN = arg;
+        break;
+    case 'V':
+        if (!ParseInt(arg, gSubjectVID, 16))
+        {
+            PrintArgError("%s: Invalid value specified for the subject VID attribute: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 'P':
+        if (!ParseInt(arg, gSubjectPID, 16))
+        {
+            PrintArgError("%s: Invalid value specified for the subject PID attribute: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 'a':
+        gEncodeVIDandPIDasCN = true;
+        break;
+    case 'C':
+        gCACertFileNameOrStr = arg;
+        break;
+    case 'K':
+        gCAKeyFileNameOrStr = arg;
+        break;
+    case 'n':
+        if (!ParseInt(arg, gCount) || gCount == 0)
+        {
+            PrintArgError("%s: Invalid value specified for the certificate count: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 'i':
+        gInFileName = arg;
+        break;
+    case 'o':
+        gOutFileName = arg;
+        break;
+    case 'F':
+        if (strcmp(arg, "csv") == 0)
+        {
+            gOutputFormat = OutputFormat::kCSV;
+        }
+        else if (strcmp(arg, "json") == 0)
+        {
+            gOutputFormat = OutputFormat::kJSON;
+        }
+        else
+        {
+            PrintArgError("%s: Invalid value specified for the output format: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 'f':
+        if (!ParseDateTime(arg, gValidFrom))
+        {
+            PrintArgError("%s: Invalid value specified for certificate validity date: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 'l':
+        if (!ParseInt(arg, gValidDays))
+        {
+            PrintArgError("%s: Invalid value specified for certificate lifetime: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 't':
+        if (!ParseInt(arg, gThreadCount) || gThreadCount == 0)
+        {
+            PrintArgError("%s: Invalid value specified for the number of threads: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case 'S':
+        gSeedLen = Encoding::HexToBytes(arg, strlen(arg), gSeed, sizeof(gSeed));
+        if (gSeedLen == 0)
+        {
+            PrintArgError("%s: Invalid value specified for the seed: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    default:
+        PrintArgError("%s: Unhandled option: %s\n", progName, name);
+        return false;
+    }
+
+    return true;
+}
+
+// The Common Names are written as is in the CSV and JSON output.
+bool IsValidSubjectCN(const std::string & subjectCN)
+{
+    return std::none_of(subjectCN.begin(), subjectCN.end(),
+                        [](char c) { return c == ',' || c == '"' || c == '\\' || iscntrl(static_cast<unsigned char>(c)); });
+}
+
+// Read the inputs of the next device from the input file, or use the default ones. Returns false at the end of the input.
+bool ReadNextUnit(FILE * inFile, uint32_t index, AttCertUnit & unit)
+{
+    unit.index      = index;
+    unit.subjectCN  = gSubjectCN;
+    unit.subjectPID = gSubjectPID;
+
+    if (inFile == nullptr)
+    {
+        return index < gCount;
+    }
+
+    char * line     = nullptr;
+    size_t lineSize = 0;
+    ssize_t lineLen = getline(&line, &lineSize, inFile);
+    std::string lineStr((lineLen > 0) ? line : "");
+    free(line);
+    VerifyOrReturnValue(lineLen > 0, false);
+
+    lineStr.erase(lineStr.find_last_not_of("\r\n") + 1);
+
+    size_t separator = lineStr.find(',');
+    if (separator != std::string::npos)
+    {
+        std::string pidStr = lineStr.substr(separator + 1);
+        if (!pidStr.empty() && !ParseInt(pidStr.c_str(), unit.subjectPID, 16))
+        {
+            fprintf(stderr, "Invalid PID on the line %" PRIu32 " of the input file: %s\n", index + 1, pidStr.c_str());
+            unit.subjectPID = 0;
+        }
+        lineStr.resize(separator);
+    }
+    if (!lineStr.empty())
+    {
+        unit.subjectCN = lineStr;
+    }
+
+    return true;
+}
+
+// Derive a value from the seed, for the device at the given index. The attempt number allows derivations to be retried.
+bool DeriveFromSeed(const char * label, uint32_t index, uint32_t attempt, uint8_t (&out)[kSHA256_Hash_Length])
+{
+    uint8_t message[kMaxLabelLength + 2 * sizeof(uint32_t)];
+    size_t labelLen = strlen(label);
+    VerifyOrReturnValue(labelLen <= kMaxLabelLength, false);
+
+    memcpy(message, label, labelLen);
+    Encoding::LittleEndian::Put32(&message[labelLen], index);
+    Encoding::LittleEndian::Put32(&message[labelLen + sizeof(uint32_t)], attempt);
+
+    HMAC_sha hmac;
+    return hmac.HMAC_SHA256(gSeed, gSeedLen, message, labelLen + 2 * sizeof(uint32_t), out, sizeof(out)) == CHIP_NO_ERROR;
+}
+
+bool DeriveKeyPair(uint32_t index, EVP_PKEY * key)
+{
+    uint8_t privKey[kSHA256_Hash_Length];
+    static_assert(sizeof(privKey) == kP256_PrivateKey_Length);
+
+    // Draw again in the unlikely case the value is not a valid private key.
+    for (uint32_t attempt = 0; attempt < kMaxKeyDerivationAttempts; attempt++)
+    {
+        VerifyOrReturnValue(DeriveFromSeed(kKeyLabel, index, attempt, privKey), false);
+        if (MakeKeyPair(privKey, sizeof(privKey), key))
+        {
+            OPENSSL_cleanse(privKey, sizeof(privKey));
+            return true;
+        }
+    }
+
+    OPENSSL_cleanse(privKey, sizeof(privKey));
+    return false;
+}
+
+bool DeriveSerialNumber(uint32_t index, uint64_t & serialNumber)
+{
+    uint8_t derived[kSHA256_Hash_Length];
+    VerifyOrReturnValue(DeriveFromSeed(kSerialNumberLabel, index, 0, derived), false);
+
+    // Avoid negative numbers, and the value that requests a random serial number.
+    serialNumber = Encoding::LittleEndian::Get64(derived) & 0x7FFFFFFFFFFFFFFFULL;
+    if (serialNumber == kUseRandomSerialNumber)
+    {
+        serialNumber = 1;
+    }
+    return true;
+}
+
+bool EncodeDER(const uint8_t * der, int derLen, std::string & out)
+{
+    VerifyOrReturnValue(derLen > 0 && CanCastTo<uint32_t>(derLen), false);
+    uint32_t len = static_cast<uint32_t>(derLen);
+
+    out.resize(BASE64_ENCODED_LEN(len));
+    out.resize(Base64Encode32(der, len, out.data()));
+    return true;
+}
+
+bool GenerateAttCert(AttCertUnit & unit, X509 * caCert, EVP_PKEY * caKey, CertStructConfig & certConfig)
+{
+    bool res = true;
+    std::unique_ptr<X509, void (*)(X509 *)> newCert(X509_new(), &X509_free);
+    std::unique_ptr<EVP_PKEY, void (*)(EVP_PKEY *)> newKey(EVP_PKEY_new(), &EVP_PKEY_free);
+    uint8_t * der = nullptr;
+    int derLen    = 0;
+
+    unit.serialNumber = kUseRandomSerialNumber;
+
+    if (gSeedLen != 0)
+    {
+        res = DeriveKeyPair(unit.index, newKey.get());
+        VerifyTrueOrExit(res);
+
+        res = DeriveSerialNumber(unit.index, unit.serialNumber);
+        VerifyTrueOrExit(res);
+    }
+    else
+    {
+        res = GenerateKeyPair(newKey.get());
+        VerifyTrueOrExit(res);
+    }
+
+    res = MakeAttCert(kAttCertType_DAC, unit.subjectCN.c_str(), gSubjectVID, unit.subjectPID, gEncodeVIDandPIDasCN, caCert, caKey,
+                      gValidFrom, gValidDays, newCert.get(), newKey.get(), certConfig, nullptr, unit.serialNumber, gSeedLen != 0);
+    VerifyTrueOrExit(res);
+
+    if (unit.serialNumber == kUseRandomSerialNumber &&
+        !ASN1_INTEGER_get_uint64(&unit.serialNumber, X509_get0_serialNumber(newCert.get())))
+    {
+        ReportOpenSSLErrorAndExit("ASN1_INTEGER_get_uint64", res = false);
+    }
+
+    derLen = i2d_X509(newCert.get(), &der);
+    if (derLen < 0)
+    {
+        ReportOpenSSLErrorAndExit("i2d_X509", res = false);
+    }
+    res = EncodeDER(der, derLen, unit.dac);
+    VerifyTrueOrExit(res);
+
+    OPENSSL_free(der);
+    der = nullptr;
+
+    derLen = i2d_PrivateKey(newKey.get(), &der);
+    if (derLen < 0)
+    {
+        ReportOpenSSLErrorAndExit("i2d_PrivateKey", res = false);
+    }
+    res = EncodeDER(der, derLen, unit.dacKey);
+    VerifyTrueOrExit(res);
+
+exit:
+    OPENSSL_clear_free(der, (derLen > 0) ? static_cast<size_t>(derLen) : 0);
+    return res;
+}
+
+// Generate the certificates of the given devices on the given number of threads, which pick the next device until none
+// is left.
+bool GenerateAttCerts(std::vector<AttCertUnit> & units, uint32_t threadCount)
+{
+    std::atomic<size_t> nextUnit{ 0 };
+    std::atomic<bool> failed{ false };
+    auto generate = [&]() {
+        bool res = true;
+        // Each thread has its own copies of the CA certificate and key, and of the certificate configuration.
+        std::unique_ptr<X509, void (*)(X509 *)> caCert(nullptr, &X509_free);
+        std::unique_ptr<EVP_PKEY, void (*)(EVP_PKEY *)> caKey(nullptr, &EVP_PKEY_free);
+        CertStructConfig certConfig;
+
+        res = ReadCert(gCACertFileNameOrStr, caCert) && ReadKey(gCAKeyFileNameOrStr, caKey);
+        VerifyTrueOrExit(res);
+
+        for (size_t i = nextUnit++; i < units.size() && !failed; i = nextUnit++)
+        {
+            res = GenerateAttCert(units[i], caCert.get(), caKey.get(), certConfig);
+            VerifyTrueOrExit(res);
+        }
+
+    exit:
+        if (!res)
+        {
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(generate);
+    }
+    generate();
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    return !failed;
+}
+
+bool WriteAttCertUnit(FILE * outFile, const AttCertUnit & unit)
+{
+    int written;
+
+    if (gOutputFormat == OutputFormat::kJSON)
+    {
+        written = fprintf(outFile,
+                          "{\"index\":%" PRIu32 ",\"subjectCN\":\"%s\",\"pid\":\"%04X\",\"serialNumber\":\"%016" PRIX64
+                          "\",\"dac\":\"%s\",\"dacKey\":\"%s\"}\n",
+                          unit.index, unit.subjectCN.c_str(), unit.subjectPID, unit.serialNumber, unit.dac.c_str(),
+                          unit.dacKey.c_str());
+    }
+    else
+    {
+        written = fprintf(outFile, "%" PRIu32 ",%s,%04X,%016" PRIX64 ",%s,%s\n", unit.index, unit.subjectCN.c_str(),
+                          unit.subjectPID, unit.serialNumber, unit.dac.c_str(), unit.dacKey.c_str());
+    }
+
+    return written > 0;
+}
+
+} // namespace
+
+bool Cmd_GenAttCertBatch(int argc, char * argv[])
+{
+    bool res             = true;
+    FILE * inFile        = nullptr;
+    FILE * outFile       = nullptr;
+    uint32_t threadCount = 0;
+    uint32_t count       = 0;
+    bool moreUnits       = true;
+    std::vector<AttCertUnit> units;
+    std::chrono::steady_clock::time_point start;
+    double seconds = 0;
+
+    {
+        time_t now         = time(nullptr);
+        gValidFrom         = *gmtime(&now);
+        gValidFrom.tm_hour = 0;
+        gValidFrom.tm_min  = 0;
+        gValidFrom.tm_sec  = 0;
+    }
+
+    if (argc == 1)
+    {
+        gHelpOptions.PrintBriefUsage(stderr);
+        return true;
+    }
+
+    res = ParseArgs(CMD_NAME, argc, argv, gCmdOptionSets);
+    VerifyTrueOrExit(res);
+
+    if (gSubjectVID == VendorId::NotSpecified)
+    {
+        fprintf(stderr, "Please specify the VID subject DN attribute.\n");
+        return false;
+    }
+
+    if (gCACertFileNameOrStr == nullptr || gCAKeyFileNameOrStr == nullptr)
+    {
+        fprintf(stderr, "Please specify the PAI certificate and key using the --ca-cert and --ca-key options.\n");
+        return false;
+    }
+
+    if ((gCount == 0) == (gInFileName == nullptr))
+    {
+        fprintf(stderr, "Please specify either the number of certificates using the --count option, or an input file.\n");
+        return false;
+    }
+
+    if (gOutFileName == nullptr)
+    {
+        fprintf(stderr, "Please specify the file name for the new certificates using the --out option.\n");
+        return false;
+    }
+
+    if (gValidDays == kCertValidDays_Undefined)
+    {
+        fprintf(stderr, "Please specify the lifetime (in days) for the new certificates using the --lifetime option.\n");
+        return false;
+    }
+
+    if (strcmp(gOutFileName, "-") != 0 && access(gOutFileName, R_OK) == 0)
+    {
+        fprintf(stderr,
+                "Output certificates file already exists (%s)\n"
+                "To replace the file, please remove it and re-run the command.\n",
+                gOutFileName);
+        return false;
+    }
+
+#ifndef OSSL_SIGNATURE_PARAM_NONCE_TYPE
+    if (gSeedLen != 0)
+    {
+        fprintf(stderr, "Warning: deterministic ECDSA is not supported by this OpenSSL version, the signatures of the\n"
+                        "certificates are not reproducible.\n");
+    }
+#endif
+
+    res = InitOpenSSL();
+    VerifyTrueOrExit(res);
+
+    // Check the CA certificate and key before starting the threads.
+    {
+        std::unique_ptr<X509, void (*)(X509 *)> caCert(nullptr, &X509_free);
+        std::unique_ptr<EVP_PKEY, void (*)(EVP_PKEY *)> caKey(nullptr, &EVP_PKEY_free);
+
+        res = ReadCert(gCACertFileNameOrStr, caCert) && ReadKey(gCAKeyFileNameOrStr, caKey);
+        VerifyTrueOrExit(res);
+    }
+
+    if (gInFileName != nullptr)
+    {
+        res = OpenFile(gInFileName, inFile);
+        VerifyTrueOrExit(res);
+    }
+
+    res = OpenFile(gOutFileName, outFile, true);
+    VerifyTrueOrExit(res);
+
+    if (gOutputFormat == OutputFormat::kCSV && fputs("Index,Subject CN,PID,Serial Number,DAC,DAC Key\n", outFile) == EOF)
+    {
+        fprintf(stderr, "Error writing to output file: %s\n", strerror(errno));
+        ExitNow(res = false);
+    }
+
+    threadCount = (gThreadCount != 0) ? gThreadCount : std::max(std::thread::hardware_concurrency(), 1u);
+    start       = std::chrono::steady_clock::now();
+
+    units.resize(kChunkSize);
+    while (moreUnits)
+    {
+        // Read the inputs of the devices in order, so that they do not depend on how the threads are scheduled.
+        size_t unitCount = 0;
+        while (unitCount < kChunkSize && (moreUnits = ReadNextUnit(inFile, count, units[unitCount])))
+        {
+            if (!IsValidSubjectCN(units[unitCount].subjectCN))
+            {
+                fprintf(stderr, "Unsupported characters in the Common Name of the device %" PRIu32 ": %s\n", count,
+                        units[unitCount].subjectCN.c_str());
+                ExitNow(res = false);
+            }
+            if (units[unitCount].subjectCN.empty() && !gEncodeVIDandPIDasCN)
+            {
+                fprintf(stderr, "Please specify the Common Name subject DN attribute of the device %" PRIu32 ".\n", count);
+                ExitNow(res = false);
+            }
+            if (units[unitCount].subjectPID == 0)
+            {
+                fprintf(stderr, "Please specify the PID subject DN attribute of the device %" PRIu32 ".\n", count);
+                ExitNow(res = false);
+            }
+            unitCount++;
+            count++;
+        }
+        units.resize(unitCount);
+        VerifyOrExit(unitCount > 0, res = true);
+
+        res = GenerateAttCerts(units, threadCount);
+        VerifyTrueOrExit(res);
+
+        for (const AttCertUnit & unit : units)
+        {
+            if (!WriteAttCertUnit(outFile, unit))
+            {
+                fprintf(stderr, "Error writing to output file: %s\n", strerror(errno));
+                ExitNow(res = false);
+            }
+        }
+        units.resize(kChunkSize);
+    }
+
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "Generated %" PRIu32 " certificates in %.3f s (%.1f certificates/s) on %" PRIu32 " thread(s).\n", count,
+            seconds, count / seconds, threadCount);
+
+exit:
+    if (inFile != stdin)
+    {
+        CloseFile(inFile);
+    }
+    if (outFile != stdout)
+    {
+        CloseFile(outFile);
+    }
+    return res;
+}
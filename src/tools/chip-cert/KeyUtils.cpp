@@ -325,6 +325,45 @@ exit:
     return res;
 }
 
+bool MakeKeyPair(const uint8_t * privKey, uint32_t privKeyLen, EVP_PKEY * key)
+{
+    bool res = true;
+    std::unique_ptr<EC_KEY, void (*)(EC_KEY *)> ecKey(EC_KEY_new_by_curve_name(gNIDChipCurveP256), &EC_KEY_free);
+    std::unique_ptr<BIGNUM, void (*)(BIGNUM *)> privKeyBN(BN_new(), &BN_clear_free);
+    std::unique_ptr<EC_POINT, void (*)(EC_POINT *)> pubKeyPoint(nullptr, &EC_POINT_free);
+    const EC_GROUP * group = nullptr;
+
+    VerifyOrExit(key != nullptr && privKey != nullptr, res = false);
+    VerifyOrExit(ecKey != nullptr && privKeyBN != nullptr, res = false);
+
+    group = EC_KEY_get0_group(ecKey.get());
+    pubKeyPoint.reset(EC_POINT_new(group));
+    VerifyOrExit(pubKeyPoint != nullptr, res = false);
+
+    VerifyOrExit(BN_bin2bn(privKey, static_cast<int>(privKeyLen), privKeyBN.get()) != nullptr, res = false);
+
+    // The private key must be in [1, n-1], n being the order of the curve.
+    VerifyOrExit(!BN_is_zero(privKeyBN.get()) && BN_cmp(privKeyBN.get(), EC_GROUP_get0_order(group)) < 0, res = false);
+
+    if (!EC_POINT_mul(group, pubKeyPoint.get(), privKeyBN.get(), nullptr, nullptr, nullptr))
+    {
+        ReportOpenSSLErrorAndExit("EC_POINT_mul", res = false);
+    }
+
+    if (!EC_KEY_set_private_key(ecKey.get(), privKeyBN.get()) || !EC_KEY_set_public_key(ecKey.get(), pubKeyPoint.get()))
+    {
+        ReportOpenSSLErrorAndExit("EC_KEY_set_private_key", res = false);
+    }
+
+    if (!EVP_PKEY_set1_EC_KEY(key, ecKey.get()))
+    {
+        ReportOpenSSLErrorAndExit("EVP_PKEY_set1_EC_KEY", res = false);
+    }
+
+exit:
+    return res;
+}
+
 bool GenerateKeyPair_Secp256k1(EVP_PKEY * key)
 {
     bool res = true;
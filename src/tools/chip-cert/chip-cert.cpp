@@ -60,6 +60,8 @@ const char * const sHelp =
     "\n"
     "    gen-att-cert -- Generate a CHIP attestation certificate.\n"
     "\n"
+    "    gen-att-cert-batch -- Generate a batch of CHIP device attestation certificates and keys.\n"
+    "\n"
     "    validate-att-cert -- Validate a CHIP attestation certificate chain.\n"
     "\n"
     "    gen-cd -- Generate a CHIP certification declaration signed message.\n"
@@ -131,6 +133,10 @@ int main(int argc, char * argv[])
     {
         res = Cmd_GenAttCert(argc - 1, argv + 1);
     }
+    else if (strcasecmp(argv[1], "gen-att-cert-batch") == 0 || strcasecmp(argv[1], "genattcertbatch") == 0)
+    {
+        res = Cmd_GenAttCertBatch(argc - 1, argv + 1);
+    }
     else if (strcasecmp(argv[1], "validate-att-cert") == 0 || strcasecmp(argv[1], "validateattcert") == 0)
     {
         res = Cmd_ValidateAttCert(argc - 1, argv + 1);
@@ -25,14 +25,21 @@
 
 #include "spake2p.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <CHIPVersion.h>
 #include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
 #include <lib/support/CHIPMem.h>
 #include <protocols/secure_channel/PASESession.h>
@@ -58,6 +65,9 @@ OptionDef gCmdOptionDefs[] =
     { "salt-len",        kArgumentRequired, 'l' },
     { "salt",            kArgumentRequired, 's' },
     { "out",             kArgumentRequired, 'o' },
+    { "format",          kArgumentRequired, 'F' },
+    { "threads",         kArgumentRequired, 't' },
+    { "seed",            kArgumentRequired, 'S' },
     { }
 };
 
@@ -127,6 +137,24 @@ const char * const gCmdOptionHelp =
     "           index of the parameter set in the list,'pin-code','iteration-count','salt'(Base-64 encoded),'verifier'(Base-64 encoded)\n"
     "           ....\n"
     "\n"
+    "   -F, --format <csv|json>\n"
+    "\n"
+    "       Format of the output file. With 'json', each parameter set is written as one JSON object per line:\n"
+    "           {\"index\":0,\"pinCode\":20202021,\"iterationCount\":1000,\"salt\":\"...\",\"verifier\":\"...\"}\n"
+    "       If not specified, the CSV format is used.\n"
+    "\n"
+    "   -t, --threads <int>\n"
+    "\n"
+    "       The number of threads generating the parameter sets. If not specified, one thread per CPU core\n"
+    "       is used. The parameter sets are written in the order of their index, whatever the number of threads.\n"
+    "\n"
+    "   -S, --seed <hex-digits>\n"
+    "\n"
+    "       Seed (up to 64 bytes, in hex) for the PIN codes and salts that are not specified, instead of random\n"
+    "       values. The PIN code and the salt of each parameter set are derived from the seed and the index of\n"
+    "       the set with HMAC-SHA256, so the same seed and options always generate the same output.\n"
+    "       This is intended for reproducible test runs: the seed must be kept as secret as the PIN codes.\n"
+    "\n"
     ;
 
 OptionSet gCmdOptions =
@@ -152,6 +180,19 @@ OptionSet *gCmdOptionSets[] =
 };
 // clang-format on
 
+enum class OutputFormat
+{
+    kCSV,
+    kJSON,
+};
+
+// Number of parameter sets generated in parallel, then written, at a time.
+constexpr uint32_t kChunkSize     = 4096;
+constexpr size_t kMaxSeedLength   = 64;
+constexpr size_t kMaxLabelLength  = 8;
+constexpr const char * kPinLabel  = "PIN";
+constexpr const char * kSaltLabel = "Salt";
+
 uint32_t gCount          = 1;
 uint32_t gPinCode        = chip::kSetupPINCodeUndefinedValue;
 uint32_t gIterationCount = 0;
@@ -160,6 +201,17 @@ uint8_t gSaltDecodedLen   = 0;
 uint8_t gSaltLen          = 0;
 const char * gOutFileName = nullptr;
 std::ifstream gPinCodeFile;
+OutputFormat gOutputFormat = OutputFormat::kCSV;
+uint32_t gThreadCount      = 0;
+uint8_t gSeed[kMaxSeedLength];
+size_t gSeedLen = 0;
+
+struct VerifierSet
+{
+    uint32_t pinCode;
+    uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
+    Spake2pVerifierSerialized serializedVerifier;
+};
 
 static uint32_t GetNextPinCode()
 {
@@ -262,6 +314,39 @@ bool HandleOption(const char * progName, OptionSet * optSet, int id, const char
         gOutFileName = arg;
         break;
 
+    case 'F':
+        if (strcmp(arg, "csv") == 0)
+        {
+            gOutputFormat = OutputFormat::kCSV;
+        }
+        else if (strcmp(arg, "json") == 0)
+        {
+            gOutputFormat = OutputFormat::kJSON;
+        }
+        else
+        {
+            PrintArgError("%s: Invalid value specified for the output format: %s\n", progName, arg);
+            return false;
+        }
+        break;
+
+    case 't':
+        if (!ParseInt(arg, gThreadCount) || gThreadCount == 0)
+        {
+            PrintArgError("%s: Invalid value specified for the number of threads: %s\n", progName, arg);
+            return false;
+        }
+        break;
+
+    case 'S':
+        gSeedLen = chip::Encoding::HexToBytes(arg, strlen(arg), gSeed, sizeof(gSeed));
+        if (gSeedLen == 0)
+        {
+            PrintArgError("%s: Invalid value specified for the seed: %s\n", progName, arg);
+            return false;
+        }
+        break;
+
     default:
         PrintArgError("%s: Unhandled option: %s\n", progName, name);
         return false;
@@ -270,6 +355,112 @@ bool HandleOption(const char * progName, OptionSet * optSet, int id, const char
     return true;
 }
 
+// Derive a value from the seed, for the parameter set at the given index. The attempt number allows derivations to be retried.
+bool DeriveFromSeed(const char * label, uint32_t index, uint32_t attempt, uint8_t (&out)[kSHA256_Hash_Length])
+{
+    uint8_t message[kMaxLabelLength + 2 * sizeof(uint32_t)];
+    size_t labelLen = strlen(label);
+    VerifyOrReturnValue(labelLen <= kMaxLabelLength, false);
+
+    memcpy(message, label, labelLen);
+    chip::Encoding::LittleEndian::Put32(&message[labelLen], index);
+    chip::Encoding::LittleEndian::Put32(&message[labelLen + sizeof(uint32_t)], attempt);
+
+    HMAC_sha hmac;
+    return hmac.HMAC_SHA256(gSeed, gSeedLen, message, labelLen + 2 * sizeof(uint32_t), out, sizeof(out)) == CHIP_NO_ERROR;
+}
+
+bool DerivePinCode(uint32_t index, uint32_t & pinCode)
+{
+    uint8_t derived[kSHA256_Hash_Length];
+
+    // Draw again when the value is one of the few invalid PIN codes.
+    for (uint32_t attempt = 0;; attempt++)
+    {
+        VerifyOrReturnValue(DeriveFromSeed(kPinLabel, index, attempt, derived), false);
+        pinCode = static_cast<uint32_t>(chip::Encoding::LittleEndian::Get64(derived) % chip::kSetupPINCodeMaximumValue) + 1;
+        if (chip::SetupPayload::IsValidSetupPIN(pinCode))
+        {
+            return true;
+        }
+    }
+}
+
+bool GenerateVerifier(VerifierSet & set)
+{
+    Spake2pVerifier verifier;
+    CHIP_ERROR err = chip::PASESession::GeneratePASEVerifier(verifier, gIterationCount, chip::ByteSpan(set.salt, gSaltLen),
+                                                             (set.pinCode == chip::kSetupPINCodeUndefinedValue), set.pinCode);
+    if (err != CHIP_NO_ERROR)
+    {
+        std::cerr << "GeneratePASEVerifier() failed.\n";
+        return false;
+    }
+
+    chip::MutableByteSpan serializedVerifierSpan(set.serializedVerifier);
+    err = verifier.Serialize(serializedVerifierSpan);
+    if (err != CHIP_NO_ERROR)
+    {
+        std::cerr << "Spake2pVerifier::Serialize() failed.\n";
+        return false;
+    }
+
+    return true;
+}
+
+// Generate the verifiers of the sets on the given number of threads, which pick the next set to generate until none is left.
+bool GenerateVerifiers(std::vector<VerifierSet> & sets, uint32_t threadCount)
+{
+    std::atomic<size_t> nextSet{ 0 };
+    std::atomic<bool> failed{ false };
+    auto generate = [&]() {
+        for (size_t i = nextSet++; i < sets.size() && !failed; i = nextSet++)
+        {
+            if (!GenerateVerifier(sets[i]))
+            {
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(generate);
+    }
+    generate();
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    return !failed;
+}
+
+bool WriteVerifierSet(std::ostream & outStream, uint32_t index, const VerifierSet & set)
+{
+    char saltB64[BASE64_ENCODED_LEN(kSpake2p_Max_PBKDF_Salt_Length) + 1];
+    uint32_t saltB64Len = chip::Base64Encode32(set.salt, gSaltLen, saltB64);
+    saltB64[saltB64Len] = '\0';
+
+    char verifierB64[BASE64_ENCODED_LEN(kSpake2p_VerifierSerialized_Length) + 1];
+    uint32_t verifierB64Len     = chip::Base64Encode32(set.serializedVerifier, kSpake2p_VerifierSerialized_Length, verifierB64);
+    verifierB64[verifierB64Len] = '\0';
+
+    if (gOutputFormat == OutputFormat::kJSON)
+    {
+        outStream << "{\"index\":" << index << ",\"pinCode\":" << set.pinCode << ",\"iterationCount\":" << gIterationCount
+                  << ",\"salt\":\"" << saltB64 << "\",\"verifier\":\"" << verifierB64 << "\"}\n";
+    }
+    else
+    {
+        outStream << index << "," << std::setfill('0') << std::setw(8) << set.pinCode << "," << gIterationCount << "," << saltB64
+                  << "," << verifierB64 << "\n";
+    }
+
+    return !outStream.fail();
+}
+
 } // namespace
 
 bool Cmd_GenVerifier(int argc, char * argv[])
@@ -325,69 +516,86 @@ bool Cmd_GenVerifier(int argc, char * argv[])
     {
         outStream = &std::cout;
     }
-    (*outStream) << "Index,PIN Code,Iteration Count,Salt,Verifier\n";
-    if (outStream->fail())
+    if (gOutputFormat == OutputFormat::kCSV)
     {
-        std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
+        (*outStream) << "Index,PIN Code,Iteration Count,Salt,Verifier\n";
+        if (outStream->fail())
+        {
+            std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
+        }
     }
 
-    for (uint32_t i = 0; i < gCount; i++)
+    uint32_t threadCount = (gThreadCount != 0) ? gThreadCount : std::max(std::thread::hardware_concurrency(), 1u);
+    auto start           = std::chrono::steady_clock::now();
+
+    std::vector<VerifierSet> sets;
+    for (uint32_t first = 0; first < gCount; first += kChunkSize)
     {
-        uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
-        if (gSaltDecodedLen == 0)
+        sets.resize(std::min(kChunkSize, gCount - first));
+
+        // Select the inputs of the sets in order, so that they do not depend on how the threads are scheduled.
+        for (uint32_t i = 0; i < sets.size(); i++)
         {
-            CHIP_ERROR err = chip::Crypto::DRBG_get_bytes(salt, gSaltLen);
-            if (err != CHIP_NO_ERROR)
+            VerifierSet & set = sets[i];
+
+            // Without a seed, the PIN code is randomly generated along with the verifier.
+            set.pinCode = gPinCode;
+            if (set.pinCode == chip::kSetupPINCodeUndefinedValue && gSeedLen != 0 && !DerivePinCode(first + i, set.pinCode))
             {
-                std::cerr << "DRBG_get_bytes() failed.\n";
+                std::cerr << "Failed to derive the PIN code from the seed.\n";
                 return false;
             }
-        }
-        else
-        {
-            memcpy(salt, gSalt, gSaltLen);
-        }
 
-        Spake2pVerifier verifier;
-        CHIP_ERROR err = chip::PASESession::GeneratePASEVerifier(verifier, gIterationCount, chip::ByteSpan(salt, gSaltLen),
-                                                                 (gPinCode == chip::kSetupPINCodeUndefinedValue), gPinCode);
-        if (err != CHIP_NO_ERROR)
-        {
-            std::cerr << "GeneratePASEVerifier() failed.\n";
-            return false;
+            if (gSaltDecodedLen != 0)
+            {
+                memcpy(set.salt, gSalt, gSaltLen);
+            }
+            else if (gSeedLen != 0)
+            {
+                uint8_t derived[kSHA256_Hash_Length];
+                static_assert(kSpake2p_Max_PBKDF_Salt_Length <= sizeof(derived));
+                if (!DeriveFromSeed(kSaltLabel, first + i, 0, derived))
+                {
+                    std::cerr << "Failed to derive the salt from the seed.\n";
+                    return false;
+                }
+                memcpy(set.salt, derived, gSaltLen);
+            }
+            else
+            {
+                CHIP_ERROR err = chip::Crypto::DRBG_get_bytes(set.salt, gSaltLen);
+                if (err != CHIP_NO_ERROR)
+                {
+                    std::cerr << "DRBG_get_bytes() failed.\n";
+                    return false;
+                }
+            }
+
+            // If the file with PIN codes is not provided, the PIN code of the next set will be randomly generated.
+            gPinCode = GetNextPinCode();
+            // The Salt of the next set will be randomly generated.
+            gSaltDecodedLen = 0;
         }
 
-        Spake2pVerifierSerialized serializedVerifier;
-        chip::MutableByteSpan serializedVerifierSpan(serializedVerifier);
-        err = verifier.Serialize(serializedVerifierSpan);
-        if (err != CHIP_NO_ERROR)
+        if (!GenerateVerifiers(sets, threadCount))
         {
-            std::cerr << "Spake2pVerifier::Serialize() failed.\n";
             return false;
         }
 
-        char saltB64[BASE64_ENCODED_LEN(kSpake2p_Max_PBKDF_Salt_Length) + 1];
-        uint32_t saltB64Len = chip::Base64Encode32(salt, gSaltLen, saltB64);
-        saltB64[saltB64Len] = '\0';
-
-        char verifierB64[BASE64_ENCODED_LEN(kSpake2p_VerifierSerialized_Length) + 1];
-        uint32_t verifierB64Len     = chip::Base64Encode32(serializedVerifier, kSpake2p_VerifierSerialized_Length, verifierB64);
-        verifierB64[verifierB64Len] = '\0';
-
-        (*outStream) << i << "," << std::setfill('0') << std::setw(8) << gPinCode << "," << gIterationCount << "," << saltB64 << ","
-                     << verifierB64 << "\n";
-        if (outStream->fail())
+        for (uint32_t i = 0; i < sets.size(); i++)
         {
-            std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
-            return false;
+            if (!WriteVerifierSet(*outStream, first + i, sets[i]))
+            {
+                std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
+                return false;
+            }
         }
-
-        // If the file with PIN codes is not provided, the PIN code on next iteration will be randomly generated.
-        gPinCode = GetNextPinCode();
-        // On the next iteration the Salt will be randomly generated.
-        gSaltDecodedLen = 0;
     }
 
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "Generated " << gCount << " parameter sets in " << std::fixed << std::setprecision(3) << seconds << " s ("
+              << std::setprecision(1) << (gCount / seconds) << " sets/s) on " << threadCount << " thread(s).\n";
+
     gPinCodeFile.close();
     return true;
 }
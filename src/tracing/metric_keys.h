@@ -39,6 +39,12 @@ constexpr MetricKey kMetricDeviceCommissionerCommission = "core_dcm_commission_d
 
 constexpr MetricKey kMetricDeviceCommissionerCommissionStage = "core_dcm_commission_stage";
 
+// Commissioning pipeline: a batch of devices, from the first queued device until the pipeline is idle again
+constexpr MetricKey kMetricCommissioningPipelineBatch = "core_dcm_pipeline_batch";
+
+// Commissioning pipeline: number of devices being commissioned at the same time
+constexpr MetricKey kMetricCommissioningPipelineInProgress = "core_dcm_pipeline_in_progress";
+
 // Setup Code Pairer
 constexpr MetricKey kMetricSetupCodePairerPairDevice = "core_setup_code_pairer_pair_dev";
 
@@ -72,11 +78,39 @@ constexpr MetricKey kMetricDeviceCASESessionSigma2Resume = "core_dev_case_sessio
 // CASE Session SigmaFinished
 constexpr MetricKey kMetricDeviceCASESessionSigmaFinished = "core_dev_case_session_sigma_finished";
 
+// CASE Session Sigma2 preparation on the responder (ephemeral key, shared secret, signature), i.e. the Sigma1 to Sigma2
+// turnaround without message encoding
+constexpr MetricKey kMetricDeviceCASESessionSigma2Prepare = "core_dev_case_session_sigma2_prepare";
+
+// CASE Session ephemeral keypair: 1 if taken from the pool of pre-generated keypairs, 0 if generated in place
+constexpr MetricKey kMetricDeviceCASESessionEphemeralKeyPooled = "core_dev_case_session_eph_key_pooled";
+
 // MRP Retry Counter
 constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Number of subscriptions reportable at once when the report scheduler fires
+constexpr MetricKey kMetricReportSchedulerQueueDepth = "core_report_scheduler_queue_depth";
+
+// Delay, in milliseconds, of a subscription report past its max interval
+constexpr MetricKey kMetricReportSchedulerLateness = "core_report_scheduler_lateness_ms";
+
+// Number of commands in a batched invoke request
+constexpr MetricKey kMetricInvokeBatchSize = "core_im_invoke_batch_size";
+
+// Time, in milliseconds, from dispatching a command to its asynchronous response
+constexpr MetricKey kMetricInvokeCommandLatency = "core_im_invoke_command_latency_ms";
+
+// Number of commands answered with a Timeout status because their handler did not respond in time
+constexpr MetricKey kMetricInvokeCommandTimeout = "core_im_invoke_command_timeout";
+
+// Resumption of the persisted subscriptions, from the resumption timer until the sessions to all the subscribers are done
+constexpr MetricKey kMetricSubscriptionResumption = "core_im_subscription_resumption";
+
+// Number of distinct subscribers in a subscription resumption pass
+constexpr MetricKey kMetricSubscriptionResumptionPeerCount = "core_im_subscription_resumption_peers";
+
 } // namespace Tracing
 } // namespace chip
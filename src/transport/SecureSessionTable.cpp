@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = CreateSessionObject(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
+                                                 peerSessionId, fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = CreateSessionObject(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -111,10 +111,10 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     //
     // The size of this shouldn't place significant demands on the stack if using the default
     // configuration for CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (17). Each item is
-    // 8 bytes in size (on a 32-bit platform), and 16 bytes in size (on a 64-bit platform,
+    // 12 bytes in size (on a 32-bit platform), and 16 bytes in size (on a 64-bit platform,
     // including padding).
     //
-    // Total size of this stack variable = 17 * 8 = 136bytes (32-bit platform), 272 bytes (64-bit platform).
+    // Total size of this stack variable = 17 * 12 = 204bytes (32-bit platform), 272 bytes (64-bit platform).
     //
     // Even if the define is set to a large value, it's likely not so bad on the sort of platform setup
     // that would have that sort of pool size.
@@ -134,38 +134,21 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     unsigned int index = 0;
 
     //
-    // Compute two key stats for each session - the number of other sessions that
-    // match its fabric, as well as the number of other sessions that match its peer.
+    // Each session also gets two key stats used by the session eviction algorithm - the number of other sessions that
+    // match its fabric, as well as the number of other sessions that match its peer - from the counts kept as sessions
+    // change peers. Sessions start in pool order, which breaks ties between equivalent candidates.
     //
-    // This will be used by the session eviction algorithm later.
-    //
-    ForEachSession([&index, &sortableSessions, this](auto * session) {
+    ForEachSession([this, &index, &sortableSessions](auto * session) {
         sortableSessions[index].mSession             = session;
-        sortableSessions[index].mNumMatchingOnFabric = 0;
-        sortableSessions[index].mNumMatchingOnPeer   = 0;
-
-        ForEachSession([session, index, &sortableSessions](auto * otherSession) {
-            if (session != otherSession)
-            {
-                if (session->GetFabricIndex() == otherSession->GetFabricIndex())
-                {
-                    sortableSessions[index].mNumMatchingOnFabric++;
-
-                    if (session->GetPeerNodeId() == otherSession->GetPeerNodeId())
-                    {
-                        sortableSessions[index].mNumMatchingOnPeer++;
-                    }
-                }
-            }
-
-            return Loop::Continue;
-        });
-
+        sortableSessions[index].mNumMatchingOnFabric = static_cast<uint16_t>(GetNumSessionsOnFabric(session->GetFabricIndex()) - 1);
+        sortableSessions[index].mNumMatchingOnPeer   = static_cast<uint16_t>(GetNumSessionsToPeer(session->GetPeer()) - 1);
+        sortableSessions[index].mSortOrder           = static_cast<uint16_t>(index);
         index++;
         return Loop::Continue;
     });
 
     auto sortableSessionSpan = Span<SortableSession>(sortableSessions, mEntries.Allocated());
+
     EvictionPolicyContext policyContext(sortableSessionSpan, sessionEvictionHint);
 
     DefaultEvictionPolicy(policyContext);
@@ -216,7 +199,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = CreateSessionObject(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -337,6 +320,113 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    RemoveFromIndexes(session);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    mEntries.ReleaseObject(session);
+}
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
+Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
+{
+    SecureSession * const * result = mSessionsByLocalId.Find(localSessionId);
+    return result != nullptr ? MakeOptional<SessionHandle>(**result) : Optional<SessionHandle>::Missing();
+}
+
+Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
+{
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++)
+    {
+        // kUnsecuredSessionId is never available
+        if (candidate != kUnsecuredSessionId && !mSessionsByLocalId.Contains(candidate))
+        {
+            return MakeOptional<uint16_t>(candidate);
+        }
+        candidate = static_cast<uint16_t>(candidate + 1);
+    }
+
+    return NullOptional;
+}
+
+bool SecureSessionTable::AddToIndexes(SecureSession * session)
+{
+    VerifyOrReturnValue(!mSessionsByLocalId.Contains(session->GetLocalSessionId()), false);
+    VerifyOrReturnValue(mSessionsByLocalId.Insert(session->GetLocalSessionId(), session) != nullptr, false);
+    if (!AddPeer(session))
+    {
+        mSessionsByLocalId.Erase(session->GetLocalSessionId());
+        return false;
+    }
+    return true;
+}
+
+void SecureSessionTable::RemoveFromIndexes(SecureSession * session)
+{
+    RemovePeer(session);
+    mSessionsByLocalId.Erase(session->GetLocalSessionId());
+}
+
+bool SecureSessionTable::AddPeer(SecureSession * session)
+{
+    uint16_t * numOnFabric = mNumSessionsOnFabric.Emplace(session->GetFabricIndex(), static_cast<uint16_t>(0));
+    VerifyOrReturnValue(numOnFabric != nullptr, false);
+
+    PeerSessions * peerSessions = mSessionsByPeer.Emplace(session->GetPeer());
+    if (peerSessions == nullptr)
+    {
+        if (*numOnFabric == 0)
+        {
+            mNumSessionsOnFabric.Erase(session->GetFabricIndex());
+        }
+        return false;
+    }
+
+    // Append the session, so that sessions to a peer are visited from the oldest one as they are in the session table.
+    SecureSession ** link = &peerSessions->first;
+    while (*link != nullptr)
+    {
+        link = &(*link)->mNextSessionToPeer;
+    }
+    *link                       = session;
+    session->mNextSessionToPeer = nullptr;
+
+    (*numOnFabric)++;
+    peerSessions->count++;
+    return true;
+}
+
+void SecureSessionTable::RemovePeer(SecureSession * session)
+{
+    PeerSessions * peerSessions = mSessionsByPeer.Find(session->GetPeer());
+    VerifyOrReturn(peerSessions != nullptr);
+
+    SecureSession ** link = &peerSessions->first;
+    while (*link != session)
+    {
+        VerifyOrReturn(*link != nullptr);
+        link = &(*link)->mNextSessionToPeer;
+    }
+    *link                       = session->mNextSessionToPeer;
+    session->mNextSessionToPeer = nullptr;
+
+    if (--peerSessions->count == 0)
+    {
+        mSessionsByPeer.Erase(session->GetPeer());
+    }
+
+    uint16_t * numOnFabric = mNumSessionsOnFabric.Find(session->GetFabricIndex());
+    if (numOnFabric != nullptr && --(*numOnFabric) == 0)
+    {
+        mNumSessionsOnFabric.Erase(session->GetFabricIndex());
+    }
+}
+
+#else // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
     SecureSession * result = nullptr;
@@ -403,5 +493,7 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     return NullOptional;
 }
 
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
 } // namespace Transport
 } // namespace chip
@@ -17,12 +17,17 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
 #include <lib/support/CodeUtils.h>
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+#include <lib/support/FixedHashMap.h>
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
 #include <lib/support/Pool.h>
-#include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Transport {
 
@@ -76,7 +81,7 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,9 +89,80 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call `function` on each session whose peer is `peer`. With CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES, this does
+     * not walk the session table: sessions are indexed by peer as their peer is set. `function` must not release
+     * sessions other than the one it is given.
+     */
+    template <typename Function>
+    void ForEachSessionToPeer(const ScopedNodeId & peer, Function && function)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+        const PeerSessions * peerSessions = mSessionsByPeer.Find(peer);
+        VerifyOrReturn(peerSessions != nullptr);
+
+        for (SecureSession * session = peerSessions->first; session != nullptr;)
+        {
+            // Grab the next session first, in case `function` releases this one.
+            SecureSession * next = session->mNextSessionToPeer;
+            function(session);
+            session = next;
+        }
+#else
+        mEntries.ForEachActiveObject([&peer, &function](SecureSession * session) {
+            if (session->GetPeer() == peer)
+            {
+                function(session);
+            }
+            return Loop::Continue;
+        });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    }
+
+    /// Number of sessions in the table whose peer is `peer`.
+    uint16_t GetNumSessionsToPeer(const ScopedNodeId & peer) const
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+        const PeerSessions * peerSessions = mSessionsByPeer.Find(peer);
+        return peerSessions != nullptr ? peerSessions->count : 0;
+#else
+        uint16_t count = 0;
+        mEntries.ForEachActiveObject([&peer, &count](const SecureSession * session) {
+            if (session->GetPeer() == peer)
+            {
+                count++;
+            }
+            return Loop::Continue;
+        });
+        return count;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    }
+
+    /// Number of sessions in the table on fabric `fabricIndex` (kUndefinedFabricIndex for sessions not on a fabric yet).
+    uint16_t GetNumSessionsOnFabric(FabricIndex fabricIndex) const
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+        const uint16_t * count = mNumSessionsOnFabric.Find(fabricIndex);
+        return count != nullptr ? *count : 0;
+#else
+        uint16_t count = 0;
+        mEntries.ForEachActiveObject([fabricIndex, &count](const SecureSession * session) {
+            if (session->GetFabricIndex() == fabricIndex)
+            {
+                count++;
+            }
+            return Loop::Continue;
+        });
+        return count;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    }
+
     /**
      * Get a secure session given its session ID.
      *
+     * This is called for every received secure unicast message. With CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES, it
+     * does not walk the session table: sessions are indexed by local session ID when they are allocated.
+     *
      * @param localSessionId the identifier of a secure unicast session context within the local node
      *
      * @return the session if found, NullOptional if not found
@@ -121,6 +197,7 @@ public:
     }
 
 private:
+    friend class SecureSession;
     friend class TestSecureSessionTable;
 
     /**
@@ -150,6 +227,9 @@ private:
         uint16_t mNumMatchingOnFabric;
         uint16_t mNumMatchingOnPeer;
 
+        // Position of the session in the list before the last sort, used to break ties between equivalent sessions.
+        uint16_t mSortOrder;
+
         static_assert(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE <= std::numeric_limits<decltype(mNumMatchingOnFabric)>::max(),
                       "mNumMatchingOnFabric must be able to count up to CHIP_CONFIG_SECURE_SESSION_POOL_SIZE!");
         static_assert(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE <= std::numeric_limits<decltype(mNumMatchingOnPeer)>::max(),
@@ -177,13 +257,29 @@ private:
          *
          * If a is a better candidate than b, true should be returned. Else, return false.
          *
-         * NOTE: Sort() can be called multiple times.
+         * NOTE: Sort() can be called multiple times. The sort is stable: sessions that compare equal keep the
+         *       order they had before the call.
          *
          */
         template <typename CompareFunc>
         void Sort(CompareFunc func)
         {
-            Sorting::InsertionSort(mSessionList.begin(), mSessionList.size(), func);
+            std::sort(mSessionList.begin(), mSessionList.end(), [&func](const SortableSession & a, const SortableSession & b) {
+                if (func(a, b))
+                {
+                    return true;
+                }
+                if (func(b, a))
+                {
+                    return false;
+                }
+                return a.mSortOrder < b.mSortOrder;
+            });
+
+            for (size_t i = 0; i < mSessionList.size(); i++)
+            {
+                mSessionList[i].mSortOrder = static_cast<uint16_t>(i);
+            }
         }
 
         const ScopedNodeId & GetSessionEvictionHint() const { return mSessionEvictionHint; }
@@ -243,21 +339,82 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * With CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES, session IDs are probed in sequence from the starting mNextSessionId
+     * clue using the local session ID index. Since there are at most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE sessions in the
+     * table, an available session ID is found after at most that many + 1 probes, and usually after the first one since
+     * IDs are handed out sequentially. Otherwise, the session table is walked once per 64-ID bucket from the clue until a
+     * bucket with a free ID is found.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    template <typename... Args>
+    SecureSession * CreateSessionObject(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        VerifyOrReturnValue(session != nullptr, nullptr);
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+        // Heap-backed pools are not bounded by CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, but the indexes are.
+        if (!AddToIndexes(session))
+        {
+            mEntries.ReleaseObject(session);
+            return nullptr;
+        }
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+        return session;
+    }
+
+    /**
+     * Keep the peer index and the per-peer and per-fabric session counts up to date with a change of the peer of a
+     * session: RemovePeer must be called before the peer or fabric of an indexed session change, and AddPeer after.
+     * Without CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES there is nothing to keep up to date and these always succeed.
+     */
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    bool AddPeer(SecureSession * session);
+    void RemovePeer(SecureSession * session);
+#else
+    bool AddPeer(SecureSession *) { return true; }
+    void RemovePeer(SecureSession *) {}
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    bool AddToIndexes(SecureSession * session);
+    void RemoveFromIndexes(SecureSession * session);
+
+    /// Sessions to a peer, linked through SecureSession::mNextSessionToPeer, and their number.
+    struct PeerSessions
+    {
+        SecureSession * first = nullptr;
+        uint16_t count        = 0;
+    };
+
+    struct ScopedNodeIdHash
+    {
+        size_t operator()(const ScopedNodeId & peer) const
+        {
+            return FixedContainerHash<uint64_t>()(peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56));
+        }
+    };
+
+    /// Local session IDs are handed out sequentially, so they are used as their own hash to keep them in separate buckets.
+    struct LocalSessionIdHash
+    {
+        size_t operator()(uint16_t localSessionId) const { return localSessionId; }
+    };
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
+    static_assert(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE <= UINT16_MAX, "Session counts must fit in 16 bits");
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+    FixedHashMap<uint16_t, SecureSession *, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, LocalSessionIdHash> mSessionsByLocalId;
+    FixedHashMap<ScopedNodeId, PeerSessions, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, ScopedNodeIdHash> mSessionsByPeer;
+    FixedHashMap<FabricIndex, uint16_t, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mNumSessionsOnFabric;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
 
     size_t GetMaxSessionTableSize() const
     {
@@ -461,5 +461,193 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+TEST_F(TestSecureSessionTable, LocalSessionIdIndexCollisions)
+{
+    constexpr uint16_t kIndexSize = static_cast<uint16_t>(internal::FixedHashBucketCount(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE));
+    static_assert(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE >= 4, "This test needs room for 4 sessions");
+
+    // The 1st, 2nd and 4th IDs share a bucket, the 3rd one lands in the bucket the 2nd one has been pushed to.
+    const uint16_t localSessionIds[] = { 5, static_cast<uint16_t>(5 + kIndexSize), 6, static_cast<uint16_t>(5 + 2 * kIndexSize) };
+    SecureSessionTable sessionTable;
+    sessionTable.Init();
+
+    Optional<SessionHandle> sessions[MATTER_ARRAY_SIZE(localSessionIds)];
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(localSessionIds); i++)
+    {
+        sessions[i] = sessionTable.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, localSessionIds[i], kUndefinedNodeId,
+                                                                 kUndefinedNodeId, CATValues(), 1, kUndefinedFabricIndex,
+                                                                 GetDefaultMRPConfig());
+        ASSERT_TRUE(sessions[i].HasValue());
+    }
+
+    auto validate = [&]() {
+        for (size_t i = 0; i < MATTER_ARRAY_SIZE(localSessionIds); i++)
+        {
+            auto found = sessionTable.FindSecureSessionByLocalKey(localSessionIds[i]);
+            EXPECT_EQ(found.HasValue(), sessions[i].HasValue());
+            if (found.HasValue())
+            {
+                EXPECT_EQ(found.Value(), sessions[i].Value());
+            }
+        }
+    };
+
+    validate();
+    EXPECT_FALSE(sessionTable.FindSecureSessionByLocalKey(static_cast<uint16_t>(5 + 3 * kIndexSize)).HasValue());
+
+    // Release sessions in the middle and at the start of the collision chain.
+    for (size_t i : { 1, 0, 3, 2 })
+    {
+        sessions[i].Value()->AsSecureSession()->MarkForEviction();
+        sessions[i].ClearValue();
+        validate();
+    }
+}
+
+TEST_F(TestSecureSessionTable, TableIsBounded)
+{
+    constexpr FabricIndex kFabricIndex1 = 1;
+    SecureSessionTable sessionTable;
+    sessionTable.Init();
+
+    Optional<SessionHandle> sessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+    for (uint16_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        sessions[i] = sessionTable.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, static_cast<uint16_t>(i + 1), 1,
+                                                                 i + 1u, CATValues(), 1, kFabricIndex1, GetDefaultMRPConfig());
+        ASSERT_TRUE(sessions[i].HasValue());
+    }
+
+    // Whether or not the pool could grow, the indexes are full.
+    auto extra = sessionTable.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1,
+                                                            1, 1, CATValues(), 1, kFabricIndex1, GetDefaultMRPConfig());
+    EXPECT_FALSE(extra.HasValue());
+    EXPECT_FALSE(sessionTable.FindSecureSessionByLocalKey(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1).HasValue());
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kFabricIndex1), CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+    for (auto & session : sessions)
+    {
+        session.Value()->AsSecureSession()->MarkForEviction();
+    }
+}
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXES
+
+TEST_F(TestSecureSessionTable, PeerIndex)
+{
+    constexpr FabricIndex kFabricIndex1 = 1;
+    constexpr FabricIndex kFabricIndex2 = 2;
+    constexpr FabricIndex kFabricIndex3 = 3;
+    SecureSessionTable sessionTable;
+    sessionTable.Init();
+
+    const ScopedNodeId peer1(1, kFabricIndex1);
+    const ScopedNodeId peer2(2, kFabricIndex1);
+    const ScopedNodeId peer1OnFabric2(1, kFabricIndex2);
+    const ReliableMessageProtocolConfig config = GetDefaultMRPConfig();
+
+    auto activate = [&](Optional<SessionHandle> & session, const ScopedNodeId & peer) {
+        session = sessionTable.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        VerifyOrDie(session.HasValue());
+        session.Value()->AsSecureSession()->Activate(ScopedNodeId(0x100, peer.GetFabricIndex()), peer, CATValues(), 1, config);
+    };
+    auto sessionsToPeer = [&](const ScopedNodeId & peer) {
+        std::vector<SecureSession *> found;
+        sessionTable.ForEachSessionToPeer(peer, [&](SecureSession * session) { found.push_back(session); });
+        return found;
+    };
+
+    // Sessions being established are not on a peer yet.
+    auto pending = sessionTable.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(pending.HasValue());
+    EXPECT_EQ(sessionTable.GetNumSessionsToPeer(ScopedNodeId()), 1u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kUndefinedFabricIndex), 1u);
+
+    Optional<SessionHandle> first, second, other, remote;
+    activate(first, peer1);
+    activate(second, peer1);
+    activate(other, peer2);
+    activate(remote, peer1OnFabric2);
+
+    EXPECT_EQ(sessionTable.GetNumSessionsToPeer(peer1), 2u);
+    EXPECT_EQ(sessionTable.GetNumSessionsToPeer(peer2), 1u);
+    EXPECT_EQ(sessionTable.GetNumSessionsToPeer(peer1OnFabric2), 1u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kFabricIndex1), 3u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kFabricIndex2), 1u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kUndefinedFabricIndex), 1u);
+
+    // Sessions to a peer are visited oldest first.
+    auto found = sessionsToPeer(peer1);
+    ASSERT_EQ(found.size(), 2u);
+    EXPECT_EQ(found[0], first.Value()->AsSecureSession());
+    EXPECT_EQ(found[1], second.Value()->AsSecureSession());
+
+    first.Value()->AsSecureSession()->MarkForEviction();
+    first.ClearValue();
+    found = sessionsToPeer(peer1);
+    ASSERT_EQ(found.size(), 1u);
+    EXPECT_EQ(found[0], second.Value()->AsSecureSession());
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kFabricIndex1), 2u);
+
+    // PASE sessions move to the fabric they are commissioned onto.
+    auto pase = sessionTable.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(pase.HasValue());
+    pase.Value()->AsSecureSession()->Activate(ScopedNodeId(), ScopedNodeId(kUndefinedNodeId, kUndefinedFabricIndex), CATValues(),
+                                              1, config);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kUndefinedFabricIndex), 2u);
+    EXPECT_EQ(pase.Value()->AsSecureSession()->AdoptFabricIndex(kFabricIndex3), CHIP_NO_ERROR);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kUndefinedFabricIndex), 1u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kFabricIndex3), 1u);
+    EXPECT_EQ(sessionsToPeer(ScopedNodeId(kUndefinedNodeId, kFabricIndex3)).size(), 1u);
+
+    for (auto * session : { &pending, &second, &other, &remote, &pase })
+    {
+        session->Value()->AsSecureSession()->MarkForEviction();
+        session->ClearValue();
+    }
+    EXPECT_EQ(sessionTable.GetNumSessionsToPeer(peer1), 0u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kFabricIndex1), 0u);
+    EXPECT_EQ(sessionTable.GetNumSessionsOnFabric(kUndefinedFabricIndex), 0u);
+    EXPECT_TRUE(sessionsToPeer(peer1).empty());
+}
+
+TEST_F(TestSecureSessionTable, SessionChurn)
+{
+    constexpr size_t kMaxLiveSessions = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE - 1;
+    SecureSessionTable sessionTable;
+    sessionTable.Init();
+
+    Optional<SessionHandle> sessions[kMaxLiveSessions];
+
+    for (size_t i = 0; i < 2000; i++)
+    {
+        // Walk the slots in a scattered order so that sessions are released in a different order than they were allocated.
+        auto & slot = sessions[(i * 7) % kMaxLiveSessions];
+        if (slot.HasValue())
+        {
+            uint16_t localSessionId = slot.Value()->AsSecureSession()->GetLocalSessionId();
+            slot.ClearValue();
+            EXPECT_FALSE(sessionTable.FindSecureSessionByLocalKey(localSessionId).HasValue());
+        }
+        else
+        {
+            slot = sessionTable.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+            ASSERT_TRUE(slot.HasValue());
+            EXPECT_NE(slot.Value()->AsSecureSession()->GetLocalSessionId(), kUnsecuredSessionId);
+        }
+
+        for (auto & session : sessions)
+        {
+            if (session.HasValue())
+            {
+                auto found = sessionTable.FindSecureSessionByLocalKey(session.Value()->AsSecureSession()->GetLocalSessionId());
+                ASSERT_TRUE(found.HasValue());
+                EXPECT_EQ(found.Value(), session.Value());
+            }
+        }
+    }
+}
+
 } // namespace Transport
 } // namespace chip
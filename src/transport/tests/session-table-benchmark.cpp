@@ -0,0 +1,168 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of a full SecureSessionTable, as used by controllers talking to many nodes: the lookup of the session
+ *      of each received message by local session ID, the lookup of the sessions to a peer, and session churn, where
+ *      each new session evicts an existing one.
+ *
+ *      The table holds CHIP_CONFIG_SECURE_SESSION_POOL_SIZE sessions, spread over a few fabrics with a few sessions per
+ *      peer; build with a larger CHIP_CONFIG_SECURE_SESSION_POOL_SIZE to measure larger tables.
+ *
+ *      Build in release mode for meaningful numbers.
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/SecureSessionTable.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr size_t kPoolSize         = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
+constexpr FabricIndex kFabricCount = 3;
+constexpr size_t kSessionsPerPeer  = 2;
+constexpr NodeId kLocalNodeId      = 0x1000;
+constexpr NodeId kFirstPeerNodeId  = 0x2000;
+constexpr size_t kLookups          = 1 << 16;
+constexpr size_t kChurns           = 1 << 10;
+constexpr size_t kMeasurements     = 5;
+
+// Sink for the results, so that the work cannot be optimized away.
+volatile uintptr_t gSink;
+
+// Keeps the logs of each session state change and eviction out of the results.
+void DiscardLog(const char *, uint8_t, const char *, va_list) {}
+
+ScopedNodeId PeerOfSession(size_t index)
+{
+    const size_t peer = index / kSessionsPerPeer;
+    return ScopedNodeId(kFirstPeerNodeId + peer / kFabricCount, static_cast<FabricIndex>(1 + peer % kFabricCount));
+}
+
+// Adds a CASE session to `peer`, evicting an existing session if the table is full.
+void AddSession(SecureSessionTable & table, const ScopedNodeId & peer)
+{
+    // The pending session is only held by this handle until it is activated.
+    auto session = table.CreateNewSecureSession(SecureSession::Type::kCASE, peer);
+    VerifyOrDie(session.HasValue());
+    session.Value()->AsSecureSession()->Activate(ScopedNodeId(kLocalNodeId, peer.GetFabricIndex()), peer, CATValues(), 1,
+                                                 GetDefaultMRPConfig());
+}
+
+template <typename Function>
+double MeasureNsPerOperation(size_t operations, Function function)
+{
+    // Warm up the caches.
+    function(0);
+
+    double fastest = 0;
+    for (size_t measurement = 0; measurement < kMeasurements; measurement++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < operations; i++)
+        {
+            function(i);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double ns      = seconds * 1e9 / static_cast<double>(operations);
+        fastest        = (measurement == 0) ? ns : std::min(fastest, ns);
+    }
+    return fastest;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    Logging::SetLogRedirectCallback(DiscardLog);
+
+    static SecureSessionTable table;
+    table.Init();
+    for (size_t i = 0; i < kPoolSize; i++)
+    {
+        AddSession(table, PeerOfSession(i));
+    }
+
+    uint16_t localSessionIds[kPoolSize];
+    size_t count = 0;
+    table.ForEachSession([&](SecureSession * session) {
+        localSessionIds[count++] = session->GetLocalSessionId();
+        return Loop::Continue;
+    });
+    VerifyOrDie(count == kPoolSize);
+
+    printf("%-40s %12s\n", "operation", "ns / op");
+    printf("%-40s %12zu\n", "(sessions in the table)", kPoolSize);
+
+    const double indexedLookupNs = MeasureNsPerOperation(kLookups, [&](size_t i) {
+        auto session = table.FindSecureSessionByLocalKey(localSessionIds[(i * 7) % kPoolSize]);
+        gSink        = reinterpret_cast<uintptr_t>(session.Value()->AsSecureSession());
+    });
+    const double walkedLookupNs = MeasureNsPerOperation(kLookups, [&](size_t i) {
+        const uint16_t localSessionId = localSessionIds[(i * 7) % kPoolSize];
+        SecureSession * found         = nullptr;
+        table.ForEachSession([&](SecureSession * session) {
+            VerifyOrReturnValue(session->GetLocalSessionId() == localSessionId, Loop::Continue);
+            found = session;
+            return Loop::Break;
+        });
+        gSink = reinterpret_cast<uintptr_t>(found);
+    });
+    printf("%-40s %12.1f\n", "find by local session id: index", indexedLookupNs);
+    printf("%-40s %12.1f\n", "find by local session id: table walk", walkedLookupNs);
+
+    const double indexedPeerNs = MeasureNsPerOperation(kLookups, [&](size_t i) {
+        const ScopedNodeId peer = PeerOfSession((i * 7) % kPoolSize);
+        uintptr_t found         = 0;
+        table.ForEachSessionToPeer(peer, [&](SecureSession * session) { found += reinterpret_cast<uintptr_t>(session); });
+        gSink = found;
+    });
+    const double walkedPeerNs = MeasureNsPerOperation(kLookups, [&](size_t i) {
+        const ScopedNodeId peer = PeerOfSession((i * 7) % kPoolSize);
+        uintptr_t found         = 0;
+        table.ForEachSession([&](SecureSession * session) {
+            if (session->GetPeer() == peer)
+            {
+                found += reinterpret_cast<uintptr_t>(session);
+            }
+            return Loop::Continue;
+        });
+        gSink = found;
+    });
+    printf("%-40s %12.1f\n", "sessions to a peer: index", indexedPeerNs);
+    printf("%-40s %12.1f\n", "sessions to a peer: table walk", walkedPeerNs);
+
+    const double churnNs =
+        MeasureNsPerOperation(kChurns, [&](size_t i) { AddSession(table, PeerOfSession((i * 7) % kPoolSize)); });
+    printf("%-40s %12.1f\n", "churn: evict and add a session", churnNs);
+
+    Platform::MemoryShutdown();
+    return 0;
+}